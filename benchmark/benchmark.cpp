@@ -4,11 +4,15 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cassert>
+#include <cerrno>
 #include <chrono>
 #include <codecvt>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <locale>
+#include <stdexcept>
 #include <string>
 
 #include "utf8.h"
@@ -16,6 +20,11 @@
 #include <boost/locale/encoding_utf.hpp>
 
 #include <tcb/unicode.hpp>
+#include <tcb/unicode/cjk.hpp>
+
+#ifdef TCB_BENCHMARK_ICONV
+#include <iconv.h>
+#endif
 
 using std::string;
 using std::u16string;
@@ -277,6 +286,106 @@ u16string range_view_u32_to_u16(const u32string& u32)
     return tcb::unicode::as_utf16(u32);
 }
 
+/*
+ * Legacy multi-byte encodings, compared with iconv where available
+ */
+
+template <typename Encoding>
+string range_legacy_to_u8(const string& in)
+{
+    return tcb::unicode::to_u8string<Encoding>(in);
+}
+
+template <typename Encoding>
+string range_u8_to_legacy(const string& u8)
+{
+    return tcb::unicode::to_multibyte<Encoding>(u8);
+}
+
+#ifdef TCB_BENCHMARK_ICONV
+
+// Throws std::runtime_error if iconv cannot convert between the encodings,
+// or fails part way through, so that a broken iconv is not timed as a fast one
+struct iconv_converter {
+    iconv_converter(const char* from, const char* to)
+        : cd_(iconv_open(to, from))
+    {
+        if (cd_ == reinterpret_cast<iconv_t>(-1)) {
+            throw std::runtime_error(string("iconv_open from ") + from + " to " + to +
+                                     ": " + std::strerror(errno));
+        }
+    }
+
+    iconv_converter(const iconv_converter&) = delete;
+    iconv_converter& operator=(const iconv_converter&) = delete;
+
+    ~iconv_converter() { iconv_close(cd_); }
+
+    string operator()(const string& in) const
+    {
+        string out(in.size() * 4 + 4, '\0');
+        char* inbuf = const_cast<char*>(in.data());
+        std::size_t inleft = in.size();
+        char* outbuf = &out[0];
+        std::size_t outleft = out.size();
+        iconv(cd_, nullptr, nullptr, nullptr, nullptr);
+        if (iconv(cd_, &inbuf, &inleft, &outbuf, &outleft) == static_cast<std::size_t>(-1)) {
+            throw std::runtime_error(string("iconv: ") + std::strerror(errno) + " at byte " +
+                                     std::to_string(in.size() - inleft));
+        }
+        out.resize(out.size() - outleft);
+        return out;
+    }
+
+private:
+    iconv_t cd_;
+};
+
+#endif // TCB_BENCHMARK_ICONV
+
+template <typename Encoding>
+void time_legacy_encoding(const string& u8str, const char* iconv_name,
+                          int num_iterations)
+{
+    const string legacy = range_u8_to_legacy<Encoding>(u8str);
+    const string name = iconv_name;
+
+#ifdef TCB_BENCHMARK_ICONV
+    // Round trip through our encoder first, so that iconv never sees
+    // characters that it can't represent
+    const string roundtrip = range_legacy_to_u8<Encoding>(legacy);
+
+    // Each converter is tried once before it is timed, and skipped with a
+    // message if it fails
+    try {
+        const iconv_converter iconv_decode{iconv_name, "UTF-8"};
+        iconv_decode(legacy);
+        time_function_call(std::cref(iconv_decode), legacy, num_iterations, "iconv " + name + " to u8");
+    }
+    catch (const std::runtime_error& e) {
+        std::cout << "iconv " << name << " to u8 skipped: " << e.what() << "\n";
+    }
+#endif
+    time_function_call(range_legacy_to_u8<Encoding>, legacy, num_iterations,
+                       "range " + name + " to u8");
+#ifdef TCB_BENCHMARK_ICONV
+    try {
+        const iconv_converter iconv_encode{"UTF-8", iconv_name};
+        iconv_encode(roundtrip);
+        time_function_call(std::cref(iconv_encode), roundtrip, num_iterations, "iconv u8 to " + name);
+    }
+    catch (const std::runtime_error& e) {
+        std::cout << "iconv u8 to " << name << " skipped: " << e.what() << "\n";
+    }
+    time_function_call(range_u8_to_legacy<Encoding>, roundtrip, num_iterations,
+                       "range u8 to " + name);
+#else
+    time_function_call(range_u8_to_legacy<Encoding>, u8str, num_iterations,
+                       "range u8 to " + name);
+#endif
+    std::cout << "\n";
+}
+
 } // end anonymous namespace
 
 int main(int argc, char** argv)
@@ -344,4 +453,10 @@ int main(int argc, char** argv)
     time_function_call(boost_u32_to_u16, u32str, num_iterations, "boost u32 to u16");
     time_function_call(range_u32_to_u16, u32str, num_iterations, "range u32 to u16");
     time_function_call(range_view_u32_to_u16, u32str, num_iterations, "range view u32 to u16");
-}
\ No newline at end of file
+    std::cout << "\n";
+
+    // Legacy multi-byte encodings
+    time_legacy_encoding<tcb::unicode::shift_jis>(u8str, "SHIFT_JIS", num_iterations);
+    time_legacy_encoding<tcb::unicode::gb18030>(u8str, "GB18030", num_iterations);
+    time_legacy_encoding<tcb::unicode::euc_kr>(u8str, "EUC-KR", num_iterations);
+}
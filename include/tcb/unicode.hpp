@@ -2,10 +2,15 @@
 #ifndef TCB_UNICODE_HPP_INCLUDED
 #define TCB_UNICODE_HPP_INCLUDED
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <istream>
 #include <iterator>
 #include <string>
+#include <type_traits>
 
 #if __cpp_constexpr >= 201304
 #define TCB_CONSTEXPR14 constexpr
@@ -16,6 +21,12 @@
 namespace tcb {
 namespace unicode {
 
+///
+/// Tag type naming the ISO-8859-1 (Latin-1) encoding, whose code units are
+/// bytes holding code points U+0000 to U+00FF
+///
+struct latin1 {};
+
 namespace detail {
 
 template <typename C, typename InputIt, typename Sentinel>
@@ -38,6 +49,7 @@ constexpr bool is_compatible_container_v = is_compatible_container<C, InputIt, S
 using code_point = char32_t;
 static constexpr code_point illegal = 0xFFFFFFFFu;
 static constexpr code_point incomplete = 0xFFFFFFFEu;
+static constexpr code_point replacement_character = 0xFFFDu;
 
 inline TCB_CONSTEXPR14 bool is_valid_codepoint(code_point v)
 {
@@ -51,22 +63,17 @@ inline TCB_CONSTEXPR14 bool is_valid_codepoint(code_point v)
 template <typename CharType, int size = sizeof(CharType)>
 struct utf_traits;
 
-template <typename CharType>
+template <typename CharType, int Capacity = 4 / sizeof(CharType)>
 struct encoded_chars {
 public:
     constexpr encoded_chars() = default;
 
-    constexpr encoded_chars(CharType _1)
-            : chars_{{_1}}, size_{1} {}
-
-    constexpr encoded_chars(CharType _1, CharType _2)
-            : chars_{{_1, _2}}, size_{2} {}
-
-    constexpr encoded_chars(CharType _1, CharType _2, CharType _3)
-            : chars_{{_1, _2, _3}}, size_{3} {}
+    template <typename... Chars>
+    constexpr encoded_chars(CharType _1, Chars... rest)
+            : chars_{{_1, static_cast<CharType>(rest)...}},
+              size_{1 + static_cast<int>(sizeof...(Chars))} {}
 
-    constexpr encoded_chars(CharType _1, CharType _2, CharType _3, CharType _4)
-            : chars_{{_1, _2, _3, _4}}, size_{4} {}
+    TCB_CONSTEXPR14 void push_back(CharType c) noexcept { chars_[size_++] = c; }
 
     constexpr int size() const noexcept { return size_; }
 
@@ -81,7 +88,7 @@ public:
     }
 
 private:
-    std::array<CharType, 4 / sizeof(CharType)> chars_{{}};
+    std::array<CharType, Capacity> chars_{{}};
     int size_ = 0;
 };
 
@@ -164,23 +171,26 @@ struct utf_traits<CharType, 1> {
         case 3:
             if (TCB_UNLIKELY(p == e))
                 return incomplete;
-            tmp = *p++;
+            tmp = *p;
             if (!is_trail(tmp))
                 return illegal;
+            ++p;
             c = (c << 6) | (tmp & 0x3F);
         case 2:
             if (TCB_UNLIKELY(p == e))
                 return incomplete;
-            tmp = *p++;
+            tmp = *p;
             if (!is_trail(tmp))
                 return illegal;
+            ++p;
             c = (c << 6) | (tmp & 0x3F);
         case 1:
             if (TCB_UNLIKELY(p == e))
                 return incomplete;
-            tmp = *p++;
+            tmp = *p;
             if (!is_trail(tmp))
                 return illegal;
+            ++p;
             c = (c << 6) | (tmp & 0x3F);
         }
 
@@ -333,9 +343,10 @@ struct utf_traits<CharType, 2> {
             return illegal;
         if (current == last)
             return incomplete;
-        uint16_t w2 = *current++;
+        uint16_t w2 = *current;
         if (w2 < 0xDC00 || 0xDFFF < w2)
             return illegal;
+        ++current;
         return combine_surrogate(w1, w2);
     }
 
@@ -442,13 +453,458 @@ struct utf_traits<CharType, 4> {
 
 }; // utf32
 
+template <>
+struct utf_traits<latin1, 1> {
+    typedef char char_type;
+
+    static constexpr int trail_length(char_type /*c*/)
+    {
+        return 0;
+    }
+
+    static constexpr bool is_trail(char_type /*c*/)
+    {
+        return false;
+    }
+
+    static constexpr bool is_lead(char_type /*c*/)
+    {
+        return true;
+    }
+
+    template <typename It>
+    static TCB_CONSTEXPR14 code_point decode_valid(It& current)
+    {
+        return static_cast<unsigned char>(*current++);
+    }
+
+    template <typename It, typename S>
+    static TCB_CONSTEXPR14 code_point decode(It& current, S last)
+    {
+        if (TCB_UNLIKELY(current == last))
+            return incomplete;
+        return static_cast<unsigned char>(*current++);
+    }
+
+    static constexpr int max_width = 1;
+
+    static constexpr int width(code_point /*u*/)
+    {
+        return 1;
+    }
+
+    // Code points outside Latin-1 are replaced by '?'
+    template <typename It>
+    static TCB_CONSTEXPR14 It encode(code_point u, It out)
+    {
+        *out++ = static_cast<char_type>(u <= 0xFF ? u : '?');
+        return out;
+    }
+
+    static constexpr encoded_chars<char_type> encode(code_point u)
+    {
+        return {static_cast<char_type>(u <= 0xFF ? u : '?')};
+    }
+
+}; // latin1
+
+template <typename Encoding>
+using char_type_t = typename utf_traits<Encoding>::char_type;
+
+// Bulk conversion kernels for contiguous buffers
+
+template <std::size_t CharSize>
+struct ascii_word_mask;
+
+template <>
+struct ascii_word_mask<1> {
+    static constexpr std::uint64_t value = 0x8080808080808080u;
+};
+
+template <>
+struct ascii_word_mask<2> {
+    static constexpr std::uint64_t value = 0xFF80FF80FF80FF80u;
+};
+
+template <>
+struct ascii_word_mask<4> {
+    static constexpr std::uint64_t value = 0xFFFFFF80FFFFFF80u;
+};
+
+template <typename CharT>
+constexpr bool is_ascii_unit(CharT c)
+{
+    return static_cast<std::make_unsigned_t<CharT>>(c) < 0x80;
+}
+
+///
+/// Returns the number of leading ASCII code units in [first, last), testing
+/// a machine word's worth of code units at a time
+///
+template <typename CharT>
+inline std::size_t ascii_prefix_length(const CharT* first, const CharT* last)
+{
+    constexpr std::ptrdiff_t per_word = sizeof(std::uint64_t) / sizeof(CharT);
+    constexpr std::uint64_t mask = ascii_word_mask<sizeof(CharT)>::value;
+
+    const CharT* p = first;
+    while (last - p >= 2 * per_word) {
+        std::uint64_t w1, w2;
+        std::memcpy(&w1, p, sizeof(w1));
+        std::memcpy(&w2, p + per_word, sizeof(w2));
+        if ((w1 | w2) & mask)
+            break;
+        p += 2 * per_word;
+    }
+    while (p != last && is_ascii_unit(*p))
+        ++p;
+    return static_cast<std::size_t>(p - first);
+}
+
+template <typename InCharT, typename OutCharT>
+struct convert_result {
+    const InCharT* in;
+    OutCharT* out;
+};
+
+///
+/// Returns an upper bound on the number of output code units produced by
+/// converting `n` input code units
+///
+template <typename OutEncoding>
+constexpr std::size_t max_converted_size(std::size_t n)
+{
+    return n * utf_traits<OutEncoding>::max_width;
+}
+
+template <typename T>
+struct is_encoding_tag : std::false_type {};
+
+template <>
+struct is_encoding_tag<latin1> : std::true_type {};
+
+///
+/// Whether an encoding can represent lone surrogate code points (as WTF-8
+/// and WTF-16 can). Surrogates decoded from such an encoding are replaced
+/// by U+FFFD when converting to one which cannot.
+///
+template <typename Encoding>
+struct allows_surrogates : std::false_type {};
+
+///
+/// Whether an encoding writes each ASCII code point as a single code unit
+/// of the same value, so that runs of ASCII can be copied directly
+///
+template <typename Encoding>
+struct encodes_ascii_directly : std::true_type {};
+
+template <typename InEncoding, typename OutEncoding>
+constexpr bool is_surrogate_misfit(code_point c)
+{
+    return allows_surrogates<InEncoding>::value &&
+           !allows_surrogates<OutEncoding>::value &&
+           c >= 0xD800 && c <= 0xDFFF;
+}
+
+///
+/// Returns `c`, a value returned from decoding `InEncoding`, or U+FFFD if it
+/// is an error or a code point which cannot be written as `OutEncoding`
+///
+template <typename InEncoding, typename OutEncoding>
+constexpr code_point replace_invalid(code_point c)
+{
+    return c == illegal || c == incomplete ||
+           is_surrogate_misfit<InEncoding, OutEncoding>(c)
+               ? replacement_character : c;
+}
+
+///
+/// Returns whether `c` begins a run of units which can be copied to
+/// `OutEncoding` unchanged
+///
+template <typename OutEncoding, typename CharT>
+constexpr bool is_direct_unit(CharT c)
+{
+    return is_ascii_unit(c) && (encodes_ascii_directly<OutEncoding>::value || c != 0);
+}
+
+template <typename OutEncoding, typename CharT>
+inline std::size_t direct_prefix_length(const CharT* first, const CharT* last)
+{
+    std::size_t n = ascii_prefix_length(first, last);
+    if (!encodes_ascii_directly<OutEncoding>::value) {
+        n = static_cast<std::size_t>(std::find(first, first + n, CharT{}) - first);
+    }
+    return n;
+}
+
+///
+/// Generic block conversion: an ASCII fast path, and otherwise decoding and
+/// encoding one code point at a time
+///
+template <typename InEncoding, typename OutEncoding,
+          typename InCharT = char_type_t<InEncoding>,
+          typename OutCharT = char_type_t<OutEncoding>>
+convert_result<InCharT, OutCharT>
+convert_block_generic(const InCharT* first, const InCharT* last, OutCharT* out,
+                      bool final)
+{
+    while (first != last) {
+        const std::size_t n = direct_prefix_length<OutEncoding>(first, last);
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = static_cast<OutCharT>(first[i]);
+        }
+        first += n;
+        out += n;
+
+        // Decode code points one at a time until we see ASCII again
+        while (first != last && !is_direct_unit<OutEncoding>(*first)) {
+            const InCharT* p = first;
+            code_point c = utf_traits<InEncoding>::decode(p, last);
+            if (TCB_UNLIKELY(c == incomplete && !final))
+                return {first, out};
+            // A lead surrogate at the end of a block may yet be paired
+            // with a trail surrogate at the start of the next one
+            if (TCB_UNLIKELY(allows_surrogates<InEncoding>::value && !final &&
+                             p == last && c >= 0xD800 && c <= 0xDBFF))
+                return {first, out};
+            c = replace_invalid<InEncoding, OutEncoding>(c);
+            out = utf_traits<OutEncoding>::encode(c, out);
+            first = p;
+        }
+    }
+    return {first, out};
+}
+
+// Latin-1 kernels
+
+///
+/// Converts the longest prefix of [first, last) consisting of well-formed
+/// code points no greater than U+00FF to Latin-1, returning the position of
+/// the first code point which does not fit (or is ill-formed)
+///
+template <typename InEncoding, typename InCharT = char_type_t<InEncoding>>
+convert_result<InCharT, char>
+narrow_latin1_prefix(const InCharT* first, const InCharT* last, char* out)
+{
+    while (first != last) {
+        const InCharT* p = first;
+        const code_point c = utf_traits<InEncoding>::decode(p, last);
+        if (c > 0xFF)
+            break;
+        *out++ = static_cast<char>(c);
+        first = p;
+    }
+    return {first, out};
+}
+
+// UTF-8: ASCII runs, and two-byte sequences with lead byte C2 or C3
+inline convert_result<char, char>
+narrow_latin1_prefix_utf8(const char* first, const char* last, char* out)
+{
+    while (first != last) {
+        const std::size_t n = ascii_prefix_length(first, last);
+        std::memcpy(out, first, n);
+        first += n;
+        out += n;
+
+        while (last - first >= 2) {
+            const auto lead = static_cast<unsigned char>(first[0]);
+            const auto trail = static_cast<unsigned char>(first[1]);
+            if ((lead & 0xFE) != 0xC2 || (trail & 0xC0) != 0x80)
+                break;
+            *out++ = static_cast<char>(((lead & 0x1F) << 6) | (trail & 0x3F));
+            first += 2;
+        }
+        if (first != last && !is_ascii_unit(*first))
+            break;
+    }
+    return {first, out};
+}
+
+template <>
+inline convert_result<char, char>
+narrow_latin1_prefix<char>(const char* first, const char* last, char* out)
+{
+    return narrow_latin1_prefix_utf8(first, last, out);
+}
+
+// UTF-16 and UTF-32: a word's worth of code units are checked together
+template <typename CharT>
+convert_result<CharT, char>
+narrow_latin1_prefix_wide(const CharT* first, const CharT* last, char* out)
+{
+    constexpr std::ptrdiff_t per_word = sizeof(std::uint64_t) / sizeof(CharT);
+    constexpr std::uint64_t mask = sizeof(CharT) == 2 ? 0xFF00FF00FF00FF00u
+                                                      : 0xFFFFFF00FFFFFF00u;
+
+    while (last - first >= per_word) {
+        std::uint64_t w;
+        std::memcpy(&w, first, sizeof(w));
+        if (w & mask)
+            break;
+        for (std::ptrdiff_t i = 0; i < per_word; i++) {
+            out[i] = static_cast<char>(first[i]);
+        }
+        first += per_word;
+        out += per_word;
+    }
+    while (first != last && static_cast<std::uint32_t>(*first) <= 0xFF) {
+        *out++ = static_cast<char>(*first++);
+    }
+    return {first, out};
+}
+
+template <>
+inline convert_result<char16_t, char>
+narrow_latin1_prefix<char16_t>(const char16_t* first, const char16_t* last, char* out)
+{
+    return narrow_latin1_prefix_wide(first, last, out);
+}
+
+template <>
+inline convert_result<char32_t, char>
+narrow_latin1_prefix<char32_t>(const char32_t* first, const char32_t* last, char* out)
+{
+    return narrow_latin1_prefix_wide(first, last, out);
+}
+
+template <>
+inline convert_result<wchar_t, char>
+narrow_latin1_prefix<wchar_t>(const wchar_t* first, const wchar_t* last, char* out)
+{
+    return narrow_latin1_prefix_wide(first, last, out);
+}
+
+// Latin-1 to UTF-16 or UTF-32 is a plain widening of each byte
+template <typename OutCharT>
+convert_result<char, OutCharT>
+widen_latin1(const char* first, const char* last, OutCharT* out, std::true_type)
+{
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = static_cast<OutCharT>(static_cast<unsigned char>(first[i]));
+    }
+    return {last, out + n};
+}
+
+// Latin-1 to UTF-8 copies ASCII runs, and expands other bytes to two
+inline convert_result<char, char>
+widen_latin1(const char* first, const char* last, char* out, std::false_type)
+{
+    while (first != last) {
+        const std::size_t n = ascii_prefix_length(first, last);
+        std::memcpy(out, first, n);
+        first += n;
+        out += n;
+
+        while (first != last && !is_ascii_unit(*first)) {
+            const auto c = static_cast<unsigned char>(*first++);
+            out[0] = static_cast<char>(0xC0 | (c >> 6));
+            out[1] = static_cast<char>(0x80 | (c & 0x3F));
+            out += 2;
+        }
+    }
+    return {last, out};
+}
+
+template <typename InEncoding, typename OutEncoding>
+struct block_converter {
+    template <typename InCharT, typename OutCharT>
+    static convert_result<InCharT, OutCharT>
+    convert(const InCharT* first, const InCharT* last, OutCharT* out, bool final)
+    {
+        return convert_block_generic<InEncoding, OutEncoding>(first, last, out, final);
+    }
+};
+
+template <typename OutEncoding>
+struct block_converter<latin1, OutEncoding> {
+    template <typename OutCharT>
+    static convert_result<char, OutCharT>
+    convert(const char* first, const char* last, OutCharT* out, bool final)
+    {
+        return convert(first, last, out, final, is_encoding_tag<OutEncoding>{});
+    }
+
+private:
+    // Output to another tagged encoding
+    template <typename OutCharT>
+    static convert_result<char, OutCharT>
+    convert(const char* first, const char* last, OutCharT* out, bool final, std::true_type)
+    {
+        return convert_block_generic<latin1, OutEncoding>(first, last, out, final);
+    }
+
+    // Output to UTF-8, UTF-16 or UTF-32
+    template <typename OutCharT>
+    static convert_result<char, OutCharT>
+    convert(const char* first, const char* last, OutCharT* out, bool, std::false_type)
+    {
+        return widen_latin1(first, last, out,
+                            std::integral_constant<bool, (sizeof(OutCharT) > 1)>{});
+    }
+};
+
+template <typename InEncoding>
+struct block_converter<InEncoding, latin1> {
+    template <typename InCharT>
+    static convert_result<InCharT, char>
+    convert(const InCharT* first, const InCharT* last, char* out, bool final)
+    {
+        while (true) {
+            const auto res = narrow_latin1_prefix<InEncoding>(first, last, out);
+            first = res.in;
+            out = res.out;
+            if (first == last)
+                break;
+
+            // Replace the code point which doesn't fit
+            const InCharT* p = first;
+            const code_point c = utf_traits<InEncoding>::decode(p, last);
+            if (c == incomplete && !final)
+                break;
+            *out++ = '?';
+            first = p;
+        }
+        return {first, out};
+    }
+};
+
+template <>
+struct block_converter<latin1, latin1> {
+    static convert_result<char, char>
+    convert(const char* first, const char* last, char* out, bool)
+    {
+        std::memcpy(out, first, static_cast<std::size_t>(last - first));
+        return {last, out + (last - first)};
+    }
+};
+
+///
+/// Converts the contiguous range [first, last) into the buffer at `out`, which
+/// must have room for at least max_converted_size(last - first) code units.
+/// Illegal sequences are replaced by U+FFFD. If `final` is false, an
+/// incomplete sequence at the end of the input is left unconsumed so that
+/// it can be completed by the next block; the returned `in` points to it.
+/// The encodings are given explicitly, as they may be tag types.
+///
+template <typename InEncoding, typename OutEncoding,
+          typename InCharT = char_type_t<InEncoding>,
+          typename OutCharT = char_type_t<OutEncoding>>
+convert_result<InCharT, OutCharT>
+convert_block(const InCharT* first, const InCharT* last, OutCharT* out,
+              bool final = true)
+{
+    return block_converter<InEncoding, OutEncoding>::convert(first, last, out, final);
+}
 
 template <typename InputIt, typename Sentinel, typename InCharT, typename OutCharT>
 class unicode_view {
 private:
     struct iterator {
         // Required typedefs
-        using value_type = OutCharT;
+        using value_type = char_type_t<OutCharT>;
         using difference_type = typename std::iterator_traits<InputIt>::difference_type; // ?
         using pointer = const value_type*;
         using reference = const value_type&;
@@ -464,8 +920,7 @@ private:
                 : first_(first), last_(last)
         {
             if (first_ != last_) {
-                char32_t c = detail::utf_traits<InCharT>::decode(first_, last_);
-                next_chars_ = detail::utf_traits<OutCharT>::encode(c);
+                next_chars_ = utf_traits<OutCharT>::encode(decode_next());
             }
         }
 
@@ -482,8 +937,7 @@ private:
         TCB_CONSTEXPR14 iterator& operator++()
         {
             if (++idx_ == next_chars_.size() && first_ != last_) {
-                char32_t c = utf_traits<InCharT>::decode(first_, last_);
-                next_chars_ = utf_traits<OutCharT>::encode(c);
+                next_chars_ = utf_traits<OutCharT>::encode(decode_next());
                 idx_ = 0;
             }
             return *this;
@@ -519,7 +973,13 @@ private:
             return first_ == last_ && idx_ == next_chars_.size();
         }
 
-        encoded_chars<OutCharT> next_chars_;
+        TCB_CONSTEXPR14 code_point decode_next()
+        {
+            return replace_invalid<InCharT, OutCharT>(
+                utf_traits<InCharT>::decode(first_, last_));
+        }
+
+        decltype(utf_traits<OutCharT>::encode(code_point{})) next_chars_;
         InputIt first_{};
         Sentinel last_{};
         std::uint8_t idx_ = 0;
@@ -558,7 +1018,25 @@ using iter_value_t = typename std::iterator_traits<Iter>::value_type;
 
 } // end namespace detail
 
-template <typename InputIt, typename Sentinel>
+///
+/// Byte order of multi-byte code units
+///
+enum class byte_order {
+    little,
+    big,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    native = big
+#else
+    native = little
+#endif
+};
+
+///
+/// A view of the individual bytes of a sequence of code units, with each
+/// code unit serialised in the given byte order
+///
+template <typename InputIt, typename Sentinel,
+          byte_order Order = byte_order::native>
 class bytes_view {
 public:
     struct iterator {
@@ -577,10 +1055,10 @@ public:
 
         constexpr iterator() = default;
 
-        constexpr iterator(InputIt first, Sentinel last)
-                : first_(first)
+        TCB_CONSTEXPR14 iterator(InputIt first, Sentinel last)
+                : first_(first), last_(last)
         {
-            if (first != last) {
+            if (first_ != last_) {
                 fill_buffer();
             }
         }
@@ -595,11 +1073,12 @@ public:
             return &buf_[idx_];
         }
 
-        constexpr iterator& operator++()
+        TCB_CONSTEXPR14 iterator& operator++()
         {
-            if (++idx_ == sizeof(input_type)) {
+            if (++idx_ == sizeof(input_type) && first_ != last_) {
                 fill_buffer();
             }
+            return *this;
         }
 
         TCB_CONSTEXPR14 iterator operator++(int)
@@ -609,25 +1088,43 @@ public:
             return t;
         }
 
-        constexpr bool operator==(const iterator& other)
+        bool operator==(const iterator& other) const
+        {
+            return (done() && other.done()) ||
+                   (first_ == other.first_ &&
+                    last_ == other.last_ &&
+                    idx_ == other.idx_);
+        }
+
+        bool operator!=(const iterator& other) const
         {
-            return first_ == other.first_ &&
-                   idx_ == other.idx_;
+            return !(*this == other);
         }
 
     private:
+        bool done() const
+        {
+            return first_ == last_ && idx_ == sizeof(input_type);
+        }
+
         TCB_CONSTEXPR14 void fill_buffer()
         {
-            const input_type t = *first_;
-            std::copy(reinterpret_cast<const byte*>(&t),
-                      reinterpret_cast<const byte*>(&t) + sizeof(input_type),
-                      buf_.begin());
-            idx_ = sizeof(input_type);
+            using uint_type = std::make_unsigned_t<input_type>;
+            const auto t = static_cast<std::uint32_t>(static_cast<uint_type>(*first_));
+            ++first_;
+            for (std::size_t i = 0; i < sizeof(input_type); i++) {
+                const std::size_t shift = Order == byte_order::little
+                                          ? 8 * i
+                                          : 8 * (sizeof(input_type) - 1 - i);
+                buf_[i] = static_cast<byte>((t >> shift) & 0xFF);
+            }
+            idx_ = 0;
         }
 
-        InputIt first_;
         std::array<byte, sizeof(input_type)> buf_{{}};
-        std::int8_t idx_ = 0;
+        InputIt first_{};
+        Sentinel last_{};
+        std::uint8_t idx_ = sizeof(input_type);
     };
 
     constexpr bytes_view() = default;
@@ -637,9 +1134,9 @@ public:
               last_(last)
     {}
 
-    constexpr iterator begin() const { return iterator{first_}; }
+    constexpr iterator begin() const { return iterator{first_, last_}; }
     constexpr iterator cbegin() const { return begin(); }
-    constexpr iterator end() const { return iterator{last_}; }
+    constexpr iterator end() const { return iterator{last_, last_}; }
     constexpr iterator cend() const { return end(); }
 
 private:
@@ -659,7 +1156,15 @@ template <typename InputIt, typename Sentinel,
         typename InCharT = detail::iter_value_t<InputIt>>
 using utf32_view = detail::unicode_view<InputIt, Sentinel, InCharT, char32_t>;
 
+template <typename InputIt, typename Sentinel,
+        typename InCharT = detail::iter_value_t<InputIt>>
+using latin1_view = detail::unicode_view<InputIt, Sentinel, InCharT, latin1>;
+
 // View functions
+//
+// Each takes an optional explicit input encoding tag, for example
+// as_utf8<latin1>(str); otherwise the encoding is implied by the size of
+// the input's value type.
 
 template <typename InputIt, typename Sentinel>
 constexpr
@@ -675,6 +1180,22 @@ auto as_utf8(const String& str)
     return as_utf8(std::cbegin(str), std::cend(str));
 }
 
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+utf8_view<InputIt, Sentinel, InEncoding> as_utf8(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+auto as_utf8(const String& str)
+{
+    return as_utf8<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
 template <typename InputIt, typename Sentinel>
 constexpr
 utf16_view<InputIt, Sentinel> as_utf16(InputIt first, Sentinel last)
@@ -689,6 +1210,22 @@ auto as_utf16(const String& str)
     return as_utf16(std::cbegin(str), std::cend(str));
 }
 
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+utf16_view<InputIt, Sentinel, InEncoding> as_utf16(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+auto as_utf16(const String& str)
+{
+    return as_utf16<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
 template <typename InputIt, typename Sentinel>
 constexpr
 utf32_view<InputIt, Sentinel> as_utf32(InputIt first, Sentinel last)
@@ -703,6 +1240,52 @@ auto as_utf32(const String& str)
     return as_utf32(std::cbegin(str), std::cend(str));
 }
 
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+utf32_view<InputIt, Sentinel, InEncoding> as_utf32(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+auto as_utf32(const String& str)
+{
+    return as_utf32<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
+template <typename InputIt, typename Sentinel>
+constexpr
+latin1_view<InputIt, Sentinel> as_latin1(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename String>
+constexpr
+auto as_latin1(const String& str)
+{
+    return as_latin1(std::cbegin(str), std::cend(str));
+}
+
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+latin1_view<InputIt, Sentinel, InEncoding> as_latin1(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+constexpr
+auto as_latin1(const String& str)
+{
+    return as_latin1<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
 template <typename InputIt, typename Sentinel>
 constexpr bytes_view<InputIt, Sentinel>
 as_bytes(InputIt first, Sentinel last)
@@ -717,6 +1300,20 @@ auto as_bytes(const String& str)
     return as_bytes(std::cbegin(str), std::cend(str));
 }
 
+template <byte_order Order, typename InputIt, typename Sentinel>
+constexpr bytes_view<InputIt, Sentinel, Order>
+as_bytes(InputIt first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <byte_order Order, typename String>
+constexpr
+auto as_bytes(const String& str)
+{
+    return as_bytes<Order>(std::cbegin(str), std::cend(str));
+}
+
 // Conversion functions
 
 template <typename OutCharT,
@@ -727,19 +1324,124 @@ TCB_CONSTEXPR14
 OutIter utf_convert(InIter first, Sentinel last, OutIter out)
 {
     while (first != last) {
-        const char32_t c = detail::utf_traits<InCharT>::decode(first, last);
-        detail::utf_traits<OutCharT>::encode(c, out);
+        const char32_t c = detail::replace_invalid<InCharT, OutCharT>(
+            detail::utf_traits<InCharT>::decode(first, last));
+        out = detail::utf_traits<OutCharT>::encode(c, out);
     }
     return out;
 }
 
-template <typename OutCharT,
-          typename InputIt, typename Sentinel,
-          typename InCharT = detail::iter_value_t<InputIt>>
-std::basic_string<OutCharT>
-to_utf_string(InputIt first, Sentinel last)
-{
-    using string_type = std::basic_string<OutCharT>;
+namespace detail {
+
+template <typename T>
+struct is_istreambuf_iterator : std::false_type {};
+
+template <typename CharT, typename Traits>
+struct is_istreambuf_iterator<std::istreambuf_iterator<CharT, Traits>>
+    : std::true_type {};
+
+template <typename T>
+using is_istream = std::is_base_of<std::ios_base, T>;
+
+template <typename...>
+struct make_void { using type = void; };
+
+template <typename... Ts>
+using void_t = typename make_void<Ts...>::type;
+
+template <typename String>
+using range_value_t = iter_value_t<decltype(std::cbegin(std::declval<const String&>()))>;
+
+template <typename String, typename = void>
+struct has_contiguous_data : std::false_type {};
+
+template <typename String>
+struct has_contiguous_data<String, void_t<decltype(std::declval<const String&>().data()),
+                                          decltype(std::declval<const String&>().size())>>
+    : std::is_pointer<decltype(std::declval<const String&>().data())> {};
+
+///
+/// Converts input supplied in blocks by `read(buf, n)`, which should return
+/// the number of code units written to `buf` (at most `n`), or zero at the
+/// end of the input. The contiguous kernels are run on each block.
+///
+template <typename OutEncoding, typename InEncoding, typename ReadFn>
+std::basic_string<char_type_t<OutEncoding>> to_utf_string_chunked(ReadFn read)
+{
+    using InCharT = char_type_t<InEncoding>;
+    using OutCharT = char_type_t<OutEncoding>;
+
+    constexpr std::size_t chunk_size = 4096;
+
+    std::basic_string<OutCharT> output;
+    InCharT buf[chunk_size];
+    std::size_t pending = 0;
+    bool final = false;
+
+    while (!final) {
+        const std::size_t n = read(buf + pending, chunk_size - pending);
+        final = n == 0;
+        const std::size_t avail = pending + n;
+
+        const std::size_t old_size = output.size();
+        output.resize(old_size + max_converted_size<OutEncoding>(avail));
+        const auto res = convert_block<InEncoding, OutEncoding>(
+            buf, buf + avail, &output[old_size], final);
+        output.resize(static_cast<std::size_t>(res.out - &output[0]));
+
+        pending = static_cast<std::size_t>(buf + avail - res.in);
+        std::memmove(buf, res.in, pending * sizeof(InCharT));
+    }
+
+    return output;
+}
+
+///
+/// Converts the contiguous range [first, last), running the kernels directly
+/// on the input and growing the output a block at a time
+///
+template <typename OutEncoding, typename InEncoding, typename InCharT>
+std::basic_string<char_type_t<OutEncoding>>
+to_utf_string_contiguous(const InCharT* first, const InCharT* last)
+{
+    constexpr std::ptrdiff_t block_size = 16384;
+
+    std::basic_string<char_type_t<OutEncoding>> output;
+    output.reserve(static_cast<std::size_t>(last - first));
+
+    while (first != last) {
+        const InCharT* block_end = last - first > block_size ? first + block_size : last;
+        const std::size_t old_size = output.size();
+        output.resize(old_size + max_converted_size<OutEncoding>(
+                                     static_cast<std::size_t>(block_end - first)));
+        const auto res = convert_block<InEncoding, OutEncoding>(
+            first, block_end, &output[old_size], block_end == last);
+        output.resize(static_cast<std::size_t>(res.out - &output[0]));
+        first = res.in;
+    }
+
+    return output;
+}
+
+struct generic_input_tag {};
+struct contiguous_input_tag {};
+struct streambuf_input_tag {};
+
+template <typename InputIt, typename Sentinel>
+using input_tag_t =
+    std::conditional_t<is_istreambuf_iterator<InputIt>::value,
+                       streambuf_input_tag,
+                       std::conditional_t<std::is_pointer<InputIt>::value &&
+                                          std::is_same<InputIt, Sentinel>::value,
+                                          contiguous_input_tag,
+                                          generic_input_tag>>;
+
+template <typename OutCharT, typename InCharT,
+          typename InputIt, typename Sentinel>
+std::basic_string<char_type_t<OutCharT>>
+to_utf_string_impl(InputIt first, Sentinel last, generic_input_tag)
+{
+    using string_type = std::basic_string<char_type_t<OutCharT>>;
 
     string_type output;
 
@@ -749,21 +1451,124 @@ to_utf_string(InputIt first, Sentinel last)
         output.reserve(static_cast<typename string_type::size_type>(std::distance(first, last)));
     }
 
-    utf_convert<OutCharT>(first, last, std::back_inserter(output));
+    utf_convert<OutCharT, InputIt, Sentinel,
+                std::back_insert_iterator<string_type>, InCharT>(
+                first, last, std::back_inserter(output));
 
     return output;
 }
 
+template <typename OutCharT, typename InCharT,
+          typename InputIt, typename Sentinel>
+std::basic_string<char_type_t<OutCharT>>
+to_utf_string_impl(InputIt first, Sentinel last, contiguous_input_tag)
+{
+    return to_utf_string_contiguous<OutCharT, InCharT>(first, last);
+}
+
+// Stream buffer iterators: rather than decoding through the iterator one
+// code unit at a time, pull blocks into a local buffer and convert those
+template <typename OutCharT, typename InCharT,
+          typename InputIt, typename Sentinel>
+std::basic_string<char_type_t<OutCharT>>
+to_utf_string_impl(InputIt first, Sentinel last, streambuf_input_tag)
+{
+    using buf_char = char_type_t<InCharT>;
+
+    return to_utf_string_chunked<OutCharT, InCharT>(
+        [&first, &last](buf_char* buf, std::size_t n) {
+            std::size_t i = 0;
+            for (; i < n && first != last; ++i, ++first) {
+                buf[i] = *first;
+            }
+            return i;
+        });
+}
+
+template <typename OutCharT, typename InCharT, typename String>
+std::basic_string<char_type_t<OutCharT>>
+to_utf_string_range(const String& str, std::true_type)
+{
+    return to_utf_string_contiguous<OutCharT, InCharT>(str.data(), str.data() + str.size());
+}
+
+template <typename OutCharT, typename InCharT, typename String>
+std::basic_string<char_type_t<OutCharT>>
+to_utf_string_range(const String& str, std::false_type)
+{
+    return to_utf_string_impl<OutCharT, InCharT>(
+        std::cbegin(str), std::cend(str),
+        input_tag_t<decltype(std::cbegin(str)), decltype(std::cend(str))>{});
+}
+
+} // end namespace detail
+
+template <typename OutCharT,
+          typename InputIt, typename Sentinel,
+          typename InCharT = detail::iter_value_t<InputIt>>
+std::basic_string<detail::char_type_t<OutCharT>>
+to_utf_string(InputIt first, Sentinel last)
+{
+    return detail::to_utf_string_impl<OutCharT, InCharT>(
+        first, last, detail::input_tag_t<InputIt, Sentinel>{});
+}
+
+///
+/// Reads the remainder of the stream in blocks using the stream buffer's
+/// sgetn(), and returns it converted to OutCharT
+///
+template <typename OutCharT, typename InCharT, typename Traits>
+std::basic_string<detail::char_type_t<OutCharT>>
+to_utf_string(std::basic_istream<InCharT, Traits>& is)
+{
+    auto* buf = is.rdbuf();
+    if (!buf) {
+        is.setstate(std::ios_base::badbit);
+        return {};
+    }
+
+    auto output = detail::to_utf_string_chunked<OutCharT, InCharT>(
+        [buf](InCharT* p, std::size_t n) {
+            const std::streamsize r = buf->sgetn(p, static_cast<std::streamsize>(n));
+            return r > 0 ? static_cast<std::size_t>(r) : std::size_t{0};
+        });
+    is.setstate(std::ios_base::eofbit);
+    return output;
+}
+
 template <typename InputIt, typename Sentinel>
 std::string to_u8string(InputIt first, Sentinel last)
 {
     return to_utf_string<char>(first, last);
 }
 
-template <typename String>
+template <typename String,
+          typename = std::enable_if_t<!detail::is_istream<String>::value>>
 std::string to_u8string(const String& str)
 {
-    return to_u8string(std::cbegin(str), std::cend(str));
+    return detail::to_utf_string_range<char, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename CharT, typename Traits>
+std::string to_u8string(std::basic_istream<CharT, Traits>& is)
+{
+    return to_utf_string<char>(is);
+}
+
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::string to_u8string(InputIt first, Sentinel last)
+{
+    return to_utf_string<char, InputIt, Sentinel, InEncoding>(first, last);
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::string to_u8string(const String& str)
+{
+    return detail::to_utf_string_range<char, InEncoding>(
+        str, detail::has_contiguous_data<String>{});
 }
 
 template <typename InputIt, typename Sentinel>
@@ -772,10 +1577,33 @@ std::u16string to_u16string(InputIt first, Sentinel last)
     return to_utf_string<char16_t>(first, last);
 }
 
-template <typename String>
+template <typename String,
+          typename = std::enable_if_t<!detail::is_istream<String>::value>>
+std::u16string to_u16string(const String& str)
+{
+    return detail::to_utf_string_range<char16_t, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename CharT, typename Traits>
+std::u16string to_u16string(std::basic_istream<CharT, Traits>& is)
+{
+    return to_utf_string<char16_t>(is);
+}
+
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::u16string to_u16string(InputIt first, Sentinel last)
+{
+    return to_utf_string<char16_t, InputIt, Sentinel, InEncoding>(first, last);
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
 std::u16string to_u16string(const String& str)
 {
-    return to_u16string(std::cbegin(str), std::cend(str));
+    return detail::to_utf_string_range<char16_t, InEncoding>(
+        str, detail::has_contiguous_data<String>{});
 }
 
 template <typename InputIt, typename Sentinel>
@@ -784,10 +1612,595 @@ std::u32string to_u32string(InputIt first, Sentinel last)
     return to_utf_string<char32_t>(first, last);
 }
 
-template <typename String>
+template <typename String,
+          typename = std::enable_if_t<!detail::is_istream<String>::value>>
 std::u32string to_u32string(const String& str)
 {
-    return to_u32string(std::cbegin(str), std::cend(str));
+    return detail::to_utf_string_range<char32_t, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename CharT, typename Traits>
+std::u32string to_u32string(std::basic_istream<CharT, Traits>& is)
+{
+    return to_utf_string<char32_t>(is);
+}
+
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::u32string to_u32string(InputIt first, Sentinel last)
+{
+    return to_utf_string<char32_t, InputIt, Sentinel, InEncoding>(first, last);
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::u32string to_u32string(const String& str)
+{
+    return detail::to_utf_string_range<char32_t, InEncoding>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename InputIt, typename Sentinel>
+std::string to_latin1(InputIt first, Sentinel last)
+{
+    return to_utf_string<latin1>(first, last);
+}
+
+template <typename String,
+          typename = std::enable_if_t<!detail::is_istream<String>::value>>
+std::string to_latin1(const String& str)
+{
+    return detail::to_utf_string_range<latin1, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename InEncoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::string to_latin1(InputIt first, Sentinel last)
+{
+    return to_utf_string<latin1, InputIt, Sentinel, InEncoding>(first, last);
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::string to_latin1(const String& str)
+{
+    return detail::to_utf_string_range<latin1, InEncoding>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+///
+/// The result of to_latin1_checked()
+///
+struct latin1_result {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// The converted text, up to the first code point which doesn't fit
+    std::string text;
+
+    /// The offset in code units of the first code point in the input which
+    /// is ill-formed or greater than U+00FF, or npos if there is none
+    std::size_t error_position = npos;
+
+    explicit operator bool() const { return error_position == npos; }
+};
+
+///
+/// Converts to Latin-1, stopping at and reporting the first code point
+/// which cannot be represented, rather than replacing it with '?'
+///
+template <typename InEncoding, typename InCharT>
+latin1_result to_latin1_checked(const InCharT* first, const InCharT* last)
+{
+    latin1_result result;
+    result.text.resize(static_cast<std::size_t>(last - first));
+    const auto res = detail::narrow_latin1_prefix<InEncoding>(first, last, &result.text[0]);
+    result.text.resize(static_cast<std::size_t>(res.out - &result.text[0]));
+    if (res.in != last) {
+        result.error_position = static_cast<std::size_t>(res.in - first);
+    }
+    return result;
+}
+
+template <typename String,
+          typename = std::enable_if_t<detail::has_contiguous_data<String>::value>>
+latin1_result to_latin1_checked(const String& str)
+{
+    using char_type = std::remove_const_t<std::remove_pointer_t<decltype(str.data())>>;
+    return to_latin1_checked<char_type>(str.data(), str.data() + str.size());
+}
+
+// Byte-oriented conversion
+
+///
+/// Encodings of byte sequences, for converting raw buffers and files
+///
+enum class encoding {
+    utf8,
+    latin1,
+    utf16le,
+    utf16be,
+    utf32le,
+    utf32be
+};
+
+namespace detail {
+
+static constexpr bool native_little_endian = byte_order::native == byte_order::little;
+
+///
+/// Reverses the byte order of each of the `n` code units of size `Size` at
+/// `p`, a machine word at a time
+///
+template <std::size_t Size>
+inline void byteswap_units(unsigned char* p, std::size_t n);
+
+template <>
+inline void byteswap_units<1>(unsigned char*, std::size_t) {}
+
+template <>
+inline void byteswap_units<2>(unsigned char* p, std::size_t n)
+{
+    constexpr std::uint64_t mask = 0x00FF00FF00FF00FFu;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        std::uint64_t w;
+        std::memcpy(&w, p + 2 * i, sizeof(w));
+        w = ((w & mask) << 8) | ((w >> 8) & mask);
+        std::memcpy(p + 2 * i, &w, sizeof(w));
+    }
+    for (; i < n; i++) {
+        std::swap(p[2 * i], p[2 * i + 1]);
+    }
+}
+
+template <>
+inline void byteswap_units<4>(unsigned char* p, std::size_t n)
+{
+    constexpr std::uint64_t mask8 = 0x00FF00FF00FF00FFu;
+    constexpr std::uint64_t mask16 = 0x0000FFFF0000FFFFu;
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        std::uint64_t w;
+        std::memcpy(&w, p + 4 * i, sizeof(w));
+        w = ((w & mask8) << 8) | ((w >> 8) & mask8);
+        w = ((w & mask16) << 16) | ((w >> 16) & mask16);
+        std::memcpy(p + 4 * i, &w, sizeof(w));
+    }
+    for (; i < n; i++) {
+        std::swap(p[4 * i], p[4 * i + 3]);
+        std::swap(p[4 * i + 1], p[4 * i + 2]);
+    }
+}
+
+///
+/// Copies `n` code units from the byte buffer `in` to `out`, reversing the
+/// byte order of each unit if `Swap` is true
+///
+template <bool Swap, typename CharT>
+inline void load_units(const unsigned char* in, std::size_t n, CharT* out)
+{
+    std::memcpy(out, in, n * sizeof(CharT));
+    if (Swap) {
+        byteswap_units<sizeof(CharT)>(reinterpret_cast<unsigned char*>(out), n);
+    }
+}
+
+template <bool Swap, typename CharT>
+inline void store_units(const CharT* in, std::size_t n, unsigned char* out)
+{
+    std::memcpy(out, in, n * sizeof(CharT));
+    if (Swap) {
+        byteswap_units<sizeof(CharT)>(out, n);
+    }
+}
+
+struct byte_convert_result {
+    std::size_t consumed;
+    std::size_t produced;
+};
+
+///
+/// Converts the bytes [in, in + size) in blocks of code units via
+/// convert_block(). If `Store` is false, nothing is written and only the
+/// output size is computed.
+///
+template <bool Store, typename InEncoding, bool InSwap, typename OutEncoding, bool OutSwap>
+byte_convert_result transcode_bytes_impl(const unsigned char* in, std::size_t size,
+                                         unsigned char* out, bool final)
+{
+    using InCharT = char_type_t<InEncoding>;
+    using OutCharT = char_type_t<OutEncoding>;
+
+    constexpr std::size_t block_size = 1024;
+
+    InCharT ibuf[block_size];
+    OutCharT obuf[max_converted_size<OutEncoding>(block_size)];
+
+    const std::size_t units = size / sizeof(InCharT);
+    std::size_t consumed = 0;
+    std::size_t produced = 0;
+
+    while (consumed < units) {
+        const std::size_t n = std::min(block_size, units - consumed);
+        load_units<InSwap>(in + consumed * sizeof(InCharT), n, ibuf);
+
+        const auto res = convert_block<InEncoding, OutEncoding>(
+            ibuf, ibuf + n, obuf, final && consumed + n == units);
+        const std::size_t m = static_cast<std::size_t>(res.out - obuf);
+        if (Store) {
+            store_units<OutSwap>(obuf, m, out + produced);
+        }
+        produced += m * sizeof(OutCharT);
+
+        if (res.in == ibuf)
+            break;
+        consumed += static_cast<std::size_t>(res.in - ibuf);
+    }
+
+    consumed *= sizeof(InCharT);
+
+    // A trailing partial code unit
+    if (final && consumed == units * sizeof(InCharT) && consumed != size) {
+        OutCharT* end = utf_traits<OutEncoding>::encode(replacement_character, obuf);
+        const std::size_t m = static_cast<std::size_t>(end - obuf);
+        if (Store) {
+            store_units<OutSwap>(obuf, m, out + produced);
+        }
+        produced += m * sizeof(OutCharT);
+        consumed = size;
+    }
+
+    return {consumed, produced};
+}
+
+template <bool Store, typename InEncoding, bool InSwap>
+byte_convert_result transcode_bytes_to(const unsigned char* in, std::size_t size,
+                                       unsigned char* out, encoding to, bool final)
+{
+    switch (to) {
+    case encoding::utf8:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, char, false>(in, size, out, final);
+    case encoding::latin1:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, latin1, false>(in, size, out, final);
+    case encoding::utf16le:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, char16_t, !native_little_endian>(in, size, out, final);
+    case encoding::utf16be:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, char16_t, native_little_endian>(in, size, out, final);
+    case encoding::utf32le:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, char32_t, !native_little_endian>(in, size, out, final);
+    case encoding::utf32be:
+        return transcode_bytes_impl<Store, InEncoding, InSwap, char32_t, native_little_endian>(in, size, out, final);
+    }
+    return {0, 0};
+}
+
+template <bool Store>
+byte_convert_result transcode_bytes(const unsigned char* in, std::size_t size,
+                                    encoding from, unsigned char* out,
+                                    encoding to, bool final)
+{
+    switch (from) {
+    case encoding::utf8:
+        return transcode_bytes_to<Store, char, false>(in, size, out, to, final);
+    case encoding::latin1:
+        return transcode_bytes_to<Store, latin1, false>(in, size, out, to, final);
+    case encoding::utf16le:
+        return transcode_bytes_to<Store, char16_t, !native_little_endian>(in, size, out, to, final);
+    case encoding::utf16be:
+        return transcode_bytes_to<Store, char16_t, native_little_endian>(in, size, out, to, final);
+    case encoding::utf32le:
+        return transcode_bytes_to<Store, char32_t, !native_little_endian>(in, size, out, to, final);
+    case encoding::utf32be:
+        return transcode_bytes_to<Store, char32_t, native_little_endian>(in, size, out, to, final);
+    }
+    return {0, 0};
+}
+
+inline std::size_t code_unit_size(encoding e)
+{
+    switch (e) {
+    case encoding::utf8:
+    case encoding::latin1:
+        return 1;
+    case encoding::utf16le:
+    case encoding::utf16be:
+        return 2;
+    case encoding::utf32le:
+    case encoding::utf32be:
+        return 4;
+    }
+    return 1;
+}
+
+///
+/// Returns the first code point boundary at or after byte offset `pos`
+///
+inline std::size_t next_code_point_boundary(const unsigned char* data, std::size_t size,
+                                            std::size_t pos, encoding e)
+{
+    const std::size_t unit = code_unit_size(e);
+    pos += (unit - pos % unit) % unit;
+
+    // Never need to skip more than three trail units
+    for (int i = 0; i < 3 && pos + unit <= size; i++, pos += unit) {
+        bool trail = false;
+        switch (e) {
+        case encoding::utf8:
+            trail = utf_traits<char>::is_trail(static_cast<char>(data[pos]));
+            break;
+        case encoding::utf16le:
+            trail = utf_traits<char16_t>::is_trail(
+                static_cast<char16_t>(data[pos] | (data[pos + 1] << 8)));
+            break;
+        case encoding::utf16be:
+            trail = utf_traits<char16_t>::is_trail(
+                static_cast<char16_t>((data[pos] << 8) | data[pos + 1]));
+            break;
+        case encoding::latin1:
+        case encoding::utf32le:
+        case encoding::utf32be:
+            break;
+        }
+        if (!trail)
+            break;
+    }
+    return std::min(pos, size);
+}
+
+} // end namespace detail
+
+///
+/// Incrementally converts a byte stream from one encoding to another.
+/// Input may be supplied in arbitrarily-sized pieces; code units or
+/// sequences split between pieces are held back until they are complete.
+///
+class utf_transcoder {
+public:
+    utf_transcoder(encoding from, encoding to)
+            : from_(from), to_(to)
+    {}
+
+    encoding from() const { return from_; }
+
+    encoding to() const { return to_; }
+
+    ///
+    /// Returns an upper bound on the number of bytes written by
+    /// convert() for `size` input bytes, or by finish() if `size` is zero
+    ///
+    std::size_t max_output_size(std::size_t size) const
+    {
+        // No input code unit produces more than four bytes of output
+        const std::size_t units = (size + pending_size_) / detail::code_unit_size(from_) + 1;
+        return units * 4;
+    }
+
+    ///
+    /// Converts `size` bytes from `data`, writing to `out`, which must have
+    /// room for max_output_size(size) bytes. Returns the number of bytes
+    /// written.
+    ///
+    std::size_t convert(const void* data, std::size_t size, void* out)
+    {
+        auto in = static_cast<const unsigned char*>(data);
+        auto o = static_cast<unsigned char*>(out);
+        std::size_t produced = 0;
+
+        // Complete any sequence left over from the last call
+        while (pending_size_ > 0 && size > 0) {
+            const std::size_t old_size = pending_size_;
+            const std::size_t n = std::min(size, pending_.size() - old_size);
+            std::memcpy(pending_.data() + old_size, in, n);
+
+            const auto res = detail::transcode_bytes<true>(
+                pending_.data(), old_size + n, from_, o + produced, to_, false);
+            produced += res.produced;
+
+            if (res.consumed >= old_size) {
+                in += res.consumed - old_size;
+                size -= res.consumed - old_size;
+                pending_size_ = 0;
+            }
+            else if (res.consumed > 0) {
+                std::memmove(pending_.data(), pending_.data() + res.consumed,
+                             old_size - res.consumed);
+                pending_size_ = old_size - res.consumed;
+            }
+            else {
+                // Still incomplete, so the input must all fit
+                pending_size_ = old_size + n;
+                return produced;
+            }
+        }
+
+        // Nothing more to convert, and any pending bytes must be kept
+        if (size == 0)
+            return produced;
+
+        const auto res = detail::transcode_bytes<true>(in, size, from_, o + produced, to_, false);
+        produced += res.produced;
+
+        pending_size_ = size - res.consumed;
+        std::memcpy(pending_.data(), in + res.consumed, pending_size_);
+
+        return produced;
+    }
+
+    ///
+    /// As above, appending the converted bytes to `out`
+    ///
+    void convert(const void* data, std::size_t size, std::string& out)
+    {
+        const std::size_t old_size = out.size();
+        out.resize(old_size + max_output_size(size));
+        const std::size_t n = convert(data, size, &out[old_size]);
+        out.resize(old_size + n);
+    }
+
+    ///
+    /// Flushes any incomplete trailing input as U+FFFD, writing to `out`,
+    /// which must have room for max_output_size(0) bytes. Returns the
+    /// number of bytes written.
+    ///
+    std::size_t finish(void* out)
+    {
+        const auto res = detail::transcode_bytes<true>(pending_.data(), pending_size_, from_,
+                                                       static_cast<unsigned char*>(out), to_, true);
+        pending_size_ = 0;
+        return res.produced;
+    }
+
+    void finish(std::string& out)
+    {
+        const std::size_t old_size = out.size();
+        out.resize(old_size + max_output_size(0));
+        const std::size_t n = finish(&out[old_size]);
+        out.resize(old_size + n);
+    }
+
+private:
+    encoding from_;
+    encoding to_;
+    std::array<unsigned char, 16> pending_{{}};
+    std::size_t pending_size_ = 0;
+};
+
+
+namespace detail {
+
+template <typename T>
+struct is_byte_type : std::false_type {};
+
+template <> struct is_byte_type<char> : std::true_type {};
+template <> struct is_byte_type<unsigned char> : std::true_type {};
+#ifdef __cpp_lib_byte
+template <> struct is_byte_type<std::byte> : std::true_type {};
+#endif
+
+template <typename CharT>
+constexpr encoding native_encoding()
+{
+    return sizeof(CharT) == 1 ? encoding::utf8
+         : sizeof(CharT) == 2 ? (native_little_endian ? encoding::utf16le : encoding::utf16be)
+         : (native_little_endian ? encoding::utf32le : encoding::utf32be);
+}
+
+template <typename OutCharT, typename InEncoding, bool Swap>
+std::basic_string<OutCharT>
+to_utf_string_from_bytes(const unsigned char* data, std::size_t size)
+{
+    using InCharT = char_type_t<InEncoding>;
+
+    const std::size_t units = size / sizeof(InCharT);
+    std::size_t pos = 0;
+
+    auto output = to_utf_string_chunked<OutCharT, InEncoding>(
+        [&](InCharT* buf, std::size_t n) {
+            n = std::min(n, units - pos);
+            load_units<Swap>(data + pos * sizeof(InCharT), n, buf);
+            pos += n;
+            return n;
+        });
+
+    // A trailing partial code unit
+    if (size % sizeof(InCharT) != 0) {
+        utf_traits<OutCharT>::encode(replacement_character, std::back_inserter(output));
+    }
+    return output;
+}
+
+///
+/// Converts the bytes [in, in + size), appending the result to `out`
+///
+inline void transcode_bytes_append(const unsigned char* in, std::size_t size,
+                                   encoding from, encoding to, std::string& out)
+{
+    constexpr std::size_t block_size = 65536;
+
+    while (size > 0) {
+        const std::size_t n = std::min(block_size, size);
+        const std::size_t old_size = out.size();
+        out.resize(old_size + (n / code_unit_size(from) + 1) * 4);
+
+        const auto res = transcode_bytes<true>(
+            in, n, from, reinterpret_cast<unsigned char*>(&out[old_size]), to, n == size);
+        out.resize(old_size + res.produced);
+        in += res.consumed;
+        size -= res.consumed;
+    }
+}
+
+} // end namespace detail
+
+///
+/// Decodes `size` bytes of text in encoding `from`, returning it converted
+/// to OutCharT
+///
+template <typename OutCharT, typename Byte,
+          typename = std::enable_if_t<detail::is_byte_type<Byte>::value>>
+std::basic_string<OutCharT>
+to_utf_string(const Byte* data, std::size_t size, encoding from)
+{
+    constexpr bool little = detail::native_little_endian;
+    const auto bytes = reinterpret_cast<const unsigned char*>(data);
+
+    switch (from) {
+    case encoding::utf8:
+        return detail::to_utf_string_from_bytes<OutCharT, char, false>(bytes, size);
+    case encoding::latin1:
+        return detail::to_utf_string_from_bytes<OutCharT, latin1, false>(bytes, size);
+    case encoding::utf16le:
+        return detail::to_utf_string_from_bytes<OutCharT, char16_t, !little>(bytes, size);
+    case encoding::utf16be:
+        return detail::to_utf_string_from_bytes<OutCharT, char16_t, little>(bytes, size);
+    case encoding::utf32le:
+        return detail::to_utf_string_from_bytes<OutCharT, char32_t, !little>(bytes, size);
+    case encoding::utf32be:
+        return detail::to_utf_string_from_bytes<OutCharT, char32_t, little>(bytes, size);
+    }
+    return {};
+}
+
+template <typename Byte,
+          typename = std::enable_if_t<detail::is_byte_type<Byte>::value>>
+std::string to_u8string(const Byte* data, std::size_t size, encoding from)
+{
+    return to_utf_string<char>(data, size, from);
+}
+
+template <typename Byte,
+          typename = std::enable_if_t<detail::is_byte_type<Byte>::value>>
+std::u16string to_u16string(const Byte* data, std::size_t size, encoding from)
+{
+    return to_utf_string<char16_t>(data, size, from);
+}
+
+template <typename Byte,
+          typename = std::enable_if_t<detail::is_byte_type<Byte>::value>>
+std::u32string to_u32string(const Byte* data, std::size_t size, encoding from)
+{
+    return to_utf_string<char32_t>(data, size, from);
+}
+
+///
+/// Encodes the `size` code units at `data` as bytes in encoding `to`
+///
+template <typename CharT>
+std::string to_bytes(const CharT* data, std::size_t size, encoding to)
+{
+    std::string output;
+    detail::transcode_bytes_append(reinterpret_cast<const unsigned char*>(data),
+                                   size * sizeof(CharT),
+                                   detail::native_encoding<CharT>(), to, output);
+    return output;
+}
+
+template <typename String>
+std::string to_bytes(const String& str, encoding to)
+{
+    return to_bytes(str.data(), str.size(), to);
 }
 
 } // end namespace unicode
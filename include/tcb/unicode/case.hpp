@@ -0,0 +1,652 @@
+
+#ifndef TCB_UNICODE_CASE_HPP_INCLUDED
+#define TCB_UNICODE_CASE_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/case_tables.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Case mapping and case folding, as in section 3.13 of the Unicode
+/// Standard (version 14.0).
+///
+/// The full mappings may map one code point to several (for instance, the
+/// uppercase of U+00DF LATIN SMALL LETTER SHARP S is "SS", and its case
+/// folding is "ss"); the simple mappings are always one to one. Only the
+/// unconditional mappings are applied: those of SpecialCasing.txt which
+/// depend on the language (as for Turkish dotted and dotless i) or on the
+/// context (as for Greek final sigma) are not, and nor are the Turkic case
+/// foldings.
+///
+/// Each mapping is found with a single table lookup (the tables are about
+/// 10 KB and are generated by tools/ucdgen.cpp), except for ASCII: runs of
+/// ASCII in contiguous input are mapped two machine words at a time,
+/// without being decoded. As case mappings seldom change the length of
+/// text, the result is allocated once with the length of the input, and
+/// grows only if a mapping needs more room.
+///
+/// Text is compared and hashed ignoring case by folding it a code point at
+/// a time as it is read, without making folded copies. Runs of ASCII in
+/// contiguous input are compared (and, in UTF-8, hashed) a machine word or
+/// two at a time. Hashes are of the UTF-8 encoding of the case folding, so
+/// they do not depend on the encoding of the text.
+///
+/// Ill-formed sequences are replaced by U+FFFD.
+///
+
+/// Which case mappings to apply
+enum class case_mapping {
+    full,   ///< Mappings of one code point to one or more
+    simple, ///< Mappings of one code point to one
+};
+
+namespace detail {
+
+enum class case_operation { lower, upper, fold };
+
+template <case_operation Op>
+constexpr std::uint32_t case_mapping_record(code_point c)
+{
+    using t = case_mapping_tables<>;
+    return Op == case_operation::lower ? t::lower[case_record_lookup(c)]
+         : Op == case_operation::upper ? t::upper[case_record_lookup(c)]
+                                       : t::fold[case_record_lookup(c)];
+}
+
+template <case_operation Op>
+constexpr code_point simple_case_mapping(code_point c)
+{
+    return c > 0x10FFFF ? c : (c + (case_mapping_record<Op>(c) & 0x3FFFFF)) & 0x3FFFFF;
+}
+
+constexpr int max_case_mapping_length = case_mapping_tables<>::max_length;
+
+///
+/// Writes the mapping of `c` to `out`, which must have room for
+/// max_case_mapping_length code points, and returns its length
+///
+template <case_operation Op, case_mapping Mapping>
+inline int map_case(code_point c, code_point* out)
+{
+    const std::uint32_t record = case_mapping_record<Op>(c);
+    const std::uint32_t offset = record >> 22;
+    if (Mapping == case_mapping::full && offset != 0) {
+        const std::uint32_t* p = case_mapping_tables<>::special + offset;
+        int n = 0;
+        do {
+            out[n++] = *p & 0x1FFFFF;
+        } while ((*p++ & 0x80000000) == 0);
+        return n;
+    }
+    out[0] = (c + (record & 0x3FFFFF)) & 0x3FFFFF;
+    return 1;
+}
+
+// The ASCII letters changed by each operation
+template <case_operation Op>
+struct ascii_case_range {
+    static constexpr std::uint32_t first = Op == case_operation::upper ? 'a' : 'A';
+};
+
+template <case_operation Op, typename CharT>
+constexpr CharT map_ascii_case(CharT c)
+{
+    return static_cast<std::uint32_t>(c) - ascii_case_range<Op>::first < 26
+               ? static_cast<CharT>(c ^ 0x20) : c;
+}
+
+// A word with one in the lowest bit of each code unit
+template <int CharSize>
+struct unit_word_ones;
+
+template <>
+struct unit_word_ones<1> {
+    static constexpr std::uint64_t value = 0x0101010101010101u;
+};
+
+template <>
+struct unit_word_ones<2> {
+    static constexpr std::uint64_t value = 0x0001000100010001u;
+};
+
+template <>
+struct unit_word_ones<4> {
+    static constexpr std::uint64_t value = 0x0000000100000001u;
+};
+
+/// Maps the case of each of the ASCII code units packed in `w`
+template <case_operation Op, typename CharT>
+inline std::uint64_t map_ascii_case_word(std::uint64_t w)
+{
+    // Adding 0x80 - first sets the top bit of the low byte of each code
+    // unit which is at least `first`, and adding 0x80 - first - 26 of each
+    // which is past the last letter; neither can carry out of the byte
+    constexpr std::uint64_t ones = unit_word_ones<sizeof(CharT)>::value;
+    constexpr std::uint64_t first = ascii_case_range<Op>::first;
+    const std::uint64_t from_first = w + ones * (0x80 - first);
+    const std::uint64_t past_last = w + ones * (0x80 - first - 26);
+    return w ^ ((from_first & ~past_last & ones * 0x80) >> 2);
+}
+
+///
+/// Maps the case of the code units in [first, last) to `out`, stopping
+/// before the first which is not ASCII, a machine word's worth at a time
+///
+template <case_operation Op, typename CharT>
+inline void map_ascii_prefix(const CharT*& first, const CharT* last, CharT*& out)
+{
+    constexpr std::ptrdiff_t per_word = sizeof(std::uint64_t) / sizeof(CharT);
+    constexpr std::uint64_t mask = ascii_word_mask<sizeof(CharT)>::value;
+
+    while (last - first >= 2 * per_word) {
+        std::uint64_t w1, w2;
+        std::memcpy(&w1, first, sizeof(w1));
+        std::memcpy(&w2, first + per_word, sizeof(w2));
+        if ((w1 | w2) & mask)
+            break;
+        w1 = map_ascii_case_word<Op, CharT>(w1);
+        w2 = map_ascii_case_word<Op, CharT>(w2);
+        std::memcpy(out, &w1, sizeof(w1));
+        std::memcpy(out + per_word, &w2, sizeof(w2));
+        first += 2 * per_word;
+        out += 2 * per_word;
+    }
+    while (first != last && is_ascii_unit(*first))
+        *out++ = map_ascii_case<Op>(*first++);
+}
+
+template <typename String, typename = void>
+struct is_resizable_contiguous : std::false_type {};
+
+template <typename String>
+struct is_resizable_contiguous<String, void_t<decltype(std::declval<String&>().resize(std::size_t{})),
+                                              decltype(std::declval<String&>()[0])>>
+    : has_contiguous_data<String> {};
+
+template <case_operation Op, case_mapping Mapping, typename String>
+String map_string_case(const String& str, std::true_type /*resizable contiguous*/)
+{
+    using char_type = range_value_t<String>;
+    constexpr std::ptrdiff_t max_units =
+        max_case_mapping_length * static_cast<std::ptrdiff_t>(4 / sizeof(char_type));
+
+    String result;
+    if (str.size() == 0)
+        return result;
+
+    // The result always has room for the rest of the input mapped one code
+    // unit to one, and for the longest mapping of one more code point. That
+    // holds for as long as no mapping is longer than its input, so most
+    // text is mapped with a single allocation, and the result is made bigger
+    // only after a mapping which is longer.
+    result.resize(str.size() + static_cast<std::size_t>(max_units));
+    const char_type* first = str.data();
+    const char_type* last = first + str.size();
+    char_type* out = &result[0];
+    char_type* out_end = out + result.size();
+    code_point mapped[max_case_mapping_length];
+
+    while (true) {
+        map_ascii_prefix<Op>(first, last, out);
+        if (first == last)
+            break;
+
+        const code_point c = replace_invalid<char_type, char_type>(
+            utf_traits<char_type>::decode(first, last));
+        const int n = map_case<Op, Mapping>(c, mapped);
+        for (int i = 0; i < n; i++)
+            out = utf_traits<char_type>::encode(mapped[i], out);
+
+        if (out_end - out < (last - first) + max_units) {
+            const std::size_t written = static_cast<std::size_t>(out - &result[0]);
+            result.resize(std::max(2 * result.size(),
+                                   written + static_cast<std::size_t>((last - first) + max_units)));
+            out = &result[0] + written;
+            out_end = &result[0] + result.size();
+        }
+    }
+
+    result.resize(static_cast<std::size_t>(out - &result[0]));
+    return result;
+}
+
+template <case_operation Op, case_mapping Mapping, typename String>
+String map_string_case(const String& str, std::false_type /*resizable contiguous*/)
+{
+    using encoding = range_value_t<String>;
+
+    String result;
+    auto out = std::back_inserter(result);
+    auto first = std::cbegin(str);
+    const auto last = std::cend(str);
+    code_point mapped[max_case_mapping_length];
+    while (first != last) {
+        const code_point c = replace_invalid<encoding, encoding>(
+            utf_traits<encoding>::decode(first, last));
+        const int n = map_case<Op, Mapping>(c, mapped);
+        for (int i = 0; i < n; i++)
+            out = utf_traits<encoding>::encode(mapped[i], out);
+    }
+    return result;
+}
+
+template <case_operation Op, typename String>
+String map_string_case(const String& str, case_mapping mapping)
+{
+    return mapping == case_mapping::full
+               ? map_string_case<Op, case_mapping::full>(str, is_resizable_contiguous<String>{})
+               : map_string_case<Op, case_mapping::simple>(str, is_resizable_contiguous<String>{});
+}
+
+///
+/// Reads the full case folding of [first, last) one code point at a time
+///
+template <typename InEncoding, typename Iter, typename Sentinel>
+class case_fold_reader {
+public:
+    case_fold_reader(Iter first, Sentinel last) : first_(first), last_(last) {}
+
+    /// Returns whether the whole of the case folding has been read
+    bool done() const { return pos_ == size_ && first_ == last_; }
+
+    /// Returns whether all of the case folding of the input before
+    /// position() has been read
+    bool at_position() const { return pos_ == size_; }
+
+    Iter& position() { return first_; }
+
+    /// Returns the next code point of the case folding
+    code_point next()
+    {
+        if (pos_ == size_) {
+            const code_point c = replace_invalid<InEncoding, InEncoding>(
+                utf_traits<InEncoding>::decode(first_, last_));
+            pos_ = 0;
+            if (c < 0x80) {
+                folded_[0] = map_ascii_case<case_operation::fold>(c);
+                size_ = 1;
+            }
+            else {
+                size_ = map_case<case_operation::fold, case_mapping::full>(c, folded_);
+            }
+        }
+        return folded_[pos_++];
+    }
+
+private:
+    Iter first_;
+    Sentinel last_;
+    code_point folded_[max_case_mapping_length];
+    int pos_ = 0;
+    int size_ = 0;
+};
+
+template <typename Iter1, typename Sentinel1, typename Iter2, typename Sentinel2>
+void skip_equal_ascii(Iter1&, Sentinel1, Iter2&, Sentinel2)
+{
+}
+
+///
+/// Moves `first1` and `first2` past runs of ASCII with the same case
+/// folding, two machine words at a time where possible
+///
+template <typename CharT>
+void skip_equal_ascii(const CharT*& first1, const CharT* last1,
+                      const CharT*& first2, const CharT* last2)
+{
+    constexpr std::ptrdiff_t per_word = sizeof(std::uint64_t) / sizeof(CharT);
+    constexpr std::uint64_t mask = ascii_word_mask<sizeof(CharT)>::value;
+    constexpr auto fold = case_operation::fold;
+
+    while (last1 - first1 >= 2 * per_word && last2 - first2 >= 2 * per_word) {
+        std::uint64_t a1, a2, b1, b2;
+        std::memcpy(&a1, first1, sizeof(a1));
+        std::memcpy(&a2, first1 + per_word, sizeof(a2));
+        std::memcpy(&b1, first2, sizeof(b1));
+        std::memcpy(&b2, first2 + per_word, sizeof(b2));
+        if ((a1 | a2 | b1 | b2) & mask)
+            break;
+        if ((map_ascii_case_word<fold, CharT>(a1) ^ map_ascii_case_word<fold, CharT>(b1)) |
+            (map_ascii_case_word<fold, CharT>(a2) ^ map_ascii_case_word<fold, CharT>(b2)))
+            break;
+        first1 += 2 * per_word;
+        first2 += 2 * per_word;
+    }
+    while (first1 != last1 && first2 != last2 && is_ascii_unit(*first1) &&
+           is_ascii_unit(*first2) && map_ascii_case<fold>(*first1) == map_ascii_case<fold>(*first2)) {
+        ++first1;
+        ++first2;
+    }
+}
+
+///
+/// Compares the case foldings of [first1, last1) and [first2, last2) code
+/// point by code point, returning a negative number, zero or a positive
+/// number as the first is less than, equal to or greater than the second
+///
+template <typename Encoding1, typename Encoding2, typename Iter1, typename Sentinel1,
+          typename Iter2, typename Sentinel2>
+int compare_folded(Iter1 first1, Sentinel1 last1, Iter2 first2, Sentinel2 last2)
+{
+    case_fold_reader<Encoding1, Iter1, Sentinel1> lhs(first1, last1);
+    case_fold_reader<Encoding2, Iter2, Sentinel2> rhs(first2, last2);
+    while (true) {
+        if (lhs.at_position() && rhs.at_position())
+            skip_equal_ascii(lhs.position(), last1, rhs.position(), last2);
+
+        if (lhs.done() || rhs.done())
+            return lhs.done() ? (rhs.done() ? 0 : -1) : 1;
+        const code_point a = lhs.next();
+        const code_point b = rhs.next();
+        if (a != b)
+            return a < b ? -1 : 1;
+    }
+}
+
+///
+/// Hashes the UTF-8 encoding of a sequence of code points, eight bytes at a
+/// time, so that text hashes alike whatever its encoding
+///
+class case_fold_hasher {
+public:
+    void append_byte(unsigned char b)
+    {
+        buffer_ |= std::uint64_t{b} << (8 * fill_);
+        if (++fill_ == 8) {
+            mix(buffer_);
+            buffer_ = 0;
+            fill_ = 0;
+        }
+        ++length_;
+    }
+
+    /// Appends eight bytes, packed in little-endian order
+    void append_word(std::uint64_t w)
+    {
+        mix(buffer_ | (w << (8 * fill_)));
+        buffer_ = fill_ == 0 ? 0 : w >> (64 - 8 * fill_);
+        length_ += 8;
+    }
+
+    void append(code_point c)
+    {
+        if (c < 0x80) {
+            append_byte(static_cast<unsigned char>(c));
+            return;
+        }
+        char units[4];
+        const char* const end = utf_traits<char>::encode(c, units);
+        for (const char* p = units; p != end; ++p)
+            append_byte(static_cast<unsigned char>(*p));
+    }
+
+    std::size_t result() const
+    {
+        // The final mix of MurmurHash3
+        std::uint64_t h = ((state_ ^ buffer_) * multiplier) ^ length_;
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDu;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53u;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+private:
+    static constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15u;
+
+    void mix(std::uint64_t w)
+    {
+        state_ = (state_ ^ w) * multiplier;
+        state_ ^= state_ >> 32;
+    }
+
+    std::uint64_t state_ = 0;
+    std::uint64_t buffer_ = 0;
+    std::uint64_t length_ = 0;
+    unsigned fill_ = 0;
+};
+
+template <typename Iter, typename Sentinel>
+void hash_ascii_prefix(Iter&, Sentinel, case_fold_hasher&)
+{
+}
+
+/// Hashes the case folding of the ASCII code units at the start of
+/// [first, last), a machine word at a time for UTF-8
+template <typename CharT>
+void hash_ascii_prefix(const CharT*& first, const CharT* last, case_fold_hasher& hasher)
+{
+    if (sizeof(CharT) == 1 && native_little_endian) {
+        constexpr std::uint64_t mask = ascii_word_mask<sizeof(CharT)>::value;
+        while (last - first >= 8) {
+            std::uint64_t w;
+            std::memcpy(&w, first, sizeof(w));
+            if (w & mask)
+                break;
+            hasher.append_word(map_ascii_case_word<case_operation::fold, CharT>(w));
+            first += 8;
+        }
+    }
+    while (first != last && is_ascii_unit(*first))
+        hasher.append_byte(static_cast<unsigned char>(map_ascii_case<case_operation::fold>(*first++)));
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel>
+std::size_t hash_folded(Iter first, Sentinel last)
+{
+    case_fold_hasher hasher;
+    code_point folded[max_case_mapping_length];
+    while (true) {
+        hash_ascii_prefix(first, last, hasher);
+        if (first == last)
+            break;
+        const code_point c = replace_invalid<InEncoding, InEncoding>(
+            utf_traits<InEncoding>::decode(first, last));
+        const int n = map_case<case_operation::fold, case_mapping::full>(c, folded);
+        for (int i = 0; i < n; i++)
+            hasher.append(folded[i]);
+    }
+    return hasher.result();
+}
+
+template <typename String>
+std::size_t hash_string_folded(const String& str, std::true_type /*contiguous*/)
+{
+    return hash_folded<range_value_t<String>>(str.data(), str.data() + str.size());
+}
+
+template <typename String>
+std::size_t hash_string_folded(const String& str, std::false_type /*contiguous*/)
+{
+    return hash_folded<range_value_t<String>>(std::cbegin(str), std::cend(str));
+}
+
+template <typename String>
+int compare_strings_folded(const String& lhs, const String& rhs, std::true_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+    return compare_folded<encoding, encoding>(lhs.data(), lhs.data() + lhs.size(),
+                                              rhs.data(), rhs.data() + rhs.size());
+}
+
+template <typename String>
+int compare_strings_folded(const String& lhs, const String& rhs, std::false_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+    return compare_folded<encoding, encoding>(std::cbegin(lhs), std::cend(lhs),
+                                              std::cbegin(rhs), std::cend(rhs));
+}
+
+template <typename String>
+int compare_strings_folded(const String& lhs, const range_value_t<String>* rhs,
+                           std::true_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+    return compare_folded<encoding, encoding>(
+        lhs.data(), lhs.data() + lhs.size(),
+        rhs, rhs + std::char_traits<encoding>::length(rhs));
+}
+
+template <typename String>
+int compare_strings_folded(const String& lhs, const range_value_t<String>* rhs,
+                           std::false_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+    return compare_folded<encoding, encoding>(
+        std::cbegin(lhs), std::cend(lhs),
+        rhs, rhs + std::char_traits<encoding>::length(rhs));
+}
+
+} // end namespace detail
+
+/// Returns the simple lowercase mapping of `c`
+constexpr char32_t simple_lowercase(char32_t c)
+{
+    return detail::simple_case_mapping<detail::case_operation::lower>(c);
+}
+
+/// Returns the simple uppercase mapping of `c`
+constexpr char32_t simple_uppercase(char32_t c)
+{
+    return detail::simple_case_mapping<detail::case_operation::upper>(c);
+}
+
+/// Returns the simple case folding of `c`
+constexpr char32_t simple_case_fold(char32_t c)
+{
+    return detail::simple_case_mapping<detail::case_operation::fold>(c);
+}
+
+/// Returns `str` in lowercase
+template <typename String>
+String to_lower(const String& str, case_mapping mapping = case_mapping::full)
+{
+    return detail::map_string_case<detail::case_operation::lower>(str, mapping);
+}
+
+/// Returns `str` in uppercase
+template <typename String>
+String to_upper(const String& str, case_mapping mapping = case_mapping::full)
+{
+    return detail::map_string_case<detail::case_operation::upper>(str, mapping);
+}
+
+///
+/// Returns the case folding of `str`: strings which differ only in case
+/// have the same case folding
+///
+template <typename String>
+String case_fold(const String& str, case_mapping mapping = case_mapping::full)
+{
+    return detail::map_string_case<detail::case_operation::fold>(str, mapping);
+}
+
+///
+/// Compares the case foldings of [first1, last1) and [first2, last2), which
+/// may be in different encodings, code point by code point. Returns a
+/// negative number, zero or a positive number as the first is less than,
+/// equal to or greater than the second.
+///
+template <typename Iter1, typename Sentinel1, typename Iter2, typename Sentinel2>
+int compare_ignore_case(Iter1 first1, Sentinel1 last1, Iter2 first2, Sentinel2 last2)
+{
+    return detail::compare_folded<detail::iter_value_t<Iter1>, detail::iter_value_t<Iter2>>(
+        first1, last1, first2, last2);
+}
+
+template <typename String>
+int compare_ignore_case(const String& lhs, const String& rhs)
+{
+    return detail::compare_strings_folded(lhs, rhs, detail::has_contiguous_data<String>{});
+}
+
+template <typename String>
+int compare_ignore_case(const String& lhs, const detail::range_value_t<String>* rhs)
+{
+    return detail::compare_strings_folded(lhs, rhs, detail::has_contiguous_data<String>{});
+}
+
+///
+/// Returns whether [first1, last1) and [first2, last2) have the same case
+/// folding, so that "Straße" is equal to "STRASSE"
+///
+template <typename Iter1, typename Sentinel1, typename Iter2, typename Sentinel2>
+bool equal_ignore_case(Iter1 first1, Sentinel1 last1, Iter2 first2, Sentinel2 last2)
+{
+    return compare_ignore_case(first1, last1, first2, last2) == 0;
+}
+
+template <typename String>
+bool equal_ignore_case(const String& lhs, const String& rhs)
+{
+    return compare_ignore_case(lhs, rhs) == 0;
+}
+
+template <typename String>
+bool equal_ignore_case(const String& lhs, const detail::range_value_t<String>* rhs)
+{
+    return compare_ignore_case(lhs, rhs) == 0;
+}
+
+///
+/// Returns a hash of the case folding of [first, last), which is the same
+/// for text which is equal ignoring case, whatever its encoding
+///
+template <typename Iter, typename Sentinel>
+std::size_t hash_ignore_case(Iter first, Sentinel last)
+{
+    return detail::hash_folded<detail::iter_value_t<Iter>>(first, last);
+}
+
+template <typename String>
+std::size_t hash_ignore_case(const String& str)
+{
+    return detail::hash_string_folded(str, detail::has_contiguous_data<String>{});
+}
+
+///
+/// Function objects for unordered and ordered containers whose keys are
+/// compared ignoring case, as in
+///
+///     std::unordered_map<std::string, int, ignore_case_hash, ignore_case_equal_to>
+///
+struct ignore_case_hash {
+    template <typename String>
+    std::size_t operator()(const String& str) const
+    {
+        return hash_ignore_case(str);
+    }
+};
+
+struct ignore_case_equal_to {
+    template <typename String>
+    bool operator()(const String& lhs, const String& rhs) const
+    {
+        return equal_ignore_case(lhs, rhs);
+    }
+};
+
+struct ignore_case_less {
+    template <typename String>
+    bool operator()(const String& lhs, const String& rhs) const
+    {
+        return compare_ignore_case(lhs, rhs) < 0;
+    }
+};
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,439 @@
+
+#ifndef TCB_UNICODE_CJK_HPP_INCLUDED
+#define TCB_UNICODE_CJK_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/cjk_tables.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Encoding tags for the multi-byte East Asian legacy encodings. Like
+/// `latin1`, these may be used wherever a code unit type is accepted, for
+/// example `to_u8string<shift_jis>(str)` or `to_multibyte<gb18030>(u16str)`.
+/// Ill-formed or unmapped byte sequences decode to U+FFFD, and code points
+/// which the encoding cannot represent are encoded as '?'.
+///
+
+/// Shift_JIS: JIS X 0201 single bytes (ASCII and halfwidth katakana) and
+/// JIS X 0208 double bytes
+struct shift_jis {};
+
+/// GB18030, which includes GBK as its one- and two-byte subset, and
+/// represents every other code point with four bytes
+struct gb18030 {};
+
+/// EUC-KR: ASCII and KS X 1001 double bytes
+struct euc_kr {};
+
+namespace detail {
+
+template <>
+struct is_encoding_tag<shift_jis> : std::true_type {};
+
+template <>
+struct is_encoding_tag<gb18030> : std::true_type {};
+
+template <>
+struct is_encoding_tag<euc_kr> : std::true_type {};
+
+template <typename Table>
+inline char16_t cjk_table_decode(std::uint16_t key)
+{
+    constexpr int shift = Table::decode_shift;
+    return Table::decode_data()[(Table::decode_index()[key >> shift] << shift) +
+                                (key & ((1u << shift) - 1))];
+}
+
+template <typename Table>
+inline std::uint16_t cjk_table_encode(code_point u)
+{
+    constexpr int shift = Table::encode_shift;
+    return Table::encode_data()[(Table::encode_index()[u >> shift] << shift) +
+                                (u & ((1u << shift) - 1))];
+}
+
+///
+/// Writes the one- or two-byte code `code` to `out`, or '?' if it is zero
+///
+template <typename It>
+It put_cjk_code(std::uint16_t code, It out)
+{
+    if (code == 0) {
+        *out++ = '?';
+    }
+    else if (code > 0xFF) {
+        *out++ = static_cast<char>(code >> 8);
+        *out++ = static_cast<char>(code & 0xFF);
+    }
+    else {
+        *out++ = static_cast<char>(code);
+    }
+    return out;
+}
+
+inline encoded_chars<char> cjk_code_chars(std::uint16_t code)
+{
+    if (code == 0)
+        return {'?'};
+    if (code > 0xFF)
+        return {static_cast<char>(code >> 8), static_cast<char>(code & 0xFF)};
+    return {static_cast<char>(code)};
+}
+
+///
+/// Traits shared by the double-byte encodings, which differ only in their
+/// tables and the byte ranges of their lead and trail bytes
+///
+template <typename Table, typename Ranges>
+struct double_byte_traits {
+    typedef char char_type;
+
+    static constexpr int trail_length(char_type c)
+    {
+        return Ranges::is_double_lead(static_cast<unsigned char>(c)) ? 1 : 0;
+    }
+
+    // The trail byte ranges overlap the lead byte (and for Shift_JIS,
+    // the ASCII) ranges, so a byte cannot be classified on its own
+    static constexpr bool is_trail(char_type /*c*/)
+    {
+        return false;
+    }
+
+    static constexpr bool is_lead(char_type /*c*/)
+    {
+        return true;
+    }
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        if (current == last)
+            return incomplete;
+
+        const unsigned char lead = static_cast<unsigned char>(*current++);
+        if (lead < 0x80)
+            return lead;
+
+        if (!Ranges::is_double_lead(lead)) {
+            const code_point c = cjk_table_decode<Table>(lead);
+            return c == replacement_character ? illegal : c;
+        }
+
+        if (current == last)
+            return incomplete;
+
+        const unsigned char trail = static_cast<unsigned char>(*current);
+        if (!Ranges::is_trail(trail))
+            return illegal;
+
+        const code_point c = cjk_table_decode<Table>(
+            static_cast<std::uint16_t>((lead << 8) | trail));
+        // As in the WHATWG decoders, an ASCII byte following a lead byte
+        // is left to be decoded by itself if the pair is unmapped
+        if (c == replacement_character) {
+            if (trail >= 0x80)
+                ++current;
+            return illegal;
+        }
+        ++current;
+        return c;
+    }
+
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        const unsigned char lead = static_cast<unsigned char>(*current++);
+        if (lead < 0x80)
+            return lead;
+        if (!Ranges::is_double_lead(lead))
+            return cjk_table_decode<Table>(lead);
+        const unsigned char trail = static_cast<unsigned char>(*current++);
+        return cjk_table_decode<Table>(static_cast<std::uint16_t>((lead << 8) | trail));
+    }
+
+    static constexpr int max_width = 2;
+
+    static int width(code_point u)
+    {
+        if (u < 0x80)
+            return 1;
+        const std::uint16_t code = u <= 0xFFFF ? cjk_table_encode<Table>(u) : 0;
+        return code > 0xFF ? 2 : 1;
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        if (u < 0x80) {
+            *out++ = static_cast<char>(u);
+            return out;
+        }
+        return put_cjk_code(u <= 0xFFFF ? cjk_table_encode<Table>(u) : 0, out);
+    }
+
+    static encoded_chars<char_type> encode(code_point u)
+    {
+        if (u < 0x80)
+            return {static_cast<char>(u)};
+        return cjk_code_chars(u <= 0xFFFF ? cjk_table_encode<Table>(u) : 0);
+    }
+};
+
+struct shift_jis_ranges {
+    static constexpr bool is_double_lead(unsigned char b)
+    {
+        return (b >= 0x81 && b <= 0x9F) || (b >= 0xE0 && b <= 0xFC);
+    }
+
+    static constexpr bool is_trail(unsigned char b)
+    {
+        return b >= 0x40 && b <= 0xFC && b != 0x7F;
+    }
+};
+
+struct euc_kr_ranges {
+    static constexpr bool is_double_lead(unsigned char b)
+    {
+        return b >= 0xA1 && b <= 0xFE;
+    }
+
+    static constexpr bool is_trail(unsigned char b)
+    {
+        return b >= 0xA1 && b <= 0xFE;
+    }
+};
+
+template <>
+struct utf_traits<shift_jis, 1> : double_byte_traits<shift_jis_table, shift_jis_ranges> {};
+
+template <>
+struct utf_traits<euc_kr, 1> : double_byte_traits<euc_kr_table, euc_kr_ranges> {};
+
+// GB18030 four-byte codes are numbered consecutively from 81 30 81 30
+constexpr std::uint32_t gb18030_linear(unsigned b1, unsigned b2, unsigned b3, unsigned b4)
+{
+    return (((b1 - 0x81) * 10 + (b2 - 0x30)) * 126 + (b3 - 0x81)) * 10 + (b4 - 0x30);
+}
+
+// The linear index of the first supplementary plane code, 90 30 81 30
+constexpr std::uint32_t gb18030_supplementary_base = gb18030_linear(0x90, 0x30, 0x81, 0x30);
+
+inline code_point gb18030_four_byte_decode(std::uint32_t linear)
+{
+    if (linear >= gb18030_supplementary_base) {
+        const std::uint32_t c = linear - gb18030_supplementary_base + 0x10000;
+        return c <= 0x10FFFF ? c : illegal;
+    }
+
+    const std::uint32_t* ranges = gb18030_table::four_byte_ranges();
+    const std::size_t n = gb18030_table::four_byte_ranges_size;
+
+    // Find the last run starting at or before linear
+    std::size_t lo = 0, hi = n;
+    while (lo < hi) {
+        const std::size_t mid = (lo + hi) / 2;
+        if (ranges[3 * mid] <= linear)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return illegal;
+    const std::uint32_t* run = ranges + 3 * (lo - 1);
+    if (linear - run[0] >= run[2])
+        return illegal;
+    return run[1] + (linear - run[0]);
+}
+
+inline std::uint32_t gb18030_four_byte_encode(code_point u)
+{
+    if (u >= 0x10000)
+        return u - 0x10000 + gb18030_supplementary_base;
+
+    const std::uint32_t* ranges = gb18030_table::four_byte_ranges();
+    const std::size_t n = gb18030_table::four_byte_ranges_size;
+
+    std::size_t lo = 0, hi = n;
+    while (lo < hi) {
+        const std::size_t mid = (lo + hi) / 2;
+        if (ranges[3 * mid + 1] <= u)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return 0;
+    const std::uint32_t* run = ranges + 3 * (lo - 1);
+    return run[0] + (u - run[1]);
+}
+
+template <>
+struct utf_traits<gb18030, 1> {
+    typedef char char_type;
+
+    static constexpr int trail_length(char_type c)
+    {
+        return static_cast<unsigned char>(c) >= 0x81 &&
+               static_cast<unsigned char>(c) <= 0xFE ? 1 : 0;
+    }
+
+    static constexpr bool is_trail(char_type /*c*/)
+    {
+        return false;
+    }
+
+    static constexpr bool is_lead(char_type /*c*/)
+    {
+        return true;
+    }
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        if (current == last)
+            return incomplete;
+
+        const unsigned char b1 = static_cast<unsigned char>(*current++);
+        if (b1 < 0x80)
+            return b1;
+        if (b1 == 0x80 || b1 == 0xFF)
+            return illegal;
+
+        if (current == last)
+            return incomplete;
+        const unsigned char b2 = static_cast<unsigned char>(*current);
+
+        if (b2 >= 0x30 && b2 <= 0x39) {
+            // Four-byte code: on failure, only the first byte is consumed
+            // A truncated code at the end of the input is consumed whole
+            It p = current;
+            ++p;
+            if (p == last) {
+                current = p;
+                return incomplete;
+            }
+            const unsigned char b3 = static_cast<unsigned char>(*p);
+            if (b3 < 0x81 || b3 == 0xFF)
+                return illegal;
+            ++p;
+            if (p == last) {
+                current = p;
+                return incomplete;
+            }
+            const unsigned char b4 = static_cast<unsigned char>(*p);
+            if (b4 < 0x30 || b4 > 0x39)
+                return illegal;
+            current = ++p;
+            return gb18030_four_byte_decode(gb18030_linear(b1, b2, b3, b4));
+        }
+
+        if (b2 < 0x40 || b2 == 0x7F || b2 == 0xFF)
+            return illegal;
+
+        const code_point c = cjk_table_decode<gb18030_table>(
+            static_cast<std::uint16_t>((b1 << 8) | b2));
+        if (c == replacement_character) {
+            if (b2 >= 0x80)
+                ++current;
+            return illegal;
+        }
+        ++current;
+        return c;
+    }
+
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        const unsigned char b1 = static_cast<unsigned char>(*current++);
+        if (b1 < 0x80)
+            return b1;
+        const unsigned char b2 = static_cast<unsigned char>(*current++);
+        if (b2 > 0x39)
+            return cjk_table_decode<gb18030_table>(static_cast<std::uint16_t>((b1 << 8) | b2));
+        const unsigned char b3 = static_cast<unsigned char>(*current++);
+        const unsigned char b4 = static_cast<unsigned char>(*current++);
+        return gb18030_four_byte_decode(gb18030_linear(b1, b2, b3, b4));
+    }
+
+    static constexpr int max_width = 4;
+
+    static int width(code_point u)
+    {
+        if (u < 0x80)
+            return 1;
+        if (u <= 0xFFFF && cjk_table_encode<gb18030_table>(u) != 0)
+            return 2;
+        return 4;
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        const encoded_chars<char_type> chars = encode(u);
+        for (int i = 0; i < chars.size(); i++) {
+            *out++ = chars[i];
+        }
+        return out;
+    }
+
+    static encoded_chars<char_type> encode(code_point u)
+    {
+        if (u < 0x80)
+            return {static_cast<char>(u)};
+
+        if (u <= 0xFFFF) {
+            const std::uint16_t code = cjk_table_encode<gb18030_table>(u);
+            if (code != 0)
+                return cjk_code_chars(code);
+            if (u >= 0xD800 && u <= 0xDFFF)
+                return {'?'};
+        }
+        else if (u > 0x10FFFF) {
+            return {'?'};
+        }
+
+        std::uint32_t linear = gb18030_four_byte_encode(u);
+        const char b4 = static_cast<char>(0x30 + linear % 10);
+        linear /= 10;
+        const char b3 = static_cast<char>(0x81 + linear % 126);
+        linear /= 126;
+        const char b2 = static_cast<char>(0x30 + linear % 10);
+        const char b1 = static_cast<char>(0x81 + linear / 10);
+        return {b1, b2, b3, b4};
+    }
+
+}; // gb18030
+
+} // end namespace detail
+
+///
+/// Converts UTF-8, UTF-16 or UTF-32 text to the multi-byte encoding given by
+/// `Encoding`, replacing code points which it cannot represent with '?'
+///
+template <typename Encoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<Encoding>::value>>
+std::string to_multibyte(InputIt first, Sentinel last)
+{
+    return to_utf_string<Encoding>(first, last);
+}
+
+template <typename Encoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<Encoding>::value>>
+std::string to_multibyte(const String& str)
+{
+    return detail::to_utf_string_range<Encoding, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
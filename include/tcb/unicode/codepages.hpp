@@ -0,0 +1,252 @@
+
+#ifndef TCB_UNICODE_CODEPAGES_HPP_INCLUDED
+#define TCB_UNICODE_CODEPAGES_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/codepage_tables.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Encoding tag for an ASCII-compatible single-byte code page described by
+/// `Table` (see detail/codepage_tables.hpp). Like `latin1`, it may be used
+/// wherever a code unit type is accepted, for example
+/// `to_u8string<windows1252>(str)` or `as_utf16<koi8_r>(str)`. Bytes which
+/// the code page leaves undefined decode to U+FFFD, and code points which
+/// the code page cannot represent are encoded as '?'.
+///
+template <typename Table>
+struct codepage {};
+
+using windows874 = codepage<detail::cp874_table>;
+using windows1250 = codepage<detail::cp1250_table>;
+using windows1251 = codepage<detail::cp1251_table>;
+using windows1252 = codepage<detail::cp1252_table>;
+using windows1253 = codepage<detail::cp1253_table>;
+using windows1254 = codepage<detail::cp1254_table>;
+using windows1255 = codepage<detail::cp1255_table>;
+using windows1256 = codepage<detail::cp1256_table>;
+using windows1257 = codepage<detail::cp1257_table>;
+using windows1258 = codepage<detail::cp1258_table>;
+using iso8859_2 = codepage<detail::iso8859_2_table>;
+using iso8859_3 = codepage<detail::iso8859_3_table>;
+using iso8859_4 = codepage<detail::iso8859_4_table>;
+using iso8859_5 = codepage<detail::iso8859_5_table>;
+using iso8859_6 = codepage<detail::iso8859_6_table>;
+using iso8859_7 = codepage<detail::iso8859_7_table>;
+using iso8859_8 = codepage<detail::iso8859_8_table>;
+using iso8859_9 = codepage<detail::iso8859_9_table>;
+using iso8859_10 = codepage<detail::iso8859_10_table>;
+using iso8859_11 = codepage<detail::iso8859_11_table>;
+using iso8859_13 = codepage<detail::iso8859_13_table>;
+using iso8859_14 = codepage<detail::iso8859_14_table>;
+using iso8859_15 = codepage<detail::iso8859_15_table>;
+using iso8859_16 = codepage<detail::iso8859_16_table>;
+using koi8_r = codepage<detail::koi8_r_table>;
+using koi8_u = codepage<detail::koi8_u_table>;
+
+namespace detail {
+
+template <typename Table>
+struct is_encoding_tag<codepage<Table>> : std::true_type {};
+
+///
+/// Returns the byte for code point `u` in the code page, or '?'
+///
+template <typename Table>
+inline char codepage_encode(code_point u)
+{
+    if (u < 0x80)
+        return static_cast<char>(u);
+
+    const std::uint32_t* first = Table::from_unicode();
+    const std::uint32_t* last = first + Table::from_unicode_size;
+    const std::uint32_t key = u << 8;
+    const std::uint32_t* it = std::lower_bound(first, last, key);
+    if (it != last && (*it >> 8) == u)
+        return static_cast<char>(*it & 0xFF);
+    return '?';
+}
+
+template <typename Table>
+struct utf_traits<codepage<Table>, 1> {
+    typedef char char_type;
+
+    static constexpr int trail_length(char_type /*c*/)
+    {
+        return 0;
+    }
+
+    static constexpr bool is_trail(char_type /*c*/)
+    {
+        return false;
+    }
+
+    static constexpr bool is_lead(char_type /*c*/)
+    {
+        return true;
+    }
+
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        return Table::to_unicode()[static_cast<unsigned char>(*current++)];
+    }
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        if (current == last)
+            return incomplete;
+        const code_point c = Table::to_unicode()[static_cast<unsigned char>(*current++)];
+        return c == replacement_character ? illegal : c;
+    }
+
+    static constexpr int max_width = 1;
+
+    static constexpr int width(code_point /*u*/)
+    {
+        return 1;
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        *out++ = codepage_encode<Table>(u);
+        return out;
+    }
+
+    static encoded_chars<char_type> encode(code_point u)
+    {
+        return {codepage_encode<Table>(u)};
+    }
+
+}; // codepage
+
+// Block kernels between code pages and UTF-8, UTF-16 and UTF-32
+
+template <typename Table>
+struct codepage_decoder {
+    // To UTF-16 and UTF-32 every byte is a single table lookup, with no
+    // branches, so the loop can be vectorised
+    template <typename OutCharT>
+    static convert_result<char, OutCharT>
+    convert(const char* first, const char* last, OutCharT* out, bool)
+    {
+        return convert(first, last, out, std::integral_constant<bool, (sizeof(OutCharT) > 1)>{});
+    }
+
+private:
+    template <typename OutCharT>
+    static convert_result<char, OutCharT>
+    convert(const char* first, const char* last, OutCharT* out, std::true_type)
+    {
+        const char16_t* table = Table::to_unicode();
+        const std::size_t n = static_cast<std::size_t>(last - first);
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = static_cast<OutCharT>(table[static_cast<unsigned char>(first[i])]);
+        }
+        return {last, out + n};
+    }
+
+    // To UTF-8, ASCII runs are copied a word at a time
+    static convert_result<char, char>
+    convert(const char* first, const char* last, char* out, std::false_type)
+    {
+        const char16_t* table = Table::to_unicode();
+        while (first != last) {
+            const std::size_t n = ascii_prefix_length(first, last);
+            std::memcpy(out, first, n);
+            first += n;
+            out += n;
+
+            while (first != last && !is_ascii_unit(*first)) {
+                out = utf_traits<char>::encode(table[static_cast<unsigned char>(*first++)], out);
+            }
+        }
+        return {last, out};
+    }
+};
+
+template <typename InEncoding, typename Table>
+struct codepage_encoder {
+    template <typename InCharT>
+    static convert_result<InCharT, char>
+    convert(const InCharT* first, const InCharT* last, char* out, bool final)
+    {
+        while (first != last) {
+            const std::size_t n = ascii_prefix_length(first, last);
+            for (std::size_t i = 0; i < n; i++) {
+                out[i] = static_cast<char>(first[i]);
+            }
+            first += n;
+            out += n;
+
+            while (first != last && !is_ascii_unit(*first)) {
+                const InCharT* p = first;
+                const code_point c = utf_traits<InEncoding>::decode(p, last);
+                if (c == incomplete && !final)
+                    return {first, out};
+                *out++ = c == incomplete || c == illegal ? '?' : codepage_encode<Table>(c);
+                first = p;
+            }
+        }
+        return {first, out};
+    }
+};
+
+template <typename Table>
+struct block_converter<codepage<Table>, char> : codepage_decoder<Table> {};
+
+template <typename Table>
+struct block_converter<codepage<Table>, char16_t> : codepage_decoder<Table> {};
+
+template <typename Table>
+struct block_converter<codepage<Table>, char32_t> : codepage_decoder<Table> {};
+
+template <typename Table>
+struct block_converter<codepage<Table>, wchar_t> : codepage_decoder<Table> {};
+
+template <typename Table>
+struct block_converter<char, codepage<Table>> : codepage_encoder<char, Table> {};
+
+template <typename Table>
+struct block_converter<char16_t, codepage<Table>> : codepage_encoder<char16_t, Table> {};
+
+template <typename Table>
+struct block_converter<char32_t, codepage<Table>> : codepage_encoder<char32_t, Table> {};
+
+template <typename Table>
+struct block_converter<wchar_t, codepage<Table>> : codepage_encoder<wchar_t, Table> {};
+
+} // end namespace detail
+
+///
+/// Converts UTF-8, UTF-16 or UTF-32 text to the code page given by
+/// `Encoding`, replacing code points which it cannot represent with '?'
+///
+template <typename Encoding, typename InputIt, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<Encoding>::value>>
+std::string to_codepage(InputIt first, Sentinel last)
+{
+    return to_utf_string<Encoding>(first, last);
+}
+
+template <typename Encoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<Encoding>::value>>
+std::string to_codepage(const String& str)
+{
+    return detail::to_utf_string_range<Encoding, detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
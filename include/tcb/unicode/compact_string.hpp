@@ -0,0 +1,429 @@
+
+#ifndef TCB_UNICODE_COMPACT_STRING_HPP_INCLUDED
+#define TCB_UNICODE_COMPACT_STRING_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// An immutable string of code points, stored with one, two or four bytes
+/// per code point, whichever is the narrowest that can hold every code point
+/// in the string (as in CPython's PEP 393). Mostly-ASCII text takes a
+/// quarter of the memory of a std::u32string, while still offering O(1)
+/// indexing by code point.
+///
+/// Any input encoding accepted by to_u32string() may be used to construct
+/// one; ill-formed input is replaced with U+FFFD. Two-byte storage never
+/// contains surrogates, so it is also valid UTF-16.
+///
+class compact_string {
+public:
+    using value_type = char32_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class const_iterator {
+    public:
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = char32_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        const_iterator() = default;
+
+        char32_t operator*() const { return (*str_)[idx_]; }
+        char32_t operator[](difference_type n) const { return (*str_)[idx_ + n]; }
+
+        const_iterator& operator++() { ++idx_; return *this; }
+        const_iterator operator++(int) { auto tmp = *this; ++idx_; return tmp; }
+        const_iterator& operator--() { --idx_; return *this; }
+        const_iterator operator--(int) { auto tmp = *this; --idx_; return tmp; }
+
+        const_iterator& operator+=(difference_type n) { idx_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { idx_ -= n; return *this; }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.idx_ - rhs.idx_);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ == rhs.idx_; }
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ != rhs.idx_; }
+        friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ < rhs.idx_; }
+        friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ > rhs.idx_; }
+        friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ <= rhs.idx_; }
+        friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.idx_ >= rhs.idx_; }
+
+    private:
+        friend class compact_string;
+
+        const_iterator(const compact_string* str, size_type idx) : str_(str), idx_(idx) {}
+
+        const compact_string* str_ = nullptr;
+        size_type idx_ = 0;
+    };
+
+    using iterator = const_iterator;
+
+    compact_string() noexcept
+    {
+        new (&latin1_) std::string;
+    }
+
+    template <typename InputIt, typename Sentinel,
+              typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    compact_string(InputIt first, Sentinel last)
+        : compact_string()
+    {
+        assign_utf32(to_u32string(first, last));
+    }
+
+    template <typename CharT,
+              typename = std::enable_if_t<std::is_integral<CharT>::value>>
+    compact_string(const CharT* str)
+        : compact_string()
+    {
+        assign_contiguous<CharT>(str, str + std::char_traits<CharT>::length(str));
+    }
+
+    template <typename String,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<String>, compact_string>::value &&
+                                          !std::is_array<String>::value>>
+    explicit compact_string(const String& str)
+        : compact_string()
+    {
+        assign(str, detail::has_contiguous_data<String>{});
+    }
+
+    compact_string(const compact_string& other)
+        : width_(other.width_)
+    {
+        switch (width_) {
+        case 1: new (&latin1_) std::string(other.latin1_); break;
+        case 2: new (&ucs2_) std::u16string(other.ucs2_); break;
+        default: new (&ucs4_) std::u32string(other.ucs4_); break;
+        }
+    }
+
+    compact_string(compact_string&& other) noexcept
+        : width_(other.width_)
+    {
+        switch (width_) {
+        case 1: new (&latin1_) std::string(std::move(other.latin1_)); break;
+        case 2: new (&ucs2_) std::u16string(std::move(other.ucs2_)); break;
+        default: new (&ucs4_) std::u32string(std::move(other.ucs4_)); break;
+        }
+    }
+
+    compact_string& operator=(const compact_string& other)
+    {
+        if (this != &other) {
+            compact_string tmp{other};
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    compact_string& operator=(compact_string&& other) noexcept
+    {
+        if (this != &other) {
+            destroy();
+            width_ = other.width_;
+            switch (width_) {
+            case 1: new (&latin1_) std::string(std::move(other.latin1_)); break;
+            case 2: new (&ucs2_) std::u16string(std::move(other.ucs2_)); break;
+            default: new (&ucs4_) std::u32string(std::move(other.ucs4_)); break;
+            }
+        }
+        return *this;
+    }
+
+    ~compact_string()
+    {
+        destroy();
+    }
+
+    /// Returns the number of code points
+    size_type size() const noexcept
+    {
+        switch (width_) {
+        case 1: return latin1_.size();
+        case 2: return ucs2_.size();
+        default: return ucs4_.size();
+        }
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    /// Returns the number of bytes used to store each code point: 1, 2 or 4
+    int width() const noexcept { return width_; }
+
+    /// Returns the code point at index `i`, which must be less than size()
+    char32_t operator[](size_type i) const noexcept
+    {
+        switch (width_) {
+        case 1: return static_cast<unsigned char>(latin1_[i]);
+        case 2: return ucs2_[i];
+        default: return ucs4_[i];
+        }
+    }
+
+    const_iterator begin() const noexcept { return {this, 0}; }
+    const_iterator end() const noexcept { return {this, size()}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /// Calls `f` with a pointer to the stored code points and their number.
+    /// The pointer is a `const char*` of Latin-1, `const char16_t*` of UCS-2
+    /// or `const char32_t*` of UTF-32, depending on width().
+    template <typename Func>
+    decltype(auto) visit(Func&& f) const
+    {
+        switch (width_) {
+        case 1: return std::forward<Func>(f)(latin1_.data(), latin1_.size());
+        case 2: return std::forward<Func>(f)(ucs2_.data(), ucs2_.size());
+        default: return std::forward<Func>(f)(ucs4_.data(), ucs4_.size());
+        }
+    }
+
+    friend bool operator==(const compact_string& lhs, const compact_string& rhs)
+    {
+        // Storage is always as narrow as possible, so equal strings are
+        // stored with the same width
+        if (lhs.width_ != rhs.width_)
+            return false;
+        switch (lhs.width_) {
+        case 1: return lhs.latin1_ == rhs.latin1_;
+        case 2: return lhs.ucs2_ == rhs.ucs2_;
+        default: return lhs.ucs4_ == rhs.ucs4_;
+        }
+    }
+
+    friend bool operator!=(const compact_string& lhs, const compact_string& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    void destroy() noexcept
+    {
+        switch (width_) {
+        case 1: latin1_.~basic_string(); break;
+        case 2: ucs2_.~basic_string(); break;
+        default: ucs4_.~basic_string(); break;
+        }
+    }
+
+    void set_width(int width)
+    {
+        destroy();
+        width_ = static_cast<unsigned char>(width);
+        switch (width_) {
+        case 1: new (&latin1_) std::string; break;
+        case 2: new (&ucs2_) std::u16string; break;
+        default: new (&ucs4_) std::u32string; break;
+        }
+    }
+
+    template <typename String>
+    void assign(const String& str, std::false_type)
+    {
+        assign_utf32(to_u32string(str));
+    }
+
+    template <typename String>
+    void assign(const String& str, std::true_type)
+    {
+        assign_contiguous<detail::range_value_t<String>>(str.data(), str.data() + str.size());
+    }
+
+    template <typename InEncoding, typename CharT>
+    void assign_contiguous(const CharT* first, const CharT* last)
+    {
+        constexpr int kind = detail::is_encoding_tag<InEncoding>::value ? 0 : sizeof(CharT);
+        assign_contiguous<InEncoding>(first, last, std::integral_constant<int, kind>{});
+    }
+
+    template <typename InEncoding, typename CharT>
+    void assign_contiguous(const CharT* first, const CharT* last, std::integral_constant<int, 0>)
+    {
+        if (std::is_same<InEncoding, latin1>::value) {
+            latin1_.assign(first, last);
+        }
+        else {
+            assign_utf32(detail::to_utf_string_contiguous<char32_t, InEncoding>(first, last));
+        }
+    }
+
+    // UTF-8: pure ASCII is copied directly; otherwise decode to UTF-16
+    // with the block kernels, and narrow or widen from there
+    template <typename InEncoding, typename CharT>
+    void assign_contiguous(const CharT* first, const CharT* last, std::integral_constant<int, 1>)
+    {
+        const auto n = static_cast<std::size_t>(last - first);
+        if (detail::ascii_prefix_length(first, last) == n) {
+            latin1_.assign(first, last);
+            return;
+        }
+        const auto u16 = detail::to_utf_string_contiguous<char16_t, InEncoding>(first, last);
+        assign_utf16(u16.data(), u16.data() + u16.size());
+    }
+
+    template <typename InEncoding, typename CharT>
+    void assign_contiguous(const CharT* first, const CharT* last, std::integral_constant<int, 2>)
+    {
+        assign_utf16(first, last);
+    }
+
+    template <typename InEncoding, typename CharT>
+    void assign_contiguous(const CharT* first, const CharT* last, std::integral_constant<int, 4>)
+    {
+        assign_utf32(std::u32string(first, last));
+    }
+
+    // The OR of all the code units bounds their maximum, and like the
+    // surrogate check is a reduction which compilers vectorise
+    template <typename CharT>
+    void assign_utf16(const CharT* first, const CharT* last)
+    {
+        const auto n = static_cast<std::size_t>(last - first);
+        std::uint32_t bits = 0;
+        bool surrogates = false;
+        for (std::size_t i = 0; i < n; i++) {
+            const std::uint32_t c = static_cast<std::uint16_t>(first[i]);
+            bits |= c;
+            surrogates |= (c & 0xF800) == 0xD800;
+        }
+
+        if (surrogates) {
+            assign_utf32(detail::to_utf_string_contiguous<char32_t, char16_t>(
+                reinterpret_cast<const char16_t*>(first), reinterpret_cast<const char16_t*>(last)));
+        }
+        else if (bits <= 0xFF) {
+            set_width(1);
+            narrow_into(latin1_, first, n);
+        }
+        else {
+            set_width(2);
+            narrow_into(ucs2_, first, n);
+        }
+    }
+
+    void assign_utf32(std::u32string&& str)
+    {
+        std::uint32_t bits = 0;
+        for (char32_t c : str) {
+            bits |= c;
+        }
+        // Only now is it worth looking for surrogates and out-of-range values
+        if (bits >= 0xD800) {
+            bits = 0;
+            for (char32_t& c : str) {
+                if (!detail::is_valid_codepoint(c))
+                    c = detail::replacement_character;
+                bits |= c;
+            }
+        }
+
+        if (bits <= 0xFF) {
+            set_width(1);
+            narrow_into(latin1_, str.data(), str.size());
+        }
+        else if (bits <= 0xFFFF) {
+            set_width(2);
+            narrow_into(ucs2_, str.data(), str.size());
+        }
+        else {
+            set_width(4);
+            ucs4_ = std::move(str);
+        }
+    }
+
+    template <typename CharT, typename InCharT>
+    static void narrow_into(std::basic_string<CharT>& out, const InCharT* in, std::size_t n)
+    {
+        out.resize(n);
+        CharT* p = &out[0];
+        for (std::size_t i = 0; i < n; i++) {
+            p[i] = static_cast<CharT>(in[i]);
+        }
+    }
+
+    union {
+        std::string latin1_;
+        std::u16string ucs2_;
+        std::u32string ucs4_;
+    };
+    unsigned char width_ = 1;
+
+    friend std::string to_u8string(const compact_string& str);
+    friend std::u16string to_u16string(const compact_string& str);
+    friend std::u32string to_u32string(const compact_string& str);
+};
+
+///
+/// Conversions from compact_string run a kernel specific to its storage
+/// width over the stored code points, rather than indexing one at a time
+///
+
+inline std::string to_u8string(const compact_string& str)
+{
+    switch (str.width_) {
+    case 1:
+        return detail::to_utf_string_contiguous<char, latin1>(
+            str.latin1_.data(), str.latin1_.data() + str.latin1_.size());
+    case 2:
+        return detail::to_utf_string_contiguous<char, char16_t>(
+            str.ucs2_.data(), str.ucs2_.data() + str.ucs2_.size());
+    default:
+        return detail::to_utf_string_contiguous<char, char32_t>(
+            str.ucs4_.data(), str.ucs4_.data() + str.ucs4_.size());
+    }
+}
+
+inline std::u16string to_u16string(const compact_string& str)
+{
+    switch (str.width_) {
+    case 1:
+        return detail::to_utf_string_contiguous<char16_t, latin1>(
+            str.latin1_.data(), str.latin1_.data() + str.latin1_.size());
+    case 2:
+        return str.ucs2_;
+    default:
+        return detail::to_utf_string_contiguous<char16_t, char32_t>(
+            str.ucs4_.data(), str.ucs4_.data() + str.ucs4_.size());
+    }
+}
+
+inline std::u32string to_u32string(const compact_string& str)
+{
+    switch (str.width_) {
+    case 1:
+        return detail::to_utf_string_contiguous<char32_t, latin1>(
+            str.latin1_.data(), str.latin1_.data() + str.latin1_.size());
+    case 2:
+        return std::u32string(str.ucs2_.begin(), str.ucs2_.end());
+    default:
+        return str.ucs4_;
+    }
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
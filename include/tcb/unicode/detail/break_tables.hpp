@@ -0,0 +1,2259 @@
+
+// Generated by tools/ucdgen.cpp -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_BREAK_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_BREAK_TABLES_HPP_INCLUDED
+
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+/// The Grapheme_Cluster_Break property, with Extended_Pictographic
+enum class grapheme_cluster_break : std::uint8_t {
+    other, ///< Other
+    cr, ///< CR
+    lf, ///< LF
+    control, ///< Control
+    extend, ///< Extend
+    zwj, ///< ZWJ
+    regional_indicator, ///< Regional_Indicator
+    prepend, ///< Prepend
+    spacing_mark, ///< SpacingMark
+    l, ///< L
+    v, ///< V
+    t, ///< T
+    lv, ///< LV
+    lvt, ///< LVT
+    extended_pictographic, ///< Extended_Pictographic
+};
+
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct grapheme_cluster_break_tables {
+    static constexpr int shift1 = 6;
+    static constexpr int shift2 = 3;
+
+    static constexpr std::uint8_t stage1[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+        15, 16, 17, 18, 19, 20, 21, 10, 22, 23, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+        30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 35, 10, 36,
+        37, 38, 10, 10, 10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 53, 10,
+        10, 10, 10, 10, 10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+        58, 59, 10, 10, 60, 10, 10, 10, 61, 62, 63, 64, 65, 66, 67, 68,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        69, 70, 70, 70, 70, 70, 70, 70, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    };
+
+    static constexpr std::uint8_t stage2[4544] = {
+        0, 1, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+        0, 0, 0, 0, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        6, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 8, 5, 5, 5, 5, 9, 10, 2, 2, 2, 2, 2, 2, 2,
+        11, 2, 5, 12, 2, 2, 2, 2, 2, 6, 5, 5, 2, 2, 13, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 15, 16, 17, 2, 2,
+        2, 18, 19, 2, 2, 2, 5, 5, 5, 20, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 14, 5, 13, 2, 2, 2, 2, 2, 2, 6, 21, 22,
+        2, 2, 14, 23, 24, 25, 2, 2, 2, 2, 2, 26, 2, 2, 2, 2,
+        2, 2, 27, 5, 2, 2, 2, 2, 2, 28, 5, 5, 29, 5, 5, 5,
+        30, 2, 2, 2, 2, 2, 2, 31, 32, 33, 8, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 36, 37, 38, 39, 2, 34, 2, 2, 40,
+        41, 2, 2, 2, 2, 2, 2, 42, 43, 44, 19, 2, 2, 2, 45, 2,
+        41, 2, 2, 2, 2, 2, 2, 42, 46, 47, 2, 2, 34, 2, 2, 28,
+        35, 2, 2, 2, 2, 2, 2, 48, 37, 38, 49, 2, 34, 2, 2, 2,
+        50, 2, 2, 2, 2, 2, 2, 51, 52, 53, 39, 2, 2, 2, 2, 2,
+        54, 2, 2, 2, 2, 2, 2, 48, 55, 17, 56, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 57, 58, 59, 56, 2, 34, 2, 2, 2,
+        60, 2, 2, 2, 2, 2, 2, 61, 62, 63, 39, 2, 34, 2, 2, 2,
+        35, 2, 2, 2, 2, 2, 2, 2, 2, 64, 65, 66, 2, 2, 67, 2,
+        2, 2, 2, 2, 2, 2, 68, 20, 39, 69, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 68, 70, 2, 71, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 7, 2, 2, 72, 73, 2, 2, 2, 2, 2, 2, 8, 74,
+        75, 49, 5, 8, 5, 5, 5, 70, 40, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 49, 76, 77, 2, 2, 78, 79, 13, 2, 80, 2,
+        81, 22, 2, 22, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 85, 2, 2, 2, 86, 2, 2, 2, 34, 2, 2, 2, 34, 2,
+        2, 2, 2, 2, 2, 2, 87, 88, 89, 32, 21, 22, 2, 2, 2, 2,
+        2, 90, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        56, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 91, 92, 93, 94, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 39, 95, 2, 2, 2, 2, 2, 2, 96, 69, 97, 98, 99, 16,
+        2, 2, 2, 2, 2, 2, 5, 5, 5, 69, 2, 2, 2, 2, 2, 2,
+        100, 2, 2, 2, 2, 2, 101, 102, 103, 2, 2, 2, 2, 6, 21, 2,
+        104, 2, 2, 2, 105, 106, 2, 2, 2, 2, 2, 2, 51, 107, 60, 2,
+        2, 2, 2, 2, 108, 109, 110, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 5, 76, 112, 113, 7,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5,
+        2, 114, 2, 2, 2, 115, 2, 116, 2, 117, 2, 2, 0, 0, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 13, 2,
+        2, 2, 2, 2, 118, 2, 2, 117, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 119, 120, 2, 121, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 122, 2, 123, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 123, 2, 2, 2, 2, 2, 2, 2, 124, 2, 2, 2, 125, 126, 127,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 118, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 122, 128, 2, 123, 2, 2, 2, 2, 2, 2, 129,
+        130, 131, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        133, 2, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        133, 131, 134, 135, 117, 123, 136, 2, 137, 138, 139, 2, 140, 2, 2, 2,
+        2, 2, 141, 2, 117, 2, 123, 124, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 142, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        141, 2, 2, 136, 2, 2, 2, 2, 2, 2, 143, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 7, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+        2, 2, 2, 2, 2, 28, 123, 135, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 144, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 124, 117, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 111, 71,
+        2, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        145, 146, 2, 2, 147, 148, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        149, 2, 2, 2, 2, 2, 108, 150, 151, 2, 2, 2, 5, 5, 7, 39,
+        2, 2, 2, 2, 14, 71, 2, 2, 39, 5, 60, 2, 82, 82, 82, 152,
+        30, 2, 2, 2, 2, 2, 153, 154, 155, 2, 2, 2, 22, 2, 2, 2,
+        2, 2, 2, 2, 2, 156, 157, 2, 146, 158, 2, 2, 2, 2, 2, 148,
+        2, 2, 2, 2, 2, 2, 159, 160, 19, 2, 2, 2, 2, 161, 162, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 163, 164, 2, 2,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165,
+        166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166,
+        167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166,
+        166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166,
+        165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166,
+        166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167,
+        166, 166, 166, 165, 166, 166, 167, 166, 166, 166, 165, 166, 166, 167, 166, 166,
+        166, 165, 166, 166, 168, 2, 83, 83, 169, 170, 84, 84, 84, 84, 84, 171,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 40, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 2, 2, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 172,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 22,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 20,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        173, 101, 2, 2, 2, 2, 2, 174, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 56, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 101, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 14, 5, 13, 2, 2, 2, 2, 2,
+        176, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        177, 2, 2, 2, 2, 2, 2, 5, 69, 2, 2, 2, 2, 2, 178, 39,
+        104, 2, 2, 2, 2, 2, 179, 180, 50, 181, 2, 2, 2, 2, 2, 2,
+        20, 2, 2, 2, 39, 182, 70, 2, 183, 2, 2, 2, 2, 2, 146, 2,
+        104, 2, 2, 2, 2, 2, 184, 74, 185, 186, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 187, 188, 40, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 99, 20, 2, 2,
+        60, 2, 2, 2, 2, 2, 2, 61, 189, 190, 39, 2, 191, 70, 70, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 192, 5, 193, 2, 2, 40, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 194, 195, 196, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 39, 197, 198, 13, 2, 2, 199, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 99, 200, 13, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 201, 202, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 49, 203, 21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 187, 5, 204, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 205, 206, 207, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 208, 209, 210, 2, 2, 2,
+        8, 20, 2, 2, 2, 2, 6, 211, 39, 2, 156, 94, 2, 2, 2, 2,
+        212, 213, 74, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 214, 69, 202, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 28, 5, 5, 215, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 217, 218, 219, 2, 2, 2, 2, 2, 2, 2,
+        2, 220, 221, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 222, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 0, 223, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 70, 2,
+        2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 39, 224, 150, 150, 150, 150, 150,
+        150, 39, 20, 2, 2, 2, 2, 2, 2, 2, 2, 2, 148, 2, 149, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 56, 172, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 71, 5, 5, 69, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 225, 226, 227, 228,
+        229, 21, 2, 2, 2, 176, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 230, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 5, 69, 6, 5, 5, 5, 5, 5, 70, 22, 2,
+        148, 2, 2, 6, 8, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        69, 5, 5, 231, 232, 20, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 40, 2, 2, 2, 2, 2, 2, 2, 101, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 101, 20, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 141, 2, 2, 2, 124, 2, 2, 2, 2, 2, 2, 2, 119, 120, 233,
+        2, 128, 125, 127, 2, 141, 131, 131, 131, 131, 131, 131, 234, 235, 235, 235,
+        125, 131, 2, 118, 2, 124, 236, 132, 2, 125, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 237,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 133, 233, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 119, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 141, 131, 131, 131, 131, 131,
+        2, 119, 2, 2, 2, 2, 2, 2, 2, 131, 2, 236, 2, 2, 2, 2,
+        2, 131, 2, 2, 2, 233, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 119, 131, 131, 131, 131, 131, 132, 130, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 133,
+        0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr std::uint8_t stage3[1904] = {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+        0, 14, 0, 0, 0, 3, 14, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+        0, 4, 4, 0, 4, 4, 0, 4, 7, 7, 7, 7, 7, 7, 0, 0,
+        4, 4, 4, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+        4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+        0, 4, 4, 4, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4,
+        4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8, 8,
+        8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+        0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 8, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 0, 4, 8, 8, 4, 4, 4, 4, 0, 0, 8,
+        8, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 0, 8, 8, 8, 4, 4, 0, 0, 0, 0, 4,
+        4, 0, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 4, 0, 0,
+        8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+        0, 0, 0, 0, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+        0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8,
+        4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0,
+        4, 8, 8, 8, 4, 0, 0, 0, 4, 8, 8, 8, 8, 0, 4, 4,
+        0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+        8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0,
+        4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+        8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0,
+        0, 0, 4, 0, 0, 0, 0, 4, 8, 8, 4, 4, 4, 0, 4, 0,
+        8, 8, 8, 8, 8, 8, 8, 4, 0, 0, 8, 8, 0, 0, 0, 0,
+        0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8, 8,
+        4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 4, 4,
+        4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4, 4,
+        0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 4, 0, 8, 4, 4, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+        11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 4, 4, 4, 8, 0, 0,
+        0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 4,
+        4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 4, 8,
+        0, 0, 0, 4, 4, 4, 3, 4, 4, 4, 4, 8, 8, 8, 8, 4,
+        4, 8, 8, 8, 0, 0, 0, 0, 8, 8, 4, 8, 8, 8, 8, 8,
+        8, 4, 4, 4, 0, 0, 0, 0, 4, 8, 8, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 8, 4, 8, 4, 0, 4, 0, 0, 4, 4, 4,
+        4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 8, 4, 8, 8, 8, 8, 8, 4, 8, 8, 0, 0, 0,
+        4, 4, 8, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4, 4, 8, 8,
+        4, 4, 8, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 4, 8, 4,
+        0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+        4, 4, 4, 4, 8, 8, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+        4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 8,
+        0, 0, 0, 3, 4, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 14, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 14, 14, 14, 14, 0,
+        14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        14, 14, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+        0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 14,
+        0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 14, 14, 14, 0, 14,
+        0, 0, 0, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 14, 14, 14,
+        0, 0, 0, 0, 14, 14, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0,
+        0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 8,
+        0, 0, 0, 0, 4, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 0, 0,
+        9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 4, 8, 8, 4, 4,
+        4, 4, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 4, 8, 0, 0, 4, 0, 4, 4, 4, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 8, 4, 4, 8, 8,
+        0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 8, 8, 4, 8, 8,
+        4, 8, 8, 0, 8, 4, 0, 0, 12, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+        13, 13, 13, 13, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+        0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+        3, 3, 3, 3, 0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 4, 0,
+        4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 4, 4, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 0, 0, 8, 4, 8, 0, 0, 0, 0, 0,
+        4, 0, 0, 4, 4, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 8,
+        8, 4, 4, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+        4, 4, 4, 4, 8, 4, 4, 4, 0, 0, 0, 0, 0, 8, 8, 0,
+        0, 0, 0, 8, 8, 8, 4, 4, 8, 0, 7, 7, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 0, 8, 4, 0, 0, 0, 0, 8, 8, 8, 4,
+        4, 4, 8, 8, 4, 8, 4, 4, 4, 8, 8, 8, 8, 0, 0, 8,
+        8, 0, 0, 8, 8, 8, 0, 0, 0, 0, 8, 8, 0, 0, 4, 4,
+        0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 4, 4, 4, 8, 4, 0,
+        4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4,
+        4, 8, 4, 4, 0, 0, 0, 0, 8, 8, 4, 4, 4, 4, 0, 0,
+        8, 8, 8, 8, 4, 4, 8, 4, 0, 0, 0, 0, 4, 4, 0, 0,
+        4, 4, 4, 8, 8, 4, 8, 4, 0, 0, 0, 4, 8, 4, 8, 8,
+        4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 4, 4, 4, 4, 8, 4,
+        8, 4, 4, 0, 0, 0, 0, 0, 4, 8, 8, 8, 8, 8, 0, 8,
+        8, 0, 0, 4, 4, 8, 4, 7, 8, 7, 8, 4, 0, 0, 0, 0,
+        0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8,
+        4, 0, 0, 0, 8, 0, 0, 0, 4, 8, 7, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4,
+        4, 8, 4, 4, 8, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+        0, 0, 8, 8, 8, 8, 8, 0, 4, 4, 0, 8, 8, 4, 8, 4,
+        0, 0, 0, 4, 4, 8, 8, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 4, 8, 4,
+        4, 4, 0, 0, 0, 8, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3,
+        3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4,
+        0, 0, 4, 4, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 4,
+        4, 4, 0, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 0, 14, 14,
+        14, 14, 14, 14, 14, 14, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 4, 4, 4, 4, 4,
+    };
+
+    static constexpr std::uint8_t results[15] = {
+        0, 1, 2, 3, 4, 5,
+        6, 7, 8, 9, 10, 11,
+        12, 13, 14,
+    };
+};
+
+template <typename T>
+constexpr int grapheme_cluster_break_tables<T>::shift1;
+
+template <typename T>
+constexpr int grapheme_cluster_break_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t grapheme_cluster_break_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint8_t grapheme_cluster_break_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint8_t grapheme_cluster_break_tables<T>::stage3[];
+
+template <typename T>
+constexpr std::uint8_t grapheme_cluster_break_tables<T>::results[];
+
+constexpr std::uint8_t grapheme_cluster_break_lookup(char32_t c)
+{
+    using t = grapheme_cluster_break_tables<>;
+    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+}
+
+/// The Word_Break property
+enum class word_break : std::uint8_t {
+    other, ///< Other
+    cr, ///< CR
+    lf, ///< LF
+    newline, ///< Newline
+    extend, ///< Extend
+    zwj, ///< ZWJ
+    regional_indicator, ///< Regional_Indicator
+    format, ///< Format
+    katakana, ///< Katakana
+    hebrew_letter, ///< Hebrew_Letter
+    aletter, ///< ALetter
+    single_quote, ///< Single_Quote
+    double_quote, ///< Double_Quote
+    midnumlet, ///< MidNumLet
+    midletter, ///< MidLetter
+    midnum, ///< MidNum
+    numeric, ///< Numeric
+    extendnumlet, ///< ExtendNumLet
+    wsegspace, ///< WSegSpace
+};
+
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct word_break_tables {
+    static constexpr int shift1 = 7;
+    static constexpr int shift2 = 2;
+
+    static constexpr std::uint8_t stage1[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 17, 17, 17, 19, 20, 21, 22, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        23, 23, 24, 25, 26, 27, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+        23, 48, 49, 17, 17, 17, 17, 50, 23, 23, 51, 17, 17, 17, 17, 17,
+        17, 17, 23, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 23, 53, 17, 54, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 55, 56, 17, 17, 17, 17, 17, 57, 17,
+        17, 17, 17, 17, 17, 17, 17, 58, 59, 60, 61, 62, 17, 63, 17, 64,
+        65, 66, 17, 67, 68, 17, 17, 69, 70, 71, 17, 17, 17, 72, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        73, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    };
+
+    static constexpr std::uint8_t stage2[9472] = {
+        0, 0, 1, 2, 0, 0, 0, 0, 3, 4, 0, 5, 6, 6, 7, 0,
+        8, 9, 9, 9, 9, 9, 10, 11, 8, 9, 9, 9, 9, 9, 10, 0,
+        0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 13, 14, 0, 15, 13, 0,
+        9, 9, 9, 9, 9, 10, 9, 9, 9, 9, 9, 9, 9, 10, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 0, 16, 9, 9, 9, 9, 9, 9, 9, 9,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 9, 18, 16, 19,
+        0, 20, 10, 18, 9, 9, 9, 9, 21, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 21, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        22, 17, 23, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 9, 9, 9,
+        9, 9, 9, 9, 9, 10, 8, 24, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 25, 0, 26, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 27,
+        28, 27, 0, 0, 29, 29, 29, 29, 29, 29, 30, 31, 32, 33, 0, 0,
+        34, 35, 0, 36, 17, 17, 37, 38, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 39, 17, 17, 17, 17, 17, 6, 6, 40, 41, 42, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 43, 17, 44, 17, 45, 46, 23, 6, 6, 47, 48,
+        0, 0, 0, 49, 50, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17, 17,
+        17, 17, 37, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 51, 17, 17, 52, 0, 0, 0,
+        6, 6, 47, 9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 53, 54, 55,
+        9, 9, 9, 9, 9, 51, 56, 17, 17, 57, 57, 58, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 57, 0, 9, 9, 10, 0, 9, 9, 9, 9,
+        9, 9, 8, 10, 35, 0, 17, 17, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 51, 17, 17, 17, 17, 17, 59, 17, 17, 17, 17, 17, 17, 17,
+        17, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 51, 60,
+        17, 17, 17, 17, 57, 17, 9, 9, 51, 61, 6, 6, 8, 9, 9, 9,
+        57, 8, 9, 48, 48, 9, 9, 9, 9, 9, 18, 9, 62, 16, 53, 60,
+        17, 63, 63, 64, 0, 65, 0, 21, 51, 61, 6, 6, 53, 0, 0, 66,
+        26, 8, 10, 67, 48, 9, 9, 9, 9, 9, 18, 9, 18, 68, 53, 46,
+        37, 65, 63, 58, 55, 0, 8, 62, 0, 61, 6, 6, 23, 69, 0, 0,
+        26, 8, 9, 21, 21, 9, 9, 9, 9, 9, 18, 9, 18, 8, 53, 60,
+        17, 27, 27, 58, 70, 0, 0, 0, 51, 61, 6, 6, 0, 0, 43, 17,
+        26, 8, 9, 48, 48, 9, 9, 9, 9, 9, 18, 9, 18, 8, 53, 60,
+        17, 63, 63, 58, 0, 26, 0, 21, 51, 61, 6, 6, 71, 0, 0, 0,
+        72, 8, 10, 16, 18, 53, 68, 18, 67, 70, 10, 16, 9, 9, 53, 73,
+        37, 73, 46, 58, 70, 65, 0, 0, 0, 61, 6, 6, 0, 0, 0, 0,
+        17, 42, 9, 18, 18, 9, 9, 9, 9, 9, 18, 9, 9, 9, 53, 60,
+        17, 46, 46, 58, 0, 28, 10, 71, 51, 61, 6, 6, 0, 0, 0, 0,
+        57, 8, 9, 18, 18, 9, 9, 9, 9, 9, 18, 9, 9, 8, 53, 60,
+        17, 46, 46, 58, 0, 28, 0, 68, 51, 61, 6, 6, 68, 0, 0, 0,
+        17, 9, 9, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 60,
+        17, 46, 46, 64, 0, 39, 0, 67, 51, 61, 6, 6, 0, 0, 16, 9,
+        26, 8, 9, 9, 9, 10, 16, 9, 9, 9, 9, 9, 21, 9, 9, 71,
+        9, 10, 74, 65, 17, 75, 17, 17, 0, 61, 6, 6, 73, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 17, 37, 0,
+        0, 65, 17, 37, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 17, 17, 77,
+        0, 0, 17, 58, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        70, 0, 0, 0, 0, 0, 58, 0, 6, 6, 76, 0, 0, 78, 55, 73,
+        9, 9, 8, 9, 9, 9, 9, 9, 9, 9, 9, 70, 26, 17, 17, 17,
+        17, 46, 9, 57, 17, 17, 26, 17, 17, 17, 17, 17, 17, 17, 17, 77,
+        0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 17, 17, 17, 17, 37,
+        6, 6, 76, 0, 0, 73, 58, 73, 46, 63, 17, 58, 26, 77, 0, 0,
+        73, 17, 17, 27, 6, 6, 79, 58, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 21, 0, 71, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 18, 53, 9, 10, 18, 53, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 18, 53, 9, 9, 9, 9, 9, 9, 9, 9, 18, 53, 9, 10,
+        18, 53, 9, 9, 9, 10, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 18, 53, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 10, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 9, 53,
+        8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 48, 9, 9, 9, 9,
+        80, 9, 9, 9, 9, 9, 10, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 16, 9, 9, 70, 0,
+        9, 9, 9, 9, 51, 58, 0, 67, 9, 9, 9, 9, 51, 77, 0, 0,
+        9, 9, 9, 9, 51, 0, 0, 0, 9, 9, 9, 18, 81, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17,
+        17, 17, 17, 17, 17, 0, 0, 55, 6, 6, 76, 0, 0, 0, 0, 0,
+        0, 0, 65, 59, 6, 6, 76, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 0,
+        9, 82, 9, 9, 9, 9, 9, 9, 9, 9, 83, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 10, 17, 17, 17, 0, 17, 17, 17, 0,
+        0, 61, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 39, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 26, 17, 37, 17, 17, 17, 17, 17, 17, 17, 63,
+        6, 6, 76, 0, 6, 6, 76, 0, 0, 0, 0, 0, 17, 17, 17, 17,
+        17, 17, 17, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 42, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17,
+        17, 42, 9, 70, 6, 6, 76, 0, 0, 0, 65, 17, 17, 0, 0, 0,
+        84, 9, 9, 9, 9, 9, 9, 9, 57, 17, 17, 23, 6, 6, 47, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 51, 17, 17, 17, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17, 17, 17, 0, 0,
+        6, 6, 76, 8, 6, 6, 47, 9, 9, 9, 9, 9, 9, 9, 9, 53,
+        9, 9, 70, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 8,
+        0, 0, 0, 0, 37, 17, 17, 17, 17, 17, 42, 50, 9, 45, 64, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 53, 9, 53, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 53, 9, 53, 9, 9, 85, 85, 9, 9, 9, 9, 9, 9, 9, 53,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 9, 62,
+        16, 18, 9, 70, 9, 16, 9, 0, 9, 9, 9, 70, 16, 18, 9, 70,
+        86, 87, 87, 88, 0, 0, 89, 0, 0, 90, 91, 92, 0, 0, 0, 11,
+        93, 94, 0, 0, 0, 93, 0, 95, 34, 96, 34, 34, 71, 0, 0, 67,
+        0, 0, 0, 0, 9, 9, 9, 70, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 77, 0, 0, 0,
+        13, 67, 16, 9, 9, 71, 8, 53, 0, 62, 18, 21, 9, 9, 53, 9,
+        0, 8, 53, 13, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 67, 39, 23, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 21, 0, 71, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 67, 0, 0, 0, 65,
+        9, 9, 9, 9, 9, 10, 0, 0, 9, 10, 9, 10, 9, 10, 9, 10,
+        9, 10, 9, 10, 9, 10, 9, 10, 17, 17, 17, 17, 17, 17, 17, 17,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        97, 71, 0, 0, 0, 0, 0, 0, 0, 0, 73, 17, 98, 99, 67, 70,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 100, 101, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 103, 102,
+        0, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 10, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 102, 102, 102,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 103,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 70, 9, 9, 9, 9, 6, 6, 47, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 37, 17, 17, 104,
+        9, 9, 9, 9, 9, 9, 9, 51, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 58, 0, 0, 0,
+        0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 10, 0, 21, 8, 53, 0, 0, 0, 0, 0, 16, 9, 9, 9,
+        105, 105, 39, 9, 9, 9, 9, 9, 39, 17, 0, 77, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+        23, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17,
+        17, 58, 0, 0, 6, 6, 76, 0, 17, 17, 17, 17, 23, 9, 67, 106,
+        6, 6, 47, 9, 9, 9, 9, 9, 9, 51, 17, 58, 9, 9, 9, 9,
+        9, 39, 17, 17, 17, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 70,
+        17, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 17,
+        77, 0, 0, 67, 6, 6, 76, 0, 0, 55, 0, 0, 6, 6, 76, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 57, 17, 17, 37, 0, 0,
+        39, 9, 9, 58, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 65, 58,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 63, 77, 73,
+        55, 0, 0, 0, 0, 0, 0, 0, 9, 9, 39, 17, 16, 107, 0, 0,
+        8, 10, 8, 10, 8, 10, 0, 0, 9, 10, 9, 10, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 37, 58, 6, 6, 76, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9, 9, 9,
+        9, 10, 67, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 10, 0, 0, 67, 9, 0, 108, 29, 29, 109, 29, 29, 30, 29, 110,
+        111, 109, 29, 29, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 0, 0, 0,
+        0, 0, 0, 0, 67, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53,
+        0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 16, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 0,
+        17, 17, 17, 17, 112, 94, 0, 0, 17, 17, 17, 17, 11, 93, 0, 0,
+        0, 0, 0, 113, 5, 114, 0, 0, 0, 0, 0, 0, 9, 18, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 115,
+        0, 116, 0, 5, 6, 6, 7, 0, 8, 9, 9, 9, 9, 9, 10, 11,
+        8, 9, 9, 9, 9, 9, 10, 0, 0, 117, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 118, 9, 9, 9, 9, 9, 9, 9, 10,
+        16, 9, 16, 9, 16, 9, 16, 70, 0, 0, 0, 0, 0, 0, 119, 0,
+        9, 9, 9, 8, 9, 9, 9, 9, 9, 10, 9, 9, 9, 9, 10, 21,
+        9, 9, 9, 53, 9, 9, 9, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 70, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 70, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 8, 9, 9, 9, 9,
+        9, 9, 10, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 51, 37, 0,
+        9, 9, 9, 9, 9, 9, 9, 53, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 0, 9, 9, 8, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 53, 6, 6, 76, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9, 10, 9,
+        9, 9, 10, 9, 10, 21, 9, 9, 21, 9, 9, 9, 21, 9, 21, 70,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0, 0,
+        9, 9, 9, 9, 9, 53, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0,
+        9, 21, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 9, 10, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 53, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 21, 70, 48,
+        9, 9, 9, 9, 9, 53, 0, 0, 9, 9, 9, 9, 9, 10, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 10, 53, 0, 0,
+        9, 9, 9, 9, 9, 53, 0, 0, 9, 9, 9, 9, 9, 9, 53, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 16,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57, 28, 0, 17, 9, 8, 8, 9, 9, 9, 9, 9, 9, 53, 37, 65,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 70,
+        9, 9, 9, 9, 9, 9, 9, 70, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 8, 9, 9, 9, 9, 9, 9, 107, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 0, 0,
+        9, 9, 9, 9, 9, 53, 0, 0, 9, 9, 9, 9, 10, 0, 0, 0,
+        9, 9, 9, 9, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 0, 0, 6, 6, 76, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 22, 77, 53, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 70, 0, 67, 0, 0, 9, 9, 9, 9,
+        9, 51, 17, 17, 77, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9,
+        51, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9,
+        9, 70, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 10, 0, 0,
+        84, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17,
+        17, 37, 0, 0, 0, 0, 0, 0, 0, 61, 6, 6, 45, 52, 0, 65,
+        84, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 37, 14,
+        74, 0, 0, 14, 9, 9, 9, 9, 9, 9, 70, 0, 6, 6, 76, 0,
+        84, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 17, 120, 6, 6,
+        0, 82, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 39, 13, 0, 0,
+        84, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 17,
+        42, 70, 26, 46, 6, 6, 121, 70, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 21, 9, 9, 9, 9, 9, 9, 17, 17, 17, 0, 74,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 10, 18, 21, 9, 9, 9, 21, 9, 9, 70, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 37, 0, 6, 6, 76, 0,
+        17, 8, 9, 48, 48, 9, 9, 9, 9, 9, 18, 9, 18, 8, 22, 60,
+        17, 63, 63, 58, 70, 65, 0, 8, 51, 73, 17, 77, 17, 77, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 57, 17, 17,
+        17, 84, 10, 0, 6, 6, 76, 72, 53, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17, 17,
+        17, 21, 0, 0, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 58, 17, 17,
+        77, 0, 0, 0, 0, 0, 9, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17, 17,
+        77, 70, 0, 0, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 17, 17, 70, 0,
+        6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 26, 17, 17, 17, 0, 6, 6, 76, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 17, 17, 37, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 6, 6, 76, 0, 0, 0, 0, 67,
+        9, 10, 71, 9, 9, 68, 9, 9, 9, 9, 9, 9, 17, 27, 63, 84,
+        60, 0, 0, 0, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 16, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 57, 17, 73, 17, 122, 77, 0, 0, 0, 0, 0, 0,
+        57, 17, 84, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 56, 37,
+        0, 65, 0, 0, 57, 17, 17, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 51, 17, 17, 17, 58, 71, 0, 0, 0, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 18, 9, 9, 9, 9, 9, 9, 9, 9, 39, 17, 37, 17, 17,
+        70, 0, 0, 0, 6, 6, 76, 0, 0, 0, 0, 0, 16, 9, 9, 9,
+        9, 9, 9, 9, 73, 17, 17, 17, 17, 17, 26, 17, 17, 37, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 10, 21, 9, 9, 9, 9, 9, 9, 9, 9, 9, 57, 37, 74, 27,
+        17, 56, 0, 0, 6, 6, 76, 0, 9, 21, 18, 9, 9, 9, 9, 9,
+        9, 9, 51, 37, 27, 17, 70, 0, 6, 6, 76, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 39, 37, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 34, 34, 38, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 0,
+        9, 9, 9, 9, 9, 9, 9, 10, 6, 6, 76, 0, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10,
+        6, 6, 76, 0, 9, 9, 9, 9, 9, 9, 9, 53, 17, 77, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 37, 0, 0,
+        9, 0, 0, 0, 6, 6, 76, 0, 67, 9, 9, 9, 9, 9, 0, 8,
+        9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 10, 65, 57, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 0, 65, 84, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 21, 77, 0, 0, 58, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 98, 102, 123,
+        101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 0, 9, 9, 9, 70,
+        9, 9, 70, 0, 9, 9, 53, 28, 34, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 58, 17, 17, 17, 17,
+        17, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 58, 26, 124, 34, 125, 17,
+        37, 26, 17, 0, 0, 0, 0, 0, 0, 0, 73, 58, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        73, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 18, 13, 68, 8, 18, 9, 9, 21, 8,
+        9, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 21, 10, 8, 9, 18, 9, 18, 9, 9, 9, 9, 9, 9, 21, 10,
+        9, 62, 16, 9, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 53, 9, 9, 9, 9, 9, 9,
+        18, 9, 9, 9, 9, 9, 10, 9, 9, 9, 9, 9, 9, 9, 10, 9,
+        9, 9, 9, 9, 9, 18, 9, 9, 9, 9, 9, 9, 9, 18, 9, 9,
+        9, 9, 9, 10, 9, 9, 9, 9, 9, 9, 9, 10, 9, 9, 9, 9,
+        9, 9, 18, 9, 9, 9, 9, 9, 9, 9, 18, 9, 9, 9, 9, 9,
+        10, 9, 9, 61, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 37, 65, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 77, 0, 55, 0, 0,
+        0, 77, 0, 0, 0, 0, 65, 17, 26, 17, 17, 17, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 37, 17, 17, 17, 17, 63, 17, 27, 46, 37, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 70, 17, 84, 9, 53,
+        6, 6, 76, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 126, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 17, 6, 6, 76, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 9, 68, 9, 9, 9, 10,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 70, 0, 0, 17, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 17, 84, 0, 6, 6, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 8, 9, 9, 9, 9, 9, 9, 68, 48, 8, 9, 10, 9, 85, 0,
+        13, 67, 85, 8, 68, 48, 85, 85, 68, 48, 10, 9, 10, 9, 8, 62,
+        9, 9, 21, 9, 9, 9, 9, 0, 8, 8, 21, 9, 9, 9, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9,
+        9, 9, 53, 0, 9, 9, 9, 9, 9, 9, 53, 0, 9, 9, 9, 9,
+        9, 9, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 128, 128, 128, 128, 128, 128,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 17,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 76, 0,
+        14, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0,
+    };
+
+    static constexpr std::uint8_t stage3[516] = {
+        0, 0, 0, 0, 0, 0, 2, 3, 3, 1, 0, 0, 18, 0, 12, 0,
+        0, 0, 0, 11, 15, 0, 13, 0, 16, 16, 16, 16, 16, 16, 14, 15,
+        0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 17,
+        0, 3, 0, 0, 0, 0, 10, 0, 0, 7, 0, 0, 0, 10, 0, 14,
+        0, 0, 10, 10, 4, 4, 4, 4, 10, 0, 10, 10, 10, 10, 15, 10,
+        0, 0, 10, 14, 10, 10, 0, 10, 10, 10, 0, 4, 4, 4, 10, 10,
+        10, 0, 10, 14, 10, 15, 10, 0, 0, 4, 4, 4, 4, 4, 0, 4,
+        0, 4, 4, 0, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9,
+        9, 9, 9, 10, 14, 0, 0, 0, 7, 7, 7, 7, 7, 7, 0, 0,
+        15, 15, 0, 0, 4, 4, 4, 0, 7, 0, 0, 0, 10, 10, 10, 4,
+        16, 16, 0, 16, 15, 0, 10, 10, 4, 10, 10, 10, 0, 10, 4, 4,
+        4, 7, 0, 4, 4, 10, 10, 4, 4, 0, 4, 4, 16, 16, 10, 10,
+        10, 0, 0, 10, 0, 0, 0, 7, 10, 4, 10, 10, 10, 10, 4, 4,
+        4, 10, 0, 0, 10, 10, 0, 0, 15, 0, 10, 0, 0, 4, 0, 0,
+        4, 4, 10, 4, 10, 4, 4, 4, 4, 4, 0, 0, 4, 4, 7, 4,
+        4, 10, 4, 4, 0, 0, 16, 16, 10, 0, 10, 0, 4, 0, 0, 4,
+        4, 4, 10, 0, 0, 0, 0, 4, 10, 0, 4, 0, 0, 0, 0, 10,
+        0, 10, 10, 0, 10, 4, 0, 0, 10, 0, 0, 0, 0, 10, 0, 0,
+        0, 0, 4, 10, 0, 0, 4, 4, 0, 0, 4, 0, 4, 0, 4, 0,
+        16, 16, 0, 0, 4, 0, 0, 0, 0, 4, 0, 4, 16, 16, 4, 4,
+        18, 10, 10, 10, 10, 0, 4, 4, 10, 4, 4, 10, 10, 4, 10, 0,
+        4, 4, 4, 10, 0, 10, 0, 10, 18, 18, 18, 18, 18, 18, 18, 0,
+        4, 5, 7, 7, 13, 13, 0, 0, 13, 0, 0, 14, 3, 3, 7, 7,
+        7, 7, 7, 17, 17, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 18,
+        7, 0, 7, 7, 18, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0, 0,
+        0, 4, 4, 8, 8, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 0,
+        4, 4, 0, 10, 10, 10, 4, 10, 0, 10, 10, 4, 10, 4, 4, 0,
+        0, 9, 4, 9, 9, 0, 9, 9, 9, 0, 9, 0, 9, 9, 0, 9,
+        15, 0, 0, 14, 0, 17, 17, 17, 15, 14, 0, 0, 10, 0, 0, 7,
+        0, 0, 0, 13, 0, 0, 8, 8, 8, 8, 4, 4, 0, 7, 7, 7,
+        4, 0, 16, 16, 16, 16, 10, 0, 4, 10, 0, 10, 0, 8, 8, 0,
+        4, 4, 4, 7, 7, 7, 7, 4, 10, 10, 4, 0, 0, 0, 6, 6,
+        6, 6, 6, 6,
+    };
+
+    static constexpr std::uint8_t results[19] = {
+        0, 1, 2, 3, 4, 5,
+        6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17,
+        18,
+    };
+};
+
+template <typename T>
+constexpr int word_break_tables<T>::shift1;
+
+template <typename T>
+constexpr int word_break_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t word_break_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint8_t word_break_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint8_t word_break_tables<T>::stage3[];
+
+template <typename T>
+constexpr std::uint8_t word_break_tables<T>::results[];
+
+constexpr std::uint8_t word_break_lookup(char32_t c)
+{
+    using t = word_break_tables<>;
+    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+}
+
+/// The Line_Break property, with the classes of rule LB1 resolved
+enum class line_break : std::uint8_t {
+    al, ///< AL
+    bk, ///< BK
+    cr, ///< CR
+    lf, ///< LF
+    nl, ///< NL
+    sp, ///< SP
+    zw, ///< ZW
+    cm, ///< CM
+    zwj, ///< ZWJ
+    wj, ///< WJ
+    gl, ///< GL
+    cl, ///< CL
+    cp, ///< CP
+    ex, ///< EX
+    is, ///< IS
+    sy, ///< SY
+    op, ///< OP
+    qu, ///< QU
+    ns, ///< NS
+    b2, ///< B2
+    ba, ///< BA
+    bb, ///< BB
+    hy, ///< HY
+    cb, ///< CB
+    in, ///< IN
+    hl, ///< HL
+    nu, ///< NU
+    pr, ///< PR
+    po, ///< PO
+    id, ///< ID
+    eb, ///< EB
+    em, ///< EM
+    jl, ///< JL
+    jv, ///< JV
+    jt, ///< JT
+    h2, ///< H2
+    h3, ///< H3
+    ri, ///< RI
+};
+
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct line_break_tables {
+    static constexpr int shift1 = 5;
+    static constexpr int shift2 = 4;
+
+    static constexpr std::uint8_t stage1[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 18, 21, 22, 23, 24, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        27, 25, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34,
+        35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 40, 41, 42, 43,
+        44, 45, 46, 18, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+        18, 18, 59, 18, 18, 18, 18, 18, 18, 60, 61, 18, 18, 18, 18, 18,
+        18, 18, 62, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 63, 18, 64, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 65, 25, 66, 67, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 68, 69, 18, 18, 18, 18, 70, 18,
+        18, 18, 18, 18, 18, 18, 18, 71, 72, 73, 18, 74, 18, 75, 18, 18,
+        76, 77, 18, 18, 78, 18, 79, 18, 80, 81, 82, 83, 84, 85, 25, 86,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 86,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 86,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        87, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    };
+
+    static constexpr std::uint16_t stage2[2816] = {
+        0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 11, 4, 4,
+        1, 1, 1, 1, 12, 13, 14, 15, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 16, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 17, 18, 1, 19, 20, 21, 22, 23,
+        24, 25, 4, 4, 26, 1, 27, 28, 4, 4, 4, 4, 4, 29, 30, 31,
+        4, 32, 4, 1, 33, 4, 4, 4, 4, 4, 34, 28, 31, 4, 26, 35,
+        4, 36, 37, 4, 4, 38, 4, 4, 4, 39, 4, 4, 40, 1, 41, 1,
+        42, 4, 4, 43, 1, 44, 45, 4, 46, 4, 4, 47, 48, 49, 50, 51,
+        46, 4, 4, 47, 52, 32, 53, 54, 46, 4, 4, 47, 55, 4, 50, 56,
+        46, 4, 4, 47, 48, 57, 50, 4, 58, 4, 4, 59, 60, 49, 53, 61,
+        62, 4, 4, 47, 63, 64, 50, 65, 66, 4, 4, 47, 63, 64, 50, 4,
+        42, 4, 4, 67, 63, 49, 50, 68, 46, 4, 4, 4, 69, 70, 53, 71,
+        4, 4, 4, 72, 73, 74, 4, 4, 4, 4, 4, 75, 76, 31, 4, 4,
+        77, 78, 31, 79, 4, 4, 4, 80, 81, 82, 1, 83, 84, 85, 4, 4,
+        4, 4, 26, 86, 74, 87, 88, 89, 90, 91, 4, 4, 4, 4, 4, 4,
+        92, 92, 92, 92, 92, 92, 93, 93, 93, 93, 94, 95, 95, 95, 95, 95,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 96, 97, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        98, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 98, 99, 4, 4, 4, 4, 100, 4,
+        4, 101, 4, 102, 4, 71, 4, 71, 4, 4, 4, 103, 1, 104, 31, 4,
+        105, 31, 4, 4, 4, 4, 4, 4, 64, 4, 106, 4, 4, 4, 4, 4,
+        4, 4, 107, 107, 108, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4, 4,
+        4, 109, 4, 4, 4, 110, 1, 111, 31, 31, 4, 1, 86, 4, 4, 4,
+        62, 4, 4, 103, 62, 112, 113, 114, 115, 4, 116, 31, 4, 4, 34, 42,
+        4, 4, 103, 117, 31, 31, 4, 118, 4, 4, 4, 4, 4, 119, 120, 121,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 122,
+        123, 124, 125, 126, 127, 128, 129, 130, 130, 4, 131, 132, 133, 1, 1, 28,
+        134, 135, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 136, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 137, 4,
+        138, 139, 140, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 141,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        141, 142, 4, 143, 4, 4, 144, 145, 4, 4, 4, 146, 147, 148, 149, 150,
+        151, 4, 4, 4, 4, 152, 153, 154, 4, 4, 4, 4, 155, 4, 156, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 157, 158, 4, 4, 4, 138, 4, 159,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 160, 161,
+        4, 4, 4, 4, 4, 4, 4, 162, 4, 4, 4, 4, 4, 4, 1, 1,
+        163, 164, 165, 166, 167, 168, 4, 4, 169, 170, 169, 169, 169, 169, 169, 141,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 171, 4, 172,
+        173, 174, 175, 176, 177, 169, 178, 169, 179, 180, 181, 169, 178, 169, 179, 182,
+        183, 169, 169, 184, 169, 169, 169, 169, 185, 169, 169, 169, 169, 169, 141, 186,
+        169, 185, 169, 169, 187, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 4, 4, 4, 4,
+        169, 188, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 189, 169, 169, 169, 190, 4, 4, 118,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        191, 4, 31, 4, 4, 4, 160, 192, 4, 59, 4, 4, 4, 4, 4, 193,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        194, 4, 195, 196, 4, 4, 4, 197, 198, 4, 4, 103, 199, 31, 1, 200,
+        31, 4, 201, 4, 202, 42, 92, 203, 42, 4, 4, 204, 205, 31, 206, 31,
+        4, 4, 207, 208, 209, 210, 4, 211, 4, 4, 4, 212, 32, 4, 26, 213,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 214, 31,
+        215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+        217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218,
+        217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219,
+        217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215,
+        216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217,
+        218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217,
+        219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217,
+        215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+        217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218,
+        217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219,
+        217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215,
+        216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217,
+        218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217,
+        219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217,
+        215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+        217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 220, 93, 221, 95, 95, 222,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        4, 223, 224, 225, 226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 227, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 228,
+        1, 229, 1, 230, 231, 232, 233, 4, 4, 4, 4, 4, 4, 4, 4, 234,
+        235, 236, 169, 237, 169, 238, 239, 240, 169, 241, 169, 185, 242, 243, 244, 245,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        246, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 247,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 28, 4,
+        4, 4, 4, 4, 4, 4, 4, 248, 4, 249, 4, 4, 4, 98, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 250, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 249, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        251, 4, 4, 252, 4, 253, 4, 4, 4, 4, 4, 4, 4, 4, 64, 254,
+        4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 256, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 257, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 34, 28, 4, 4, 101, 4, 4, 4, 4, 4, 4, 4,
+        115, 4, 4, 39, 258, 4, 53, 259, 115, 4, 4, 260, 261, 4, 4, 31,
+        115, 4, 202, 262, 263, 4, 4, 264, 115, 4, 4, 204, 265, 266, 4, 4,
+        4, 4, 267, 268, 4, 4, 4, 4, 4, 4, 269, 4, 4, 160, 33, 31,
+        42, 4, 4, 67, 48, 49, 270, 62, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 271, 272, 273, 4, 4, 4, 4, 4, 1, 42, 31, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 160, 274, 275, 276, 4, 4,
+        4, 4, 4, 1, 277, 31, 278, 4, 4, 4, 26, 279, 31, 4, 4, 4,
+        4, 96, 107, 280, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 267, 33, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4,
+        4, 4, 4, 281, 282, 31, 4, 4, 4, 4, 4, 4, 4, 283, 284, 4,
+        285, 4, 4, 286, 287, 288, 4, 4, 40, 289, 290, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 160, 291, 292, 31, 4, 293, 4, 294, 82, 208, 4, 4, 4, 4,
+        4, 4, 4, 295, 296, 31, 4, 4, 297, 298, 31, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 299,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 300, 301, 249,
+        4, 4, 4, 4, 4, 4, 4, 302, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 303, 4, 4, 304, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 305, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 306, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 307, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 308, 4, 4, 4, 4, 4, 31, 4, 4, 309,
+        4, 4, 4, 310, 311, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 312, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 160, 18, 1, 1, 313, 115, 4, 4, 4, 4, 314, 198,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 187,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        315, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 316, 4, 4, 317, 318, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 172,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 319, 42, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 320, 1, 208, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 321, 1, 322, 4, 323, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 324, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 325, 326, 326, 326,
+        1, 1, 1, 327, 1, 1, 328, 206, 329, 26, 18, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        291, 330, 331, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 208, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 332, 4, 4, 4, 267, 333,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 208, 4, 4,
+        4, 4, 4, 4, 334, 335, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 228, 301, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        146, 4, 4, 4, 4, 4, 146, 4, 4, 4, 146, 169, 169, 169, 336, 337,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 338, 339, 169, 340, 341, 169, 169, 342,
+        169, 169, 169, 169, 343, 344, 345, 346, 347, 348, 349, 350, 169, 169, 169, 169,
+        351, 190, 183, 352, 353, 169, 169, 354, 169, 355, 169, 169, 169, 356, 169, 357,
+        169, 169, 169, 169, 358, 4, 4, 359, 169, 169, 360, 361, 362, 169, 169, 169,
+        4, 4, 4, 4, 4, 4, 4, 363, 4, 4, 4, 4, 4, 183, 169, 169,
+        364, 4, 4, 4, 365, 353, 4, 4, 365, 4, 366, 169, 169, 169, 169, 169,
+        367, 368, 369, 370, 169, 169, 169, 371, 169, 169, 169, 372, 373, 374, 169, 169,
+        4, 4, 4, 4, 4, 363, 169, 169, 169, 169, 169, 169, 375, 169, 169, 376,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 377,
+        32, 4, 1, 1, 1, 1, 1, 1, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4,
+    };
+
+    static constexpr std::uint8_t stage3[6048] = {
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 20, 3, 1, 1, 2, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        5, 13, 17, 0, 27, 28, 0, 17, 16, 12, 0, 27, 14, 22, 14, 15,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 14, 14, 0, 0, 0, 13,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 27, 12, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 20, 11, 0, 7,
+        7, 7, 7, 7, 7, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        10, 16, 28, 27, 27, 27, 0, 0, 0, 0, 0, 17, 0, 20, 0, 0,
+        28, 27, 0, 0, 21, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 16,
+        0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 21, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10, 10, 10,
+        10, 10, 10, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+        0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 20, 0, 0, 0, 0, 27,
+        0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 20, 7,
+        0, 7, 7, 0, 7, 7, 13, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 25,
+        25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 28, 14, 14, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 13, 7, 13, 13, 13,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 26, 26, 0, 0, 0,
+        7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 13, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7,
+        7, 7, 7, 7, 7, 0, 0, 7, 7, 0, 7, 7, 7, 7, 0, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0,
+        0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 0, 0, 0, 0, 14, 13, 0, 0, 0, 7, 27, 27,
+        0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 0, 7, 7, 7, 0, 7, 7, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7,
+        7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 7, 7,
+        0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 20, 20, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        0, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7, 7,
+        7, 7, 7, 7, 7, 0, 0, 7, 7, 0, 0, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        0, 0, 28, 28, 0, 0, 0, 0, 0, 28, 0, 27, 0, 0, 7, 0,
+        7, 7, 7, 0, 0, 0, 0, 7, 7, 0, 0, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        7, 7, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 0, 7, 7, 7, 0, 0,
+        0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7,
+        0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+        7, 7, 7, 0, 0, 0, 7, 7, 7, 0, 7, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 0, 7, 7, 7, 0, 7, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 7, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 7,
+        7, 7, 7, 7, 7, 0, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 27,
+        0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 20, 20, 0, 0, 0, 0,
+        0, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 0, 0,
+        0, 21, 21, 21, 21, 0, 21, 21, 10, 21, 21, 20, 10, 13, 13, 13,
+        13, 13, 10, 0, 13, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 20, 7, 0, 7, 0, 7, 16, 11, 16, 11, 7, 7,
+        0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 20,
+        7, 7, 7, 7, 7, 20, 7, 7, 0, 0, 0, 0, 0, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 20, 20,
+        0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 20, 21, 0, 0, 0, 0, 0, 10, 10, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0,
+        0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 0, 0, 0, 0, 7, 7,
+        7, 0, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+        0, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 7, 7, 7, 7, 0, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7,
+        0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 0, 0,
+        0, 0, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 7, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 20, 20, 18, 0, 20, 0, 20, 27, 0, 7, 0, 0,
+        0, 0, 13, 13, 20, 20, 21, 0, 13, 13, 0, 7, 7, 7, 10, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 13, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 20, 20, 0, 20, 20, 20,
+        20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 0,
+        7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 20, 20, 20, 20, 20,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20,
+        7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 7, 0, 0,
+        0, 0, 0, 0, 7, 0, 0, 7, 7, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 10, 20, 20, 20, 6, 7, 8, 7, 7,
+        20, 10, 20, 20, 19, 0, 0, 0, 17, 17, 16, 17, 17, 17, 16, 17,
+        0, 0, 0, 0, 24, 24, 24, 20, 1, 1, 7, 7, 7, 7, 7, 10,
+        28, 28, 28, 28, 28, 28, 28, 28, 0, 17, 17, 0, 18, 18, 0, 0,
+        0, 0, 0, 0, 14, 16, 11, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 20, 0, 20, 20, 20, 20, 0, 20, 20, 20,
+        9, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 0,
+        27, 27, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 28, 27, 27, 28, 27,
+        28, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        0, 0, 0, 28, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+        0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 16, 11, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 29, 29, 0, 0, 29, 0, 29, 29, 29, 30, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 29, 0, 29,
+        29, 29, 0, 29, 29, 0, 0, 0, 29, 29, 0, 0, 29, 0, 0, 29,
+        29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0,
+        0, 29, 29, 29, 29, 29, 0, 29, 29, 30, 29, 0, 0, 29, 29, 29,
+        29, 29, 29, 29, 29, 0, 0, 0, 29, 29, 30, 30, 30, 30, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17,
+        17, 0, 13, 13, 29, 0, 0, 0, 16, 11, 16, 11, 16, 11, 16, 11,
+        16, 11, 16, 11, 16, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 16, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 11, 16, 11, 16, 11, 16, 11, 16, 11,
+        0, 0, 0, 16, 11, 16, 11, 16, 11, 16, 11, 16, 11, 16, 11, 16,
+        11, 16, 11, 16, 11, 16, 11, 16, 11, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+        7, 7, 0, 0, 0, 0, 0, 0, 0, 13, 20, 20, 20, 0, 13, 20,
+        20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 20, 20,
+        20, 20, 20, 20, 20, 20, 0, 20, 16, 20, 0, 0, 17, 17, 0, 0,
+        17, 17, 16, 11, 16, 11, 16, 11, 16, 11, 20, 20, 20, 20, 13, 0,
+        20, 20, 0, 20, 20, 0, 0, 0, 0, 0, 19, 19, 20, 20, 20, 0,
+        20, 20, 16, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 0, 20, 20,
+        0, 0, 0, 13, 13, 16, 11, 16, 11, 16, 11, 16, 11, 20, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0,
+        20, 11, 11, 29, 29, 18, 29, 29, 16, 11, 16, 11, 16, 11, 16, 11,
+        16, 11, 29, 29, 16, 11, 16, 11, 16, 11, 16, 11, 18, 16, 11, 11,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 7, 7, 7, 7, 7, 7,
+        29, 29, 29, 29, 29, 7, 29, 29, 29, 29, 29, 18, 18, 29, 29, 29,
+        0, 18, 29, 18, 29, 18, 29, 18, 29, 18, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 18, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 18, 29, 18, 29, 18, 29, 29, 29, 29, 29, 29, 18, 29,
+        29, 29, 29, 29, 29, 18, 18, 0, 0, 7, 7, 18, 18, 18, 18, 29,
+        18, 18, 29, 18, 29, 18, 29, 18, 29, 18, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 18, 18, 29, 29, 29, 29, 18, 18, 18, 18, 29,
+        0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 18, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 13, 20,
+        7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+        7, 7, 0, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+        0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 21, 21, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20,
+        7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 7,
+        0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 20, 20,
+        0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0,
+        0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 0, 0, 0, 0, 0, 0, 20, 20, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 20, 20, 20,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0,
+        7, 0, 7, 7, 7, 0, 0, 7, 7, 0, 0, 0, 0, 0, 7, 7,
+        20, 20, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 20, 7, 7, 0, 0,
+        35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 35, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 35, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 7, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 0, 25, 0,
+        25, 25, 0, 25, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 16,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+        14, 11, 11, 14, 14, 13, 13, 16, 11, 24, 0, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 16, 11, 16, 11, 16, 11, 16, 11, 16, 11, 16,
+        11, 16, 11, 16, 11, 29, 29, 16, 11, 29, 29, 29, 29, 29, 29, 29,
+        11, 29, 11, 0, 18, 18, 13, 13, 29, 16, 11, 16, 11, 16, 11, 29,
+        29, 29, 29, 29, 29, 29, 29, 0, 29, 27, 28, 29, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 13, 29, 29, 27, 28, 29, 29, 16, 11, 29, 29, 11, 29, 11, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 18, 18, 29, 29, 29, 13,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 16, 29, 11, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 16, 29, 11, 29, 16,
+        11, 11, 16, 11, 11, 18, 29, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 18, 18,
+        0, 0, 29, 29, 29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 29,
+        0, 0, 29, 29, 29, 29, 29, 29, 0, 0, 29, 29, 29, 0, 0, 0,
+        28, 27, 29, 29, 29, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 23, 0, 0, 0,
+        20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+        0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 0, 7, 7, 0, 0, 0, 0, 0, 7, 7, 7, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0, 7,
+        20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20,
+        0, 0, 0, 0, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 20, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 20, 20, 0, 0, 0, 0, 0, 0, 0,
+        7, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 20, 20,
+        20, 20, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        20, 20, 20, 20, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 0, 0, 0, 0, 20, 20, 0, 20, 7, 7, 7, 7, 0, 7, 7,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 21, 0, 20, 20, 20,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 20, 20, 0, 20, 20, 0, 7, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 20, 20, 20, 20, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 20, 20, 0, 0, 7, 0,
+        7, 7, 7, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 21, 20, 20, 13, 13, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 7, 7, 0, 0,
+        7, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 20, 20, 20, 0,
+        7, 7, 7, 7, 7, 7, 0, 7, 7, 0, 0, 7, 7, 7, 7, 0,
+        7, 0, 7, 7, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7,
+        7, 0, 21, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 21,
+        0, 20, 20, 20, 20, 21, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 20, 20, 20, 0, 21, 21,
+        21, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        0, 7, 7, 7, 7, 7, 7, 0, 0, 0, 7, 0, 7, 7, 0, 7,
+        7, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0,
+        7, 7, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 28,
+        28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 11, 11, 11, 0, 0,
+        0, 0, 11, 0, 0, 0, 16, 11, 16, 11, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11, 11, 0, 0, 0, 0,
+        10, 10, 10, 10, 10, 10, 10, 16, 11, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 11,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 20, 20,
+        7, 7, 7, 7, 7, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 20, 20, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 20, 20, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 7,
+        18, 18, 18, 18, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0,
+        29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 20,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 7, 7, 7,
+        7, 7, 7, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 0, 0,
+        0, 0, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+        0, 0, 0, 0, 7, 0, 0, 20, 20, 20, 20, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7,
+        7, 7, 0, 7, 7, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 27,
+        0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 16, 16,
+        29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+        37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+        29, 29, 29, 29, 29, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 29, 29,
+        29, 29, 29, 29, 29, 0, 0, 29, 29, 29, 29, 29, 0, 29, 29, 29,
+        29, 29, 30, 30, 30, 29, 29, 30, 29, 29, 30, 30, 30, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 31, 31, 31, 31, 31,
+        29, 29, 30, 30, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 30, 29, 29, 29,
+        29, 30, 30, 30, 29, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 30,
+        29, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 29, 0, 29, 0, 29, 29, 29, 29, 29, 30, 29, 29, 29, 29, 0,
+        29, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 30, 30, 29, 29, 29, 29, 30, 29, 29, 29, 29, 29,
+        30, 29, 29, 29, 29, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 30, 30, 30, 29, 29, 29, 30, 30, 30, 30, 30,
+        0, 0, 0, 0, 0, 0, 17, 17, 17, 18, 18, 18, 0, 0, 0, 0,
+        29, 29, 29, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 29, 29, 29,
+        0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 29, 29, 30,
+        29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+        29, 29, 29, 29, 29, 29, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 30, 30, 30, 29,
+        29, 29, 29, 29, 29, 29, 29, 30, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 30, 30, 29, 30, 30, 29, 30, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30,
+        29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 29, 29,
+        29, 29, 29, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0,
+    };
+
+    static constexpr std::uint8_t results[38] = {
+        0, 1, 2, 3, 4, 5,
+        6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23,
+        24, 25, 26, 27, 28, 29,
+        30, 31, 32, 33, 34, 35,
+        36, 37,
+    };
+};
+
+template <typename T>
+constexpr int line_break_tables<T>::shift1;
+
+template <typename T>
+constexpr int line_break_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t line_break_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint16_t line_break_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint8_t line_break_tables<T>::stage3[];
+
+template <typename T>
+constexpr std::uint8_t line_break_tables<T>::results[];
+
+constexpr std::uint8_t line_break_lookup(char32_t c)
+{
+    using t = line_break_tables<>;
+    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+}
+
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,581 @@
+
+// Generated by tools/ucdgen.cpp -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_CASE_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_CASE_TABLES_HPP_INCLUDED
+
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+// The number of the case mapping record of each code point
+
+// The value for code point c is
+//   stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                  ((c >> shift2) & mask1)] << shift2) + (c & mask2)]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct case_record_tables {
+    static constexpr int shift1 = 7;
+    static constexpr int shift2 = 3;
+
+    static constexpr std::uint8_t stage1[1088] = {
+        0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10, 11,
+        2, 12, 2, 13, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    };
+
+    static constexpr std::uint8_t stage2[2176] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 3, 4, 5, 5, 6,
+        0, 0, 0, 0, 0, 0, 7, 0, 2, 2, 8, 9, 5, 5, 10, 11,
+        12, 12, 12, 12, 12, 12, 13, 14, 15, 16, 12, 12, 12, 12, 12, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 15, 28, 12, 12, 29, 12,
+        12, 12, 12, 12, 30, 12, 31, 32, 33, 12, 34, 35, 36, 37, 38, 39,
+        40, 41, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 45, 46,
+        47, 48, 49, 2, 50, 51, 52, 5, 53, 54, 55, 12, 12, 12, 56, 57,
+        58, 58, 2, 2, 2, 2, 5, 5, 5, 5, 59, 59, 12, 12, 12, 12,
+        60, 61, 12, 12, 12, 12, 12, 12, 62, 63, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 64, 65, 65, 65, 66, 0, 67, 68, 68, 68,
+        69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 70, 70, 70, 70, 71, 72, 73, 73, 73, 73, 73, 74,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 76, 77,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 79, 80, 80, 80, 80, 80, 81, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82,
+        0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 84, 85, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        86, 87, 88, 89, 86, 87, 86, 87, 88, 89, 90, 91, 86, 87, 92, 93,
+        94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 110, 111, 112, 0, 0, 113, 0, 0, 114, 114, 115, 115,
+        116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 117, 118, 118, 118, 119, 119, 119, 120, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        65, 65, 65, 65, 65, 65, 68, 68, 68, 68, 68, 68, 121, 122, 123, 124,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 31, 125, 126, 0,
+        127, 127, 127, 127, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 130, 0, 0,
+        12, 12, 12, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 61, 12, 61, 12, 12, 12, 12, 12, 12, 12, 0, 131,
+        12, 132, 133, 12, 12, 134, 135, 12, 136, 137, 138, 60, 0, 0, 139, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 0, 0, 0, 141, 141,
+        141, 141, 141, 141, 141, 141, 141, 141, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        142, 0, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 2, 2, 3, 4, 5, 5, 6, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        144, 144, 144, 144, 144, 145, 145, 145, 145, 145, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 146, 145, 145, 145, 145, 147,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 149,
+        148, 149, 150, 151, 152, 151, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        154, 154, 154, 154, 154, 154, 155, 0, 156, 156, 156, 156, 156, 156, 157, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2, 2, 2, 2, 5, 5, 5, 5, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 5, 5, 5, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        158, 158, 158, 158, 159, 160, 160, 160, 161, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr std::uint16_t stage3[1296] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 4,
+        2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5,
+        6, 7, 6, 7, 6, 7, 6, 7, 8, 9, 6, 7, 6, 7, 6, 7,
+        0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+        7, 10, 6, 7, 6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+        13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6, 7, 0, 17, 18,
+        19, 6, 7, 16, 20, 21, 22, 23, 6, 7, 24, 0, 22, 25, 26, 27,
+        6, 7, 6, 7, 6, 7, 28, 6, 7, 28, 0, 0, 6, 7, 28, 6,
+        7, 29, 29, 6, 7, 6, 7, 30, 6, 7, 0, 0, 6, 7, 0, 31,
+        0, 0, 0, 0, 32, 33, 34, 32, 33, 34, 32, 33, 34, 6, 7, 6,
+        7, 6, 7, 6, 7, 35, 6, 7, 36, 32, 33, 34, 6, 7, 37, 38,
+        39, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+        0, 0, 40, 6, 7, 41, 42, 43, 43, 6, 7, 44, 45, 46, 6, 7,
+        47, 48, 49, 50, 51, 0, 52, 52, 0, 53, 0, 54, 55, 0, 0, 0,
+        52, 56, 0, 57, 0, 58, 59, 0, 60, 61, 59, 62, 63, 0, 0, 61,
+        0, 64, 65, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0,
+        68, 0, 69, 68, 0, 0, 0, 70, 68, 71, 72, 72, 73, 0, 0, 0,
+        0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0,
+        0, 0, 0, 0, 0, 77, 0, 0, 6, 7, 6, 7, 0, 0, 6, 7,
+        0, 0, 0, 26, 26, 26, 0, 78, 0, 0, 0, 0, 0, 0, 79, 0,
+        80, 80, 80, 0, 81, 0, 82, 82, 83, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 84, 85, 85, 85,
+        86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 87, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 88, 89, 89, 90, 91, 92, 0, 0, 0, 93, 94, 95,
+        96, 97, 98, 99, 100, 101, 0, 6, 7, 102, 6, 7, 0, 39, 39, 39,
+        103, 103, 103, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104,
+        6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 6, 7,
+        105, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 106,
+        0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 0, 0, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 109,
+        110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 0, 110,
+        0, 0, 0, 0, 0, 110, 0, 0, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 0, 0, 111, 111, 111, 112, 112, 112, 112, 112, 112, 112, 112,
+        113, 113, 113, 113, 113, 113, 0, 0, 114, 114, 114, 114, 114, 114, 0, 0,
+        115, 116, 117, 118, 118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 123, 123, 123,
+        0, 124, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+        6, 7, 6, 7, 6, 7, 127, 128, 129, 130, 131, 132, 0, 0, 133, 0,
+        134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135,
+        134, 134, 134, 134, 134, 134, 0, 0, 135, 135, 135, 135, 135, 135, 0, 0,
+        136, 134, 137, 134, 138, 134, 139, 134, 0, 135, 0, 135, 0, 135, 0, 135,
+        140, 140, 141, 141, 141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 0, 0,
+        146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+        162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+        178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+        134, 134, 194, 195, 196, 0, 197, 198, 135, 135, 199, 199, 200, 0, 201, 0,
+        0, 0, 202, 203, 204, 0, 205, 206, 207, 207, 207, 207, 208, 0, 0, 0,
+        134, 134, 209, 83, 0, 0, 210, 211, 135, 135, 212, 212, 0, 0, 0, 0,
+        134, 134, 213, 86, 214, 98, 215, 216, 135, 135, 217, 217, 102, 0, 0, 0,
+        0, 0, 218, 219, 220, 0, 221, 222, 223, 223, 224, 224, 225, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 227, 228, 0, 0, 0, 0,
+        0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+        231, 231, 231, 231, 231, 231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 232,
+        0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 233,
+        233, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 234, 234, 234, 234, 234,
+        234, 234, 0, 0, 0, 0, 0, 0, 6, 7, 235, 236, 237, 238, 239, 6,
+        7, 6, 7, 6, 7, 240, 241, 242, 243, 0, 6, 7, 0, 6, 7, 0,
+        0, 0, 0, 0, 0, 0, 244, 244, 0, 0, 0, 6, 7, 6, 7, 0,
+        0, 0, 6, 7, 0, 0, 0, 0, 245, 245, 245, 245, 245, 245, 245, 245,
+        245, 245, 245, 245, 245, 245, 0, 245, 0, 0, 0, 0, 0, 245, 0, 0,
+        6, 7, 6, 7, 6, 7, 0, 0, 0, 6, 7, 6, 7, 246, 6, 7,
+        0, 0, 0, 6, 7, 247, 0, 0, 6, 7, 6, 7, 248, 0, 6, 7,
+        6, 7, 249, 250, 251, 252, 249, 0, 253, 254, 255, 256, 6, 7, 6, 7,
+        6, 7, 6, 7, 257, 258, 259, 6, 7, 6, 7, 0, 0, 0, 0, 0,
+        6, 7, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 6, 7, 0,
+        0, 0, 0, 260, 0, 0, 0, 0, 261, 261, 261, 261, 261, 261, 261, 261,
+        262, 263, 264, 265, 266, 267, 267, 0, 0, 0, 0, 268, 269, 270, 271, 272,
+        273, 273, 273, 273, 273, 273, 273, 273, 274, 274, 274, 274, 274, 274, 274, 274,
+        273, 273, 273, 273, 0, 0, 0, 0, 274, 274, 274, 274, 0, 0, 0, 0,
+        275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 275, 275,
+        275, 275, 275, 0, 275, 275, 0, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+        276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 0, 276, 276, 0, 0, 0,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 0, 0, 0, 0, 0,
+        277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 278, 278, 278, 278, 278, 278,
+        278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 0, 0, 0,
+    };
+};
+
+template <typename T>
+constexpr int case_record_tables<T>::shift1;
+
+template <typename T>
+constexpr int case_record_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t case_record_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint8_t case_record_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint16_t case_record_tables<T>::stage3[];
+
+constexpr std::uint16_t case_record_lookup(char32_t c)
+{
+    using t = case_record_tables<>;
+    return c > 0x10FFFF ? 0 :
+        t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                  (c & ((1u << t::shift2) - 1))];
+}
+
+// The lowercase, uppercase and case folding mappings of each record, as
+// (c + simple mapping - c) % 2^22 | offset of full mapping << 22, and
+// the full mappings which are not the simple mapping, as sequences of
+// code points in which the last has bit 31 set
+template <typename = void>
+struct case_mapping_tables {
+    static constexpr int max_length = 3;
+
+    static constexpr std::uint32_t lower[279] = {
+        0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000000, 0x017FFF39, 0x00000000, 0x00000000, 0x003FFF87,
+        0x00000000, 0x00000000, 0x000000D2, 0x000000CE, 0x000000CD, 0x0000004F,
+        0x000000CA, 0x000000CB, 0x000000CF, 0x00000000, 0x000000D3, 0x000000D1,
+        0x00000000, 0x000000D5, 0x00000000, 0x000000D6, 0x000000DA, 0x000000D9,
+        0x000000DB, 0x00000000, 0x00000002, 0x00000001, 0x00000000, 0x00000000,
+        0x00000000, 0x003FFF9F, 0x003FFFC8, 0x003FFF7E, 0x00002A2B, 0x003FFF5D,
+        0x00002A28, 0x00000000, 0x003FFF3D, 0x00000045, 0x00000047, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000074, 0x00000026, 0x00000025, 0x00000040, 0x0000003F, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003FFFC4, 0x00000000,
+        0x003FFFF9, 0x00000050, 0x00000000, 0x0000000F, 0x00000000, 0x00000030,
+        0x00000000, 0x00000000, 0x00001C60, 0x00000000, 0x000097D0, 0x00000008,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x003FF440, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x003FE241, 0x00000000, 0x003FFFF8, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003FFFF8, 0x003FFFF8,
+        0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8,
+        0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8, 0x003FFFF8,
+        0x003FFFF8, 0x003FFFF8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x003FFFB6, 0x003FFFF7, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x003FFFAA, 0x003FFFF7, 0x00000000,
+        0x00000000, 0x00000000, 0x003FFF9C, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x003FFF90, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x003FFF80, 0x003FFF82, 0x003FFFF7, 0x003FE2A3, 0x003FDF41,
+        0x003FDFBA, 0x0000001C, 0x00000000, 0x00000010, 0x00000000, 0x0000001A,
+        0x00000000, 0x003FD609, 0x003FF11A, 0x003FD619, 0x00000000, 0x00000000,
+        0x003FD5E4, 0x003FD603, 0x003FD5E1, 0x003FD5E2, 0x003FD5C1, 0x00000000,
+        0x003F75FC, 0x003F5AD8, 0x00000000, 0x003F5ABC, 0x003F5AB1, 0x003F5AB5,
+        0x003F5ABF, 0x003F5AEE, 0x003F5AD6, 0x003F5AEB, 0x000003A0, 0x003FFFD0,
+        0x003F5ABD, 0x003F75C8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000028, 0x00000000, 0x00000027,
+        0x00000000, 0x00000022, 0x00000000,
+    };
+
+    static constexpr std::uint32_t upper[279] = {
+        0x00000000, 0x00000000, 0x003FFFE0, 0x000002E7, 0x00400000, 0x00000079,
+        0x00000000, 0x003FFFFF, 0x00000000, 0x003FFF18, 0x01C00000, 0x00000000,
+        0x003FFED4, 0x000000C3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000061, 0x00000000, 0x00000000,
+        0x000000A3, 0x00000000, 0x00000082, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000038, 0x00000000, 0x003FFFFF, 0x003FFFFE, 0x003FFFB1,
+        0x02C00000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00002A3F, 0x00000000, 0x00000000, 0x00000000, 0x00002A1F,
+        0x00002A1C, 0x00002A1E, 0x003FFF2E, 0x003FFF32, 0x003FFF33, 0x003FFF36,
+        0x003FFF35, 0x0000A54F, 0x0000A54B, 0x003FFF31, 0x0000A528, 0x0000A544,
+        0x003FFF2F, 0x003FFF2D, 0x000029F7, 0x0000A541, 0x000029FD, 0x003FFF2B,
+        0x003FFF2A, 0x000029E7, 0x003FFF26, 0x0000A543, 0x0000A52A, 0x003FFFBB,
+        0x003FFF27, 0x003FFFB9, 0x003FFF25, 0x0000A515, 0x0000A512, 0x00000054,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03C00000,
+        0x003FFFDA, 0x003FFFDB, 0x05400000, 0x003FFFE1, 0x003FFFC0, 0x003FFFC1,
+        0x00000000, 0x003FFFC2, 0x003FFFC7, 0x003FFFD1, 0x003FFFCA, 0x003FFFF8,
+        0x003FFFAA, 0x003FFFB0, 0x00000007, 0x003FFF8C, 0x00000000, 0x003FFFA0,
+        0x00000000, 0x00000000, 0x003FFFB0, 0x00000000, 0x003FFFF1, 0x00000000,
+        0x003FFFD0, 0x06C00000, 0x00000000, 0x00000BC0, 0x00000000, 0x00000000,
+        0x003FFFF8, 0x003FE792, 0x003FE793, 0x003FE79C, 0x003FE79E, 0x003FE79D,
+        0x003FE7A4, 0x003FE7DB, 0x000089C2, 0x00000000, 0x00008A04, 0x00000EE6,
+        0x00008A38, 0x07C00000, 0x08C00000, 0x09C00000, 0x0AC00000, 0x0BC00000,
+        0x003FFFC5, 0x00000000, 0x00000008, 0x00000000, 0x0CC00000, 0x0DC00000,
+        0x0F400000, 0x10C00000, 0x0000004A, 0x00000056, 0x00000064, 0x00000080,
+        0x00000070, 0x0000007E, 0x12400008, 0x13400008, 0x14400008, 0x15400008,
+        0x16400008, 0x17400008, 0x18400008, 0x19400008, 0x12400000, 0x13400000,
+        0x14400000, 0x15400000, 0x16400000, 0x17400000, 0x18400000, 0x19400000,
+        0x1A400008, 0x1B400008, 0x1C400008, 0x1D400008, 0x1E400008, 0x1F400008,
+        0x20400008, 0x21400008, 0x1A400000, 0x1B400000, 0x1C400000, 0x1D400000,
+        0x1E400000, 0x1F400000, 0x20400000, 0x21400000, 0x22400008, 0x23400008,
+        0x24400008, 0x25400008, 0x26400008, 0x27400008, 0x28400008, 0x29400008,
+        0x22400000, 0x23400000, 0x24400000, 0x25400000, 0x26400000, 0x27400000,
+        0x28400000, 0x29400000, 0x2A400000, 0x2B400009, 0x2C400000, 0x2D400000,
+        0x2E400000, 0x00000000, 0x2B400000, 0x003FE3DB, 0x2FC00000, 0x30C00009,
+        0x31C00000, 0x32C00000, 0x33C00000, 0x00000000, 0x30C00000, 0x35400000,
+        0x36C00000, 0x37C00000, 0x00000000, 0x39400000, 0x3AC00000, 0x3BC00000,
+        0x3CC00000, 0x00000000, 0x3E400000, 0x3F400009, 0x40400000, 0x41400000,
+        0x42400000, 0x00000000, 0x00000000, 0x3F400000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x003FFFE4, 0x00000000, 0x003FFFF0, 0x00000000,
+        0x003FFFE6, 0x00000000, 0x00000000, 0x00000000, 0x003FD5D5, 0x003FD5D8,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003FE3A0,
+        0x00000000, 0x00000000, 0x00000030, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x003FFC60, 0x003F6830, 0x43C00000, 0x44C00000,
+        0x45C00000, 0x46C00000, 0x48400000, 0x49C00000, 0x4AC00000, 0x4BC00000,
+        0x4CC00000, 0x4DC00000, 0x4EC00000, 0x00000000, 0x003FFFD8, 0x00000000,
+        0x003FFFD9, 0x00000000, 0x003FFFDE,
+    };
+
+    static constexpr std::uint32_t fold[279] = {
+        0x00000000, 0x00000020, 0x00000000, 0x00000307, 0x00C00000, 0x00000000,
+        0x00000001, 0x00000000, 0x01400000, 0x00000000, 0x02400000, 0x003FFF87,
+        0x003FFEF4, 0x00000000, 0x000000D2, 0x000000CE, 0x000000CD, 0x0000004F,
+        0x000000CA, 0x000000CB, 0x000000CF, 0x00000000, 0x000000D3, 0x000000D1,
+        0x00000000, 0x000000D5, 0x00000000, 0x000000D6, 0x000000DA, 0x000000D9,
+        0x000000DB, 0x00000000, 0x00000002, 0x00000001, 0x00000000, 0x00000000,
+        0x03400000, 0x003FFF9F, 0x003FFFC8, 0x003FFF7E, 0x00002A2B, 0x003FFF5D,
+        0x00002A28, 0x00000000, 0x003FFF3D, 0x00000045, 0x00000047, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000074,
+        0x00000074, 0x00000026, 0x00000025, 0x00000040, 0x0000003F, 0x04800000,
+        0x00000000, 0x00000000, 0x06000000, 0x00000001, 0x00000000, 0x00000000,
+        0x00000008, 0x003FFFE2, 0x003FFFE7, 0x003FFFF1, 0x003FFFEA, 0x00000000,
+        0x003FFFCA, 0x003FFFD0, 0x00000000, 0x00000000, 0x003FFFC4, 0x003FFFC0,
+        0x003FFFF9, 0x00000050, 0x00000000, 0x0000000F, 0x00000000, 0x00000030,
+        0x00000000, 0x07400000, 0x00001C60, 0x00000000, 0x00000000, 0x00000000,
+        0x003FFFF8, 0x003FE7B2, 0x003FE7B3, 0x003FE7BC, 0x003FE7BE, 0x003FE7BD,
+        0x003FE7C4, 0x003FE7DC, 0x000089C3, 0x003FF440, 0x00000000, 0x00000000,
+        0x00000000, 0x08400000, 0x09400000, 0x0A400000, 0x0B400000, 0x0C400000,
+        0x003FFFC6, 0x00FFE241, 0x00000000, 0x003FFFF8, 0x0D400000, 0x0E800000,
+        0x10000000, 0x11800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x12C00000, 0x13C00000, 0x14C00000, 0x15C00000,
+        0x16C00000, 0x17C00000, 0x18C00000, 0x19C00000, 0x12FFFFF8, 0x13FFFFF8,
+        0x14FFFFF8, 0x15FFFFF8, 0x16FFFFF8, 0x17FFFFF8, 0x18FFFFF8, 0x19FFFFF8,
+        0x1AC00000, 0x1BC00000, 0x1CC00000, 0x1DC00000, 0x1EC00000, 0x1FC00000,
+        0x20C00000, 0x21C00000, 0x1AFFFFF8, 0x1BFFFFF8, 0x1CFFFFF8, 0x1DFFFFF8,
+        0x1EFFFFF8, 0x1FFFFFF8, 0x20FFFFF8, 0x21FFFFF8, 0x22C00000, 0x23C00000,
+        0x24C00000, 0x25C00000, 0x26C00000, 0x27C00000, 0x28C00000, 0x29C00000,
+        0x22FFFFF8, 0x23FFFFF8, 0x24FFFFF8, 0x25FFFFF8, 0x26FFFFF8, 0x27FFFFF8,
+        0x28FFFFF8, 0x29FFFFF8, 0x2AC00000, 0x2BC00000, 0x2CC00000, 0x2DC00000,
+        0x2F000000, 0x003FFFB6, 0x2BFFFFF7, 0x003FE3FB, 0x30400000, 0x31400000,
+        0x32400000, 0x33400000, 0x34800000, 0x003FFFAA, 0x317FFFF7, 0x36000000,
+        0x37400000, 0x38800000, 0x003FFF9C, 0x3A000000, 0x3B400000, 0x3C400000,
+        0x3D800000, 0x003FFF90, 0x3EC00000, 0x3FC00000, 0x40C00000, 0x41C00000,
+        0x43000000, 0x003FFF80, 0x003FFF82, 0x3FFFFFF7, 0x003FE2A3, 0x003FDF41,
+        0x003FDFBA, 0x0000001C, 0x00000000, 0x00000010, 0x00000000, 0x0000001A,
+        0x00000000, 0x003FD609, 0x003FF11A, 0x003FD619, 0x00000000, 0x00000000,
+        0x003FD5E4, 0x003FD603, 0x003FD5E1, 0x003FD5E2, 0x003FD5C1, 0x00000000,
+        0x003F75FC, 0x003F5AD8, 0x00000000, 0x003F5ABC, 0x003F5AB1, 0x003F5AB5,
+        0x003F5ABF, 0x003F5AEE, 0x003F5AD6, 0x003F5AEB, 0x000003A0, 0x003FFFD0,
+        0x003F5ABD, 0x003F75C8, 0x00000000, 0x003F6830, 0x44400000, 0x45400000,
+        0x46400000, 0x47800000, 0x49000000, 0x4A400000, 0x4B400000, 0x4C400000,
+        0x4D400000, 0x4E400000, 0x4F400000, 0x00000028, 0x00000000, 0x00000027,
+        0x00000000, 0x00000022, 0x00000000,
+    };
+
+    static constexpr std::uint32_t special[319] = {
+        0x00000000, 0x00000053, 0x80000053, 0x00000073, 0x80000073, 0x00000069,
+        0x80000307, 0x000002BC, 0x8000004E, 0x000002BC, 0x8000006E, 0x0000004A,
+        0x8000030C, 0x0000006A, 0x8000030C, 0x00000399, 0x00000308, 0x80000301,
+        0x000003B9, 0x00000308, 0x80000301, 0x000003A5, 0x00000308, 0x80000301,
+        0x000003C5, 0x00000308, 0x80000301, 0x00000535, 0x80000552, 0x00000565,
+        0x80000582, 0x00000048, 0x80000331, 0x00000068, 0x80000331, 0x00000054,
+        0x80000308, 0x00000074, 0x80000308, 0x00000057, 0x8000030A, 0x00000077,
+        0x8000030A, 0x00000059, 0x8000030A, 0x00000079, 0x8000030A, 0x00000041,
+        0x800002BE, 0x00000061, 0x800002BE, 0x000003A5, 0x80000313, 0x000003C5,
+        0x80000313, 0x000003A5, 0x00000313, 0x80000300, 0x000003C5, 0x00000313,
+        0x80000300, 0x000003A5, 0x00000313, 0x80000301, 0x000003C5, 0x00000313,
+        0x80000301, 0x000003A5, 0x00000313, 0x80000342, 0x000003C5, 0x00000313,
+        0x80000342, 0x00001F08, 0x80000399, 0x00001F00, 0x800003B9, 0x00001F09,
+        0x80000399, 0x00001F01, 0x800003B9, 0x00001F0A, 0x80000399, 0x00001F02,
+        0x800003B9, 0x00001F0B, 0x80000399, 0x00001F03, 0x800003B9, 0x00001F0C,
+        0x80000399, 0x00001F04, 0x800003B9, 0x00001F0D, 0x80000399, 0x00001F05,
+        0x800003B9, 0x00001F0E, 0x80000399, 0x00001F06, 0x800003B9, 0x00001F0F,
+        0x80000399, 0x00001F07, 0x800003B9, 0x00001F28, 0x80000399, 0x00001F20,
+        0x800003B9, 0x00001F29, 0x80000399, 0x00001F21, 0x800003B9, 0x00001F2A,
+        0x80000399, 0x00001F22, 0x800003B9, 0x00001F2B, 0x80000399, 0x00001F23,
+        0x800003B9, 0x00001F2C, 0x80000399, 0x00001F24, 0x800003B9, 0x00001F2D,
+        0x80000399, 0x00001F25, 0x800003B9, 0x00001F2E, 0x80000399, 0x00001F26,
+        0x800003B9, 0x00001F2F, 0x80000399, 0x00001F27, 0x800003B9, 0x00001F68,
+        0x80000399, 0x00001F60, 0x800003B9, 0x00001F69, 0x80000399, 0x00001F61,
+        0x800003B9, 0x00001F6A, 0x80000399, 0x00001F62, 0x800003B9, 0x00001F6B,
+        0x80000399, 0x00001F63, 0x800003B9, 0x00001F6C, 0x80000399, 0x00001F64,
+        0x800003B9, 0x00001F6D, 0x80000399, 0x00001F65, 0x800003B9, 0x00001F6E,
+        0x80000399, 0x00001F66, 0x800003B9, 0x00001F6F, 0x80000399, 0x00001F67,
+        0x800003B9, 0x00001FBA, 0x80000399, 0x00001F70, 0x800003B9, 0x00000391,
+        0x80000399, 0x000003B1, 0x800003B9, 0x00000386, 0x80000399, 0x000003AC,
+        0x800003B9, 0x00000391, 0x80000342, 0x000003B1, 0x80000342, 0x00000391,
+        0x00000342, 0x80000399, 0x000003B1, 0x00000342, 0x800003B9, 0x00001FCA,
+        0x80000399, 0x00001F74, 0x800003B9, 0x00000397, 0x80000399, 0x000003B7,
+        0x800003B9, 0x00000389, 0x80000399, 0x000003AE, 0x800003B9, 0x00000397,
+        0x80000342, 0x000003B7, 0x80000342, 0x00000397, 0x00000342, 0x80000399,
+        0x000003B7, 0x00000342, 0x800003B9, 0x00000399, 0x00000308, 0x80000300,
+        0x000003B9, 0x00000308, 0x80000300, 0x00000399, 0x80000342, 0x000003B9,
+        0x80000342, 0x00000399, 0x00000308, 0x80000342, 0x000003B9, 0x00000308,
+        0x80000342, 0x000003A5, 0x00000308, 0x80000300, 0x000003C5, 0x00000308,
+        0x80000300, 0x000003A1, 0x80000313, 0x000003C1, 0x80000313, 0x000003A5,
+        0x80000342, 0x000003C5, 0x80000342, 0x000003A5, 0x00000308, 0x80000342,
+        0x000003C5, 0x00000308, 0x80000342, 0x00001FFA, 0x80000399, 0x00001F7C,
+        0x800003B9, 0x000003A9, 0x80000399, 0x000003C9, 0x800003B9, 0x0000038F,
+        0x80000399, 0x000003CE, 0x800003B9, 0x000003A9, 0x80000342, 0x000003C9,
+        0x80000342, 0x000003A9, 0x00000342, 0x80000399, 0x000003C9, 0x00000342,
+        0x800003B9, 0x00000046, 0x80000046, 0x00000066, 0x80000066, 0x00000046,
+        0x80000049, 0x00000066, 0x80000069, 0x00000046, 0x8000004C, 0x00000066,
+        0x8000006C, 0x00000046, 0x00000046, 0x80000049, 0x00000066, 0x00000066,
+        0x80000069, 0x00000046, 0x00000046, 0x8000004C, 0x00000066, 0x00000066,
+        0x8000006C, 0x00000053, 0x80000054, 0x00000073, 0x80000074, 0x00000544,
+        0x80000546, 0x00000574, 0x80000576, 0x00000544, 0x80000535, 0x00000574,
+        0x80000565, 0x00000544, 0x8000053B, 0x00000574, 0x8000056B, 0x0000054E,
+        0x80000546, 0x0000057E, 0x80000576, 0x00000544, 0x8000053D, 0x00000574,
+        0x8000056D,
+    };
+};
+
+template <typename T>
+constexpr int case_mapping_tables<T>::max_length;
+
+template <typename T>
+constexpr std::uint32_t case_mapping_tables<T>::lower[];
+
+template <typename T>
+constexpr std::uint32_t case_mapping_tables<T>::upper[];
+
+template <typename T>
+constexpr std::uint32_t case_mapping_tables<T>::fold[];
+
+template <typename T>
+constexpr std::uint32_t case_mapping_tables<T>::special[];
+
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
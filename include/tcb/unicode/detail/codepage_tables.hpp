@@ -0,0 +1,1885 @@
+
+// Generated by tools/gen_codepages.py -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_CODEPAGE_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_CODEPAGE_TABLES_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+namespace detail {
+
+// Each table provides:
+//  - to_unicode(): 256 entries mapping each byte to a BMP code point, with
+//    U+FFFD for bytes the code page leaves undefined
+//  - from_unicode(): the defined non-ASCII bytes as (code_point << 8 | byte),
+//    sorted for binary search
+
+// Windows-874 (Thai)
+struct cp874_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2026, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07,
+            0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+            0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17,
+            0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+            0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27,
+            0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+            0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37,
+            0x0E38, 0x0E39, 0x0E3A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0E3F,
+            0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47,
+            0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+            0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57,
+            0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 97;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x0E01A1, 0x0E02A2, 0x0E03A3, 0x0E04A4, 0x0E05A5,
+            0x0E06A6, 0x0E07A7, 0x0E08A8, 0x0E09A9, 0x0E0AAA, 0x0E0BAB,
+            0x0E0CAC, 0x0E0DAD, 0x0E0EAE, 0x0E0FAF, 0x0E10B0, 0x0E11B1,
+            0x0E12B2, 0x0E13B3, 0x0E14B4, 0x0E15B5, 0x0E16B6, 0x0E17B7,
+            0x0E18B8, 0x0E19B9, 0x0E1ABA, 0x0E1BBB, 0x0E1CBC, 0x0E1DBD,
+            0x0E1EBE, 0x0E1FBF, 0x0E20C0, 0x0E21C1, 0x0E22C2, 0x0E23C3,
+            0x0E24C4, 0x0E25C5, 0x0E26C6, 0x0E27C7, 0x0E28C8, 0x0E29C9,
+            0x0E2ACA, 0x0E2BCB, 0x0E2CCC, 0x0E2DCD, 0x0E2ECE, 0x0E2FCF,
+            0x0E30D0, 0x0E31D1, 0x0E32D2, 0x0E33D3, 0x0E34D4, 0x0E35D5,
+            0x0E36D6, 0x0E37D7, 0x0E38D8, 0x0E39D9, 0x0E3ADA, 0x0E3FDF,
+            0x0E40E0, 0x0E41E1, 0x0E42E2, 0x0E43E3, 0x0E44E4, 0x0E45E5,
+            0x0E46E6, 0x0E47E7, 0x0E48E8, 0x0E49E9, 0x0E4AEA, 0x0E4BEB,
+            0x0E4CEC, 0x0E4DED, 0x0E4EEE, 0x0E4FEF, 0x0E50F0, 0x0E51F1,
+            0x0E52F2, 0x0E53F3, 0x0E54F4, 0x0E55F5, 0x0E56F6, 0x0E57F7,
+            0x0E58F8, 0x0E59F9, 0x0E5AFA, 0x0E5BFB, 0x201396, 0x201497,
+            0x201891, 0x201992, 0x201C93, 0x201D94, 0x202295, 0x202685,
+            0x20AC80,
+        };
+        return table;
+    }
+};
+
+// Windows-1250 (Central European)
+struct cp1250_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021,
+            0xFFFD, 0x2030, 0x0160, 0x2039, 0x015A, 0x0164, 0x017D, 0x0179,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0xFFFD, 0x2122, 0x0161, 0x203A, 0x015B, 0x0165, 0x017E, 0x017A,
+            0x00A0, 0x02C7, 0x02D8, 0x0141, 0x00A4, 0x0104, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x015E, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x017B,
+            0x00B0, 0x00B1, 0x02DB, 0x0142, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x0105, 0x015F, 0x00BB, 0x013D, 0x02DD, 0x013E, 0x017C,
+            0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7,
+            0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+            0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7,
+            0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+            0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7,
+            0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+            0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7,
+            0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 123;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A4A4, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9,
+            0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00B0B0, 0x00B1B1,
+            0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00BBBB,
+            0x00C1C1, 0x00C2C2, 0x00C4C4, 0x00C7C7, 0x00C9C9, 0x00CBCB,
+            0x00CDCD, 0x00CECE, 0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7,
+            0x00DADA, 0x00DCDC, 0x00DDDD, 0x00DFDF, 0x00E1E1, 0x00E2E2,
+            0x00E4E4, 0x00E7E7, 0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE,
+            0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00FAFA, 0x00FCFC,
+            0x00FDFD, 0x0102C3, 0x0103E3, 0x0104A5, 0x0105B9, 0x0106C6,
+            0x0107E6, 0x010CC8, 0x010DE8, 0x010ECF, 0x010FEF, 0x0110D0,
+            0x0111F0, 0x0118CA, 0x0119EA, 0x011ACC, 0x011BEC, 0x0139C5,
+            0x013AE5, 0x013DBC, 0x013EBE, 0x0141A3, 0x0142B3, 0x0143D1,
+            0x0144F1, 0x0147D2, 0x0148F2, 0x0150D5, 0x0151F5, 0x0154C0,
+            0x0155E0, 0x0158D8, 0x0159F8, 0x015A8C, 0x015B9C, 0x015EAA,
+            0x015FBA, 0x01608A, 0x01619A, 0x0162DE, 0x0163FE, 0x01648D,
+            0x01659D, 0x016ED9, 0x016FF9, 0x0170DB, 0x0171FB, 0x01798F,
+            0x017A9F, 0x017BAF, 0x017CBF, 0x017D8E, 0x017E9E, 0x02C7A1,
+            0x02D8A2, 0x02D9FF, 0x02DBB2, 0x02DDBD, 0x201396, 0x201497,
+            0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84,
+            0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+            0x203A9B, 0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1251 (Cyrillic)
+struct cp1251_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+            0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0xFFFD, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+            0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+            0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+            0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+            0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+            0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+            0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+            0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+            0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+            0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+            0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+            0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+            0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 127;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A4A4, 0x00A6A6, 0x00A7A7, 0x00A9A9, 0x00ABAB,
+            0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00B0B0, 0x00B1B1, 0x00B5B5,
+            0x00B6B6, 0x00B7B7, 0x00BBBB, 0x0401A8, 0x040280, 0x040381,
+            0x0404AA, 0x0405BD, 0x0406B2, 0x0407AF, 0x0408A3, 0x04098A,
+            0x040A8C, 0x040B8E, 0x040C8D, 0x040EA1, 0x040F8F, 0x0410C0,
+            0x0411C1, 0x0412C2, 0x0413C3, 0x0414C4, 0x0415C5, 0x0416C6,
+            0x0417C7, 0x0418C8, 0x0419C9, 0x041ACA, 0x041BCB, 0x041CCC,
+            0x041DCD, 0x041ECE, 0x041FCF, 0x0420D0, 0x0421D1, 0x0422D2,
+            0x0423D3, 0x0424D4, 0x0425D5, 0x0426D6, 0x0427D7, 0x0428D8,
+            0x0429D9, 0x042ADA, 0x042BDB, 0x042CDC, 0x042DDD, 0x042EDE,
+            0x042FDF, 0x0430E0, 0x0431E1, 0x0432E2, 0x0433E3, 0x0434E4,
+            0x0435E5, 0x0436E6, 0x0437E7, 0x0438E8, 0x0439E9, 0x043AEA,
+            0x043BEB, 0x043CEC, 0x043DED, 0x043EEE, 0x043FEF, 0x0440F0,
+            0x0441F1, 0x0442F2, 0x0443F3, 0x0444F4, 0x0445F5, 0x0446F6,
+            0x0447F7, 0x0448F8, 0x0449F9, 0x044AFA, 0x044BFB, 0x044CFC,
+            0x044DFD, 0x044EFE, 0x044FFF, 0x0451B8, 0x045290, 0x045383,
+            0x0454BA, 0x0455BE, 0x0456B3, 0x0457BF, 0x0458BC, 0x04599A,
+            0x045A9C, 0x045B9E, 0x045C9D, 0x045EA2, 0x045F9F, 0x0490A5,
+            0x0491B4, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82,
+            0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295,
+            0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC88, 0x2116B9,
+            0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1252 (Western European)
+struct cp1252_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0x017D, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0x017E, 0x0178,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+            0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 123;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5,
+            0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+            0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1,
+            0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+            0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD,
+            0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+            0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9,
+            0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+            0x00D0D0, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5,
+            0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB,
+            0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF, 0x00E0E0, 0x00E1E1,
+            0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7,
+            0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED,
+            0x00EEEE, 0x00EFEF, 0x00F0F0, 0x00F1F1, 0x00F2F2, 0x00F3F3,
+            0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9,
+            0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x00FFFF,
+            0x01528C, 0x01539C, 0x01608A, 0x01619A, 0x01789F, 0x017D8E,
+            0x017E9E, 0x019283, 0x02C688, 0x02DC98, 0x201396, 0x201497,
+            0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84,
+            0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+            0x203A9B, 0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1253 (Greek)
+struct cp1253_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x00A0, 0x0385, 0x0386, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0xFFFD, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x2015,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x00B5, 0x00B6, 0x00B7,
+            0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+            0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+            0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+            0x03A0, 0x03A1, 0xFFFD, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+            0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+            0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+            0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+            0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+            0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 111;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7,
+            0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE,
+            0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B5B5, 0x00B6B6,
+            0x00B7B7, 0x00BBBB, 0x00BDBD, 0x019283, 0x0384B4, 0x0385A1,
+            0x0386A2, 0x0388B8, 0x0389B9, 0x038ABA, 0x038CBC, 0x038EBE,
+            0x038FBF, 0x0390C0, 0x0391C1, 0x0392C2, 0x0393C3, 0x0394C4,
+            0x0395C5, 0x0396C6, 0x0397C7, 0x0398C8, 0x0399C9, 0x039ACA,
+            0x039BCB, 0x039CCC, 0x039DCD, 0x039ECE, 0x039FCF, 0x03A0D0,
+            0x03A1D1, 0x03A3D3, 0x03A4D4, 0x03A5D5, 0x03A6D6, 0x03A7D7,
+            0x03A8D8, 0x03A9D9, 0x03AADA, 0x03ABDB, 0x03ACDC, 0x03ADDD,
+            0x03AEDE, 0x03AFDF, 0x03B0E0, 0x03B1E1, 0x03B2E2, 0x03B3E3,
+            0x03B4E4, 0x03B5E5, 0x03B6E6, 0x03B7E7, 0x03B8E8, 0x03B9E9,
+            0x03BAEA, 0x03BBEB, 0x03BCEC, 0x03BDED, 0x03BEEE, 0x03BFEF,
+            0x03C0F0, 0x03C1F1, 0x03C2F2, 0x03C3F3, 0x03C4F4, 0x03C5F5,
+            0x03C6F6, 0x03C7F7, 0x03C8F8, 0x03C9F9, 0x03CAFA, 0x03CBFB,
+            0x03CCFC, 0x03CDFD, 0x03CEFE, 0x201396, 0x201497, 0x2015AF,
+            0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84,
+            0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+            0x203A9B, 0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1254 (Turkish)
+struct cp1254_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+            0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 121;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5,
+            0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+            0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1,
+            0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+            0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD,
+            0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+            0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9,
+            0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+            0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6,
+            0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC,
+            0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4,
+            0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA,
+            0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1,
+            0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7,
+            0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF,
+            0x011ED0, 0x011FF0, 0x0130DD, 0x0131FD, 0x01528C, 0x01539C,
+            0x015EDE, 0x015FFE, 0x01608A, 0x01619A, 0x01789F, 0x019283,
+            0x02C688, 0x02DC98, 0x201396, 0x201497, 0x201891, 0x201992,
+            0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187,
+            0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC80,
+            0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1255 (Hebrew)
+struct cp1255_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AA, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+            0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7,
+            0x05B8, 0x05B9, 0xFFFD, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF,
+            0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05F0, 0x05F1, 0x05F2, 0x05F3,
+            0x05F4, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+            0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+            0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+            0x05E8, 0x05E9, 0x05EA, 0xFFFD, 0xFFFD, 0x200E, 0x200F, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 105;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A5A5, 0x00A6A6,
+            0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD,
+            0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3,
+            0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9,
+            0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00D7AA,
+            0x00F7BA, 0x019283, 0x02C688, 0x02DC98, 0x05B0C0, 0x05B1C1,
+            0x05B2C2, 0x05B3C3, 0x05B4C4, 0x05B5C5, 0x05B6C6, 0x05B7C7,
+            0x05B8C8, 0x05B9C9, 0x05BBCB, 0x05BCCC, 0x05BDCD, 0x05BECE,
+            0x05BFCF, 0x05C0D0, 0x05C1D1, 0x05C2D2, 0x05C3D3, 0x05D0E0,
+            0x05D1E1, 0x05D2E2, 0x05D3E3, 0x05D4E4, 0x05D5E5, 0x05D6E6,
+            0x05D7E7, 0x05D8E8, 0x05D9E9, 0x05DAEA, 0x05DBEB, 0x05DCEC,
+            0x05DDED, 0x05DEEE, 0x05DFEF, 0x05E0F0, 0x05E1F1, 0x05E2F2,
+            0x05E3F3, 0x05E4F4, 0x05E5F5, 0x05E6F6, 0x05E7F7, 0x05E8F8,
+            0x05E9F9, 0x05EAFA, 0x05F0D4, 0x05F1D5, 0x05F2D6, 0x05F3D7,
+            0x05F4D8, 0x200EFD, 0x200FFE, 0x201396, 0x201497, 0x201891,
+            0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+            0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B,
+            0x20AAA4, 0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1256 (Arabic)
+struct cp1256_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0x067E, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688,
+            0x06AF, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x06A9, 0x2122, 0x0691, 0x203A, 0x0153, 0x200C, 0x200D, 0x06BA,
+            0x00A0, 0x060C, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x06BE, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x061B, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x061F,
+            0x06C1, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+            0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+            0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x00D7,
+            0x0637, 0x0638, 0x0639, 0x063A, 0x0640, 0x0641, 0x0642, 0x0643,
+            0x00E0, 0x0644, 0x00E2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0649, 0x064A, 0x00EE, 0x00EF,
+            0x064B, 0x064C, 0x064D, 0x064E, 0x00F4, 0x064F, 0x0650, 0x00F7,
+            0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x06D2,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6,
+            0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD,
+            0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3,
+            0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9,
+            0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00D7D7, 0x00E0E0,
+            0x00E2E2, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB,
+            0x00EEEE, 0x00EFEF, 0x00F4F4, 0x00F7F7, 0x00F9F9, 0x00FBFB,
+            0x00FCFC, 0x01528C, 0x01539C, 0x019283, 0x02C688, 0x060CA1,
+            0x061BBA, 0x061FBF, 0x0621C1, 0x0622C2, 0x0623C3, 0x0624C4,
+            0x0625C5, 0x0626C6, 0x0627C7, 0x0628C8, 0x0629C9, 0x062ACA,
+            0x062BCB, 0x062CCC, 0x062DCD, 0x062ECE, 0x062FCF, 0x0630D0,
+            0x0631D1, 0x0632D2, 0x0633D3, 0x0634D4, 0x0635D5, 0x0636D6,
+            0x0637D8, 0x0638D9, 0x0639DA, 0x063ADB, 0x0640DC, 0x0641DD,
+            0x0642DE, 0x0643DF, 0x0644E1, 0x0645E3, 0x0646E4, 0x0647E5,
+            0x0648E6, 0x0649EC, 0x064AED, 0x064BF0, 0x064CF1, 0x064DF2,
+            0x064EF3, 0x064FF5, 0x0650F6, 0x0651F8, 0x0652FA, 0x06798A,
+            0x067E81, 0x06868D, 0x06888F, 0x06919A, 0x06988E, 0x06A998,
+            0x06AF90, 0x06BA9F, 0x06BEAA, 0x06C1C0, 0x06D2FF, 0x200C9D,
+            0x200D9E, 0x200EFD, 0x200FFE, 0x201396, 0x201497, 0x201891,
+            0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+            0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B,
+            0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1257 (Baltic)
+struct cp1257_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0xFFFD, 0x201E, 0x2026, 0x2020, 0x2021,
+            0xFFFD, 0x2030, 0xFFFD, 0x2039, 0xFFFD, 0x00A8, 0x02C7, 0x00B8,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0xFFFD, 0x2122, 0xFFFD, 0x203A, 0xFFFD, 0x00AF, 0x02DB, 0xFFFD,
+            0x00A0, 0xFFFD, 0x00A2, 0x00A3, 0x00A4, 0xFFFD, 0x00A6, 0x00A7,
+            0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+            0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112,
+            0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+            0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7,
+            0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+            0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113,
+            0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+            0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7,
+            0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x02D9,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 116;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A6A6, 0x00A7A7,
+            0x00A88D, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE,
+            0x00AF9D, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4,
+            0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B88F, 0x00B9B9, 0x00BBBB,
+            0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00C4C4, 0x00C5C5, 0x00C6AF,
+            0x00C9C9, 0x00D3D3, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8A8,
+            0x00DCDC, 0x00DFDF, 0x00E4E4, 0x00E5E5, 0x00E6BF, 0x00E9E9,
+            0x00F3F3, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8B8, 0x00FCFC,
+            0x0100C2, 0x0101E2, 0x0104C0, 0x0105E0, 0x0106C3, 0x0107E3,
+            0x010CC8, 0x010DE8, 0x0112C7, 0x0113E7, 0x0116CB, 0x0117EB,
+            0x0118C6, 0x0119E6, 0x0122CC, 0x0123EC, 0x012ACE, 0x012BEE,
+            0x012EC1, 0x012FE1, 0x0136CD, 0x0137ED, 0x013BCF, 0x013CEF,
+            0x0141D9, 0x0142F9, 0x0143D1, 0x0144F1, 0x0145D2, 0x0146F2,
+            0x014CD4, 0x014DF4, 0x0156AA, 0x0157BA, 0x015ADA, 0x015BFA,
+            0x0160D0, 0x0161F0, 0x016ADB, 0x016BFB, 0x0172D8, 0x0173F8,
+            0x0179CA, 0x017AEA, 0x017BDD, 0x017CFD, 0x017DDE, 0x017EFE,
+            0x02C78E, 0x02D9FF, 0x02DB9E, 0x201396, 0x201497, 0x201891,
+            0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+            0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B,
+            0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// Windows-1258 (Vietnamese)
+struct cp1258_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x20AC, 0xFFFD, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0xFFFD, 0x2039, 0x0152, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0xFFFD, 0x203A, 0x0153, 0xFFFD, 0xFFFD, 0x0178,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+            0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x0300, 0x00CD, 0x00CE, 0x00CF,
+            0x0110, 0x00D1, 0x0309, 0x00D3, 0x00D4, 0x01A0, 0x00D6, 0x00D7,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x01AF, 0x0303, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0301, 0x00ED, 0x00EE, 0x00EF,
+            0x0111, 0x00F1, 0x0323, 0x00F3, 0x00F4, 0x01A1, 0x00F6, 0x00F7,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x01B0, 0x20AB, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 119;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5,
+            0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+            0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1,
+            0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+            0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD,
+            0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C4C4,
+            0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA,
+            0x00CBCB, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1, 0x00D3D3,
+            0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA,
+            0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2,
+            0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9,
+            0x00EAEA, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1,
+            0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9,
+            0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF, 0x0102C3, 0x0103E3,
+            0x0110D0, 0x0111F0, 0x01528C, 0x01539C, 0x01789F, 0x019283,
+            0x01A0D5, 0x01A1F5, 0x01AFDD, 0x01B0FD, 0x02C688, 0x02DC98,
+            0x0300CC, 0x0301EC, 0x0303DE, 0x0309D2, 0x0323F2, 0x201396,
+            0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94,
+            0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089,
+            0x20398B, 0x203A9B, 0x20ABFE, 0x20AC80, 0x212299,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-2 (Latin-2)
+struct iso8859_2_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0104, 0x02D8, 0x0141, 0x00A4, 0x013D, 0x015A, 0x00A7,
+            0x00A8, 0x0160, 0x015E, 0x0164, 0x0179, 0x00AD, 0x017D, 0x017B,
+            0x00B0, 0x0105, 0x02DB, 0x0142, 0x00B4, 0x013E, 0x015B, 0x02C7,
+            0x00B8, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C,
+            0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7,
+            0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+            0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7,
+            0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+            0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7,
+            0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+            0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7,
+            0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00A7A7, 0x00A8A8,
+            0x00ADAD, 0x00B0B0, 0x00B4B4, 0x00B8B8, 0x00C1C1, 0x00C2C2,
+            0x00C4C4, 0x00C7C7, 0x00C9C9, 0x00CBCB, 0x00CDCD, 0x00CECE,
+            0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00DADA, 0x00DCDC,
+            0x00DDDD, 0x00DFDF, 0x00E1E1, 0x00E2E2, 0x00E4E4, 0x00E7E7,
+            0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00F3F3, 0x00F4F4,
+            0x00F6F6, 0x00F7F7, 0x00FAFA, 0x00FCFC, 0x00FDFD, 0x0102C3,
+            0x0103E3, 0x0104A1, 0x0105B1, 0x0106C6, 0x0107E6, 0x010CC8,
+            0x010DE8, 0x010ECF, 0x010FEF, 0x0110D0, 0x0111F0, 0x0118CA,
+            0x0119EA, 0x011ACC, 0x011BEC, 0x0139C5, 0x013AE5, 0x013DA5,
+            0x013EB5, 0x0141A3, 0x0142B3, 0x0143D1, 0x0144F1, 0x0147D2,
+            0x0148F2, 0x0150D5, 0x0151F5, 0x0154C0, 0x0155E0, 0x0158D8,
+            0x0159F8, 0x015AA6, 0x015BB6, 0x015EAA, 0x015FBA, 0x0160A9,
+            0x0161B9, 0x0162DE, 0x0163FE, 0x0164AB, 0x0165BB, 0x016ED9,
+            0x016FF9, 0x0170DB, 0x0171FB, 0x0179AC, 0x017ABC, 0x017BAF,
+            0x017CBF, 0x017DAE, 0x017EBE, 0x02C7B7, 0x02D8A2, 0x02D9FF,
+            0x02DBB2, 0x02DDBD,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-3 (Latin-3)
+struct iso8859_3_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0126, 0x02D8, 0x00A3, 0x00A4, 0xFFFD, 0x0124, 0x00A7,
+            0x00A8, 0x0130, 0x015E, 0x011E, 0x0134, 0x00AD, 0xFFFD, 0x017B,
+            0x00B0, 0x0127, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0125, 0x00B7,
+            0x00B8, 0x0131, 0x015F, 0x011F, 0x0135, 0x00BD, 0xFFFD, 0x017C,
+            0x00C0, 0x00C1, 0x00C2, 0xFFFD, 0x00C4, 0x010A, 0x0108, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0xFFFD, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x0120, 0x00D6, 0x00D7,
+            0x011C, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x016C, 0x015C, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0xFFFD, 0x00E4, 0x010B, 0x0109, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0xFFFD, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x0121, 0x00F6, 0x00F7,
+            0x011D, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x016D, 0x015D, 0x02D9,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 121;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A4A4, 0x00A7A7,
+            0x00A8A8, 0x00ADAD, 0x00B0B0, 0x00B2B2, 0x00B3B3, 0x00B4B4,
+            0x00B5B5, 0x00B7B7, 0x00B8B8, 0x00BDBD, 0x00C0C0, 0x00C1C1,
+            0x00C2C2, 0x00C4C4, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA,
+            0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1,
+            0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00D9D9,
+            0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1,
+            0x00E2E2, 0x00E4E4, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA,
+            0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1,
+            0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00F9F9,
+            0x00FAFA, 0x00FBFB, 0x00FCFC, 0x0108C6, 0x0109E6, 0x010AC5,
+            0x010BE5, 0x011CD8, 0x011DF8, 0x011EAB, 0x011FBB, 0x0120D5,
+            0x0121F5, 0x0124A6, 0x0125B6, 0x0126A1, 0x0127B1, 0x0130A9,
+            0x0131B9, 0x0134AC, 0x0135BC, 0x015CDE, 0x015DFE, 0x015EAA,
+            0x015FBA, 0x016CDD, 0x016DFD, 0x017BAF, 0x017CBF, 0x02D8A2,
+            0x02D9FF,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-4 (Latin-4)
+struct iso8859_4_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0104, 0x0138, 0x0156, 0x00A4, 0x0128, 0x013B, 0x00A7,
+            0x00A8, 0x0160, 0x0112, 0x0122, 0x0166, 0x00AD, 0x017D, 0x00AF,
+            0x00B0, 0x0105, 0x02DB, 0x0157, 0x00B4, 0x0129, 0x013C, 0x02C7,
+            0x00B8, 0x0161, 0x0113, 0x0123, 0x0167, 0x014A, 0x017E, 0x014B,
+            0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E,
+            0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x012A,
+            0x0110, 0x0145, 0x014C, 0x0136, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+            0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x0168, 0x016A, 0x00DF,
+            0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F,
+            0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x012B,
+            0x0111, 0x0146, 0x014D, 0x0137, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+            0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x0169, 0x016B, 0x02D9,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00A7A7, 0x00A8A8,
+            0x00ADAD, 0x00AFAF, 0x00B0B0, 0x00B4B4, 0x00B8B8, 0x00C1C1,
+            0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C9C9,
+            0x00CBCB, 0x00CDCD, 0x00CECE, 0x00D4D4, 0x00D5D5, 0x00D6D6,
+            0x00D7D7, 0x00D8D8, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF,
+            0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6,
+            0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00F4F4, 0x00F5F5,
+            0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00FAFA, 0x00FBFB, 0x00FCFC,
+            0x0100C0, 0x0101E0, 0x0104A1, 0x0105B1, 0x010CC8, 0x010DE8,
+            0x0110D0, 0x0111F0, 0x0112AA, 0x0113BA, 0x0116CC, 0x0117EC,
+            0x0118CA, 0x0119EA, 0x0122AB, 0x0123BB, 0x0128A5, 0x0129B5,
+            0x012ACF, 0x012BEF, 0x012EC7, 0x012FE7, 0x0136D3, 0x0137F3,
+            0x0138A2, 0x013BA6, 0x013CB6, 0x0145D1, 0x0146F1, 0x014ABD,
+            0x014BBF, 0x014CD2, 0x014DF2, 0x0156A3, 0x0157B3, 0x0160A9,
+            0x0161B9, 0x0166AC, 0x0167BC, 0x0168DD, 0x0169FD, 0x016ADE,
+            0x016BFE, 0x0172D9, 0x0173F9, 0x017DAE, 0x017EBE, 0x02C7B7,
+            0x02D9FF, 0x02DBB2,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-5 (Cyrillic)
+struct iso8859_5_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407,
+            0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x00AD, 0x040E, 0x040F,
+            0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+            0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+            0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+            0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+            0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+            0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+            0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+            0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+            0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+            0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x00A7, 0x045E, 0x045F,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7FD, 0x00ADAD, 0x0401A1,
+            0x0402A2, 0x0403A3, 0x0404A4, 0x0405A5, 0x0406A6, 0x0407A7,
+            0x0408A8, 0x0409A9, 0x040AAA, 0x040BAB, 0x040CAC, 0x040EAE,
+            0x040FAF, 0x0410B0, 0x0411B1, 0x0412B2, 0x0413B3, 0x0414B4,
+            0x0415B5, 0x0416B6, 0x0417B7, 0x0418B8, 0x0419B9, 0x041ABA,
+            0x041BBB, 0x041CBC, 0x041DBD, 0x041EBE, 0x041FBF, 0x0420C0,
+            0x0421C1, 0x0422C2, 0x0423C3, 0x0424C4, 0x0425C5, 0x0426C6,
+            0x0427C7, 0x0428C8, 0x0429C9, 0x042ACA, 0x042BCB, 0x042CCC,
+            0x042DCD, 0x042ECE, 0x042FCF, 0x0430D0, 0x0431D1, 0x0432D2,
+            0x0433D3, 0x0434D4, 0x0435D5, 0x0436D6, 0x0437D7, 0x0438D8,
+            0x0439D9, 0x043ADA, 0x043BDB, 0x043CDC, 0x043DDD, 0x043EDE,
+            0x043FDF, 0x0440E0, 0x0441E1, 0x0442E2, 0x0443E3, 0x0444E4,
+            0x0445E5, 0x0446E6, 0x0447E7, 0x0448E8, 0x0449E9, 0x044AEA,
+            0x044BEB, 0x044CEC, 0x044DED, 0x044EEE, 0x044FEF, 0x0451F1,
+            0x0452F2, 0x0453F3, 0x0454F4, 0x0455F5, 0x0456F6, 0x0457F7,
+            0x0458F8, 0x0459F9, 0x045AFA, 0x045BFB, 0x045CFC, 0x045EFE,
+            0x045FFF, 0x2116F0,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-6 (Arabic)
+struct iso8859_6_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0xFFFD, 0xFFFD, 0xFFFD, 0x00A4, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x060C, 0x00AD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0x061B, 0xFFFD, 0xFFFD, 0xFFFD, 0x061F,
+            0xFFFD, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+            0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+            0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+            0x0638, 0x0639, 0x063A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+            0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+            0x0650, 0x0651, 0x0652, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 83;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00ADAD, 0x060CAC,
+            0x061BBB, 0x061FBF, 0x0621C1, 0x0622C2, 0x0623C3, 0x0624C4,
+            0x0625C5, 0x0626C6, 0x0627C7, 0x0628C8, 0x0629C9, 0x062ACA,
+            0x062BCB, 0x062CCC, 0x062DCD, 0x062ECE, 0x062FCF, 0x0630D0,
+            0x0631D1, 0x0632D2, 0x0633D3, 0x0634D4, 0x0635D5, 0x0636D6,
+            0x0637D7, 0x0638D8, 0x0639D9, 0x063ADA, 0x0640E0, 0x0641E1,
+            0x0642E2, 0x0643E3, 0x0644E4, 0x0645E5, 0x0646E6, 0x0647E7,
+            0x0648E8, 0x0649E9, 0x064AEA, 0x064BEB, 0x064CEC, 0x064DED,
+            0x064EEE, 0x064FEF, 0x0650F0, 0x0651F1, 0x0652F2,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-7 (Greek)
+struct iso8859_7_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x2018, 0x2019, 0x00A3, 0x20AC, 0x20AF, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x037A, 0x00AB, 0x00AC, 0x00AD, 0xFFFD, 0x2015,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x0385, 0x0386, 0x00B7,
+            0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+            0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+            0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+            0x03A0, 0x03A1, 0xFFFD, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+            0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+            0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+            0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+            0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+            0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 125;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A6A6, 0x00A7A7,
+            0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00B0B0,
+            0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B7B7, 0x00BBBB, 0x00BDBD,
+            0x037AAA, 0x0384B4, 0x0385B5, 0x0386B6, 0x0388B8, 0x0389B9,
+            0x038ABA, 0x038CBC, 0x038EBE, 0x038FBF, 0x0390C0, 0x0391C1,
+            0x0392C2, 0x0393C3, 0x0394C4, 0x0395C5, 0x0396C6, 0x0397C7,
+            0x0398C8, 0x0399C9, 0x039ACA, 0x039BCB, 0x039CCC, 0x039DCD,
+            0x039ECE, 0x039FCF, 0x03A0D0, 0x03A1D1, 0x03A3D3, 0x03A4D4,
+            0x03A5D5, 0x03A6D6, 0x03A7D7, 0x03A8D8, 0x03A9D9, 0x03AADA,
+            0x03ABDB, 0x03ACDC, 0x03ADDD, 0x03AEDE, 0x03AFDF, 0x03B0E0,
+            0x03B1E1, 0x03B2E2, 0x03B3E3, 0x03B4E4, 0x03B5E5, 0x03B6E6,
+            0x03B7E7, 0x03B8E8, 0x03B9E9, 0x03BAEA, 0x03BBEB, 0x03BCEC,
+            0x03BDED, 0x03BEEE, 0x03BFEF, 0x03C0F0, 0x03C1F1, 0x03C2F2,
+            0x03C3F3, 0x03C4F4, 0x03C5F5, 0x03C6F6, 0x03C7F7, 0x03C8F8,
+            0x03C9F9, 0x03CAFA, 0x03CBFB, 0x03CCFC, 0x03CDFD, 0x03CEFE,
+            0x2015AF, 0x2018A1, 0x2019A2, 0x20ACA4, 0x20AFA5,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-8 (Hebrew)
+struct iso8859_8_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0xFFFD, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+            0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x2017,
+            0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+            0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+            0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+            0x05E8, 0x05E9, 0x05EA, 0xFFFD, 0xFFFD, 0x200E, 0x200F, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 92;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4,
+            0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB,
+            0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1,
+            0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+            0x00B8B8, 0x00B9B9, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE,
+            0x00D7AA, 0x00F7BA, 0x05D0E0, 0x05D1E1, 0x05D2E2, 0x05D3E3,
+            0x05D4E4, 0x05D5E5, 0x05D6E6, 0x05D7E7, 0x05D8E8, 0x05D9E9,
+            0x05DAEA, 0x05DBEB, 0x05DCEC, 0x05DDED, 0x05DEEE, 0x05DFEF,
+            0x05E0F0, 0x05E1F1, 0x05E2F2, 0x05E3F3, 0x05E4F4, 0x05E5F5,
+            0x05E6F6, 0x05E7F7, 0x05E8F8, 0x05E9F9, 0x05EAFA, 0x200EFD,
+            0x200FFE, 0x2017DF,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-9 (Latin-5)
+struct iso8859_9_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+            0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+            0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+            0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3,
+            0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9,
+            0x00AAAA, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF,
+            0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5,
+            0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB,
+            0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1,
+            0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7,
+            0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD,
+            0x00CECE, 0x00CFCF, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4,
+            0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA,
+            0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2,
+            0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8,
+            0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE,
+            0x00EFEF, 0x00F1F1, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5,
+            0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB,
+            0x00FCFC, 0x00FFFF, 0x011ED0, 0x011FF0, 0x0130DD, 0x0131FD,
+            0x015EDE, 0x015FFE,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-10 (Latin-6)
+struct iso8859_10_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0104, 0x0112, 0x0122, 0x012A, 0x0128, 0x0136, 0x00A7,
+            0x013B, 0x0110, 0x0160, 0x0166, 0x017D, 0x00AD, 0x016A, 0x014A,
+            0x00B0, 0x0105, 0x0113, 0x0123, 0x012B, 0x0129, 0x0137, 0x00B7,
+            0x013C, 0x0111, 0x0161, 0x0167, 0x017E, 0x2015, 0x016B, 0x014B,
+            0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E,
+            0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x00CF,
+            0x00D0, 0x0145, 0x014C, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0168,
+            0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+            0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F,
+            0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x00EF,
+            0x00F0, 0x0146, 0x014D, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0169,
+            0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0138,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7A7, 0x00ADAD, 0x00B0B0,
+            0x00B7B7, 0x00C1C1, 0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5,
+            0x00C6C6, 0x00C9C9, 0x00CBCB, 0x00CDCD, 0x00CECE, 0x00CFCF,
+            0x00D0D0, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D8D8,
+            0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF,
+            0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6,
+            0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F0F0,
+            0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F8F8, 0x00FAFA,
+            0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x0100C0, 0x0101E0,
+            0x0104A1, 0x0105B1, 0x010CC8, 0x010DE8, 0x0110A9, 0x0111B9,
+            0x0112A2, 0x0113B2, 0x0116CC, 0x0117EC, 0x0118CA, 0x0119EA,
+            0x0122A3, 0x0123B3, 0x0128A5, 0x0129B5, 0x012AA4, 0x012BB4,
+            0x012EC7, 0x012FE7, 0x0136A6, 0x0137B6, 0x0138FF, 0x013BA8,
+            0x013CB8, 0x0145D1, 0x0146F1, 0x014AAF, 0x014BBF, 0x014CD2,
+            0x014DF2, 0x0160AA, 0x0161BA, 0x0166AB, 0x0167BB, 0x0168D7,
+            0x0169F7, 0x016AAE, 0x016BBE, 0x0172D9, 0x0173F9, 0x017DAC,
+            0x017EBC, 0x2015BD,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-11 (Thai)
+struct iso8859_11_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07,
+            0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+            0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17,
+            0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+            0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27,
+            0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+            0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37,
+            0x0E38, 0x0E39, 0x0E3A, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x0E3F,
+            0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47,
+            0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+            0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57,
+            0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 120;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x0E01A1, 0x0E02A2, 0x0E03A3,
+            0x0E04A4, 0x0E05A5, 0x0E06A6, 0x0E07A7, 0x0E08A8, 0x0E09A9,
+            0x0E0AAA, 0x0E0BAB, 0x0E0CAC, 0x0E0DAD, 0x0E0EAE, 0x0E0FAF,
+            0x0E10B0, 0x0E11B1, 0x0E12B2, 0x0E13B3, 0x0E14B4, 0x0E15B5,
+            0x0E16B6, 0x0E17B7, 0x0E18B8, 0x0E19B9, 0x0E1ABA, 0x0E1BBB,
+            0x0E1CBC, 0x0E1DBD, 0x0E1EBE, 0x0E1FBF, 0x0E20C0, 0x0E21C1,
+            0x0E22C2, 0x0E23C3, 0x0E24C4, 0x0E25C5, 0x0E26C6, 0x0E27C7,
+            0x0E28C8, 0x0E29C9, 0x0E2ACA, 0x0E2BCB, 0x0E2CCC, 0x0E2DCD,
+            0x0E2ECE, 0x0E2FCF, 0x0E30D0, 0x0E31D1, 0x0E32D2, 0x0E33D3,
+            0x0E34D4, 0x0E35D5, 0x0E36D6, 0x0E37D7, 0x0E38D8, 0x0E39D9,
+            0x0E3ADA, 0x0E3FDF, 0x0E40E0, 0x0E41E1, 0x0E42E2, 0x0E43E3,
+            0x0E44E4, 0x0E45E5, 0x0E46E6, 0x0E47E7, 0x0E48E8, 0x0E49E9,
+            0x0E4AEA, 0x0E4BEB, 0x0E4CEC, 0x0E4DED, 0x0E4EEE, 0x0E4FEF,
+            0x0E50F0, 0x0E51F1, 0x0E52F2, 0x0E53F3, 0x0E54F4, 0x0E55F5,
+            0x0E56F6, 0x0E57F7, 0x0E58F8, 0x0E59F9, 0x0E5AFA, 0x0E5BFB,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-13 (Latin-7)
+struct iso8859_13_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x201D, 0x00A2, 0x00A3, 0x00A4, 0x201E, 0x00A6, 0x00A7,
+            0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x201C, 0x00B5, 0x00B6, 0x00B7,
+            0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+            0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112,
+            0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+            0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7,
+            0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+            0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113,
+            0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+            0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7,
+            0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x2019,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4,
+            0x00A6A6, 0x00A7A7, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD,
+            0x00AEAE, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B5B5,
+            0x00B6B6, 0x00B7B7, 0x00B9B9, 0x00BBBB, 0x00BCBC, 0x00BDBD,
+            0x00BEBE, 0x00C4C4, 0x00C5C5, 0x00C6AF, 0x00C9C9, 0x00D3D3,
+            0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8A8, 0x00DCDC, 0x00DFDF,
+            0x00E4E4, 0x00E5E5, 0x00E6BF, 0x00E9E9, 0x00F3F3, 0x00F5F5,
+            0x00F6F6, 0x00F7F7, 0x00F8B8, 0x00FCFC, 0x0100C2, 0x0101E2,
+            0x0104C0, 0x0105E0, 0x0106C3, 0x0107E3, 0x010CC8, 0x010DE8,
+            0x0112C7, 0x0113E7, 0x0116CB, 0x0117EB, 0x0118C6, 0x0119E6,
+            0x0122CC, 0x0123EC, 0x012ACE, 0x012BEE, 0x012EC1, 0x012FE1,
+            0x0136CD, 0x0137ED, 0x013BCF, 0x013CEF, 0x0141D9, 0x0142F9,
+            0x0143D1, 0x0144F1, 0x0145D2, 0x0146F2, 0x014CD4, 0x014DF4,
+            0x0156AA, 0x0157BA, 0x015ADA, 0x015BFA, 0x0160D0, 0x0161F0,
+            0x016ADB, 0x016BFB, 0x0172D8, 0x0173F8, 0x0179CA, 0x017AEA,
+            0x017BDD, 0x017CFD, 0x017DDE, 0x017EFE, 0x2019FF, 0x201CB4,
+            0x201DA1, 0x201EA5,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-14 (Latin-8)
+struct iso8859_14_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x1E02, 0x1E03, 0x00A3, 0x010A, 0x010B, 0x1E0A, 0x00A7,
+            0x1E80, 0x00A9, 0x1E82, 0x1E0B, 0x1EF2, 0x00AD, 0x00AE, 0x0178,
+            0x1E1E, 0x1E1F, 0x0120, 0x0121, 0x1E40, 0x1E41, 0x00B6, 0x1E56,
+            0x1E81, 0x1E57, 0x1E83, 0x1E60, 0x1EF3, 0x1E84, 0x1E85, 0x1E61,
+            0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x0174, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x1E6A,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x0176, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x0175, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x1E6B,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x0177, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A7A7, 0x00A9A9,
+            0x00ADAD, 0x00AEAE, 0x00B6B6, 0x00C0C0, 0x00C1C1, 0x00C2C2,
+            0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8,
+            0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE,
+            0x00CFCF, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5,
+            0x00D6D6, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC,
+            0x00DDDD, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3,
+            0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9,
+            0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF,
+            0x00F1F1, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6,
+            0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD,
+            0x00FFFF, 0x010AA4, 0x010BA5, 0x0120B2, 0x0121B3, 0x0174D0,
+            0x0175F0, 0x0176DE, 0x0177FE, 0x0178AF, 0x1E02A1, 0x1E03A2,
+            0x1E0AA6, 0x1E0BAB, 0x1E1EB0, 0x1E1FB1, 0x1E40B4, 0x1E41B5,
+            0x1E56B7, 0x1E57B9, 0x1E60BB, 0x1E61BF, 0x1E6AD7, 0x1E6BF7,
+            0x1E80A8, 0x1E81B8, 0x1E82AA, 0x1E83BA, 0x1E84BD, 0x1E85BE,
+            0x1EF2AC, 0x1EF3BC,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-15 (Latin-9)
+struct iso8859_15_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AC, 0x00A5, 0x0160, 0x00A7,
+            0x0161, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x017D, 0x00B5, 0x00B6, 0x00B7,
+            0x017E, 0x00B9, 0x00BA, 0x00BB, 0x0152, 0x0153, 0x0178, 0x00BF,
+            0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+            0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+            0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3,
+            0x00A5A5, 0x00A7A7, 0x00A9A9, 0x00AAAA, 0x00ABAB, 0x00ACAC,
+            0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2,
+            0x00B3B3, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B9B9, 0x00BABA,
+            0x00BBBB, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+            0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9,
+            0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+            0x00D0D0, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5,
+            0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB,
+            0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF, 0x00E0E0, 0x00E1E1,
+            0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7,
+            0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED,
+            0x00EEEE, 0x00EFEF, 0x00F0F0, 0x00F1F1, 0x00F2F2, 0x00F3F3,
+            0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9,
+            0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x00FFFF,
+            0x0152BC, 0x0153BD, 0x0160A6, 0x0161A8, 0x0178BE, 0x017DB4,
+            0x017EB8, 0x20ACA4,
+        };
+        return table;
+    }
+};
+
+// ISO-8859-16 (Latin-10)
+struct iso8859_16_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+            0x00A0, 0x0104, 0x0105, 0x0141, 0x20AC, 0x201E, 0x0160, 0x00A7,
+            0x0161, 0x00A9, 0x0218, 0x00AB, 0x0179, 0x00AD, 0x017A, 0x017B,
+            0x00B0, 0x00B1, 0x010C, 0x0142, 0x017D, 0x201D, 0x00B6, 0x00B7,
+            0x017E, 0x010D, 0x0219, 0x00BB, 0x0152, 0x0153, 0x0178, 0x017C,
+            0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0106, 0x00C6, 0x00C7,
+            0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+            0x0110, 0x0143, 0x00D2, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x015A,
+            0x0170, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0118, 0x021A, 0x00DF,
+            0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x0107, 0x00E6, 0x00E7,
+            0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+            0x0111, 0x0144, 0x00F2, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x015B,
+            0x0171, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0119, 0x021B, 0x00FF,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585,
+            0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+            0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191,
+            0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+            0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D,
+            0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7A7, 0x00A9A9, 0x00ABAB,
+            0x00ADAD, 0x00B0B0, 0x00B1B1, 0x00B6B6, 0x00B7B7, 0x00BBBB,
+            0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C4C4, 0x00C6C6, 0x00C7C7,
+            0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD,
+            0x00CECE, 0x00CFCF, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D6D6,
+            0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0,
+            0x00E1E1, 0x00E2E2, 0x00E4E4, 0x00E6E6, 0x00E7E7, 0x00E8E8,
+            0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE,
+            0x00EFEF, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F9F9,
+            0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF, 0x0102C3, 0x0103E3,
+            0x0104A1, 0x0105A2, 0x0106C5, 0x0107E5, 0x010CB2, 0x010DB9,
+            0x0110D0, 0x0111F0, 0x0118DD, 0x0119FD, 0x0141A3, 0x0142B3,
+            0x0143D1, 0x0144F1, 0x0150D5, 0x0151F5, 0x0152BC, 0x0153BD,
+            0x015AD7, 0x015BF7, 0x0160A6, 0x0161A8, 0x0170D8, 0x0171F8,
+            0x0178BE, 0x0179AC, 0x017AAE, 0x017BAF, 0x017CBF, 0x017DB4,
+            0x017EB8, 0x0218AA, 0x0219BA, 0x021ADE, 0x021BFE, 0x201DB5,
+            0x201EA5, 0x20ACA4,
+        };
+        return table;
+    }
+};
+
+// KOI8-R (Russian)
+struct koi8_r_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+            0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+            0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+            0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+            0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+            0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E,
+            0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+            0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9,
+            0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+            0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+            0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+            0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+            0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+            0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+            0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+            0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A09A, 0x00A9BF, 0x00B09C, 0x00B29D, 0x00B79E, 0x00F79F,
+            0x0401B3, 0x0410E1, 0x0411E2, 0x0412F7, 0x0413E7, 0x0414E4,
+            0x0415E5, 0x0416F6, 0x0417FA, 0x0418E9, 0x0419EA, 0x041AEB,
+            0x041BEC, 0x041CED, 0x041DEE, 0x041EEF, 0x041FF0, 0x0420F2,
+            0x0421F3, 0x0422F4, 0x0423F5, 0x0424E6, 0x0425E8, 0x0426E3,
+            0x0427FE, 0x0428FB, 0x0429FD, 0x042AFF, 0x042BF9, 0x042CF8,
+            0x042DFC, 0x042EE0, 0x042FF1, 0x0430C1, 0x0431C2, 0x0432D7,
+            0x0433C7, 0x0434C4, 0x0435C5, 0x0436D6, 0x0437DA, 0x0438C9,
+            0x0439CA, 0x043ACB, 0x043BCC, 0x043CCD, 0x043DCE, 0x043ECF,
+            0x043FD0, 0x0440D2, 0x0441D3, 0x0442D4, 0x0443D5, 0x0444C6,
+            0x0445C8, 0x0446C3, 0x0447DE, 0x0448DB, 0x0449DD, 0x044ADF,
+            0x044BD9, 0x044CD8, 0x044DDC, 0x044EC0, 0x044FD1, 0x0451A3,
+            0x221995, 0x221A96, 0x224897, 0x226498, 0x226599, 0x232093,
+            0x23219B, 0x250080, 0x250281, 0x250C82, 0x251083, 0x251484,
+            0x251885, 0x251C86, 0x252487, 0x252C88, 0x253489, 0x253C8A,
+            0x2550A0, 0x2551A1, 0x2552A2, 0x2553A4, 0x2554A5, 0x2555A6,
+            0x2556A7, 0x2557A8, 0x2558A9, 0x2559AA, 0x255AAB, 0x255BAC,
+            0x255CAD, 0x255DAE, 0x255EAF, 0x255FB0, 0x2560B1, 0x2561B2,
+            0x2562B4, 0x2563B5, 0x2564B6, 0x2565B7, 0x2566B8, 0x2567B9,
+            0x2568BA, 0x2569BB, 0x256ABC, 0x256BBD, 0x256CBE, 0x25808B,
+            0x25848C, 0x25888D, 0x258C8E, 0x25908F, 0x259190, 0x259291,
+            0x259392, 0x25A094,
+        };
+        return table;
+    }
+};
+
+// KOI8-U (Ukrainian)
+struct koi8_u_table {
+    static const char16_t* to_unicode()
+    {
+        static constexpr char16_t table[256] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+            0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+            0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+            0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+            0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+            0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+            0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+            0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+            0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+            0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+            0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+            0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+            0x2550, 0x2551, 0x2552, 0x0451, 0x0454, 0x2554, 0x0456, 0x0457,
+            0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x0491, 0x255D, 0x255E,
+            0x255F, 0x2560, 0x2561, 0x0401, 0x0404, 0x2563, 0x0406, 0x0407,
+            0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x0490, 0x256C, 0x00A9,
+            0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+            0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+            0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+            0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+            0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+            0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+            0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+            0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A,
+        };
+        return table;
+    }
+
+    static constexpr std::size_t from_unicode_size = 128;
+
+    static const std::uint32_t* from_unicode()
+    {
+        static constexpr std::uint32_t table[from_unicode_size] = {
+            0x00A09A, 0x00A9BF, 0x00B09C, 0x00B29D, 0x00B79E, 0x00F79F,
+            0x0401B3, 0x0404B4, 0x0406B6, 0x0407B7, 0x0410E1, 0x0411E2,
+            0x0412F7, 0x0413E7, 0x0414E4, 0x0415E5, 0x0416F6, 0x0417FA,
+            0x0418E9, 0x0419EA, 0x041AEB, 0x041BEC, 0x041CED, 0x041DEE,
+            0x041EEF, 0x041FF0, 0x0420F2, 0x0421F3, 0x0422F4, 0x0423F5,
+            0x0424E6, 0x0425E8, 0x0426E3, 0x0427FE, 0x0428FB, 0x0429FD,
+            0x042AFF, 0x042BF9, 0x042CF8, 0x042DFC, 0x042EE0, 0x042FF1,
+            0x0430C1, 0x0431C2, 0x0432D7, 0x0433C7, 0x0434C4, 0x0435C5,
+            0x0436D6, 0x0437DA, 0x0438C9, 0x0439CA, 0x043ACB, 0x043BCC,
+            0x043CCD, 0x043DCE, 0x043ECF, 0x043FD0, 0x0440D2, 0x0441D3,
+            0x0442D4, 0x0443D5, 0x0444C6, 0x0445C8, 0x0446C3, 0x0447DE,
+            0x0448DB, 0x0449DD, 0x044ADF, 0x044BD9, 0x044CD8, 0x044DDC,
+            0x044EC0, 0x044FD1, 0x0451A3, 0x0454A4, 0x0456A6, 0x0457A7,
+            0x0490BD, 0x0491AD, 0x221995, 0x221A96, 0x224897, 0x226498,
+            0x226599, 0x232093, 0x23219B, 0x250080, 0x250281, 0x250C82,
+            0x251083, 0x251484, 0x251885, 0x251C86, 0x252487, 0x252C88,
+            0x253489, 0x253C8A, 0x2550A0, 0x2551A1, 0x2552A2, 0x2554A5,
+            0x2557A8, 0x2558A9, 0x2559AA, 0x255AAB, 0x255BAC, 0x255DAE,
+            0x255EAF, 0x255FB0, 0x2560B1, 0x2561B2, 0x2563B5, 0x2566B8,
+            0x2567B9, 0x2568BA, 0x2569BB, 0x256ABC, 0x256CBE, 0x25808B,
+            0x25848C, 0x25888D, 0x258C8E, 0x25908F, 0x259190, 0x259291,
+            0x259392, 0x25A094,
+        };
+        return table;
+    }
+};
+
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,2838 @@
+
+// Generated by tools/ucdgen.cpp -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_NORMALIZATION_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_NORMALIZATION_TABLES_HPP_INCLUDED
+
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+// Bits of the quick check properties in a normalization record
+enum normalization_flag : std::uint16_t {
+    flag_nfd_qc_no = 1u << 8,
+    flag_nfc_qc_no = 1u << 9,
+    flag_nfc_qc_maybe = 1u << 10,
+    flag_nfkd_qc_no = 1u << 11,
+    flag_nfkc_qc_no = 1u << 12,
+    flag_nfkc_qc_maybe = 1u << 13,
+};
+
+// The normalization properties of each code point are packed into a
+// record, as canonical_combining_class | flags
+
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct normalization_tables {
+    static constexpr int shift1 = 7;
+    static constexpr int shift2 = 2;
+
+    static constexpr std::uint8_t stage1[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 10, 10, 19, 20, 21, 22, 23, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 24, 25, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 29, 30, 31, 32,
+        33, 34, 10, 35, 10, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 46, 10, 47, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 48, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 49, 50, 51, 52, 10, 10, 10, 10,
+        53, 54, 10, 10, 55, 10, 10, 56, 57, 58, 10, 10, 10, 59, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 60, 61, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    };
+
+    static constexpr std::uint8_t stage2[7936] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 4, 5, 6, 6,
+        7, 8, 7, 7, 9, 10, 9, 11, 7, 8, 7, 7, 9, 10, 9, 8,
+        7, 7, 7, 7, 12, 7, 7, 7, 7, 11, 7, 7, 13, 7, 9, 14,
+        15, 7, 16, 7, 11, 7, 7, 7, 7, 11, 7, 7, 7, 7, 7, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 17, 18, 0, 0, 0,
+        0, 19, 19, 20, 7, 7, 7, 21, 7, 12, 7, 7, 22, 11, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 12, 0, 12, 7, 7, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 1, 0,
+        0, 0, 0, 0, 0, 0, 19, 5, 19, 1, 0, 0, 0, 0, 0, 0,
+        23, 24, 23, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+        38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 47, 47, 0, 48, 49, 50,
+        0, 51, 10, 21, 18, 0, 0, 0, 0, 0, 12, 7, 18, 0, 0, 0,
+        0, 0, 12, 10, 52, 53, 0, 0, 0, 0, 0, 0, 6, 5, 54, 0,
+        8, 17, 0, 10, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 55, 0,
+        0, 0, 0, 0, 8, 17, 0, 10, 0, 0, 0, 0, 0, 12, 0, 0,
+        56, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        57, 0, 0, 0, 7, 12, 12, 7, 12, 7, 12, 7, 7, 11, 11, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 0, 0, 58, 59, 60, 47, 61, 29, 59, 62, 63, 64, 65, 66,
+        67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 47, 47, 69, 0, 12, 10, 0, 0, 0, 0, 0, 0,
+        0, 0, 70, 71, 72, 73, 47, 74, 0, 0, 0, 0, 75, 76, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        77, 0, 0, 0, 17, 78, 47, 79, 42, 79, 80, 81, 0, 0, 0, 0,
+        0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 83, 74, 84, 85,
+        59, 85, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 47, 59, 0, 0, 87,
+        0, 0, 0, 0, 0, 78, 88, 47, 47, 89, 89, 90, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 92, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 78, 42, 29, 47, 47, 47, 93, 59, 83, 92, 94, 59, 95, 47,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 55, 18, 0, 96,
+        0, 0, 0, 97, 98, 99, 100, 100, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+        0, 0, 17, 102, 0, 103, 0, 104, 0, 0, 0, 0, 0, 0, 0, 105,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 50, 0, 107,
+        0, 0, 0, 97, 0, 0, 108, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+        0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+        0, 0, 109, 102, 0, 110, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112,
+        0, 0, 12, 102, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+        0, 0, 18, 97, 0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+        114, 17, 21, 97, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 117,
+        0, 0, 12, 102, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 118, 103, 0, 0, 119, 120, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 121, 0,
+        0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 123, 0,
+        0, 0, 124, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 125, 0, 0, 0, 0, 0, 0, 126, 127, 0,
+        106, 0, 0, 128, 50, 106, 0, 48, 0, 0, 128, 0, 129, 130, 131, 132,
+        133, 134, 0, 0, 106, 0, 0, 128, 50, 106, 0, 48, 0, 0, 128, 0,
+        0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 112, 0, 136, 137, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 138, 139, 139, 139, 139, 140, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139, 139, 139,
+        141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 144, 0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 56, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 0, 89, 47, 149,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 92, 43, 150,
+        74, 37, 59, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 119, 77, 77, 119, 0, 0, 0, 0, 0, 0, 0, 0, 152, 17, 55,
+        8, 143, 0, 0, 0, 0, 0, 0, 0, 0, 56, 37, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 153, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 151, 155, 40, 29, 156, 35, 157, 87, 0, 99, 90, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 19, 19, 6, 19,
+        19, 19, 19, 158, 19, 19, 19, 19, 19, 19, 6, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 3, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        59, 47, 59, 159, 160, 47, 47, 47, 47, 47, 47, 47, 47, 161, 162, 163,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 164, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 11, 0,
+        7, 7, 7, 7, 7, 11, 7, 11, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 11, 7, 11, 7, 7, 165, 165, 7, 7, 7, 7, 166, 166, 166, 167,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 21, 168, 169,
+        170, 21, 166, 171, 168, 12, 168, 172, 168, 7, 168, 173, 12, 21, 166, 174,
+        175, 19, 6, 0, 54, 3, 0, 0, 0, 6, 0, 3, 3, 176, 0, 2,
+        0, 3, 5, 0, 0, 3, 0, 3, 0, 0, 0, 0, 5, 19, 19, 19,
+        19, 19, 19, 6, 19, 19, 19, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 177, 47, 178, 99, 145, 179, 180, 29, 99, 0, 0, 0,
+        19, 76, 76, 19, 19, 181, 76, 5, 6, 182, 183, 158, 158, 19, 158, 19,
+        1, 76, 5, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        0, 0, 54, 0, 0, 0, 12, 0, 0, 0, 0, 119, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 18, 55, 18, 0, 0, 0, 0, 0, 77, 0, 158, 1, 0, 0, 0,
+        55, 109, 55, 0, 0, 0, 0, 0, 77, 0, 0, 9, 11, 11, 11, 0,
+        11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 12, 11, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 6, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 90, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 116,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 186, 0, 49, 6, 0,
+        0, 0, 0, 77, 77, 77, 77, 77, 77, 165, 55, 0, 8, 21, 57, 11,
+        0, 0, 0, 0, 0, 18, 187, 188, 0, 0, 0, 77, 77, 77, 77, 77,
+        77, 165, 55, 0, 8, 21, 57, 11, 0, 0, 0, 0, 0, 109, 10, 189,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 6, 4, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 6, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 6,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 47, 47, 90,
+        0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 5, 0,
+        0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 143, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 90, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 125, 0, 0, 0, 0,
+        0, 0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+        143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 193, 99, 78,
+        145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 54, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 111, 194, 108, 100, 195, 194, 184, 196, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 111, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 6, 0, 0, 3, 19, 0, 197, 19, 19, 198, 100, 100, 195, 100, 194,
+        104, 199, 100, 200, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 5, 0, 0, 0,
+        0, 0, 0, 0, 3, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 5,
+        0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 4, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 1,
+        0, 0, 0, 0, 19, 19, 5, 0, 47, 42, 29, 40, 19, 19, 19, 19,
+        19, 201, 19, 19, 6, 19, 19, 19, 19, 6, 19, 0, 6, 176, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 1,
+        76, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 6,
+        4, 19, 4, 19, 4, 19, 4, 1, 19, 6, 19, 6, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 151, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        76, 158, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 176, 19, 6, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 116,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 99, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 205, 42, 92, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        206, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 116,
+        0, 0, 0, 0, 0, 0, 119, 18, 0, 0, 17, 0, 0, 0, 207, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        151, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 12, 116, 143, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        143, 0, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 101,
+        0, 0, 17, 102, 0, 103, 0, 0, 0, 78, 47, 99, 47, 99, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        144, 154, 0, 0, 0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 0, 211, 212,
+        213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 12, 116,
+        107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 0, 18, 137,
+        136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0,
+        0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        154, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 157, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 151, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 196, 100, 216, 217, 218, 219, 0, 191, 29,
+        220, 89, 61, 0, 0, 0, 0, 0, 0, 0, 78, 90, 0, 0, 106, 100,
+        48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 176, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 176, 49, 181, 76, 176, 19, 19, 158, 76,
+        19, 76, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 158, 6, 76, 19, 176, 19, 176, 19, 19, 19, 19, 19, 19, 158, 6,
+        19, 2, 4, 19, 176, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 5, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 4, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        47, 151, 47, 47, 47, 47, 79, 47, 88, 192, 151, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 151, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 29, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 47, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 76, 19, 19, 19, 19, 19, 19, 181, 201, 76, 19, 6, 19, 222, 0,
+        49, 3, 222, 76, 181, 201, 222, 222, 181, 201, 6, 19, 6, 19, 76, 2,
+        19, 19, 158, 19, 19, 19, 19, 0, 76, 76, 158, 19, 19, 19, 19, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 19, 6, 0, 19, 19, 19, 19, 19, 19, 19, 6, 19, 19, 19, 19,
+        19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0,
+        19, 19, 1, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 5, 0,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 111, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr std::uint8_t stage3[892] = {
+        0, 0, 0, 0, 54, 0, 0, 0, 54, 0, 54, 0, 0, 0, 0, 54,
+        0, 0, 54, 54, 54, 54, 0, 0, 54, 54, 54, 0, 53, 53, 53, 53,
+        53, 53, 0, 53, 0, 53, 53, 53, 53, 53, 53, 0, 53, 53, 0, 0,
+        0, 0, 53, 53, 53, 0, 54, 54, 53, 53, 53, 54, 54, 0, 0, 53,
+        53, 54, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 54, 54, 54, 54,
+        54, 53, 53, 53, 53, 0, 53, 53, 53, 54, 54, 54, 67, 67, 67, 67,
+        67, 49, 67, 67, 67, 49, 49, 67, 49, 67, 49, 67, 67, 50, 44, 44,
+        44, 44, 50, 65, 44, 44, 44, 44, 44, 40, 40, 66, 66, 66, 66, 64,
+        64, 44, 44, 44, 44, 66, 66, 44, 66, 66, 44, 44, 1, 1, 1, 1,
+        59, 44, 44, 44, 44, 49, 49, 49, 57, 57, 67, 57, 57, 68, 49, 44,
+        44, 44, 49, 49, 49, 44, 44, 0, 49, 49, 49, 44, 44, 44, 44, 49,
+        50, 44, 44, 49, 51, 52, 52, 51, 52, 52, 51, 49, 49, 49, 49, 49,
+        56, 0, 0, 0, 0, 0, 54, 0, 0, 0, 56, 0, 54, 55, 53, 56,
+        54, 54, 54, 55, 55, 54, 54, 0, 0, 54, 0, 0, 0, 53, 0, 0,
+        0, 0, 0, 49, 0, 53, 53, 0, 0, 44, 49, 49, 49, 49, 44, 49,
+        49, 49, 45, 44, 49, 49, 44, 44, 49, 45, 48, 49, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 0, 18, 0, 19, 20, 0,
+        49, 44, 0, 13, 25, 26, 27, 0, 0, 0, 0, 22, 23, 24, 25, 26,
+        27, 28, 29, 67, 67, 66, 44, 49, 44, 49, 49, 44, 30, 0, 0, 0,
+        0, 54, 54, 54, 53, 0, 53, 0, 0, 0, 49, 49, 49, 0, 0, 49,
+        49, 0, 44, 49, 49, 44, 0, 0, 0, 31, 0, 0, 49, 44, 49, 49,
+        44, 44, 49, 44, 44, 49, 44, 49, 44, 49, 49, 0, 0, 44, 0, 0,
+        49, 49, 0, 49, 0, 49, 49, 49, 49, 49, 0, 0, 0, 44, 44, 44,
+        49, 44, 44, 44, 49, 49, 0, 44, 22, 23, 24, 49, 49, 44, 44, 49,
+        60, 0, 0, 0, 0, 4, 0, 0, 0, 49, 44, 49, 49, 0, 0, 0,
+        56, 56, 56, 56, 3, 0, 58, 0, 53, 4, 0, 0, 0, 0, 0, 58,
+        56, 56, 0, 56, 0, 0, 49, 0, 0, 0, 0, 56, 3, 0, 0, 0,
+        0, 56, 56, 56, 53, 0, 0, 53, 0, 0, 58, 58, 56, 56, 0, 0,
+        0, 0, 58, 0, 0, 32, 63, 0, 53, 0, 58, 0, 0, 58, 58, 0,
+        0, 0, 0, 4, 4, 0, 58, 0, 0, 0, 62, 0, 0, 0, 53, 0,
+        53, 53, 53, 58, 33, 33, 4, 0, 34, 34, 34, 34, 35, 35, 4, 0,
+        36, 36, 36, 36, 44, 44, 0, 0, 0, 44, 0, 44, 0, 42, 0, 0,
+        0, 56, 0, 0, 0, 37, 38, 56, 39, 56, 56, 54, 56, 54, 38, 38,
+        38, 38, 0, 0, 38, 56, 49, 49, 4, 0, 49, 49, 0, 0, 44, 0,
+        0, 0, 0, 3, 0, 4, 4, 0, 0, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 0, 0, 58, 58, 58, 0, 4, 4, 0, 0, 4, 0, 0, 0,
+        0, 0, 4, 0, 0, 49, 0, 0, 0, 48, 0, 0, 0, 45, 49, 44,
+        44, 0, 0, 0, 49, 0, 0, 44, 49, 44, 0, 44, 49, 49, 49, 0,
+        3, 58, 0, 0, 0, 0, 4, 4, 0, 0, 3, 0, 1, 44, 44, 44,
+        49, 0, 1, 1, 1, 0, 0, 0, 54, 54, 0, 54, 49, 52, 41, 44,
+        40, 49, 49, 49, 49, 49, 50, 48, 48, 44, 43, 49, 51, 44, 49, 44,
+        53, 53, 54, 55, 0, 53, 0, 53, 53, 56, 53, 56, 53, 56, 0, 0,
+        53, 53, 53, 56, 53, 54, 56, 54, 54, 55, 53, 53, 53, 55, 55, 55,
+        0, 55, 55, 55, 53, 55, 56, 56, 53, 56, 54, 0, 56, 56, 54, 54,
+        54, 0, 54, 54, 49, 49, 1, 1, 1, 1, 1, 49, 0, 1, 1, 49,
+        44, 49, 1, 1, 0, 54, 54, 0, 54, 0, 56, 0, 54, 0, 56, 56,
+        0, 56, 56, 0, 0, 0, 43, 48, 50, 45, 46, 46, 0, 61, 61, 54,
+        54, 0, 53, 54, 0, 0, 53, 54, 54, 54, 49, 49, 0, 0, 0, 44,
+        49, 0, 49, 49, 44, 0, 0, 49, 56, 0, 56, 0, 56, 56, 56, 0,
+        0, 0, 56, 56, 0, 56, 21, 56, 54, 54, 56, 56, 56, 0, 56, 56,
+        56, 56, 56, 54, 54, 0, 0, 54, 0, 44, 0, 49, 49, 1, 44, 0,
+        0, 49, 44, 0, 0, 0, 44, 44, 0, 0, 49, 44, 0, 4, 60, 0,
+        0, 4, 3, 0, 0, 3, 4, 0, 58, 0, 0, 0, 0, 0, 58, 53,
+        53, 58, 53, 0, 0, 0, 4, 3, 2, 2, 0, 0, 0, 0, 1, 0,
+        56, 42, 42, 1, 1, 1, 0, 0, 0, 47, 42, 42, 42, 42, 42, 0,
+        44, 44, 44, 0, 49, 49, 3, 0, 0, 54, 0, 54,
+    };
+
+    static constexpr std::uint16_t results[69] = {
+        0, 1, 6, 7, 9, 10,
+        11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22,
+        23, 24, 25, 26, 27, 28,
+        29, 30, 31, 32, 33, 34,
+        35, 36, 84, 103, 107, 118,
+        122, 129, 130, 132, 202, 214,
+        216, 218, 220, 222, 224, 226,
+        228, 230, 232, 233, 234, 2304,
+        6144, 6400, 6912, 7142, 9216, 9217,
+        9223, 9224, 9225, 9307, 9418, 9432,
+        9436, 9446, 9456,
+    };
+};
+
+template <typename T>
+constexpr int normalization_tables<T>::shift1;
+
+template <typename T>
+constexpr int normalization_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t normalization_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint8_t normalization_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint8_t normalization_tables<T>::stage3[];
+
+template <typename T>
+constexpr std::uint16_t normalization_tables<T>::results[];
+
+constexpr std::uint16_t normalization_lookup(char32_t c)
+{
+    using t = normalization_tables<>;
+    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+}
+
+// The offset in decomposition_tables<>::pool of the full decomposition of
+// each code point other than a Hangul syllable, or zero. This is the
+// full canonical decomposition of a code point with a canonical mapping;
+// its full compatibility decomposition is that of each code point in it.
+
+// The value for code point c is
+//   stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                  ((c >> shift2) & mask1)] << shift2) + (c & mask2)]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct decomposition_offset_tables {
+    static constexpr int shift1 = 6;
+    static constexpr int shift2 = 4;
+
+    static constexpr std::uint8_t stage1[1088] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 14, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 16,
+        5, 17, 5, 5, 18, 19, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 21, 22, 5, 5, 5, 5, 5, 23, 24, 5, 25, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 26, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    };
+
+    static constexpr std::uint16_t stage2[1728] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 25, 0, 26, 27, 0,
+        0, 0, 0, 0, 28, 0, 0, 29, 30, 31, 32, 33, 34, 35, 0, 36,
+        37, 38, 0, 39, 0, 40, 0, 41, 0, 0, 0, 0, 42, 43, 44, 45,
+        0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 47, 0, 0, 0, 0, 48, 0, 0, 0, 0, 49, 50, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 51, 52, 0, 53, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0,
+        0, 0, 0, 56, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 58, 59, 0, 0, 0, 60, 0, 0, 61, 0, 0, 0,
+        0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0,
+        0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0,
+        0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 68, 0, 0,
+        69, 0, 0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 0, 0, 0, 0,
+        0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        80, 81, 0, 82, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 84, 85, 86, 87, 88, 89, 0, 90, 91, 92, 0, 0, 0, 0,
+        93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+        109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+        125, 126, 127, 128, 129, 130, 0, 131, 132, 133, 134, 0, 0, 0, 0, 0,
+        135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 0, 146, 0, 0, 0,
+        147, 0, 148, 149, 150, 0, 151, 152, 153, 0, 154, 0, 0, 0, 155, 0,
+        0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 157, 158, 159, 160, 161, 162, 163, 164, 165, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        166, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0, 0, 168, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 172,
+        173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 0, 0,
+        187, 0, 0, 188, 189, 190, 191, 192, 0, 193, 194, 195, 196, 197, 0, 198,
+        0, 0, 0, 199, 200, 201, 202, 203, 204, 205, 0, 0, 0, 0, 0, 0,
+        206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+        222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 0, 240,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 241, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258,
+        259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 0, 0,
+        273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 0, 285, 286, 287,
+        288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+        304, 305, 306, 307, 0, 308, 309, 310, 311, 312, 313, 314, 315, 0, 0, 316,
+        0, 317, 0, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+        331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 346, 347, 348, 349, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 351, 0, 0, 0, 0, 0,
+        0, 0, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 357, 358, 0, 0, 0, 0, 359, 360, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 361, 362, 363,
+        374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 361, 362, 363, 364, 365, 376,
+        367, 368, 369, 380, 381, 382, 383, 361, 362, 363, 384, 385, 386, 387, 388, 389,
+        390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 415, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        417, 418, 419, 361, 420, 0, 421, 0, 0, 422, 0, 0, 0, 0, 0, 0,
+        423, 424, 425, 426, 427, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429,
+        430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445,
+        446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461,
+        462, 463, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr std::uint16_t stage3[7424] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, 0, 0, 0, 0, 5,
+        0, 0, 7, 8, 9, 11, 0, 0, 12, 14, 15, 0, 16, 19, 22, 0,
+        25, 27, 29, 31, 33, 35, 0, 37, 39, 41, 43, 45, 47, 49, 51, 53,
+        0, 55, 57, 59, 61, 63, 65, 0, 0, 67, 69, 71, 73, 75, 0, 0,
+        77, 79, 81, 83, 85, 87, 0, 89, 91, 93, 95, 97, 99, 101, 103, 105,
+        0, 107, 109, 111, 113, 115, 117, 0, 0, 119, 121, 123, 125, 127, 0, 129,
+        131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159, 161,
+        0, 0, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189,
+        191, 193, 195, 197, 199, 201, 0, 0, 203, 205, 207, 209, 211, 213, 215, 217,
+        219, 0, 221, 223, 225, 227, 229, 231, 0, 233, 235, 237, 239, 241, 243, 245,
+        247, 0, 0, 249, 251, 253, 255, 257, 259, 261, 0, 0, 263, 265, 267, 269,
+        271, 273, 0, 0, 275, 277, 279, 281, 283, 285, 287, 289, 291, 293, 295, 297,
+        299, 301, 303, 305, 307, 309, 0, 0, 311, 313, 315, 317, 319, 321, 323, 325,
+        327, 329, 331, 333, 335, 337, 339, 341, 343, 345, 347, 349, 351, 353, 355, 357,
+        358, 360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 362,
+        364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 366, 369, 372, 375, 377, 379, 381, 383, 385, 387, 389, 391,
+        393, 395, 397, 399, 401, 403, 406, 409, 412, 415, 418, 421, 424, 0, 427, 430,
+        433, 436, 439, 441, 0, 0, 443, 445, 447, 449, 451, 453, 455, 458, 461, 463,
+        465, 467, 469, 471, 473, 475, 0, 0, 477, 479, 481, 484, 487, 489, 491, 493,
+        495, 497, 499, 501, 503, 505, 507, 509, 511, 513, 515, 517, 519, 521, 523, 525,
+        527, 529, 531, 533, 535, 537, 539, 541, 543, 545, 547, 549, 0, 0, 551, 553,
+        0, 0, 0, 0, 0, 0, 555, 557, 559, 561, 563, 566, 569, 572, 575, 577,
+        579, 582, 585, 587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        589, 590, 591, 592, 593, 594, 595, 596, 597, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 598, 600, 602, 604, 606, 608, 0, 0,
+        610, 611, 357, 612, 613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        614, 615, 0, 616, 617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 619, 0, 0, 0, 0, 0, 620, 0, 0, 0, 622, 0,
+        0, 0, 0, 0, 9, 623, 625, 627, 628, 630, 632, 0, 634, 0, 636, 638,
+        640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 643, 645, 647, 649, 651, 653,
+        655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 660, 662, 664, 666, 0,
+        668, 669, 670, 671, 673, 675, 676, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        677, 678, 679, 0, 680, 681, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0,
+        683, 685, 0, 687, 0, 0, 0, 689, 0, 0, 0, 0, 691, 693, 695, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 697, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 699, 0, 0, 0, 0, 0, 0,
+        701, 703, 0, 705, 0, 0, 0, 707, 0, 0, 0, 0, 709, 711, 713, 0,
+        0, 0, 0, 0, 0, 0, 715, 717, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 719, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        723, 725, 727, 729, 0, 0, 731, 733, 0, 0, 735, 737, 739, 741, 743, 745,
+        0, 0, 747, 749, 751, 753, 755, 757, 0, 0, 759, 761, 763, 765, 767, 769,
+        771, 773, 775, 777, 779, 781, 0, 0, 783, 785, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 787, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 789, 791, 793, 795, 797, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 799, 801, 803, 805, 0, 0, 0, 0, 0, 0, 0,
+        807, 0, 809, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0, 0, 0,
+        0, 815, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 819, 821, 823, 825, 827, 829, 831, 833,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 835, 837, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 839, 841, 0, 843,
+        0, 0, 0, 845, 0, 0, 847, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 849, 851, 853, 0, 0, 855, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 857, 0, 0, 859, 861, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 863, 865, 0, 0,
+        0, 0, 0, 0, 867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 869, 871, 873, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 875, 0, 0, 0, 0, 0, 0, 0,
+        877, 0, 0, 0, 0, 0, 0, 879, 881, 0, 883, 885, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 888, 890, 892, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 894, 0, 896, 898, 901, 0,
+        0, 0, 0, 903, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 907, 909, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 911, 0, 0, 0,
+        0, 0, 0, 912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 914, 0, 0,
+        0, 0, 916, 0, 0, 0, 0, 918, 0, 0, 0, 0, 920, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 922, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 924, 0, 926, 928, 930, 933, 935, 0, 0, 0, 0, 0, 0,
+        0, 938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 942, 0, 0,
+        0, 0, 944, 0, 0, 0, 0, 946, 0, 0, 0, 0, 948, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 950, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 952, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 954, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 955, 0, 957, 0, 959, 0, 961, 0, 963, 0,
+        0, 0, 965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 967, 0, 969, 0, 0,
+        971, 973, 0, 975, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 977, 978, 979, 0,
+        980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 0, 991, 992, 993, 994,
+        995, 996, 997, 4, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 0, 1008,
+        1009, 1010, 15, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 668, 1021, 1022,
+        675, 1023, 1024, 592, 1016, 1019, 668, 1021, 678, 675, 1023, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1025, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 1027, 1028, 1029, 1006,
+        1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
+        1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 669,
+        1061, 1063, 1065, 1067, 1069, 1071, 1073, 1075, 1077, 1080, 1083, 1085, 1087, 1089, 1091, 1093,
+        1095, 1097, 1099, 1101, 1103, 1106, 1109, 1112, 1115, 1117, 1119, 1121, 1123, 1126, 1129, 1131,
+        1133, 1135, 1137, 1139, 1141, 1143, 1145, 1147, 1149, 1151, 1153, 1155, 1157, 1159, 1161, 1164,
+        1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183, 1186, 1189, 1191, 1193, 1195, 1197, 1199,
+        1201, 1203, 1205, 1207, 1209, 1211, 1213, 1215, 1217, 1219, 1221, 1223, 1225, 1228, 1231, 1234,
+        1237, 1240, 1243, 1246, 1249, 1251, 1253, 1255, 1257, 1259, 1261, 1263, 1265, 1268, 1271, 1273,
+        1275, 1277, 1279, 1281, 1283, 1286, 1289, 1292, 1295, 1298, 1301, 1303, 1305, 1307, 1309, 1311,
+        1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327, 1329, 1332, 1335, 1338, 1341, 1343, 1345, 1347,
+        1349, 1351, 1353, 1355, 1357, 1359, 1361, 1363, 1365, 1367, 1369, 1371, 1373, 1375, 1377, 1379,
+        1381, 1383, 1385, 1387, 1389, 1391, 1393, 1395, 1397, 1399, 1401, 1403, 0, 0, 0, 0,
+        1405, 1407, 1409, 1411, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1434, 1437, 1440, 1443, 1446,
+        1449, 1452, 1455, 1458, 1461, 1464, 1467, 1470, 1473, 1475, 1477, 1479, 1481, 1483, 1485, 1488,
+        1491, 1494, 1497, 1500, 1503, 1506, 1509, 1512, 1515, 1517, 1519, 1521, 1523, 1525, 1527, 1529,
+        1531, 1534, 1537, 1540, 1543, 1546, 1549, 1552, 1555, 1558, 1561, 1564, 1567, 1570, 1573, 1576,
+        1579, 1582, 1585, 1588, 1591, 1593, 1595, 1597, 1599, 1602, 1605, 1608, 1611, 1614, 1617, 1620,
+        1623, 1626, 1629, 1631, 1633, 1635, 1637, 1639, 1641, 1643, 0, 0, 0, 0, 0, 0,
+        1645, 1647, 1649, 1652, 1655, 1658, 1661, 1664, 1667, 1669, 1671, 1674, 1677, 1680, 1683, 1686,
+        1689, 1691, 1693, 1696, 1699, 1702, 0, 0, 1705, 1707, 1709, 1712, 1715, 1718, 0, 0,
+        1721, 1723, 1725, 1728, 1731, 1734, 1737, 1740, 1743, 1745, 1747, 1750, 1753, 1756, 1759, 1762,
+        1765, 1767, 1769, 1772, 1775, 1778, 1781, 1784, 1787, 1789, 1791, 1794, 1797, 1800, 1803, 1806,
+        1809, 1811, 1813, 1816, 1819, 1822, 0, 0, 1825, 1827, 1829, 1832, 1835, 1838, 0, 0,
+        1841, 1843, 1845, 1848, 1851, 1854, 1857, 1860, 0, 1863, 0, 1865, 0, 1868, 0, 1871,
+        1874, 1876, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1898, 1900, 1903, 1906, 1909, 1912, 1915,
+        1918, 647, 1920, 649, 1922, 651, 1924, 653, 1926, 662, 1928, 664, 1930, 666, 0, 0,
+        1932, 1935, 1938, 1942, 1946, 1950, 1954, 1958, 1962, 1965, 1968, 1972, 1976, 1980, 1984, 1988,
+        1992, 1995, 1998, 2002, 2006, 2010, 2014, 2018, 2022, 2025, 2028, 2032, 2036, 2040, 2044, 2048,
+        2052, 2055, 2058, 2062, 2066, 2070, 2074, 2078, 2082, 2085, 2088, 2092, 2096, 2100, 2104, 2108,
+        2112, 2114, 2116, 2119, 2121, 0, 2124, 2126, 2129, 2131, 2133, 625, 2135, 2137, 2139, 2137,
+        2140, 2142, 2144, 2147, 2149, 0, 2152, 2154, 2157, 628, 2159, 630, 2161, 2163, 2165, 2167,
+        2169, 2171, 2173, 640, 0, 0, 2176, 2178, 2181, 2183, 2185, 632, 0, 2187, 2189, 2191,
+        2193, 2195, 2197, 655, 2200, 2202, 2204, 2206, 2209, 2211, 2213, 636, 2215, 2217, 623, 2219,
+        0, 0, 2220, 2223, 2225, 0, 2228, 2230, 2233, 634, 2235, 638, 2237, 2239, 2240, 0,
+        2242, 2243, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 2244, 0, 0, 0, 0, 0, 2245, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2247, 2248, 2250, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 2253, 2255, 0, 2258, 2260, 0, 0, 0, 0, 2263, 0, 2265, 0,
+        0, 0, 0, 0, 0, 0, 0, 2267, 2269, 2271, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2273, 0, 0, 0, 0, 0, 0, 0, 1,
+        2277, 1024, 0, 0, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+        2277, 14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 0,
+        4, 1003, 15, 612, 1004, 589, 1008, 611, 1009, 2289, 1014, 357, 1015, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2290, 0, 0, 0, 0, 0, 0, 0,
+        2292, 2295, 2298, 2299, 0, 2301, 2304, 2307, 0, 2308, 1007, 984, 984, 984, 589, 2310,
+        985, 985, 988, 611, 0, 990, 2311, 0, 0, 993, 2313, 994, 994, 994, 0, 0,
+        2314, 2316, 2319, 0, 2321, 0, 2322, 0, 2321, 0, 987, 35, 979, 2298, 0, 1003,
+        981, 2323, 0, 989, 15, 2324, 2325, 2326, 2327, 1024, 0, 2328, 676, 1021, 2331, 2332,
+        2333, 0, 0, 0, 0, 980, 1002, 1003, 1024, 591, 0, 0, 0, 0, 0, 0,
+        2334, 2337, 2340, 2344, 2347, 2350, 2353, 2356, 2359, 2362, 2365, 2368, 2371, 2374, 2377, 2380,
+        985, 2382, 2384, 2387, 2389, 2390, 2392, 2395, 2399, 2401, 2402, 2404, 988, 2298, 980, 989,
+        1024, 2407, 2409, 2412, 1019, 2414, 2416, 2419, 2423, 612, 2425, 2427, 611, 1027, 1002, 1009,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2430, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2433, 2435, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2437, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2439, 2441, 2443,
+        0, 0, 0, 0, 2445, 0, 0, 0, 0, 2447, 0, 0, 2449, 0, 0, 0,
+        0, 0, 0, 0, 2451, 0, 2453, 0, 0, 0, 0, 0, 2455, 2457, 0, 2460,
+        2462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2465, 0, 0, 2467, 0, 0, 2469, 0, 2471, 0, 0, 0, 0, 0, 0,
+        2473, 0, 2475, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2477, 2479, 2481,
+        2483, 2485, 0, 0, 2487, 2489, 0, 0, 2491, 2493, 0, 0, 0, 0, 0, 0,
+        2495, 2497, 0, 0, 2499, 2501, 0, 0, 2503, 2505, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2507, 2509, 2511, 2513,
+        2515, 2517, 2519, 2521, 0, 0, 0, 0, 0, 0, 2523, 2525, 2527, 2529, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2531, 2532, 0, 0, 0, 0, 0,
+        14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 2533, 2535, 2537, 2539, 2541, 2543, 2545,
+        2547, 2549, 2551, 2553, 2555, 2558, 2561, 2564, 2567, 2570, 2573, 2576, 2579, 2582, 2586, 2590,
+        2594, 2598, 2602, 2606, 2610, 2614, 2618, 2622, 2626, 2628, 2630, 2632, 2634, 2636, 2638, 2640,
+        2642, 2644, 2647, 2650, 2653, 2656, 2659, 2662, 2665, 2668, 2671, 2674, 2677, 2680, 2683, 2686,
+        2689, 2692, 2695, 2698, 2701, 2704, 2707, 2710, 2713, 2716, 2719, 2722, 2725, 2728, 2731, 2734,
+        2737, 2740, 2743, 2746, 2749, 2752, 977, 979, 2298, 980, 981, 2323, 983, 984, 985, 986,
+        987, 988, 989, 990, 991, 993, 2313, 994, 2755, 995, 996, 2389, 997, 2401, 2756, 2321,
+        4, 1001, 1027, 1002, 1003, 1030, 1007, 589, 1024, 591, 1008, 611, 1009, 2289, 15, 1014,
+        2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057, 2277, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2758, 0, 0, 0,
+        0, 0, 0, 0, 2762, 2765, 2767, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2770, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 591, 2389, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2772,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2773,
+        0, 0, 0, 2774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790,
+        2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806,
+        2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822,
+        2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838,
+        2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854,
+        2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870,
+        2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886,
+        2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902,
+        2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918,
+        2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934,
+        2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950,
+        2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966,
+        2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982,
+        2983, 2984, 2985, 2986, 2987, 2988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2989, 0, 2798, 2990, 2991, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2992, 0, 2994, 0,
+        2996, 0, 2998, 0, 3000, 0, 3002, 0, 3004, 0, 3006, 0, 3008, 0, 3010, 0,
+        3012, 0, 3014, 0, 0, 3016, 0, 3018, 0, 3020, 0, 0, 0, 0, 0, 0,
+        3022, 3024, 0, 3026, 3028, 0, 3030, 3032, 0, 3034, 3036, 0, 3038, 3040, 0, 0,
+        0, 0, 0, 0, 3042, 0, 0, 0, 0, 0, 0, 3044, 3046, 0, 3048, 3050,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3052, 0, 3054, 0,
+        3056, 0, 3058, 0, 3060, 0, 3062, 0, 3064, 0, 3066, 0, 3068, 0, 3070, 0,
+        3072, 0, 3074, 0, 0, 3076, 0, 3078, 0, 3080, 0, 0, 0, 0, 0, 0,
+        3082, 3084, 0, 3086, 3088, 0, 3090, 3092, 0, 3094, 3096, 0, 3098, 3100, 0, 0,
+        0, 0, 0, 0, 3102, 0, 0, 3104, 3106, 3108, 3110, 0, 0, 0, 3112, 3114,
+        0, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130,
+        3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146,
+        3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162,
+        3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178,
+        3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194,
+        3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 0,
+        0, 0, 2775, 2781, 3210, 3211, 3212, 3213, 3214, 3215, 2779, 3216, 3217, 3218, 3219, 2783,
+        3220, 3223, 3226, 3229, 3232, 3235, 3238, 3241, 3244, 3247, 3250, 3253, 3256, 3259, 3262, 3266,
+        3270, 3274, 3278, 3282, 3286, 3290, 3294, 3298, 3302, 3306, 3310, 3314, 3318, 3322, 3329, 0,
+        3335, 3338, 3341, 3344, 3347, 3350, 3353, 3356, 3359, 3362, 3365, 3368, 3371, 3374, 3377, 3380,
+        3383, 3386, 3389, 3392, 3395, 3398, 3401, 3404, 3407, 3410, 3413, 3416, 3419, 3422, 3425, 3428,
+        3431, 3434, 3437, 3440, 3443, 3444, 2841, 3445, 0, 0, 0, 0, 0, 0, 0, 0,
+        3446, 3449, 3451, 3453, 3455, 3457, 3459, 3461, 3463, 3465, 3467, 3469, 3471, 3473, 3475, 3477,
+        3116, 3119, 3122, 3124, 3132, 3133, 3136, 3138, 3139, 3141, 3142, 3143, 3144, 3145, 3479, 3481,
+        3483, 3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505, 3507, 3512, 3516, 0,
+        2775, 2781, 3210, 3211, 3518, 3519, 3520, 2786, 3521, 2798, 2848, 2860, 2859, 2849, 2941, 2806,
+        2846, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 2812, 3532, 3533, 3534, 3535,
+        3536, 3537, 3538, 3539, 3212, 3213, 3214, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548,
+        3549, 3550, 3552, 3554, 3556, 3558, 3560, 3562, 3564, 3566, 3568, 3570, 3572, 3574, 3576, 3578,
+        3580, 3582, 3584, 3586, 3588, 3590, 3592, 3594, 3596, 3598, 3601, 3604, 3607, 3609, 3612, 3614,
+        3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632,
+        3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648,
+        3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664,
+        3666, 3671, 3675, 3680, 3683, 3688, 3691, 3694, 3700, 3704, 3707, 3710, 3713, 3717, 3721, 3725,
+        3729, 3733, 3737, 3741, 3747, 3749, 3755, 3761, 3766, 3770, 3776, 3782, 3786, 3789, 3792, 3796,
+        3800, 3805, 3810, 3813, 3816, 3820, 3823, 3826, 3828, 3830, 3833, 3836, 3842, 3846, 3851, 3857,
+        3861, 3864, 3867, 3873, 3877, 3883, 3886, 3891, 3894, 3898, 3901, 3905, 3910, 3914, 3919, 3923,
+        3925, 3930, 3933, 3936, 3940, 3943, 3946, 3949, 3954, 3958, 3960, 3966, 3969, 3974, 3978, 3982,
+        3985, 3988, 3992, 3994, 3998, 4003, 4005, 4011, 4014, 4016, 4018, 4020, 4022, 4024, 4026, 4028,
+        4030, 4032, 4034, 4037, 4040, 4043, 4046, 4049, 4052, 4055, 4058, 4061, 4064, 4067, 4070, 4073,
+        4076, 4079, 4082, 4084, 4086, 4089, 4091, 4093, 4095, 4098, 4101, 4103, 4105, 4107, 4109, 4111,
+        4115, 4117, 4119, 4121, 4123, 4125, 4127, 4129, 4131, 4134, 4138, 4140, 4142, 4144, 4146, 4148,
+        4150, 4152, 4155, 4158, 4161, 4164, 4166, 4168, 4170, 4172, 4174, 4176, 4178, 4180, 4182, 4184,
+        4187, 4190, 4192, 4195, 4198, 4201, 4203, 4206, 4209, 4213, 4215, 4218, 4221, 4224, 4227, 4232,
+        4238, 4240, 4242, 4244, 4246, 4248, 4250, 4252, 4254, 4256, 4258, 4260, 4262, 4264, 4266, 4268,
+        4270, 4272, 4274, 4278, 4280, 4282, 4284, 4288, 4291, 4293, 4295, 4297, 4299, 4301, 4303, 4305,
+        4307, 4309, 4311, 4314, 4316, 4318, 4321, 4324, 4326, 4330, 4333, 4335, 4337, 4339, 4341, 4344,
+        4347, 4349, 4351, 4353, 4355, 4357, 4359, 4361, 4363, 4365, 4368, 4371, 4374, 4377, 4380, 4383,
+        4386, 4389, 4392, 4395, 4398, 4401, 4404, 4407, 4410, 4413, 4416, 4419, 4422, 4425, 4428, 4431,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4434, 4435, 0, 0,
+        4436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2298, 2323, 2313, 0, 0, 0, 4437, 4438, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4439, 4440, 4441, 4442,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4443, 0, 0, 0, 0, 0, 0,
+        4444, 4445, 2933, 4446, 4447, 4448, 4449, 2987, 2987, 4450, 2941, 4451, 4452, 4453, 4454, 4455,
+        4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471,
+        4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487,
+        4488, 4489, 4490, 4491, 2899, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 4501, 4502,
+        2972, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516, 4517,
+        4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529, 4460, 4530, 4531, 4532,
+        4533, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548,
+        4549, 2935, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 4563,
+        4564, 2812, 4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 2793, 4573, 4574, 4575, 4576, 4577,
+        4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593,
+        4594, 4548, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602, 4532, 4603, 4604, 4605, 4606, 4607,
+        4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4460,
+        4623, 4624, 4625, 4626, 2986, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637,
+        4638, 3519, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4534, 4648, 4649, 4650, 4651,
+        4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 2940, 4661, 4662, 4663, 4664, 4665, 4666,
+        4667, 4668, 4669, 4670, 4671, 4672, 4673, 2891, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4681,
+        4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689, 2918, 4690, 2921, 4691, 4692, 4693, 0, 0,
+        4694, 0, 4695, 0, 0, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703, 4704, 2898, 0,
+        4705, 0, 4706, 0, 0, 4707, 4708, 0, 0, 0, 4709, 4710, 4711, 4712, 4713, 4714,
+        4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 2819, 4727, 4728, 4729,
+        4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 3524, 4742, 4743, 4744,
+        4745, 3528, 4746, 4747, 4748, 4749, 4750, 4584, 4751, 4752, 4753, 4754, 4755, 4756, 4756, 4757,
+        4758, 4759, 4760, 4761, 4762, 4763, 4764, 4707, 4765, 4766, 4767, 4768, 4769, 4770, 0, 0,
+        4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4721, 4779, 4780, 4781, 4694, 4782, 4783, 4784,
+        4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4729, 4794, 4730, 4795, 4796, 4797, 4798,
+        4799, 4695, 4481, 4800, 4801, 2852, 4549, 4632, 4802, 4803, 4737, 4804, 4738, 4805, 4806, 4807,
+        4697, 4808, 4809, 4810, 4811, 4812, 4698, 4813, 4814, 4815, 4816, 4817, 4818, 4750, 4819, 4820,
+        4584, 4821, 4754, 4822, 4823, 4824, 4825, 4826, 4759, 4827, 4706, 4828, 4760, 4530, 4829, 4761,
+        4830, 4763, 4831, 4832, 4833, 4834, 4835, 4765, 4703, 4836, 4766, 4837, 4767, 4838, 2987, 4839,
+        4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 0, 0, 0, 0, 0, 0,
+        4850, 4852, 4854, 4856, 4859, 4862, 4862, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4864, 4866, 4868, 4870, 4872, 0, 0, 0, 0, 0, 4874, 0, 4876,
+        4878, 2324, 2327, 4879, 4880, 4881, 4882, 4883, 4884, 2284, 4885, 4887, 4889, 4892, 4895, 4897,
+        4899, 4901, 4903, 4905, 4907, 4909, 4911, 0, 4913, 4915, 4917, 4919, 4921, 0, 4923, 0,
+        4925, 4927, 0, 4929, 4931, 0, 4933, 4935, 4937, 4939, 4941, 4943, 4945, 4947, 4949, 4951,
+        4953, 4953, 4954, 4954, 4954, 4954, 4955, 4955, 4955, 4955, 4956, 4956, 4956, 4956, 4957, 4957,
+        4957, 4957, 4958, 4958, 4958, 4958, 4959, 4959, 4959, 4959, 4960, 4960, 4960, 4960, 4961, 4961,
+        4961, 4961, 4962, 4962, 4962, 4962, 4963, 4963, 4963, 4963, 4964, 4964, 4964, 4964, 4965, 4965,
+        4965, 4965, 4966, 4966, 4967, 4967, 4968, 4968, 4969, 4969, 4970, 4970, 4971, 4971, 4972, 4972,
+        4972, 4972, 4973, 4973, 4973, 4973, 4974, 4974, 4974, 4974, 4975, 4975, 4975, 4975, 4976, 4976,
+        4977, 4977, 4977, 4977, 807, 807, 4978, 4978, 4978, 4978, 4979, 4979, 4979, 4979, 4980, 4980,
+        811, 811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4981, 4981, 4981, 4981, 4982, 4982, 4983, 4983, 4984, 4984, 803, 4985, 4985,
+        4986, 4986, 4987, 4987, 4988, 4988, 4988, 4988, 4989, 4989, 4990, 4990, 4993, 4993, 4996, 4996,
+        4999, 4999, 5002, 5002, 5005, 5005, 5008, 5008, 5008, 5011, 5011, 5011, 5014, 5014, 5014, 5014,
+        5015, 5018, 5021, 5011, 5024, 5027, 5029, 5031, 5033, 5035, 5037, 5039, 5041, 5043, 5045, 5047,
+        5049, 5051, 5053, 5055, 5057, 5059, 5061, 5063, 5065, 5067, 5069, 5071, 5073, 5075, 5077, 5079,
+        5081, 5083, 5085, 5087, 5089, 5091, 5093, 5095, 5097, 5099, 5101, 5103, 5105, 5107, 5109, 5111,
+        5113, 5115, 5117, 5119, 5121, 5123, 5125, 5127, 5129, 5131, 5133, 5135, 5137, 5139, 5141, 5143,
+        5145, 5147, 5149, 5151, 5153, 5155, 5157, 5159, 5161, 5163, 5165, 5167, 5169, 5171, 5173, 5175,
+        5177, 5179, 5181, 5183, 5185, 5187, 5189, 5191, 5193, 5195, 5197, 5199, 5201, 5203, 5205, 5208,
+        5211, 5214, 5217, 5220, 5223, 5226, 5021, 5229, 5011, 5024, 5232, 5234, 5033, 5236, 5035, 5037,
+        5238, 5240, 5045, 5242, 5047, 5049, 5244, 5246, 5053, 5248, 5055, 5057, 5115, 5117, 5123, 5125,
+        5127, 5135, 5137, 5139, 5141, 5149, 5151, 5153, 5250, 5161, 5252, 5254, 5173, 5256, 5175, 5177,
+        5203, 5258, 5260, 5193, 5262, 5195, 5197, 5015, 5018, 5264, 5021, 5267, 5027, 5029, 5031, 5033,
+        5270, 5039, 5041, 5043, 5045, 5272, 5053, 5059, 5061, 5063, 5065, 5067, 5071, 5073, 5075, 5077,
+        5079, 5081, 5274, 5083, 5085, 5087, 5089, 5091, 5093, 5097, 5099, 5101, 5103, 5105, 5107, 5109,
+        5111, 5113, 5119, 5121, 5129, 5131, 5133, 5135, 5137, 5143, 5145, 5147, 5149, 5276, 5155, 5157,
+        5159, 5161, 5167, 5169, 5171, 5173, 5278, 5179, 5181, 5280, 5187, 5189, 5191, 5193, 5282, 5021,
+        5267, 5033, 5270, 5045, 5272, 5053, 5284, 5079, 5286, 5288, 5290, 5135, 5137, 5149, 5173, 5278,
+        5193, 5282, 5292, 5295, 5298, 5301, 5303, 5305, 5307, 5309, 5311, 5313, 5315, 5317, 5319, 5321,
+        5323, 5325, 5327, 5329, 5331, 5333, 5335, 5337, 5339, 5341, 5343, 5345, 5288, 5347, 5349, 5351,
+        5353, 5301, 5303, 5305, 5307, 5309, 5311, 5313, 5315, 5317, 5319, 5321, 5323, 5325, 5327, 5329,
+        5331, 5333, 5335, 5337, 5339, 5341, 5343, 5345, 5288, 5347, 5349, 5351, 5353, 5341, 5343, 5345,
+        5288, 5286, 5290, 5095, 5073, 5075, 5077, 5341, 5343, 5345, 5095, 5097, 5355, 5355, 0, 0,
+        5357, 5360, 5360, 5363, 5366, 5369, 5372, 5375, 5378, 5378, 5381, 5384, 5387, 5390, 5393, 5396,
+        5396, 5399, 5402, 5402, 5405, 5405, 5408, 5411, 5411, 5414, 5417, 5417, 5420, 5420, 5423, 5426,
+        5426, 5429, 5429, 5432, 5435, 5438, 5441, 5441, 5444, 5447, 5450, 5453, 5456, 5456, 5459, 5462,
+        5465, 5468, 5471, 5474, 5474, 5477, 5477, 5480, 5480, 5483, 5486, 5489, 5492, 5495, 5498, 5501,
+        0, 0, 5504, 5507, 5510, 5513, 5516, 5519, 5519, 5522, 5525, 5528, 5531, 5531, 5534, 5537,
+        5540, 5543, 5546, 5549, 5552, 5555, 5558, 5561, 5564, 5567, 5570, 5573, 5576, 5579, 5582, 5585,
+        5588, 5591, 5594, 5597, 5459, 5465, 5600, 5603, 5606, 5609, 5612, 5615, 5612, 5606, 5618, 5621,
+        5624, 5627, 5630, 5615, 5438, 5408, 5633, 5636, 0, 0, 0, 0, 0, 0, 0, 0,
+        5639, 5642, 5645, 5649, 5653, 5657, 5661, 5665, 5669, 5673, 5676, 5694, 5702, 0, 0, 0,
+        5706, 5707, 5708, 5709, 622, 5710, 5711, 5712, 5713, 2250, 0, 0, 0, 0, 0, 0,
+        2248, 5714, 5715, 5716, 5716, 2287, 2288, 5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 2531,
+        2532, 5725, 5726, 5727, 5728, 0, 0, 5729, 5730, 2265, 2265, 2265, 2265, 5716, 5716, 5716,
+        5706, 5707, 2247, 0, 622, 5709, 5711, 5710, 5714, 2287, 2288, 5717, 5718, 5719, 5720, 5731,
+        5732, 5733, 2284, 5734, 5735, 5736, 2286, 0, 5737, 5738, 5739, 5740, 0, 0, 0, 0,
+        5741, 5743, 5745, 0, 5747, 0, 5749, 5751, 5753, 5755, 5757, 5759, 5761, 5763, 5765, 5767,
+        5769, 789, 789, 791, 791, 793, 793, 795, 795, 797, 797, 797, 797, 5770, 5770, 5771,
+        5771, 5771, 5771, 5772, 5772, 5773, 5773, 5773, 5773, 5774, 5774, 5774, 5774, 5775, 5775, 5775,
+        5775, 5776, 5776, 5776, 5776, 5777, 5777, 5777, 5777, 5778, 5778, 5779, 5779, 5780, 5780, 5781,
+        5781, 5782, 5782, 5782, 5782, 5783, 5783, 5783, 5783, 5784, 5784, 5784, 5784, 5785, 5785, 5785,
+        5785, 5786, 5786, 5786, 5786, 5787, 5787, 5787, 5787, 5788, 5788, 5788, 5788, 5789, 5789, 5789,
+        5789, 5790, 5790, 5790, 5790, 5791, 5791, 5791, 5791, 5792, 5792, 5792, 5792, 5793, 5793, 5793,
+        5793, 5794, 5794, 5794, 5794, 5795, 5795, 5795, 5795, 5796, 5796, 5796, 5796, 5797, 5797, 4989,
+        4989, 5798, 5798, 5798, 5798, 5799, 5799, 5802, 5802, 5805, 5805, 5808, 5808, 0, 0, 0,
+        0, 5710, 5810, 5731, 5738, 5739, 5732, 5811, 2287, 2288, 5733, 2284, 5706, 5734, 2247, 5812,
+        2277, 14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 5709, 622, 5735, 2286, 5736, 5711,
+        5740, 977, 979, 2298, 980, 981, 2323, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+        993, 2313, 994, 2755, 995, 996, 2389, 997, 2401, 2756, 2321, 5729, 5737, 5730, 5813, 5716,
+        2219, 4, 1001, 1027, 1002, 1003, 1030, 1007, 589, 1024, 591, 1008, 611, 1009, 2289, 15,
+        1014, 2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057, 5717, 5814, 5718, 5815, 5816,
+        5817, 5708, 5725, 5726, 5707, 5818, 3663, 5819, 5820, 5821, 5822, 5823, 5824, 5825, 5826, 5827,
+        5828, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631,
+        3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647,
+        3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 5829, 5830, 5831,
+        3167, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130,
+        3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 0,
+        0, 0, 3146, 3147, 3148, 3149, 3150, 3151, 0, 0, 3152, 3153, 3154, 3155, 3156, 3157,
+        0, 0, 3158, 3159, 3160, 3161, 3162, 3163, 0, 0, 3164, 3165, 3166, 0, 0, 0,
+        5832, 5833, 5834, 5, 5835, 5836, 5837, 0, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 0,
+        0, 5845, 5846, 5847, 5848, 5849, 0, 5850, 5851, 5852, 5853, 5854, 5855, 5856, 5857, 5858,
+        5859, 5860, 5861, 5862, 5863, 2310, 5864, 5865, 5866, 5867, 5868, 5869, 5870, 5871, 5872, 5873,
+        5874, 5875, 5876, 5877, 5878, 2757, 5879, 5880, 5881, 5882, 5883, 5884, 5885, 5886, 5887, 5888,
+        5889, 0, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5899, 0, 5901, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5903, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5905, 5907,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5909, 5911, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5913, 5915, 0, 5917, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5919, 5921, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 5923, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5925, 5927,
+        5929, 5932, 5935, 5938, 5941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5944, 5946, 5948, 5951, 5954,
+        5957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        977, 979, 2298, 980, 981, 2323, 983, 984, 985, 986, 987, 988, 989, 990, 991, 993,
+        2313, 994, 2755, 995, 996, 2389, 997, 2401, 2756, 2321, 4, 1001, 1027, 1002, 1003, 1030,
+        1007, 589, 1024, 591, 1008, 611, 1009, 2289, 15, 1014, 2757, 592, 357, 1015, 1016, 1019,
+        596, 612, 597, 1057, 977, 979, 2298, 980, 981, 2323, 983, 984, 985, 986, 987, 988,
+        989, 990, 991, 993, 2313, 994, 2755, 995, 996, 2389, 997, 2401, 2756, 2321, 4, 1001,
+        1027, 1002, 1003, 1030, 1007, 0, 1024, 591, 1008, 611, 1009, 2289, 15, 1014, 2757, 592,
+        357, 1015, 1016, 1019, 596, 612, 597, 1057, 977, 979, 2298, 980, 981, 2323, 983, 984,
+        985, 986, 987, 988, 989, 990, 991, 993, 2313, 994, 2755, 995, 996, 2389, 997, 2401,
+        2756, 2321, 4, 1001, 1027, 1002, 1003, 1030, 1007, 589, 1024, 591, 1008, 611, 1009, 2289,
+        15, 1014, 2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057, 977, 0, 2298, 980,
+        0, 0, 983, 0, 0, 986, 987, 0, 0, 990, 991, 993, 2313, 0, 2755, 995,
+        996, 2389, 997, 2401, 2756, 2321, 4, 1001, 1027, 1002, 0, 1030, 0, 589, 1024, 591,
+        1008, 611, 1009, 2289, 0, 1014, 2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057,
+        596, 612, 597, 1057, 977, 979, 0, 980, 981, 2323, 983, 0, 0, 986, 987, 988,
+        989, 990, 991, 993, 2313, 0, 2755, 995, 996, 2389, 997, 2401, 2756, 0, 4, 1001,
+        1027, 1002, 1003, 1030, 1007, 589, 1024, 591, 1008, 611, 1009, 2289, 15, 1014, 2757, 592,
+        357, 1015, 1016, 1019, 596, 612, 597, 1057, 977, 979, 0, 980, 981, 2323, 983, 0,
+        985, 986, 987, 988, 989, 0, 991, 0, 0, 0, 2755, 995, 996, 2389, 997, 2401,
+        2756, 0, 4, 1001, 1027, 1002, 1003, 1030, 1007, 589, 1024, 591, 1008, 611, 1009, 2289,
+        15, 1014, 2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057, 977, 979, 2298, 980,
+        981, 2323, 983, 984, 985, 986, 987, 988, 989, 990, 991, 993, 2313, 994, 2755, 995,
+        996, 2389, 997, 2401, 2756, 2321, 4, 1001, 1027, 1002, 1003, 1030, 1007, 589, 1024, 591,
+        1008, 611, 1009, 2289, 15, 1014, 2757, 592, 357, 1015, 1016, 1019, 596, 612, 597, 1057,
+        596, 612, 597, 1057, 5960, 5961, 0, 0, 5962, 5963, 2331, 5964, 5965, 5966, 5967, 680,
+        5968, 5969, 5970, 5971, 5972, 5973, 5974, 2332, 5975, 680, 682, 5976, 670, 5977, 5978, 5979,
+        2322, 5980, 5981, 668, 1021, 1022, 681, 5982, 5983, 669, 2139, 677, 5984, 11, 5985, 5986,
+        5987, 676, 678, 679, 5988, 5989, 5990, 675, 1023, 5991, 5992, 5993, 681, 669, 677, 675,
+        678, 676, 5962, 5963, 2331, 5964, 5965, 5966, 5967, 680, 5968, 5969, 5970, 5971, 5972, 5973,
+        5974, 2332, 5975, 680, 682, 5976, 670, 5977, 5978, 5979, 2322, 5980, 5981, 668, 1021, 1022,
+        681, 5982, 5983, 669, 2139, 677, 5984, 11, 5985, 5986, 5987, 676, 678, 679, 5988, 5989,
+        5990, 675, 1023, 5991, 5992, 5993, 681, 669, 677, 675, 678, 676, 5962, 5963, 2331, 5964,
+        5965, 5966, 5967, 680, 5968, 5969, 5970, 5971, 5972, 5973, 5974, 2332, 5975, 680, 682, 5976,
+        670, 5977, 5978, 5979, 2322, 5980, 5981, 668, 1021, 1022, 681, 5982, 5983, 669, 2139, 677,
+        5984, 11, 5985, 5986, 5987, 676, 678, 679, 5988, 5989, 5990, 675, 1023, 5991, 5992, 5993,
+        681, 669, 677, 675, 678, 676, 5962, 5963, 2331, 5964, 5965, 5966, 5967, 680, 5968, 5969,
+        5970, 5971, 5972, 5973, 5974, 2332, 5975, 680, 682, 5976, 670, 5977, 5978, 5979, 2322, 5980,
+        5981, 668, 1021, 1022, 681, 5982, 5983, 669, 2139, 677, 5984, 11, 5985, 5986, 5987, 676,
+        678, 679, 5988, 5989, 5990, 675, 1023, 5991, 5992, 5993, 681, 669, 677, 675, 678, 676,
+        5962, 5963, 2331, 5964, 5965, 5966, 5967, 680, 5968, 5969, 5970, 5971, 5972, 5973, 5974, 2332,
+        5975, 680, 682, 5976, 670, 5977, 5978, 5979, 2322, 5980, 5981, 668, 1021, 1022, 681, 5982,
+        5983, 669, 2139, 677, 5984, 11, 5985, 5986, 5987, 676, 678, 679, 5988, 5989, 5990, 675,
+        1023, 5991, 5992, 5993, 681, 669, 677, 675, 678, 676, 5994, 5995, 0, 0, 2277, 14,
+        7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 2277, 14, 7, 8, 2278, 2279, 2280, 2281,
+        2282, 2283, 2277, 14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 2277, 14, 7, 8,
+        2278, 2279, 2280, 2281, 2282, 2283, 2277, 14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283,
+        5770, 5771, 5775, 5778, 0, 5797, 5781, 5776, 5786, 5798, 5792, 5793, 5794, 5795, 5782, 5788,
+        5790, 5784, 5791, 5780, 5783, 5773, 5774, 5777, 5779, 5785, 5787, 5789, 5996, 4976, 5997, 5998,
+        0, 5771, 5775, 0, 5796, 0, 0, 5776, 0, 5798, 5792, 5793, 5794, 5795, 5782, 5788,
+        5790, 5784, 5791, 0, 5783, 5773, 5774, 5777, 0, 5785, 0, 5789, 0, 0, 0, 0,
+        0, 0, 5775, 0, 0, 0, 0, 5776, 0, 5798, 0, 5793, 0, 5795, 5782, 5788,
+        0, 5784, 5791, 0, 5783, 0, 0, 5777, 0, 5785, 0, 5789, 0, 4976, 0, 5998,
+        0, 5771, 5775, 0, 5796, 0, 0, 5776, 5786, 5798, 5792, 0, 5794, 5795, 5782, 5788,
+        5790, 5784, 5791, 0, 5783, 5773, 5774, 5777, 0, 5785, 5787, 5789, 5996, 0, 5997, 0,
+        5770, 5771, 5775, 5778, 5796, 5797, 5781, 5776, 5786, 5798, 0, 5793, 5794, 5795, 5782, 5788,
+        5790, 5784, 5791, 5780, 5783, 5773, 5774, 5777, 5779, 5785, 5787, 5789, 0, 0, 0, 0,
+        0, 5771, 5775, 5778, 0, 5797, 5781, 5776, 5786, 5798, 0, 5793, 5794, 5795, 5782, 5788,
+        5999, 6001, 6003, 6005, 6007, 6009, 6011, 6013, 6015, 6017, 6019, 0, 0, 0, 0, 0,
+        6021, 6024, 6027, 6030, 6033, 6036, 6039, 6042, 6045, 6048, 6051, 6054, 6057, 6060, 6063, 6066,
+        6069, 6072, 6075, 6078, 6081, 6084, 6087, 6090, 6093, 6096, 6099, 2298, 994, 6102, 6104, 0,
+        2313, 994, 2755, 995, 996, 2389, 997, 2401, 2756, 2321, 6106, 4256, 6108, 6110, 6112, 6115,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6117, 6119, 6121, 0, 0, 0,
+        6123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6125, 6127, 3627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2838, 6129, 6130, 3078, 2781, 6131, 6132, 3218, 6133, 6134, 6135, 4622, 6136, 6137, 6138, 6139,
+        6140, 6141, 2874, 6142, 6143, 6144, 6145, 6146, 6147, 2775, 3210, 6148, 3540, 3213, 3541, 6149,
+        2930, 6150, 6151, 6152, 6153, 6154, 3523, 2848, 6155, 6156, 6157, 6158, 0, 0, 0, 0,
+        6159, 6162, 6165, 6168, 6171, 6174, 6177, 6180, 6183, 0, 0, 0, 0, 0, 0, 0,
+        6186, 6187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2277, 14, 7, 8, 2278, 2279, 2280, 2281, 2282, 2283, 0, 0, 0, 0, 0, 0,
+        6188, 6189, 6190, 6191, 6192, 4715, 6193, 6194, 6195, 6196, 4716, 6197, 6198, 6199, 4717, 6200,
+        6201, 6202, 6203, 6204, 6205, 6138, 6206, 6207, 6208, 6209, 6210, 4772, 6211, 2791, 6212, 6213,
+        6214, 6215, 6156, 6216, 6217, 4777, 4718, 4719, 4778, 6218, 6219, 4536, 6220, 4720, 6221, 6222,
+        6223, 6224, 6224, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 6232, 6233, 6234, 6235, 6236,
+        6237, 6238, 6239, 6240, 6241, 6242, 6242, 4780, 6243, 6244, 6245, 6246, 4722, 6247, 6248, 6249,
+        4682, 6250, 6251, 6252, 6253, 6254, 6255, 6256, 6257, 6258, 6259, 6260, 6261, 6131, 6262, 6263,
+        6264, 6265, 6266, 6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6274, 6275, 6276, 6277, 4532,
+        6278, 6279, 6280, 6281, 6282, 2817, 6283, 6284, 2819, 6285, 6286, 6287, 6288, 6289, 6290, 6291,
+        6292, 6293, 6294, 6295, 6296, 6297, 6298, 6299, 6300, 6301, 6302, 6303, 6304, 6305, 4480, 6306,
+        2829, 6307, 6307, 6308, 6309, 6309, 6310, 6311, 6312, 6313, 6314, 6315, 6316, 6317, 6318, 6319,
+        6320, 6321, 6322, 4727, 6323, 6324, 6325, 6326, 4792, 6326, 6327, 4729, 6328, 6329, 6330, 6331,
+        4730, 4453, 6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339, 6340, 6341, 6342, 6343, 6344, 6345,
+        6346, 6347, 6348, 6349, 6350, 6351, 6352, 6353, 4731, 6354, 6355, 6356, 6357, 6358, 6359, 4733,
+        6360, 6361, 6362, 6363, 6364, 6365, 6366, 6367, 4481, 4800, 6368, 6369, 6370, 6371, 6372, 6373,
+        6374, 6375, 4734, 6376, 6377, 6378, 6379, 4842, 6380, 6381, 6382, 6383, 6384, 6385, 6386, 6387,
+        6388, 6389, 6390, 6391, 6392, 4549, 6393, 6394, 6395, 6396, 6397, 6398, 6399, 6400, 6401, 6402,
+        6403, 4735, 4632, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 4803, 6412, 6413, 6414, 6415,
+        6416, 6417, 6418, 6419, 4804, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430,
+        6431, 4806, 6432, 6433, 6434, 6435, 6436, 6437, 6438, 6439, 6440, 6441, 6442, 6442, 6443, 6444,
+        4808, 6445, 6446, 6447, 6448, 6449, 6450, 6451, 4535, 6452, 6453, 6454, 6455, 6456, 6457, 6458,
+        4814, 6459, 6460, 6461, 6462, 6463, 6464, 6464, 4815, 4844, 6465, 6466, 6467, 6468, 6469, 4498,
+        4817, 6470, 6471, 4745, 6472, 6473, 4702, 6474, 6475, 4748, 6476, 6477, 6478, 6479, 6479, 6480,
+        6481, 6482, 6483, 6484, 6485, 6486, 6487, 6488, 6489, 6490, 6491, 6492, 6493, 6494, 6495, 6496,
+        6497, 6498, 6499, 6500, 6501, 6502, 6503, 6504, 6505, 6506, 4754, 6507, 6508, 6509, 6510, 6511,
+        6512, 6513, 6514, 6515, 6516, 6517, 6518, 6519, 6520, 6521, 6522, 6308, 6523, 6524, 6525, 6526,
+        6527, 6528, 6529, 6530, 6531, 6532, 6533, 6534, 4552, 6535, 6536, 6537, 6538, 6539, 6540, 4757,
+        6541, 6542, 6543, 6544, 6545, 6546, 6547, 6548, 6549, 6550, 6551, 6552, 6553, 6554, 6555, 6556,
+        6557, 6558, 6559, 6560, 4493, 6561, 6562, 6563, 6564, 6565, 6566, 4824, 6567, 6568, 6569, 6570,
+        6571, 6572, 6573, 6574, 2919, 6575, 6576, 6577, 6578, 6579, 6580, 6581, 6582, 6583, 6584, 6585,
+        4829, 4830, 2926, 6586, 6587, 6588, 6589, 6590, 6591, 6592, 6593, 6594, 6595, 6596, 6597, 4831,
+        6598, 6599, 6600, 6601, 6602, 6603, 6604, 6605, 6606, 6607, 6608, 6609, 6610, 6611, 6612, 6613,
+        6614, 6615, 6616, 6617, 6618, 6619, 6620, 6621, 6622, 6623, 6624, 6625, 6626, 6627, 4837, 4837,
+        6628, 6629, 6630, 6631, 6632, 6633, 6634, 6635, 6636, 6637, 4838, 6638, 6639, 6640, 6641, 6642,
+        6643, 6644, 6645, 6646, 6647, 2974, 6648, 2978, 6649, 6650, 6651, 6652, 2983, 6653, 0, 0,
+    };
+};
+
+template <typename T>
+constexpr int decomposition_offset_tables<T>::shift1;
+
+template <typename T>
+constexpr int decomposition_offset_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t decomposition_offset_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint16_t decomposition_offset_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint16_t decomposition_offset_tables<T>::stage3[];
+
+constexpr std::uint16_t decomposition_offset_lookup(char32_t c)
+{
+    using t = decomposition_offset_tables<>;
+    return c > 0x10FFFF ? 0 :
+        t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                  (c & ((1u << t::shift2) - 1))];
+}
+
+// Full decompositions, as sequences of code points in which the last has
+// bit 31 set, and the primary composites (other than Hangul syllables)
+// as first << 42 | second << 21 | composite, in order
+template <typename = void>
+struct decomposition_tables {
+    static constexpr std::uint32_t pool[6654] = {
+        0x00000000, 0x80000020, 0x00000020, 0x80000308, 0x80000061, 0x00000020,
+        0x80000304, 0x80000032, 0x80000033, 0x00000020, 0x80000301, 0x800003BC,
+        0x00000020, 0x80000327, 0x80000031, 0x8000006F, 0x00000031, 0x00002044,
+        0x80000034, 0x00000031, 0x00002044, 0x80000032, 0x00000033, 0x00002044,
+        0x80000034, 0x00000041, 0x80000300, 0x00000041, 0x80000301, 0x00000041,
+        0x80000302, 0x00000041, 0x80000303, 0x00000041, 0x80000308, 0x00000041,
+        0x8000030A, 0x00000043, 0x80000327, 0x00000045, 0x80000300, 0x00000045,
+        0x80000301, 0x00000045, 0x80000302, 0x00000045, 0x80000308, 0x00000049,
+        0x80000300, 0x00000049, 0x80000301, 0x00000049, 0x80000302, 0x00000049,
+        0x80000308, 0x0000004E, 0x80000303, 0x0000004F, 0x80000300, 0x0000004F,
+        0x80000301, 0x0000004F, 0x80000302, 0x0000004F, 0x80000303, 0x0000004F,
+        0x80000308, 0x00000055, 0x80000300, 0x00000055, 0x80000301, 0x00000055,
+        0x80000302, 0x00000055, 0x80000308, 0x00000059, 0x80000301, 0x00000061,
+        0x80000300, 0x00000061, 0x80000301, 0x00000061, 0x80000302, 0x00000061,
+        0x80000303, 0x00000061, 0x80000308, 0x00000061, 0x8000030A, 0x00000063,
+        0x80000327, 0x00000065, 0x80000300, 0x00000065, 0x80000301, 0x00000065,
+        0x80000302, 0x00000065, 0x80000308, 0x00000069, 0x80000300, 0x00000069,
+        0x80000301, 0x00000069, 0x80000302, 0x00000069, 0x80000308, 0x0000006E,
+        0x80000303, 0x0000006F, 0x80000300, 0x0000006F, 0x80000301, 0x0000006F,
+        0x80000302, 0x0000006F, 0x80000303, 0x0000006F, 0x80000308, 0x00000075,
+        0x80000300, 0x00000075, 0x80000301, 0x00000075, 0x80000302, 0x00000075,
+        0x80000308, 0x00000079, 0x80000301, 0x00000079, 0x80000308, 0x00000041,
+        0x80000304, 0x00000061, 0x80000304, 0x00000041, 0x80000306, 0x00000061,
+        0x80000306, 0x00000041, 0x80000328, 0x00000061, 0x80000328, 0x00000043,
+        0x80000301, 0x00000063, 0x80000301, 0x00000043, 0x80000302, 0x00000063,
+        0x80000302, 0x00000043, 0x80000307, 0x00000063, 0x80000307, 0x00000043,
+        0x8000030C, 0x00000063, 0x8000030C, 0x00000044, 0x8000030C, 0x00000064,
+        0x8000030C, 0x00000045, 0x80000304, 0x00000065, 0x80000304, 0x00000045,
+        0x80000306, 0x00000065, 0x80000306, 0x00000045, 0x80000307, 0x00000065,
+        0x80000307, 0x00000045, 0x80000328, 0x00000065, 0x80000328, 0x00000045,
+        0x8000030C, 0x00000065, 0x8000030C, 0x00000047, 0x80000302, 0x00000067,
+        0x80000302, 0x00000047, 0x80000306, 0x00000067, 0x80000306, 0x00000047,
+        0x80000307, 0x00000067, 0x80000307, 0x00000047, 0x80000327, 0x00000067,
+        0x80000327, 0x00000048, 0x80000302, 0x00000068, 0x80000302, 0x00000049,
+        0x80000303, 0x00000069, 0x80000303, 0x00000049, 0x80000304, 0x00000069,
+        0x80000304, 0x00000049, 0x80000306, 0x00000069, 0x80000306, 0x00000049,
+        0x80000328, 0x00000069, 0x80000328, 0x00000049, 0x80000307, 0x00000049,
+        0x8000004A, 0x00000069, 0x8000006A, 0x0000004A, 0x80000302, 0x0000006A,
+        0x80000302, 0x0000004B, 0x80000327, 0x0000006B, 0x80000327, 0x0000004C,
+        0x80000301, 0x0000006C, 0x80000301, 0x0000004C, 0x80000327, 0x0000006C,
+        0x80000327, 0x0000004C, 0x8000030C, 0x0000006C, 0x8000030C, 0x0000004C,
+        0x800000B7, 0x0000006C, 0x800000B7, 0x0000004E, 0x80000301, 0x0000006E,
+        0x80000301, 0x0000004E, 0x80000327, 0x0000006E, 0x80000327, 0x0000004E,
+        0x8000030C, 0x0000006E, 0x8000030C, 0x000002BC, 0x8000006E, 0x0000004F,
+        0x80000304, 0x0000006F, 0x80000304, 0x0000004F, 0x80000306, 0x0000006F,
+        0x80000306, 0x0000004F, 0x8000030B, 0x0000006F, 0x8000030B, 0x00000052,
+        0x80000301, 0x00000072, 0x80000301, 0x00000052, 0x80000327, 0x00000072,
+        0x80000327, 0x00000052, 0x8000030C, 0x00000072, 0x8000030C, 0x00000053,
+        0x80000301, 0x00000073, 0x80000301, 0x00000053, 0x80000302, 0x00000073,
+        0x80000302, 0x00000053, 0x80000327, 0x00000073, 0x80000327, 0x00000053,
+        0x8000030C, 0x00000073, 0x8000030C, 0x00000054, 0x80000327, 0x00000074,
+        0x80000327, 0x00000054, 0x8000030C, 0x00000074, 0x8000030C, 0x00000055,
+        0x80000303, 0x00000075, 0x80000303, 0x00000055, 0x80000304, 0x00000075,
+        0x80000304, 0x00000055, 0x80000306, 0x00000075, 0x80000306, 0x00000055,
+        0x8000030A, 0x00000075, 0x8000030A, 0x00000055, 0x8000030B, 0x00000075,
+        0x8000030B, 0x00000055, 0x80000328, 0x00000075, 0x80000328, 0x00000057,
+        0x80000302, 0x00000077, 0x80000302, 0x00000059, 0x80000302, 0x00000079,
+        0x80000302, 0x00000059, 0x80000308, 0x0000005A, 0x80000301, 0x0000007A,
+        0x80000301, 0x0000005A, 0x80000307, 0x0000007A, 0x80000307, 0x0000005A,
+        0x8000030C, 0x0000007A, 0x8000030C, 0x80000073, 0x0000004F, 0x8000031B,
+        0x0000006F, 0x8000031B, 0x00000055, 0x8000031B, 0x00000075, 0x8000031B,
+        0x00000044, 0x0000005A, 0x8000030C, 0x00000044, 0x0000007A, 0x8000030C,
+        0x00000064, 0x0000007A, 0x8000030C, 0x0000004C, 0x8000004A, 0x0000004C,
+        0x8000006A, 0x0000006C, 0x8000006A, 0x0000004E, 0x8000004A, 0x0000004E,
+        0x8000006A, 0x0000006E, 0x8000006A, 0x00000041, 0x8000030C, 0x00000061,
+        0x8000030C, 0x00000049, 0x8000030C, 0x00000069, 0x8000030C, 0x0000004F,
+        0x8000030C, 0x0000006F, 0x8000030C, 0x00000055, 0x8000030C, 0x00000075,
+        0x8000030C, 0x00000055, 0x00000308, 0x80000304, 0x00000075, 0x00000308,
+        0x80000304, 0x00000055, 0x00000308, 0x80000301, 0x00000075, 0x00000308,
+        0x80000301, 0x00000055, 0x00000308, 0x8000030C, 0x00000075, 0x00000308,
+        0x8000030C, 0x00000055, 0x00000308, 0x80000300, 0x00000075, 0x00000308,
+        0x80000300, 0x00000041, 0x00000308, 0x80000304, 0x00000061, 0x00000308,
+        0x80000304, 0x00000041, 0x00000307, 0x80000304, 0x00000061, 0x00000307,
+        0x80000304, 0x000000C6, 0x80000304, 0x000000E6, 0x80000304, 0x00000047,
+        0x8000030C, 0x00000067, 0x8000030C, 0x0000004B, 0x8000030C, 0x0000006B,
+        0x8000030C, 0x0000004F, 0x80000328, 0x0000006F, 0x80000328, 0x0000004F,
+        0x00000328, 0x80000304, 0x0000006F, 0x00000328, 0x80000304, 0x000001B7,
+        0x8000030C, 0x00000292, 0x8000030C, 0x0000006A, 0x8000030C, 0x00000044,
+        0x8000005A, 0x00000044, 0x8000007A, 0x00000064, 0x8000007A, 0x00000047,
+        0x80000301, 0x00000067, 0x80000301, 0x0000004E, 0x80000300, 0x0000006E,
+        0x80000300, 0x00000041, 0x0000030A, 0x80000301, 0x00000061, 0x0000030A,
+        0x80000301, 0x000000C6, 0x80000301, 0x000000E6, 0x80000301, 0x000000D8,
+        0x80000301, 0x000000F8, 0x80000301, 0x00000041, 0x8000030F, 0x00000061,
+        0x8000030F, 0x00000041, 0x80000311, 0x00000061, 0x80000311, 0x00000045,
+        0x8000030F, 0x00000065, 0x8000030F, 0x00000045, 0x80000311, 0x00000065,
+        0x80000311, 0x00000049, 0x8000030F, 0x00000069, 0x8000030F, 0x00000049,
+        0x80000311, 0x00000069, 0x80000311, 0x0000004F, 0x8000030F, 0x0000006F,
+        0x8000030F, 0x0000004F, 0x80000311, 0x0000006F, 0x80000311, 0x00000052,
+        0x8000030F, 0x00000072, 0x8000030F, 0x00000052, 0x80000311, 0x00000072,
+        0x80000311, 0x00000055, 0x8000030F, 0x00000075, 0x8000030F, 0x00000055,
+        0x80000311, 0x00000075, 0x80000311, 0x00000053, 0x80000326, 0x00000073,
+        0x80000326, 0x00000054, 0x80000326, 0x00000074, 0x80000326, 0x00000048,
+        0x8000030C, 0x00000068, 0x8000030C, 0x00000041, 0x80000307, 0x00000061,
+        0x80000307, 0x00000045, 0x80000327, 0x00000065, 0x80000327, 0x0000004F,
+        0x00000308, 0x80000304, 0x0000006F, 0x00000308, 0x80000304, 0x0000004F,
+        0x00000303, 0x80000304, 0x0000006F, 0x00000303, 0x80000304, 0x0000004F,
+        0x80000307, 0x0000006F, 0x80000307, 0x0000004F, 0x00000307, 0x80000304,
+        0x0000006F, 0x00000307, 0x80000304, 0x00000059, 0x80000304, 0x00000079,
+        0x80000304, 0x80000068, 0x80000266, 0x8000006A, 0x80000072, 0x80000279,
+        0x8000027B, 0x80000281, 0x80000077, 0x80000079, 0x00000020, 0x80000306,
+        0x00000020, 0x80000307, 0x00000020, 0x8000030A, 0x00000020, 0x80000328,
+        0x00000020, 0x80000303, 0x00000020, 0x8000030B, 0x80000263, 0x8000006C,
+        0x80000078, 0x80000295, 0x80000300, 0x80000301, 0x80000313, 0x00000308,
+        0x80000301, 0x800002B9, 0x00000020, 0x80000345, 0x8000003B, 0x000000A8,
+        0x80000301, 0x00000391, 0x80000301, 0x800000B7, 0x00000395, 0x80000301,
+        0x00000397, 0x80000301, 0x00000399, 0x80000301, 0x0000039F, 0x80000301,
+        0x000003A5, 0x80000301, 0x000003A9, 0x80000301, 0x000003B9, 0x00000308,
+        0x80000301, 0x00000399, 0x80000308, 0x000003A5, 0x80000308, 0x000003B1,
+        0x80000301, 0x000003B5, 0x80000301, 0x000003B7, 0x80000301, 0x000003B9,
+        0x80000301, 0x000003C5, 0x00000308, 0x80000301, 0x000003B9, 0x80000308,
+        0x000003C5, 0x80000308, 0x000003BF, 0x80000301, 0x000003C5, 0x80000301,
+        0x000003C9, 0x80000301, 0x800003B2, 0x800003B8, 0x800003A5, 0x000003D2,
+        0x80000301, 0x000003D2, 0x80000308, 0x800003C6, 0x800003C0, 0x800003BA,
+        0x800003C1, 0x800003C2, 0x80000398, 0x800003B5, 0x800003A3, 0x00000415,
+        0x80000300, 0x00000415, 0x80000308, 0x00000413, 0x80000301, 0x00000406,
+        0x80000308, 0x0000041A, 0x80000301, 0x00000418, 0x80000300, 0x00000423,
+        0x80000306, 0x00000418, 0x80000306, 0x00000438, 0x80000306, 0x00000435,
+        0x80000300, 0x00000435, 0x80000308, 0x00000433, 0x80000301, 0x00000456,
+        0x80000308, 0x0000043A, 0x80000301, 0x00000438, 0x80000300, 0x00000443,
+        0x80000306, 0x00000474, 0x8000030F, 0x00000475, 0x8000030F, 0x00000416,
+        0x80000306, 0x00000436, 0x80000306, 0x00000410, 0x80000306, 0x00000430,
+        0x80000306, 0x00000410, 0x80000308, 0x00000430, 0x80000308, 0x00000415,
+        0x80000306, 0x00000435, 0x80000306, 0x000004D8, 0x80000308, 0x000004D9,
+        0x80000308, 0x00000416, 0x80000308, 0x00000436, 0x80000308, 0x00000417,
+        0x80000308, 0x00000437, 0x80000308, 0x00000418, 0x80000304, 0x00000438,
+        0x80000304, 0x00000418, 0x80000308, 0x00000438, 0x80000308, 0x0000041E,
+        0x80000308, 0x0000043E, 0x80000308, 0x000004E8, 0x80000308, 0x000004E9,
+        0x80000308, 0x0000042D, 0x80000308, 0x0000044D, 0x80000308, 0x00000423,
+        0x80000304, 0x00000443, 0x80000304, 0x00000423, 0x80000308, 0x00000443,
+        0x80000308, 0x00000423, 0x8000030B, 0x00000443, 0x8000030B, 0x00000427,
+        0x80000308, 0x00000447, 0x80000308, 0x0000042B, 0x80000308, 0x0000044B,
+        0x80000308, 0x00000565, 0x80000582, 0x00000627, 0x80000653, 0x00000627,
+        0x80000654, 0x00000648, 0x80000654, 0x00000627, 0x80000655, 0x0000064A,
+        0x80000654, 0x00000627, 0x80000674, 0x00000648, 0x80000674, 0x000006C7,
+        0x80000674, 0x0000064A, 0x80000674, 0x000006D5, 0x80000654, 0x000006C1,
+        0x80000654, 0x000006D2, 0x80000654, 0x00000928, 0x8000093C, 0x00000930,
+        0x8000093C, 0x00000933, 0x8000093C, 0x00000915, 0x8000093C, 0x00000916,
+        0x8000093C, 0x00000917, 0x8000093C, 0x0000091C, 0x8000093C, 0x00000921,
+        0x8000093C, 0x00000922, 0x8000093C, 0x0000092B, 0x8000093C, 0x0000092F,
+        0x8000093C, 0x000009C7, 0x800009BE, 0x000009C7, 0x800009D7, 0x000009A1,
+        0x800009BC, 0x000009A2, 0x800009BC, 0x000009AF, 0x800009BC, 0x00000A32,
+        0x80000A3C, 0x00000A38, 0x80000A3C, 0x00000A16, 0x80000A3C, 0x00000A17,
+        0x80000A3C, 0x00000A1C, 0x80000A3C, 0x00000A2B, 0x80000A3C, 0x00000B47,
+        0x80000B56, 0x00000B47, 0x80000B3E, 0x00000B47, 0x80000B57, 0x00000B21,
+        0x80000B3C, 0x00000B22, 0x80000B3C, 0x00000B92, 0x80000BD7, 0x00000BC6,
+        0x80000BBE, 0x00000BC7, 0x80000BBE, 0x00000BC6, 0x80000BD7, 0x00000C46,
+        0x80000C56, 0x00000CBF, 0x80000CD5, 0x00000CC6, 0x80000CD5, 0x00000CC6,
+        0x80000CD6, 0x00000CC6, 0x80000CC2, 0x00000CC6, 0x00000CC2, 0x80000CD5,
+        0x00000D46, 0x80000D3E, 0x00000D47, 0x80000D3E, 0x00000D46, 0x80000D57,
+        0x00000DD9, 0x80000DCA, 0x00000DD9, 0x80000DCF, 0x00000DD9, 0x00000DCF,
+        0x80000DCA, 0x00000DD9, 0x80000DDF, 0x00000E4D, 0x80000E32, 0x00000ECD,
+        0x80000EB2, 0x00000EAB, 0x80000E99, 0x00000EAB, 0x80000EA1, 0x80000F0B,
+        0x00000F42, 0x80000FB7, 0x00000F4C, 0x80000FB7, 0x00000F51, 0x80000FB7,
+        0x00000F56, 0x80000FB7, 0x00000F5B, 0x80000FB7, 0x00000F40, 0x80000FB5,
+        0x00000F71, 0x80000F72, 0x00000F71, 0x80000F74, 0x00000FB2, 0x80000F80,
+        0x00000FB2, 0x00000F71, 0x80000F80, 0x00000FB3, 0x80000F80, 0x00000FB3,
+        0x00000F71, 0x80000F80, 0x00000F71, 0x80000F80, 0x00000F92, 0x80000FB7,
+        0x00000F9C, 0x80000FB7, 0x00000FA1, 0x80000FB7, 0x00000FA6, 0x80000FB7,
+        0x00000FAB, 0x80000FB7, 0x00000F90, 0x80000FB5, 0x00001025, 0x8000102E,
+        0x800010DC, 0x00001B05, 0x80001B35, 0x00001B07, 0x80001B35, 0x00001B09,
+        0x80001B35, 0x00001B0B, 0x80001B35, 0x00001B0D, 0x80001B35, 0x00001B11,
+        0x80001B35, 0x00001B3A, 0x80001B35, 0x00001B3C, 0x80001B35, 0x00001B3E,
+        0x80001B35, 0x00001B3F, 0x80001B35, 0x00001B42, 0x80001B35, 0x80000041,
+        0x800000C6, 0x80000042, 0x80000044, 0x80000045, 0x8000018E, 0x80000047,
+        0x80000048, 0x80000049, 0x8000004A, 0x8000004B, 0x8000004C, 0x8000004D,
+        0x8000004E, 0x8000004F, 0x80000222, 0x80000050, 0x80000052, 0x80000054,
+        0x80000055, 0x80000057, 0x80000250, 0x80000251, 0x80001D02, 0x80000062,
+        0x80000064, 0x80000065, 0x80000259, 0x8000025B, 0x8000025C, 0x80000067,
+        0x8000006B, 0x8000006D, 0x8000014B, 0x80000254, 0x80001D16, 0x80001D17,
+        0x80000070, 0x80000074, 0x80000075, 0x80001D1D, 0x8000026F, 0x80000076,
+        0x80001D25, 0x800003B3, 0x800003B4, 0x800003C7, 0x80000069, 0x8000043D,
+        0x80000252, 0x80000063, 0x80000255, 0x800000F0, 0x80000066, 0x8000025F,
+        0x80000261, 0x80000265, 0x80000268, 0x80000269, 0x8000026A, 0x80001D7B,
+        0x8000029D, 0x8000026D, 0x80001D85, 0x8000029F, 0x80000271, 0x80000270,
+        0x80000272, 0x80000273, 0x80000274, 0x80000275, 0x80000278, 0x80000282,
+        0x80000283, 0x800001AB, 0x80000289, 0x8000028A, 0x80001D1C, 0x8000028B,
+        0x8000028C, 0x8000007A, 0x80000290, 0x80000291, 0x80000292, 0x00000041,
+        0x80000325, 0x00000061, 0x80000325, 0x00000042, 0x80000307, 0x00000062,
+        0x80000307, 0x00000042, 0x80000323, 0x00000062, 0x80000323, 0x00000042,
+        0x80000331, 0x00000062, 0x80000331, 0x00000043, 0x00000327, 0x80000301,
+        0x00000063, 0x00000327, 0x80000301, 0x00000044, 0x80000307, 0x00000064,
+        0x80000307, 0x00000044, 0x80000323, 0x00000064, 0x80000323, 0x00000044,
+        0x80000331, 0x00000064, 0x80000331, 0x00000044, 0x80000327, 0x00000064,
+        0x80000327, 0x00000044, 0x8000032D, 0x00000064, 0x8000032D, 0x00000045,
+        0x00000304, 0x80000300, 0x00000065, 0x00000304, 0x80000300, 0x00000045,
+        0x00000304, 0x80000301, 0x00000065, 0x00000304, 0x80000301, 0x00000045,
+        0x8000032D, 0x00000065, 0x8000032D, 0x00000045, 0x80000330, 0x00000065,
+        0x80000330, 0x00000045, 0x00000327, 0x80000306, 0x00000065, 0x00000327,
+        0x80000306, 0x00000046, 0x80000307, 0x00000066, 0x80000307, 0x00000047,
+        0x80000304, 0x00000067, 0x80000304, 0x00000048, 0x80000307, 0x00000068,
+        0x80000307, 0x00000048, 0x80000323, 0x00000068, 0x80000323, 0x00000048,
+        0x80000308, 0x00000068, 0x80000308, 0x00000048, 0x80000327, 0x00000068,
+        0x80000327, 0x00000048, 0x8000032E, 0x00000068, 0x8000032E, 0x00000049,
+        0x80000330, 0x00000069, 0x80000330, 0x00000049, 0x00000308, 0x80000301,
+        0x00000069, 0x00000308, 0x80000301, 0x0000004B, 0x80000301, 0x0000006B,
+        0x80000301, 0x0000004B, 0x80000323, 0x0000006B, 0x80000323, 0x0000004B,
+        0x80000331, 0x0000006B, 0x80000331, 0x0000004C, 0x80000323, 0x0000006C,
+        0x80000323, 0x0000004C, 0x00000323, 0x80000304, 0x0000006C, 0x00000323,
+        0x80000304, 0x0000004C, 0x80000331, 0x0000006C, 0x80000331, 0x0000004C,
+        0x8000032D, 0x0000006C, 0x8000032D, 0x0000004D, 0x80000301, 0x0000006D,
+        0x80000301, 0x0000004D, 0x80000307, 0x0000006D, 0x80000307, 0x0000004D,
+        0x80000323, 0x0000006D, 0x80000323, 0x0000004E, 0x80000307, 0x0000006E,
+        0x80000307, 0x0000004E, 0x80000323, 0x0000006E, 0x80000323, 0x0000004E,
+        0x80000331, 0x0000006E, 0x80000331, 0x0000004E, 0x8000032D, 0x0000006E,
+        0x8000032D, 0x0000004F, 0x00000303, 0x80000301, 0x0000006F, 0x00000303,
+        0x80000301, 0x0000004F, 0x00000303, 0x80000308, 0x0000006F, 0x00000303,
+        0x80000308, 0x0000004F, 0x00000304, 0x80000300, 0x0000006F, 0x00000304,
+        0x80000300, 0x0000004F, 0x00000304, 0x80000301, 0x0000006F, 0x00000304,
+        0x80000301, 0x00000050, 0x80000301, 0x00000070, 0x80000301, 0x00000050,
+        0x80000307, 0x00000070, 0x80000307, 0x00000052, 0x80000307, 0x00000072,
+        0x80000307, 0x00000052, 0x80000323, 0x00000072, 0x80000323, 0x00000052,
+        0x00000323, 0x80000304, 0x00000072, 0x00000323, 0x80000304, 0x00000052,
+        0x80000331, 0x00000072, 0x80000331, 0x00000053, 0x80000307, 0x00000073,
+        0x80000307, 0x00000053, 0x80000323, 0x00000073, 0x80000323, 0x00000053,
+        0x00000301, 0x80000307, 0x00000073, 0x00000301, 0x80000307, 0x00000053,
+        0x0000030C, 0x80000307, 0x00000073, 0x0000030C, 0x80000307, 0x00000053,
+        0x00000323, 0x80000307, 0x00000073, 0x00000323, 0x80000307, 0x00000054,
+        0x80000307, 0x00000074, 0x80000307, 0x00000054, 0x80000323, 0x00000074,
+        0x80000323, 0x00000054, 0x80000331, 0x00000074, 0x80000331, 0x00000054,
+        0x8000032D, 0x00000074, 0x8000032D, 0x00000055, 0x80000324, 0x00000075,
+        0x80000324, 0x00000055, 0x80000330, 0x00000075, 0x80000330, 0x00000055,
+        0x8000032D, 0x00000075, 0x8000032D, 0x00000055, 0x00000303, 0x80000301,
+        0x00000075, 0x00000303, 0x80000301, 0x00000055, 0x00000304, 0x80000308,
+        0x00000075, 0x00000304, 0x80000308, 0x00000056, 0x80000303, 0x00000076,
+        0x80000303, 0x00000056, 0x80000323, 0x00000076, 0x80000323, 0x00000057,
+        0x80000300, 0x00000077, 0x80000300, 0x00000057, 0x80000301, 0x00000077,
+        0x80000301, 0x00000057, 0x80000308, 0x00000077, 0x80000308, 0x00000057,
+        0x80000307, 0x00000077, 0x80000307, 0x00000057, 0x80000323, 0x00000077,
+        0x80000323, 0x00000058, 0x80000307, 0x00000078, 0x80000307, 0x00000058,
+        0x80000308, 0x00000078, 0x80000308, 0x00000059, 0x80000307, 0x00000079,
+        0x80000307, 0x0000005A, 0x80000302, 0x0000007A, 0x80000302, 0x0000005A,
+        0x80000323, 0x0000007A, 0x80000323, 0x0000005A, 0x80000331, 0x0000007A,
+        0x80000331, 0x00000068, 0x80000331, 0x00000074, 0x80000308, 0x00000077,
+        0x8000030A, 0x00000079, 0x8000030A, 0x00000061, 0x800002BE, 0x0000017F,
+        0x80000307, 0x00000041, 0x80000323, 0x00000061, 0x80000323, 0x00000041,
+        0x80000309, 0x00000061, 0x80000309, 0x00000041, 0x00000302, 0x80000301,
+        0x00000061, 0x00000302, 0x80000301, 0x00000041, 0x00000302, 0x80000300,
+        0x00000061, 0x00000302, 0x80000300, 0x00000041, 0x00000302, 0x80000309,
+        0x00000061, 0x00000302, 0x80000309, 0x00000041, 0x00000302, 0x80000303,
+        0x00000061, 0x00000302, 0x80000303, 0x00000041, 0x00000323, 0x80000302,
+        0x00000061, 0x00000323, 0x80000302, 0x00000041, 0x00000306, 0x80000301,
+        0x00000061, 0x00000306, 0x80000301, 0x00000041, 0x00000306, 0x80000300,
+        0x00000061, 0x00000306, 0x80000300, 0x00000041, 0x00000306, 0x80000309,
+        0x00000061, 0x00000306, 0x80000309, 0x00000041, 0x00000306, 0x80000303,
+        0x00000061, 0x00000306, 0x80000303, 0x00000041, 0x00000323, 0x80000306,
+        0x00000061, 0x00000323, 0x80000306, 0x00000045, 0x80000323, 0x00000065,
+        0x80000323, 0x00000045, 0x80000309, 0x00000065, 0x80000309, 0x00000045,
+        0x80000303, 0x00000065, 0x80000303, 0x00000045, 0x00000302, 0x80000301,
+        0x00000065, 0x00000302, 0x80000301, 0x00000045, 0x00000302, 0x80000300,
+        0x00000065, 0x00000302, 0x80000300, 0x00000045, 0x00000302, 0x80000309,
+        0x00000065, 0x00000302, 0x80000309, 0x00000045, 0x00000302, 0x80000303,
+        0x00000065, 0x00000302, 0x80000303, 0x00000045, 0x00000323, 0x80000302,
+        0x00000065, 0x00000323, 0x80000302, 0x00000049, 0x80000309, 0x00000069,
+        0x80000309, 0x00000049, 0x80000323, 0x00000069, 0x80000323, 0x0000004F,
+        0x80000323, 0x0000006F, 0x80000323, 0x0000004F, 0x80000309, 0x0000006F,
+        0x80000309, 0x0000004F, 0x00000302, 0x80000301, 0x0000006F, 0x00000302,
+        0x80000301, 0x0000004F, 0x00000302, 0x80000300, 0x0000006F, 0x00000302,
+        0x80000300, 0x0000004F, 0x00000302, 0x80000309, 0x0000006F, 0x00000302,
+        0x80000309, 0x0000004F, 0x00000302, 0x80000303, 0x0000006F, 0x00000302,
+        0x80000303, 0x0000004F, 0x00000323, 0x80000302, 0x0000006F, 0x00000323,
+        0x80000302, 0x0000004F, 0x0000031B, 0x80000301, 0x0000006F, 0x0000031B,
+        0x80000301, 0x0000004F, 0x0000031B, 0x80000300, 0x0000006F, 0x0000031B,
+        0x80000300, 0x0000004F, 0x0000031B, 0x80000309, 0x0000006F, 0x0000031B,
+        0x80000309, 0x0000004F, 0x0000031B, 0x80000303, 0x0000006F, 0x0000031B,
+        0x80000303, 0x0000004F, 0x0000031B, 0x80000323, 0x0000006F, 0x0000031B,
+        0x80000323, 0x00000055, 0x80000323, 0x00000075, 0x80000323, 0x00000055,
+        0x80000309, 0x00000075, 0x80000309, 0x00000055, 0x0000031B, 0x80000301,
+        0x00000075, 0x0000031B, 0x80000301, 0x00000055, 0x0000031B, 0x80000300,
+        0x00000075, 0x0000031B, 0x80000300, 0x00000055, 0x0000031B, 0x80000309,
+        0x00000075, 0x0000031B, 0x80000309, 0x00000055, 0x0000031B, 0x80000303,
+        0x00000075, 0x0000031B, 0x80000303, 0x00000055, 0x0000031B, 0x80000323,
+        0x00000075, 0x0000031B, 0x80000323, 0x00000059, 0x80000300, 0x00000079,
+        0x80000300, 0x00000059, 0x80000323, 0x00000079, 0x80000323, 0x00000059,
+        0x80000309, 0x00000079, 0x80000309, 0x00000059, 0x80000303, 0x00000079,
+        0x80000303, 0x000003B1, 0x80000313, 0x000003B1, 0x80000314, 0x000003B1,
+        0x00000313, 0x80000300, 0x000003B1, 0x00000314, 0x80000300, 0x000003B1,
+        0x00000313, 0x80000301, 0x000003B1, 0x00000314, 0x80000301, 0x000003B1,
+        0x00000313, 0x80000342, 0x000003B1, 0x00000314, 0x80000342, 0x00000391,
+        0x80000313, 0x00000391, 0x80000314, 0x00000391, 0x00000313, 0x80000300,
+        0x00000391, 0x00000314, 0x80000300, 0x00000391, 0x00000313, 0x80000301,
+        0x00000391, 0x00000314, 0x80000301, 0x00000391, 0x00000313, 0x80000342,
+        0x00000391, 0x00000314, 0x80000342, 0x000003B5, 0x80000313, 0x000003B5,
+        0x80000314, 0x000003B5, 0x00000313, 0x80000300, 0x000003B5, 0x00000314,
+        0x80000300, 0x000003B5, 0x00000313, 0x80000301, 0x000003B5, 0x00000314,
+        0x80000301, 0x00000395, 0x80000313, 0x00000395, 0x80000314, 0x00000395,
+        0x00000313, 0x80000300, 0x00000395, 0x00000314, 0x80000300, 0x00000395,
+        0x00000313, 0x80000301, 0x00000395, 0x00000314, 0x80000301, 0x000003B7,
+        0x80000313, 0x000003B7, 0x80000314, 0x000003B7, 0x00000313, 0x80000300,
+        0x000003B7, 0x00000314, 0x80000300, 0x000003B7, 0x00000313, 0x80000301,
+        0x000003B7, 0x00000314, 0x80000301, 0x000003B7, 0x00000313, 0x80000342,
+        0x000003B7, 0x00000314, 0x80000342, 0x00000397, 0x80000313, 0x00000397,
+        0x80000314, 0x00000397, 0x00000313, 0x80000300, 0x00000397, 0x00000314,
+        0x80000300, 0x00000397, 0x00000313, 0x80000301, 0x00000397, 0x00000314,
+        0x80000301, 0x00000397, 0x00000313, 0x80000342, 0x00000397, 0x00000314,
+        0x80000342, 0x000003B9, 0x80000313, 0x000003B9, 0x80000314, 0x000003B9,
+        0x00000313, 0x80000300, 0x000003B9, 0x00000314, 0x80000300, 0x000003B9,
+        0x00000313, 0x80000301, 0x000003B9, 0x00000314, 0x80000301, 0x000003B9,
+        0x00000313, 0x80000342, 0x000003B9, 0x00000314, 0x80000342, 0x00000399,
+        0x80000313, 0x00000399, 0x80000314, 0x00000399, 0x00000313, 0x80000300,
+        0x00000399, 0x00000314, 0x80000300, 0x00000399, 0x00000313, 0x80000301,
+        0x00000399, 0x00000314, 0x80000301, 0x00000399, 0x00000313, 0x80000342,
+        0x00000399, 0x00000314, 0x80000342, 0x000003BF, 0x80000313, 0x000003BF,
+        0x80000314, 0x000003BF, 0x00000313, 0x80000300, 0x000003BF, 0x00000314,
+        0x80000300, 0x000003BF, 0x00000313, 0x80000301, 0x000003BF, 0x00000314,
+        0x80000301, 0x0000039F, 0x80000313, 0x0000039F, 0x80000314, 0x0000039F,
+        0x00000313, 0x80000300, 0x0000039F, 0x00000314, 0x80000300, 0x0000039F,
+        0x00000313, 0x80000301, 0x0000039F, 0x00000314, 0x80000301, 0x000003C5,
+        0x80000313, 0x000003C5, 0x80000314, 0x000003C5, 0x00000313, 0x80000300,
+        0x000003C5, 0x00000314, 0x80000300, 0x000003C5, 0x00000313, 0x80000301,
+        0x000003C5, 0x00000314, 0x80000301, 0x000003C5, 0x00000313, 0x80000342,
+        0x000003C5, 0x00000314, 0x80000342, 0x000003A5, 0x80000314, 0x000003A5,
+        0x00000314, 0x80000300, 0x000003A5, 0x00000314, 0x80000301, 0x000003A5,
+        0x00000314, 0x80000342, 0x000003C9, 0x80000313, 0x000003C9, 0x80000314,
+        0x000003C9, 0x00000313, 0x80000300, 0x000003C9, 0x00000314, 0x80000300,
+        0x000003C9, 0x00000313, 0x80000301, 0x000003C9, 0x00000314, 0x80000301,
+        0x000003C9, 0x00000313, 0x80000342, 0x000003C9, 0x00000314, 0x80000342,
+        0x000003A9, 0x80000313, 0x000003A9, 0x80000314, 0x000003A9, 0x00000313,
+        0x80000300, 0x000003A9, 0x00000314, 0x80000300, 0x000003A9, 0x00000313,
+        0x80000301, 0x000003A9, 0x00000314, 0x80000301, 0x000003A9, 0x00000313,
+        0x80000342, 0x000003A9, 0x00000314, 0x80000342, 0x000003B1, 0x80000300,
+        0x000003B5, 0x80000300, 0x000003B7, 0x80000300, 0x000003B9, 0x80000300,
+        0x000003BF, 0x80000300, 0x000003C5, 0x80000300, 0x000003C9, 0x80000300,
+        0x000003B1, 0x00000313, 0x80000345, 0x000003B1, 0x00000314, 0x80000345,
+        0x000003B1, 0x00000313, 0x00000300, 0x80000345, 0x000003B1, 0x00000314,
+        0x00000300, 0x80000345, 0x000003B1, 0x00000313, 0x00000301, 0x80000345,
+        0x000003B1, 0x00000314, 0x00000301, 0x80000345, 0x000003B1, 0x00000313,
+        0x00000342, 0x80000345, 0x000003B1, 0x00000314, 0x00000342, 0x80000345,
+        0x00000391, 0x00000313, 0x80000345, 0x00000391, 0x00000314, 0x80000345,
+        0x00000391, 0x00000313, 0x00000300, 0x80000345, 0x00000391, 0x00000314,
+        0x00000300, 0x80000345, 0x00000391, 0x00000313, 0x00000301, 0x80000345,
+        0x00000391, 0x00000314, 0x00000301, 0x80000345, 0x00000391, 0x00000313,
+        0x00000342, 0x80000345, 0x00000391, 0x00000314, 0x00000342, 0x80000345,
+        0x000003B7, 0x00000313, 0x80000345, 0x000003B7, 0x00000314, 0x80000345,
+        0x000003B7, 0x00000313, 0x00000300, 0x80000345, 0x000003B7, 0x00000314,
+        0x00000300, 0x80000345, 0x000003B7, 0x00000313, 0x00000301, 0x80000345,
+        0x000003B7, 0x00000314, 0x00000301, 0x80000345, 0x000003B7, 0x00000313,
+        0x00000342, 0x80000345, 0x000003B7, 0x00000314, 0x00000342, 0x80000345,
+        0x00000397, 0x00000313, 0x80000345, 0x00000397, 0x00000314, 0x80000345,
+        0x00000397, 0x00000313, 0x00000300, 0x80000345, 0x00000397, 0x00000314,
+        0x00000300, 0x80000345, 0x00000397, 0x00000313, 0x00000301, 0x80000345,
+        0x00000397, 0x00000314, 0x00000301, 0x80000345, 0x00000397, 0x00000313,
+        0x00000342, 0x80000345, 0x00000397, 0x00000314, 0x00000342, 0x80000345,
+        0x000003C9, 0x00000313, 0x80000345, 0x000003C9, 0x00000314, 0x80000345,
+        0x000003C9, 0x00000313, 0x00000300, 0x80000345, 0x000003C9, 0x00000314,
+        0x00000300, 0x80000345, 0x000003C9, 0x00000313, 0x00000301, 0x80000345,
+        0x000003C9, 0x00000314, 0x00000301, 0x80000345, 0x000003C9, 0x00000313,
+        0x00000342, 0x80000345, 0x000003C9, 0x00000314, 0x00000342, 0x80000345,
+        0x000003A9, 0x00000313, 0x80000345, 0x000003A9, 0x00000314, 0x80000345,
+        0x000003A9, 0x00000313, 0x00000300, 0x80000345, 0x000003A9, 0x00000314,
+        0x00000300, 0x80000345, 0x000003A9, 0x00000313, 0x00000301, 0x80000345,
+        0x000003A9, 0x00000314, 0x00000301, 0x80000345, 0x000003A9, 0x00000313,
+        0x00000342, 0x80000345, 0x000003A9, 0x00000314, 0x00000342, 0x80000345,
+        0x000003B1, 0x80000306, 0x000003B1, 0x80000304, 0x000003B1, 0x00000300,
+        0x80000345, 0x000003B1, 0x80000345, 0x000003B1, 0x00000301, 0x80000345,
+        0x000003B1, 0x80000342, 0x000003B1, 0x00000342, 0x80000345, 0x00000391,
+        0x80000306, 0x00000391, 0x80000304, 0x00000391, 0x80000300, 0x00000391,
+        0x80000345, 0x00000020, 0x80000313, 0x800003B9, 0x00000020, 0x80000342,
+        0x000000A8, 0x80000342, 0x000003B7, 0x00000300, 0x80000345, 0x000003B7,
+        0x80000345, 0x000003B7, 0x00000301, 0x80000345, 0x000003B7, 0x80000342,
+        0x000003B7, 0x00000342, 0x80000345, 0x00000395, 0x80000300, 0x00000397,
+        0x80000300, 0x00000397, 0x80000345, 0x00001FBF, 0x80000300, 0x00001FBF,
+        0x80000301, 0x00001FBF, 0x80000342, 0x000003B9, 0x80000306, 0x000003B9,
+        0x80000304, 0x000003B9, 0x00000308, 0x80000300, 0x000003B9, 0x80000342,
+        0x000003B9, 0x00000308, 0x80000342, 0x00000399, 0x80000306, 0x00000399,
+        0x80000304, 0x00000399, 0x80000300, 0x00001FFE, 0x80000300, 0x00001FFE,
+        0x80000301, 0x00001FFE, 0x80000342, 0x000003C5, 0x80000306, 0x000003C5,
+        0x80000304, 0x000003C5, 0x00000308, 0x80000300, 0x000003C1, 0x80000313,
+        0x000003C1, 0x80000314, 0x000003C5, 0x80000342, 0x000003C5, 0x00000308,
+        0x80000342, 0x000003A5, 0x80000306, 0x000003A5, 0x80000304, 0x000003A5,
+        0x80000300, 0x000003A1, 0x80000314, 0x000000A8, 0x80000300, 0x80000060,
+        0x000003C9, 0x00000300, 0x80000345, 0x000003C9, 0x80000345, 0x000003C9,
+        0x00000301, 0x80000345, 0x000003C9, 0x80000342, 0x000003C9, 0x00000342,
+        0x80000345, 0x0000039F, 0x80000300, 0x000003A9, 0x80000300, 0x000003A9,
+        0x80000345, 0x800000B4, 0x00000020, 0x80000314, 0x80002002, 0x80002003,
+        0x80002010, 0x00000020, 0x80000333, 0x8000002E, 0x0000002E, 0x8000002E,
+        0x0000002E, 0x0000002E, 0x8000002E, 0x00002032, 0x80002032, 0x00002032,
+        0x00002032, 0x80002032, 0x00002035, 0x80002035, 0x00002035, 0x00002035,
+        0x80002035, 0x00000021, 0x80000021, 0x00000020, 0x80000305, 0x0000003F,
+        0x8000003F, 0x0000003F, 0x80000021, 0x00000021, 0x8000003F, 0x00002032,
+        0x00002032, 0x00002032, 0x80002032, 0x80000030, 0x80000034, 0x80000035,
+        0x80000036, 0x80000037, 0x80000038, 0x80000039, 0x8000002B, 0x80002212,
+        0x8000003D, 0x80000028, 0x80000029, 0x8000006E, 0x00000052, 0x80000073,
+        0x00000061, 0x0000002F, 0x80000063, 0x00000061, 0x0000002F, 0x80000073,
+        0x80000043, 0x000000B0, 0x80000043, 0x00000063, 0x0000002F, 0x8000006F,
+        0x00000063, 0x0000002F, 0x80000075, 0x80000190, 0x000000B0, 0x80000046,
+        0x80000127, 0x0000004E, 0x8000006F, 0x80000051, 0x00000053, 0x8000004D,
+        0x00000054, 0x00000045, 0x8000004C, 0x00000054, 0x8000004D, 0x8000005A,
+        0x800003A9, 0x80000046, 0x800005D0, 0x800005D1, 0x800005D2, 0x800005D3,
+        0x00000046, 0x00000041, 0x80000058, 0x80000393, 0x800003A0, 0x80002211,
+        0x00000031, 0x00002044, 0x80000037, 0x00000031, 0x00002044, 0x80000039,
+        0x00000031, 0x00002044, 0x00000031, 0x80000030, 0x00000031, 0x00002044,
+        0x80000033, 0x00000032, 0x00002044, 0x80000033, 0x00000031, 0x00002044,
+        0x80000035, 0x00000032, 0x00002044, 0x80000035, 0x00000033, 0x00002044,
+        0x80000035, 0x00000034, 0x00002044, 0x80000035, 0x00000031, 0x00002044,
+        0x80000036, 0x00000035, 0x00002044, 0x80000036, 0x00000031, 0x00002044,
+        0x80000038, 0x00000033, 0x00002044, 0x80000038, 0x00000035, 0x00002044,
+        0x80000038, 0x00000037, 0x00002044, 0x80000038, 0x00000031, 0x80002044,
+        0x00000049, 0x80000049, 0x00000049, 0x00000049, 0x80000049, 0x00000049,
+        0x80000056, 0x80000056, 0x00000056, 0x80000049, 0x00000056, 0x00000049,
+        0x80000049, 0x00000056, 0x00000049, 0x00000049, 0x80000049, 0x00000049,
+        0x80000058, 0x80000058, 0x00000058, 0x80000049, 0x00000058, 0x00000049,
+        0x80000049, 0x00000069, 0x80000069, 0x00000069, 0x00000069, 0x80000069,
+        0x00000069, 0x80000076, 0x00000076, 0x80000069, 0x00000076, 0x00000069,
+        0x80000069, 0x00000076, 0x00000069, 0x00000069, 0x80000069, 0x00000069,
+        0x80000078, 0x00000078, 0x80000069, 0x00000078, 0x00000069, 0x80000069,
+        0x00000030, 0x00002044, 0x80000033, 0x00002190, 0x80000338, 0x00002192,
+        0x80000338, 0x00002194, 0x80000338, 0x000021D0, 0x80000338, 0x000021D4,
+        0x80000338, 0x000021D2, 0x80000338, 0x00002203, 0x80000338, 0x00002208,
+        0x80000338, 0x0000220B, 0x80000338, 0x00002223, 0x80000338, 0x00002225,
+        0x80000338, 0x0000222B, 0x8000222B, 0x0000222B, 0x0000222B, 0x8000222B,
+        0x0000222E, 0x8000222E, 0x0000222E, 0x0000222E, 0x8000222E, 0x0000223C,
+        0x80000338, 0x00002243, 0x80000338, 0x00002245, 0x80000338, 0x00002248,
+        0x80000338, 0x0000003D, 0x80000338, 0x00002261, 0x80000338, 0x0000224D,
+        0x80000338, 0x0000003C, 0x80000338, 0x0000003E, 0x80000338, 0x00002264,
+        0x80000338, 0x00002265, 0x80000338, 0x00002272, 0x80000338, 0x00002273,
+        0x80000338, 0x00002276, 0x80000338, 0x00002277, 0x80000338, 0x0000227A,
+        0x80000338, 0x0000227B, 0x80000338, 0x00002282, 0x80000338, 0x00002283,
+        0x80000338, 0x00002286, 0x80000338, 0x00002287, 0x80000338, 0x000022A2,
+        0x80000338, 0x000022A8, 0x80000338, 0x000022A9, 0x80000338, 0x000022AB,
+        0x80000338, 0x0000227C, 0x80000338, 0x0000227D, 0x80000338, 0x00002291,
+        0x80000338, 0x00002292, 0x80000338, 0x000022B2, 0x80000338, 0x000022B3,
+        0x80000338, 0x000022B4, 0x80000338, 0x000022B5, 0x80000338, 0x80003008,
+        0x80003009, 0x00000031, 0x80000030, 0x00000031, 0x80000031, 0x00000031,
+        0x80000032, 0x00000031, 0x80000033, 0x00000031, 0x80000034, 0x00000031,
+        0x80000035, 0x00000031, 0x80000036, 0x00000031, 0x80000037, 0x00000031,
+        0x80000038, 0x00000031, 0x80000039, 0x00000032, 0x80000030, 0x00000028,
+        0x00000031, 0x80000029, 0x00000028, 0x00000032, 0x80000029, 0x00000028,
+        0x00000033, 0x80000029, 0x00000028, 0x00000034, 0x80000029, 0x00000028,
+        0x00000035, 0x80000029, 0x00000028, 0x00000036, 0x80000029, 0x00000028,
+        0x00000037, 0x80000029, 0x00000028, 0x00000038, 0x80000029, 0x00000028,
+        0x00000039, 0x80000029, 0x00000028, 0x00000031, 0x00000030, 0x80000029,
+        0x00000028, 0x00000031, 0x00000031, 0x80000029, 0x00000028, 0x00000031,
+        0x00000032, 0x80000029, 0x00000028, 0x00000031, 0x00000033, 0x80000029,
+        0x00000028, 0x00000031, 0x00000034, 0x80000029, 0x00000028, 0x00000031,
+        0x00000035, 0x80000029, 0x00000028, 0x00000031, 0x00000036, 0x80000029,
+        0x00000028, 0x00000031, 0x00000037, 0x80000029, 0x00000028, 0x00000031,
+        0x00000038, 0x80000029, 0x00000028, 0x00000031, 0x00000039, 0x80000029,
+        0x00000028, 0x00000032, 0x00000030, 0x80000029, 0x00000031, 0x8000002E,
+        0x00000032, 0x8000002E, 0x00000033, 0x8000002E, 0x00000034, 0x8000002E,
+        0x00000035, 0x8000002E, 0x00000036, 0x8000002E, 0x00000037, 0x8000002E,
+        0x00000038, 0x8000002E, 0x00000039, 0x8000002E, 0x00000031, 0x00000030,
+        0x8000002E, 0x00000031, 0x00000031, 0x8000002E, 0x00000031, 0x00000032,
+        0x8000002E, 0x00000031, 0x00000033, 0x8000002E, 0x00000031, 0x00000034,
+        0x8000002E, 0x00000031, 0x00000035, 0x8000002E, 0x00000031, 0x00000036,
+        0x8000002E, 0x00000031, 0x00000037, 0x8000002E, 0x00000031, 0x00000038,
+        0x8000002E, 0x00000031, 0x00000039, 0x8000002E, 0x00000032, 0x00000030,
+        0x8000002E, 0x00000028, 0x00000061, 0x80000029, 0x00000028, 0x00000062,
+        0x80000029, 0x00000028, 0x00000063, 0x80000029, 0x00000028, 0x00000064,
+        0x80000029, 0x00000028, 0x00000065, 0x80000029, 0x00000028, 0x00000066,
+        0x80000029, 0x00000028, 0x00000067, 0x80000029, 0x00000028, 0x00000068,
+        0x80000029, 0x00000028, 0x00000069, 0x80000029, 0x00000028, 0x0000006A,
+        0x80000029, 0x00000028, 0x0000006B, 0x80000029, 0x00000028, 0x0000006C,
+        0x80000029, 0x00000028, 0x0000006D, 0x80000029, 0x00000028, 0x0000006E,
+        0x80000029, 0x00000028, 0x0000006F, 0x80000029, 0x00000028, 0x00000070,
+        0x80000029, 0x00000028, 0x00000071, 0x80000029, 0x00000028, 0x00000072,
+        0x80000029, 0x00000028, 0x00000073, 0x80000029, 0x00000028, 0x00000074,
+        0x80000029, 0x00000028, 0x00000075, 0x80000029, 0x00000028, 0x00000076,
+        0x80000029, 0x00000028, 0x00000077, 0x80000029, 0x00000028, 0x00000078,
+        0x80000029, 0x00000028, 0x00000079, 0x80000029, 0x00000028, 0x0000007A,
+        0x80000029, 0x80000053, 0x80000059, 0x80000071, 0x0000222B, 0x0000222B,
+        0x0000222B, 0x8000222B, 0x0000003A, 0x0000003A, 0x8000003D, 0x0000003D,
+        0x8000003D, 0x0000003D, 0x0000003D, 0x8000003D, 0x00002ADD, 0x80000338,
+        0x80002D61, 0x80006BCD, 0x80009F9F, 0x80004E00, 0x80004E28, 0x80004E36,
+        0x80004E3F, 0x80004E59, 0x80004E85, 0x80004E8C, 0x80004EA0, 0x80004EBA,
+        0x8000513F, 0x80005165, 0x8000516B, 0x80005182, 0x80005196, 0x800051AB,
+        0x800051E0, 0x800051F5, 0x80005200, 0x8000529B, 0x800052F9, 0x80005315,
+        0x8000531A, 0x80005338, 0x80005341, 0x8000535C, 0x80005369, 0x80005382,
+        0x800053B6, 0x800053C8, 0x800053E3, 0x800056D7, 0x8000571F, 0x800058EB,
+        0x80005902, 0x8000590A, 0x80005915, 0x80005927, 0x80005973, 0x80005B50,
+        0x80005B80, 0x80005BF8, 0x80005C0F, 0x80005C22, 0x80005C38, 0x80005C6E,
+        0x80005C71, 0x80005DDB, 0x80005DE5, 0x80005DF1, 0x80005DFE, 0x80005E72,
+        0x80005E7A, 0x80005E7F, 0x80005EF4, 0x80005EFE, 0x80005F0B, 0x80005F13,
+        0x80005F50, 0x80005F61, 0x80005F73, 0x80005FC3, 0x80006208, 0x80006236,
+        0x8000624B, 0x8000652F, 0x80006534, 0x80006587, 0x80006597, 0x800065A4,
+        0x800065B9, 0x800065E0, 0x800065E5, 0x800066F0, 0x80006708, 0x80006728,
+        0x80006B20, 0x80006B62, 0x80006B79, 0x80006BB3, 0x80006BCB, 0x80006BD4,
+        0x80006BDB, 0x80006C0F, 0x80006C14, 0x80006C34, 0x8000706B, 0x8000722A,
+        0x80007236, 0x8000723B, 0x8000723F, 0x80007247, 0x80007259, 0x8000725B,
+        0x800072AC, 0x80007384, 0x80007389, 0x800074DC, 0x800074E6, 0x80007518,
+        0x8000751F, 0x80007528, 0x80007530, 0x8000758B, 0x80007592, 0x80007676,
+        0x8000767D, 0x800076AE, 0x800076BF, 0x800076EE, 0x800077DB, 0x800077E2,
+        0x800077F3, 0x8000793A, 0x800079B8, 0x800079BE, 0x80007A74, 0x80007ACB,
+        0x80007AF9, 0x80007C73, 0x80007CF8, 0x80007F36, 0x80007F51, 0x80007F8A,
+        0x80007FBD, 0x80008001, 0x8000800C, 0x80008012, 0x80008033, 0x8000807F,
+        0x80008089, 0x800081E3, 0x800081EA, 0x800081F3, 0x800081FC, 0x8000820C,
+        0x8000821B, 0x8000821F, 0x8000826E, 0x80008272, 0x80008278, 0x8000864D,
+        0x8000866B, 0x80008840, 0x8000884C, 0x80008863, 0x8000897E, 0x8000898B,
+        0x800089D2, 0x80008A00, 0x80008C37, 0x80008C46, 0x80008C55, 0x80008C78,
+        0x80008C9D, 0x80008D64, 0x80008D70, 0x80008DB3, 0x80008EAB, 0x80008ECA,
+        0x80008F9B, 0x80008FB0, 0x80008FB5, 0x80009091, 0x80009149, 0x800091C6,
+        0x800091CC, 0x800091D1, 0x80009577, 0x80009580, 0x8000961C, 0x800096B6,
+        0x800096B9, 0x800096E8, 0x80009751, 0x8000975E, 0x80009762, 0x80009769,
+        0x800097CB, 0x800097ED, 0x800097F3, 0x80009801, 0x800098A8, 0x800098DB,
+        0x800098DF, 0x80009996, 0x80009999, 0x800099AC, 0x80009AA8, 0x80009AD8,
+        0x80009ADF, 0x80009B25, 0x80009B2F, 0x80009B32, 0x80009B3C, 0x80009B5A,
+        0x80009CE5, 0x80009E75, 0x80009E7F, 0x80009EA5, 0x80009EBB, 0x80009EC3,
+        0x80009ECD, 0x80009ED1, 0x80009EF9, 0x80009EFD, 0x80009F0E, 0x80009F13,
+        0x80009F20, 0x80009F3B, 0x80009F4A, 0x80009F52, 0x80009F8D, 0x80009F9C,
+        0x80009FA0, 0x80003012, 0x80005344, 0x80005345, 0x0000304B, 0x80003099,
+        0x0000304D, 0x80003099, 0x0000304F, 0x80003099, 0x00003051, 0x80003099,
+        0x00003053, 0x80003099, 0x00003055, 0x80003099, 0x00003057, 0x80003099,
+        0x00003059, 0x80003099, 0x0000305B, 0x80003099, 0x0000305D, 0x80003099,
+        0x0000305F, 0x80003099, 0x00003061, 0x80003099, 0x00003064, 0x80003099,
+        0x00003066, 0x80003099, 0x00003068, 0x80003099, 0x0000306F, 0x80003099,
+        0x0000306F, 0x8000309A, 0x00003072, 0x80003099, 0x00003072, 0x8000309A,
+        0x00003075, 0x80003099, 0x00003075, 0x8000309A, 0x00003078, 0x80003099,
+        0x00003078, 0x8000309A, 0x0000307B, 0x80003099, 0x0000307B, 0x8000309A,
+        0x00003046, 0x80003099, 0x00000020, 0x80003099, 0x00000020, 0x8000309A,
+        0x0000309D, 0x80003099, 0x00003088, 0x8000308A, 0x000030AB, 0x80003099,
+        0x000030AD, 0x80003099, 0x000030AF, 0x80003099, 0x000030B1, 0x80003099,
+        0x000030B3, 0x80003099, 0x000030B5, 0x80003099, 0x000030B7, 0x80003099,
+        0x000030B9, 0x80003099, 0x000030BB, 0x80003099, 0x000030BD, 0x80003099,
+        0x000030BF, 0x80003099, 0x000030C1, 0x80003099, 0x000030C4, 0x80003099,
+        0x000030C6, 0x80003099, 0x000030C8, 0x80003099, 0x000030CF, 0x80003099,
+        0x000030CF, 0x8000309A, 0x000030D2, 0x80003099, 0x000030D2, 0x8000309A,
+        0x000030D5, 0x80003099, 0x000030D5, 0x8000309A, 0x000030D8, 0x80003099,
+        0x000030D8, 0x8000309A, 0x000030DB, 0x80003099, 0x000030DB, 0x8000309A,
+        0x000030A6, 0x80003099, 0x000030EF, 0x80003099, 0x000030F0, 0x80003099,
+        0x000030F1, 0x80003099, 0x000030F2, 0x80003099, 0x000030FD, 0x80003099,
+        0x000030B3, 0x800030C8, 0x80001100, 0x80001101, 0x800011AA, 0x80001102,
+        0x800011AC, 0x800011AD, 0x80001103, 0x80001104, 0x80001105, 0x800011B0,
+        0x800011B1, 0x800011B2, 0x800011B3, 0x800011B4, 0x800011B5, 0x8000111A,
+        0x80001106, 0x80001107, 0x80001108, 0x80001121, 0x80001109, 0x8000110A,
+        0x8000110B, 0x8000110C, 0x8000110D, 0x8000110E, 0x8000110F, 0x80001110,
+        0x80001111, 0x80001112, 0x80001161, 0x80001162, 0x80001163, 0x80001164,
+        0x80001165, 0x80001166, 0x80001167, 0x80001168, 0x80001169, 0x8000116A,
+        0x8000116B, 0x8000116C, 0x8000116D, 0x8000116E, 0x8000116F, 0x80001170,
+        0x80001171, 0x80001172, 0x80001173, 0x80001174, 0x80001175, 0x80001160,
+        0x80001114, 0x80001115, 0x800011C7, 0x800011C8, 0x800011CC, 0x800011CE,
+        0x800011D3, 0x800011D7, 0x800011D9, 0x8000111C, 0x800011DD, 0x800011DF,
+        0x8000111D, 0x8000111E, 0x80001120, 0x80001122, 0x80001123, 0x80001127,
+        0x80001129, 0x8000112B, 0x8000112C, 0x8000112D, 0x8000112E, 0x8000112F,
+        0x80001132, 0x80001136, 0x80001140, 0x80001147, 0x8000114C, 0x800011F1,
+        0x800011F2, 0x80001157, 0x80001158, 0x80001159, 0x80001184, 0x80001185,
+        0x80001188, 0x80001191, 0x80001192, 0x80001194, 0x8000119E, 0x800011A1,
+        0x80004E09, 0x800056DB, 0x80004E0A, 0x80004E2D, 0x80004E0B, 0x80007532,
+        0x80004E19, 0x80004E01, 0x80005929, 0x80005730, 0x00000028, 0x00001100,
+        0x80000029, 0x00000028, 0x00001102, 0x80000029, 0x00000028, 0x00001103,
+        0x80000029, 0x00000028, 0x00001105, 0x80000029, 0x00000028, 0x00001106,
+        0x80000029, 0x00000028, 0x00001107, 0x80000029, 0x00000028, 0x00001109,
+        0x80000029, 0x00000028, 0x0000110B, 0x80000029, 0x00000028, 0x0000110C,
+        0x80000029, 0x00000028, 0x0000110E, 0x80000029, 0x00000028, 0x0000110F,
+        0x80000029, 0x00000028, 0x00001110, 0x80000029, 0x00000028, 0x00001111,
+        0x80000029, 0x00000028, 0x00001112, 0x80000029, 0x00000028, 0x00001100,
+        0x00001161, 0x80000029, 0x00000028, 0x00001102, 0x00001161, 0x80000029,
+        0x00000028, 0x00001103, 0x00001161, 0x80000029, 0x00000028, 0x00001105,
+        0x00001161, 0x80000029, 0x00000028, 0x00001106, 0x00001161, 0x80000029,
+        0x00000028, 0x00001107, 0x00001161, 0x80000029, 0x00000028, 0x00001109,
+        0x00001161, 0x80000029, 0x00000028, 0x0000110B, 0x00001161, 0x80000029,
+        0x00000028, 0x0000110C, 0x00001161, 0x80000029, 0x00000028, 0x0000110E,
+        0x00001161, 0x80000029, 0x00000028, 0x0000110F, 0x00001161, 0x80000029,
+        0x00000028, 0x00001110, 0x00001161, 0x80000029, 0x00000028, 0x00001111,
+        0x00001161, 0x80000029, 0x00000028, 0x00001112, 0x00001161, 0x80000029,
+        0x00000028, 0x0000110C, 0x0000116E, 0x80000029, 0x00000028, 0x0000110B,
+        0x00001169, 0x0000110C, 0x00001165, 0x000011AB, 0x80000029, 0x00000028,
+        0x0000110B, 0x00001169, 0x00001112, 0x0000116E, 0x80000029, 0x00000028,
+        0x00004E00, 0x80000029, 0x00000028, 0x00004E8C, 0x80000029, 0x00000028,
+        0x00004E09, 0x80000029, 0x00000028, 0x000056DB, 0x80000029, 0x00000028,
+        0x00004E94, 0x80000029, 0x00000028, 0x0000516D, 0x80000029, 0x00000028,
+        0x00004E03, 0x80000029, 0x00000028, 0x0000516B, 0x80000029, 0x00000028,
+        0x00004E5D, 0x80000029, 0x00000028, 0x00005341, 0x80000029, 0x00000028,
+        0x00006708, 0x80000029, 0x00000028, 0x0000706B, 0x80000029, 0x00000028,
+        0x00006C34, 0x80000029, 0x00000028, 0x00006728, 0x80000029, 0x00000028,
+        0x000091D1, 0x80000029, 0x00000028, 0x0000571F, 0x80000029, 0x00000028,
+        0x000065E5, 0x80000029, 0x00000028, 0x0000682A, 0x80000029, 0x00000028,
+        0x00006709, 0x80000029, 0x00000028, 0x0000793E, 0x80000029, 0x00000028,
+        0x0000540D, 0x80000029, 0x00000028, 0x00007279, 0x80000029, 0x00000028,
+        0x00008CA1, 0x80000029, 0x00000028, 0x0000795D, 0x80000029, 0x00000028,
+        0x000052B4, 0x80000029, 0x00000028, 0x00004EE3, 0x80000029, 0x00000028,
+        0x0000547C, 0x80000029, 0x00000028, 0x00005B66, 0x80000029, 0x00000028,
+        0x000076E3, 0x80000029, 0x00000028, 0x00004F01, 0x80000029, 0x00000028,
+        0x00008CC7, 0x80000029, 0x00000028, 0x00005354, 0x80000029, 0x00000028,
+        0x0000796D, 0x80000029, 0x00000028, 0x00004F11, 0x80000029, 0x00000028,
+        0x000081EA, 0x80000029, 0x00000028, 0x000081F3, 0x80000029, 0x8000554F,
+        0x80005E7C, 0x80007B8F, 0x00000050, 0x00000054, 0x80000045, 0x00000032,
+        0x80000031, 0x00000032, 0x80000032, 0x00000032, 0x80000033, 0x00000032,
+        0x80000034, 0x00000032, 0x80000035, 0x00000032, 0x80000036, 0x00000032,
+        0x80000037, 0x00000032, 0x80000038, 0x00000032, 0x80000039, 0x00000033,
+        0x80000030, 0x00000033, 0x80000031, 0x00000033, 0x80000032, 0x00000033,
+        0x80000033, 0x00000033, 0x80000034, 0x00000033, 0x80000035, 0x00001100,
+        0x80001161, 0x00001102, 0x80001161, 0x00001103, 0x80001161, 0x00001105,
+        0x80001161, 0x00001106, 0x80001161, 0x00001107, 0x80001161, 0x00001109,
+        0x80001161, 0x0000110B, 0x80001161, 0x0000110C, 0x80001161, 0x0000110E,
+        0x80001161, 0x0000110F, 0x80001161, 0x00001110, 0x80001161, 0x00001111,
+        0x80001161, 0x00001112, 0x80001161, 0x0000110E, 0x00001161, 0x000011B7,
+        0x00001100, 0x80001169, 0x0000110C, 0x0000116E, 0x0000110B, 0x80001174,
+        0x0000110B, 0x8000116E, 0x80004E94, 0x8000516D, 0x80004E03, 0x80004E5D,
+        0x8000682A, 0x80006709, 0x8000793E, 0x8000540D, 0x80007279, 0x80008CA1,
+        0x8000795D, 0x800052B4, 0x800079D8, 0x80007537, 0x80009069, 0x8000512A,
+        0x80005370, 0x80006CE8, 0x80009805, 0x80004F11, 0x80005199, 0x80006B63,
+        0x80005DE6, 0x800053F3, 0x8000533B, 0x80005B97, 0x80005B66, 0x800076E3,
+        0x80004F01, 0x80008CC7, 0x80005354, 0x8000591C, 0x00000033, 0x80000036,
+        0x00000033, 0x80000037, 0x00000033, 0x80000038, 0x00000033, 0x80000039,
+        0x00000034, 0x80000030, 0x00000034, 0x80000031, 0x00000034, 0x80000032,
+        0x00000034, 0x80000033, 0x00000034, 0x80000034, 0x00000034, 0x80000035,
+        0x00000034, 0x80000036, 0x00000034, 0x80000037, 0x00000034, 0x80000038,
+        0x00000034, 0x80000039, 0x00000035, 0x80000030, 0x00000031, 0x80006708,
+        0x00000032, 0x80006708, 0x00000033, 0x80006708, 0x00000034, 0x80006708,
+        0x00000035, 0x80006708, 0x00000036, 0x80006708, 0x00000037, 0x80006708,
+        0x00000038, 0x80006708, 0x00000039, 0x80006708, 0x00000031, 0x00000030,
+        0x80006708, 0x00000031, 0x00000031, 0x80006708, 0x00000031, 0x00000032,
+        0x80006708, 0x00000048, 0x80000067, 0x00000065, 0x00000072, 0x80000067,
+        0x00000065, 0x80000056, 0x0000004C, 0x00000054, 0x80000044, 0x800030A2,
+        0x800030A4, 0x800030A6, 0x800030A8, 0x800030AA, 0x800030AB, 0x800030AD,
+        0x800030AF, 0x800030B1, 0x800030B3, 0x800030B5, 0x800030B7, 0x800030B9,
+        0x800030BB, 0x800030BD, 0x800030BF, 0x800030C1, 0x800030C4, 0x800030C6,
+        0x800030C8, 0x800030CA, 0x800030CB, 0x800030CC, 0x800030CD, 0x800030CE,
+        0x800030CF, 0x800030D2, 0x800030D5, 0x800030D8, 0x800030DB, 0x800030DE,
+        0x800030DF, 0x800030E0, 0x800030E1, 0x800030E2, 0x800030E4, 0x800030E6,
+        0x800030E8, 0x800030E9, 0x800030EA, 0x800030EB, 0x800030EC, 0x800030ED,
+        0x800030EF, 0x800030F0, 0x800030F1, 0x800030F2, 0x00004EE4, 0x8000548C,
+        0x000030A2, 0x000030CF, 0x0000309A, 0x000030FC, 0x800030C8, 0x000030A2,
+        0x000030EB, 0x000030D5, 0x800030A1, 0x000030A2, 0x000030F3, 0x000030D8,
+        0x0000309A, 0x800030A2, 0x000030A2, 0x000030FC, 0x800030EB, 0x000030A4,
+        0x000030CB, 0x000030F3, 0x000030AF, 0x80003099, 0x000030A4, 0x000030F3,
+        0x800030C1, 0x000030A6, 0x000030A9, 0x800030F3, 0x000030A8, 0x000030B9,
+        0x000030AF, 0x000030FC, 0x000030C8, 0x80003099, 0x000030A8, 0x000030FC,
+        0x000030AB, 0x800030FC, 0x000030AA, 0x000030F3, 0x800030B9, 0x000030AA,
+        0x000030FC, 0x800030E0, 0x000030AB, 0x000030A4, 0x800030EA, 0x000030AB,
+        0x000030E9, 0x000030C3, 0x800030C8, 0x000030AB, 0x000030ED, 0x000030EA,
+        0x800030FC, 0x000030AB, 0x00003099, 0x000030ED, 0x800030F3, 0x000030AB,
+        0x00003099, 0x000030F3, 0x800030DE, 0x000030AD, 0x00003099, 0x000030AB,
+        0x80003099, 0x000030AD, 0x00003099, 0x000030CB, 0x800030FC, 0x000030AD,
+        0x000030E5, 0x000030EA, 0x800030FC, 0x000030AD, 0x00003099, 0x000030EB,
+        0x000030BF, 0x00003099, 0x800030FC, 0x000030AD, 0x800030ED, 0x000030AD,
+        0x000030ED, 0x000030AF, 0x00003099, 0x000030E9, 0x800030E0, 0x000030AD,
+        0x000030ED, 0x000030E1, 0x000030FC, 0x000030C8, 0x800030EB, 0x000030AD,
+        0x000030ED, 0x000030EF, 0x000030C3, 0x800030C8, 0x000030AF, 0x00003099,
+        0x000030E9, 0x800030E0, 0x000030AF, 0x00003099, 0x000030E9, 0x000030E0,
+        0x000030C8, 0x800030F3, 0x000030AF, 0x000030EB, 0x000030BB, 0x00003099,
+        0x000030A4, 0x800030ED, 0x000030AF, 0x000030ED, 0x000030FC, 0x800030CD,
+        0x000030B1, 0x000030FC, 0x800030B9, 0x000030B3, 0x000030EB, 0x800030CA,
+        0x000030B3, 0x000030FC, 0x000030DB, 0x8000309A, 0x000030B5, 0x000030A4,
+        0x000030AF, 0x800030EB, 0x000030B5, 0x000030F3, 0x000030C1, 0x000030FC,
+        0x800030E0, 0x000030B7, 0x000030EA, 0x000030F3, 0x000030AF, 0x80003099,
+        0x000030BB, 0x000030F3, 0x800030C1, 0x000030BB, 0x000030F3, 0x800030C8,
+        0x000030BF, 0x00003099, 0x000030FC, 0x800030B9, 0x000030C6, 0x00003099,
+        0x800030B7, 0x000030C8, 0x00003099, 0x800030EB, 0x000030C8, 0x800030F3,
+        0x000030CA, 0x800030CE, 0x000030CE, 0x000030C3, 0x800030C8, 0x000030CF,
+        0x000030A4, 0x800030C4, 0x000030CF, 0x0000309A, 0x000030FC, 0x000030BB,
+        0x000030F3, 0x800030C8, 0x000030CF, 0x0000309A, 0x000030FC, 0x800030C4,
+        0x000030CF, 0x00003099, 0x000030FC, 0x000030EC, 0x800030EB, 0x000030D2,
+        0x0000309A, 0x000030A2, 0x000030B9, 0x000030C8, 0x800030EB, 0x000030D2,
+        0x0000309A, 0x000030AF, 0x800030EB, 0x000030D2, 0x0000309A, 0x800030B3,
+        0x000030D2, 0x00003099, 0x800030EB, 0x000030D5, 0x000030A1, 0x000030E9,
+        0x000030C3, 0x000030C8, 0x80003099, 0x000030D5, 0x000030A3, 0x000030FC,
+        0x800030C8, 0x000030D5, 0x00003099, 0x000030C3, 0x000030B7, 0x000030A7,
+        0x800030EB, 0x000030D5, 0x000030E9, 0x800030F3, 0x000030D8, 0x000030AF,
+        0x000030BF, 0x000030FC, 0x800030EB, 0x000030D8, 0x0000309A, 0x800030BD,
+        0x000030D8, 0x0000309A, 0x000030CB, 0x800030D2, 0x000030D8, 0x000030EB,
+        0x800030C4, 0x000030D8, 0x0000309A, 0x000030F3, 0x800030B9, 0x000030D8,
+        0x0000309A, 0x000030FC, 0x000030B7, 0x80003099, 0x000030D8, 0x00003099,
+        0x000030FC, 0x800030BF, 0x000030DB, 0x0000309A, 0x000030A4, 0x000030F3,
+        0x800030C8, 0x000030DB, 0x00003099, 0x000030EB, 0x800030C8, 0x000030DB,
+        0x800030F3, 0x000030DB, 0x0000309A, 0x000030F3, 0x000030C8, 0x80003099,
+        0x000030DB, 0x000030FC, 0x800030EB, 0x000030DB, 0x000030FC, 0x800030F3,
+        0x000030DE, 0x000030A4, 0x000030AF, 0x800030ED, 0x000030DE, 0x000030A4,
+        0x800030EB, 0x000030DE, 0x000030C3, 0x800030CF, 0x000030DE, 0x000030EB,
+        0x800030AF, 0x000030DE, 0x000030F3, 0x000030B7, 0x000030E7, 0x800030F3,
+        0x000030DF, 0x000030AF, 0x000030ED, 0x800030F3, 0x000030DF, 0x800030EA,
+        0x000030DF, 0x000030EA, 0x000030CF, 0x00003099, 0x000030FC, 0x800030EB,
+        0x000030E1, 0x000030AB, 0x80003099, 0x000030E1, 0x000030AB, 0x00003099,
+        0x000030C8, 0x800030F3, 0x000030E1, 0x000030FC, 0x000030C8, 0x800030EB,
+        0x000030E4, 0x000030FC, 0x000030C8, 0x80003099, 0x000030E4, 0x000030FC,
+        0x800030EB, 0x000030E6, 0x000030A2, 0x800030F3, 0x000030EA, 0x000030C3,
+        0x000030C8, 0x800030EB, 0x000030EA, 0x800030E9, 0x000030EB, 0x000030D2,
+        0x0000309A, 0x800030FC, 0x000030EB, 0x000030FC, 0x000030D5, 0x00003099,
+        0x800030EB, 0x000030EC, 0x800030E0, 0x000030EC, 0x000030F3, 0x000030C8,
+        0x000030B1, 0x00003099, 0x800030F3, 0x000030EF, 0x000030C3, 0x800030C8,
+        0x00000030, 0x800070B9, 0x00000031, 0x800070B9, 0x00000032, 0x800070B9,
+        0x00000033, 0x800070B9, 0x00000034, 0x800070B9, 0x00000035, 0x800070B9,
+        0x00000036, 0x800070B9, 0x00000037, 0x800070B9, 0x00000038, 0x800070B9,
+        0x00000039, 0x800070B9, 0x00000031, 0x00000030, 0x800070B9, 0x00000031,
+        0x00000031, 0x800070B9, 0x00000031, 0x00000032, 0x800070B9, 0x00000031,
+        0x00000033, 0x800070B9, 0x00000031, 0x00000034, 0x800070B9, 0x00000031,
+        0x00000035, 0x800070B9, 0x00000031, 0x00000036, 0x800070B9, 0x00000031,
+        0x00000037, 0x800070B9, 0x00000031, 0x00000038, 0x800070B9, 0x00000031,
+        0x00000039, 0x800070B9, 0x00000032, 0x00000030, 0x800070B9, 0x00000032,
+        0x00000031, 0x800070B9, 0x00000032, 0x00000032, 0x800070B9, 0x00000032,
+        0x00000033, 0x800070B9, 0x00000032, 0x00000034, 0x800070B9, 0x00000068,
+        0x00000050, 0x80000061, 0x00000064, 0x80000061, 0x00000041, 0x80000055,
+        0x00000062, 0x00000061, 0x80000072, 0x0000006F, 0x80000056, 0x00000070,
+        0x80000063, 0x00000064, 0x8000006D, 0x00000064, 0x0000006D, 0x80000032,
+        0x00000064, 0x0000006D, 0x80000033, 0x00000049, 0x80000055, 0x00005E73,
+        0x80006210, 0x0000662D, 0x8000548C, 0x00005927, 0x80006B63, 0x0000660E,
+        0x80006CBB, 0x0000682A, 0x00005F0F, 0x00004F1A, 0x8000793E, 0x00000070,
+        0x80000041, 0x0000006E, 0x80000041, 0x000003BC, 0x80000041, 0x0000006D,
+        0x80000041, 0x0000006B, 0x80000041, 0x0000004B, 0x80000042, 0x0000004D,
+        0x80000042, 0x00000047, 0x80000042, 0x00000063, 0x00000061, 0x8000006C,
+        0x0000006B, 0x00000063, 0x00000061, 0x8000006C, 0x00000070, 0x80000046,
+        0x0000006E, 0x80000046, 0x000003BC, 0x80000046, 0x000003BC, 0x80000067,
+        0x0000006D, 0x80000067, 0x0000006B, 0x80000067, 0x00000048, 0x8000007A,
+        0x0000006B, 0x00000048, 0x8000007A, 0x0000004D, 0x00000048, 0x8000007A,
+        0x00000047, 0x00000048, 0x8000007A, 0x00000054, 0x00000048, 0x8000007A,
+        0x000003BC, 0x8000006C, 0x0000006D, 0x8000006C, 0x00000064, 0x8000006C,
+        0x0000006B, 0x8000006C, 0x00000066, 0x8000006D, 0x0000006E, 0x8000006D,
+        0x000003BC, 0x8000006D, 0x0000006D, 0x8000006D, 0x00000063, 0x8000006D,
+        0x0000006B, 0x8000006D, 0x0000006D, 0x0000006D, 0x80000032, 0x00000063,
+        0x0000006D, 0x80000032, 0x0000006D, 0x80000032, 0x0000006B, 0x0000006D,
+        0x80000032, 0x0000006D, 0x0000006D, 0x80000033, 0x00000063, 0x0000006D,
+        0x80000033, 0x0000006D, 0x80000033, 0x0000006B, 0x0000006D, 0x80000033,
+        0x0000006D, 0x00002215, 0x80000073, 0x0000006D, 0x00002215, 0x00000073,
+        0x80000032, 0x00000050, 0x80000061, 0x0000006B, 0x00000050, 0x80000061,
+        0x0000004D, 0x00000050, 0x80000061, 0x00000047, 0x00000050, 0x80000061,
+        0x00000072, 0x00000061, 0x80000064, 0x00000072, 0x00000061, 0x00000064,
+        0x00002215, 0x80000073, 0x00000072, 0x00000061, 0x00000064, 0x00002215,
+        0x00000073, 0x80000032, 0x00000070, 0x80000073, 0x0000006E, 0x80000073,
+        0x000003BC, 0x80000073, 0x0000006D, 0x80000073, 0x00000070, 0x80000056,
+        0x0000006E, 0x80000056, 0x000003BC, 0x80000056, 0x0000006D, 0x80000056,
+        0x0000006B, 0x80000056, 0x0000004D, 0x80000056, 0x00000070, 0x80000057,
+        0x0000006E, 0x80000057, 0x000003BC, 0x80000057, 0x0000006D, 0x80000057,
+        0x0000006B, 0x80000057, 0x0000004D, 0x80000057, 0x0000006B, 0x800003A9,
+        0x0000004D, 0x800003A9, 0x00000061, 0x0000002E, 0x0000006D, 0x8000002E,
+        0x00000042, 0x80000071, 0x00000063, 0x80000063, 0x00000063, 0x80000064,
+        0x00000043, 0x00002215, 0x0000006B, 0x80000067, 0x00000043, 0x0000006F,
+        0x8000002E, 0x00000064, 0x80000042, 0x00000047, 0x80000079, 0x00000068,
+        0x80000061, 0x00000048, 0x80000050, 0x00000069, 0x8000006E, 0x0000004B,
+        0x8000004B, 0x0000004B, 0x8000004D, 0x0000006B, 0x80000074, 0x0000006C,
+        0x8000006D, 0x0000006C, 0x8000006E, 0x0000006C, 0x0000006F, 0x80000067,
+        0x0000006C, 0x80000078, 0x0000006D, 0x80000062, 0x0000006D, 0x00000069,
+        0x8000006C, 0x0000006D, 0x0000006F, 0x8000006C, 0x00000050, 0x80000048,
+        0x00000070, 0x0000002E, 0x0000006D, 0x8000002E, 0x00000050, 0x00000050,
+        0x8000004D, 0x00000050, 0x80000052, 0x00000073, 0x80000072, 0x00000053,
+        0x80000076, 0x00000057, 0x80000062, 0x00000056, 0x00002215, 0x8000006D,
+        0x00000041, 0x00002215, 0x8000006D, 0x00000031, 0x800065E5, 0x00000032,
+        0x800065E5, 0x00000033, 0x800065E5, 0x00000034, 0x800065E5, 0x00000035,
+        0x800065E5, 0x00000036, 0x800065E5, 0x00000037, 0x800065E5, 0x00000038,
+        0x800065E5, 0x00000039, 0x800065E5, 0x00000031, 0x00000030, 0x800065E5,
+        0x00000031, 0x00000031, 0x800065E5, 0x00000031, 0x00000032, 0x800065E5,
+        0x00000031, 0x00000033, 0x800065E5, 0x00000031, 0x00000034, 0x800065E5,
+        0x00000031, 0x00000035, 0x800065E5, 0x00000031, 0x00000036, 0x800065E5,
+        0x00000031, 0x00000037, 0x800065E5, 0x00000031, 0x00000038, 0x800065E5,
+        0x00000031, 0x00000039, 0x800065E5, 0x00000032, 0x00000030, 0x800065E5,
+        0x00000032, 0x00000031, 0x800065E5, 0x00000032, 0x00000032, 0x800065E5,
+        0x00000032, 0x00000033, 0x800065E5, 0x00000032, 0x00000034, 0x800065E5,
+        0x00000032, 0x00000035, 0x800065E5, 0x00000032, 0x00000036, 0x800065E5,
+        0x00000032, 0x00000037, 0x800065E5, 0x00000032, 0x00000038, 0x800065E5,
+        0x00000032, 0x00000039, 0x800065E5, 0x00000033, 0x00000030, 0x800065E5,
+        0x00000033, 0x00000031, 0x800065E5, 0x00000067, 0x00000061, 0x8000006C,
+        0x8000044A, 0x8000044C, 0x8000A76F, 0x80000126, 0x80000153, 0x8000A727,
+        0x8000AB37, 0x8000026B, 0x8000AB52, 0x8000028D, 0x80008C48, 0x800066F4,
+        0x80008CC8, 0x80006ED1, 0x80004E32, 0x800053E5, 0x80005951, 0x80005587,
+        0x80005948, 0x800061F6, 0x80007669, 0x80007F85, 0x8000863F, 0x800087BA,
+        0x800088F8, 0x8000908F, 0x80006A02, 0x80006D1B, 0x800070D9, 0x800073DE,
+        0x8000843D, 0x8000916A, 0x800099F1, 0x80004E82, 0x80005375, 0x80006B04,
+        0x8000721B, 0x8000862D, 0x80009E1E, 0x80005D50, 0x80006FEB, 0x800085CD,
+        0x80008964, 0x800062C9, 0x800081D8, 0x8000881F, 0x80005ECA, 0x80006717,
+        0x80006D6A, 0x800072FC, 0x800090CE, 0x80004F86, 0x800051B7, 0x800052DE,
+        0x800064C4, 0x80006AD3, 0x80007210, 0x800076E7, 0x80008606, 0x8000865C,
+        0x80008DEF, 0x80009732, 0x80009B6F, 0x80009DFA, 0x8000788C, 0x8000797F,
+        0x80007DA0, 0x800083C9, 0x80009304, 0x80008AD6, 0x800058DF, 0x80005F04,
+        0x80007C60, 0x8000807E, 0x80007262, 0x800078CA, 0x80008CC2, 0x800096F7,
+        0x800058D8, 0x80005C62, 0x80006A13, 0x80006DDA, 0x80006F0F, 0x80007D2F,
+        0x80007E37, 0x8000964B, 0x800052D2, 0x8000808B, 0x800051DC, 0x800051CC,
+        0x80007A1C, 0x80007DBE, 0x800083F1, 0x80009675, 0x80008B80, 0x800062CF,
+        0x80008AFE, 0x80004E39, 0x80005BE7, 0x80006012, 0x80007387, 0x80007570,
+        0x80005317, 0x800078FB, 0x80004FBF, 0x80005FA9, 0x80004E0D, 0x80006CCC,
+        0x80006578, 0x80007D22, 0x800053C3, 0x8000585E, 0x80007701, 0x80008449,
+        0x80008AAA, 0x80006BBA, 0x80006C88, 0x800062FE, 0x800082E5, 0x800063A0,
+        0x80007565, 0x80004EAE, 0x80005169, 0x800051C9, 0x80006881, 0x80007CE7,
+        0x8000826F, 0x80008AD2, 0x800091CF, 0x800052F5, 0x80005442, 0x80005EEC,
+        0x800065C5, 0x80006FFE, 0x8000792A, 0x800095AD, 0x80009A6A, 0x80009E97,
+        0x80009ECE, 0x800066C6, 0x80006B77, 0x80008F62, 0x80005E74, 0x80006190,
+        0x80006200, 0x8000649A, 0x80006F23, 0x80007149, 0x80007489, 0x800079CA,
+        0x80007DF4, 0x8000806F, 0x80008F26, 0x800084EE, 0x80009023, 0x8000934A,
+        0x80005217, 0x800052A3, 0x800054BD, 0x800070C8, 0x800088C2, 0x80005EC9,
+        0x80005FF5, 0x8000637B, 0x80006BAE, 0x80007C3E, 0x80007375, 0x80004EE4,
+        0x800056F9, 0x80005DBA, 0x8000601C, 0x800073B2, 0x80007469, 0x80007F9A,
+        0x80008046, 0x80009234, 0x800096F6, 0x80009748, 0x80009818, 0x80004F8B,
+        0x800079AE, 0x800091B4, 0x800096B8, 0x800060E1, 0x80004E86, 0x800050DA,
+        0x80005BEE, 0x80005C3F, 0x80006599, 0x800071CE, 0x80007642, 0x800084FC,
+        0x8000907C, 0x80006688, 0x8000962E, 0x80005289, 0x8000677B, 0x800067F3,
+        0x80006D41, 0x80006E9C, 0x80007409, 0x80007559, 0x8000786B, 0x80007D10,
+        0x8000985E, 0x8000622E, 0x80009678, 0x8000502B, 0x80005D19, 0x80006DEA,
+        0x80008F2A, 0x80005F8B, 0x80006144, 0x80006817, 0x80009686, 0x80005229,
+        0x8000540F, 0x80005C65, 0x80006613, 0x8000674E, 0x800068A8, 0x80006CE5,
+        0x80007406, 0x800075E2, 0x80007F79, 0x800088CF, 0x800088E1, 0x800096E2,
+        0x8000533F, 0x80006EBA, 0x8000541D, 0x800071D0, 0x80007498, 0x800085FA,
+        0x800096A3, 0x80009C57, 0x80009E9F, 0x80006797, 0x80006DCB, 0x800081E8,
+        0x80007B20, 0x80007C92, 0x800072C0, 0x80007099, 0x80008B58, 0x80004EC0,
+        0x80008336, 0x8000523A, 0x80005207, 0x80005EA6, 0x800062D3, 0x80007CD6,
+        0x80005B85, 0x80006D1E, 0x800066B4, 0x80008F3B, 0x8000964D, 0x80005ED3,
+        0x80005140, 0x800055C0, 0x8000585A, 0x80006674, 0x800051DE, 0x8000732A,
+        0x800076CA, 0x8000793C, 0x8000795E, 0x80007965, 0x8000798F, 0x80009756,
+        0x80007CBE, 0x80008612, 0x80008AF8, 0x80009038, 0x800090FD, 0x800098EF,
+        0x800098FC, 0x80009928, 0x80009DB4, 0x800090DE, 0x800096B7, 0x80004FAE,
+        0x800050E7, 0x8000514D, 0x800052C9, 0x800052E4, 0x80005351, 0x8000559D,
+        0x80005606, 0x80005668, 0x80005840, 0x800058A8, 0x80005C64, 0x80006094,
+        0x80006168, 0x8000618E, 0x800061F2, 0x8000654F, 0x800065E2, 0x80006691,
+        0x80006885, 0x80006D77, 0x80006E1A, 0x80006F22, 0x8000716E, 0x8000722B,
+        0x80007422, 0x80007891, 0x80007949, 0x80007948, 0x80007950, 0x80007956,
+        0x8000798D, 0x8000798E, 0x80007A40, 0x80007A81, 0x80007BC0, 0x80007E09,
+        0x80007E41, 0x80007F72, 0x80008005, 0x800081ED, 0x80008279, 0x80008457,
+        0x80008910, 0x80008996, 0x80008B01, 0x80008B39, 0x80008CD3, 0x80008D08,
+        0x80008FB6, 0x800096E3, 0x800097FF, 0x8000983B, 0x80006075, 0x800242EE,
+        0x80008218, 0x80004E26, 0x800051B5, 0x80005168, 0x80004F80, 0x80005145,
+        0x80005180, 0x800052C7, 0x800052FA, 0x80005555, 0x80005599, 0x800055E2,
+        0x800058B3, 0x80005944, 0x80005954, 0x80005A62, 0x80005B28, 0x80005ED2,
+        0x80005ED9, 0x80005F69, 0x80005FAD, 0x800060D8, 0x8000614E, 0x80006108,
+        0x80006160, 0x80006234, 0x800063C4, 0x8000641C, 0x80006452, 0x80006556,
+        0x8000671B, 0x80006756, 0x80006EDB, 0x80006ECB, 0x8000701E, 0x800077A7,
+        0x80007235, 0x800072AF, 0x80007471, 0x80007506, 0x8000753B, 0x8000761D,
+        0x8000761F, 0x800076DB, 0x800076F4, 0x8000774A, 0x80007740, 0x800078CC,
+        0x80007AB1, 0x80007C7B, 0x80007D5B, 0x80007F3E, 0x80008352, 0x800083EF,
+        0x80008779, 0x80008941, 0x80008986, 0x80008ABF, 0x80008ACB, 0x80008AED,
+        0x80008B8A, 0x80008F38, 0x80009072, 0x80009199, 0x80009276, 0x8000967C,
+        0x800097DB, 0x8000980B, 0x80009B12, 0x8002284A, 0x80022844, 0x800233D5,
+        0x80003B9D, 0x80004018, 0x80004039, 0x80025249, 0x80025CD0, 0x80027ED3,
+        0x80009F43, 0x80009F8E, 0x00000066, 0x80000066, 0x00000066, 0x80000069,
+        0x00000066, 0x8000006C, 0x00000066, 0x00000066, 0x80000069, 0x00000066,
+        0x00000066, 0x8000006C, 0x00000073, 0x80000074, 0x00000574, 0x80000576,
+        0x00000574, 0x80000565, 0x00000574, 0x8000056B, 0x0000057E, 0x80000576,
+        0x00000574, 0x8000056D, 0x000005D9, 0x800005B4, 0x000005F2, 0x800005B7,
+        0x800005E2, 0x800005D4, 0x800005DB, 0x800005DC, 0x800005DD, 0x800005E8,
+        0x800005EA, 0x000005E9, 0x800005C1, 0x000005E9, 0x800005C2, 0x000005E9,
+        0x000005BC, 0x800005C1, 0x000005E9, 0x000005BC, 0x800005C2, 0x000005D0,
+        0x800005B7, 0x000005D0, 0x800005B8, 0x000005D0, 0x800005BC, 0x000005D1,
+        0x800005BC, 0x000005D2, 0x800005BC, 0x000005D3, 0x800005BC, 0x000005D4,
+        0x800005BC, 0x000005D5, 0x800005BC, 0x000005D6, 0x800005BC, 0x000005D8,
+        0x800005BC, 0x000005D9, 0x800005BC, 0x000005DA, 0x800005BC, 0x000005DB,
+        0x800005BC, 0x000005DC, 0x800005BC, 0x000005DE, 0x800005BC, 0x000005E0,
+        0x800005BC, 0x000005E1, 0x800005BC, 0x000005E3, 0x800005BC, 0x000005E4,
+        0x800005BC, 0x000005E6, 0x800005BC, 0x000005E7, 0x800005BC, 0x000005E8,
+        0x800005BC, 0x000005E9, 0x800005BC, 0x000005EA, 0x800005BC, 0x000005D5,
+        0x800005B9, 0x000005D1, 0x800005BF, 0x000005DB, 0x800005BF, 0x000005E4,
+        0x800005BF, 0x000005D0, 0x800005DC, 0x80000671, 0x8000067B, 0x8000067E,
+        0x80000680, 0x8000067A, 0x8000067F, 0x80000679, 0x800006A4, 0x800006A6,
+        0x80000684, 0x80000683, 0x80000686, 0x80000687, 0x8000068D, 0x8000068C,
+        0x8000068E, 0x80000688, 0x80000698, 0x80000691, 0x800006A9, 0x800006AF,
+        0x800006B3, 0x800006B1, 0x800006BA, 0x800006BB, 0x800006C1, 0x800006BE,
+        0x800006D2, 0x800006AD, 0x800006C7, 0x800006C6, 0x800006C8, 0x800006CB,
+        0x800006C5, 0x800006C9, 0x800006D0, 0x80000649, 0x0000064A, 0x00000654,
+        0x80000627, 0x0000064A, 0x00000654, 0x800006D5, 0x0000064A, 0x00000654,
+        0x80000648, 0x0000064A, 0x00000654, 0x800006C7, 0x0000064A, 0x00000654,
+        0x800006C6, 0x0000064A, 0x00000654, 0x800006C8, 0x0000064A, 0x00000654,
+        0x800006D0, 0x0000064A, 0x00000654, 0x80000649, 0x800006CC, 0x0000064A,
+        0x00000654, 0x8000062C, 0x0000064A, 0x00000654, 0x8000062D, 0x0000064A,
+        0x00000654, 0x80000645, 0x0000064A, 0x00000654, 0x8000064A, 0x00000628,
+        0x8000062C, 0x00000628, 0x8000062D, 0x00000628, 0x8000062E, 0x00000628,
+        0x80000645, 0x00000628, 0x80000649, 0x00000628, 0x8000064A, 0x0000062A,
+        0x8000062C, 0x0000062A, 0x8000062D, 0x0000062A, 0x8000062E, 0x0000062A,
+        0x80000645, 0x0000062A, 0x80000649, 0x0000062A, 0x8000064A, 0x0000062B,
+        0x8000062C, 0x0000062B, 0x80000645, 0x0000062B, 0x80000649, 0x0000062B,
+        0x8000064A, 0x0000062C, 0x8000062D, 0x0000062C, 0x80000645, 0x0000062D,
+        0x8000062C, 0x0000062D, 0x80000645, 0x0000062E, 0x8000062C, 0x0000062E,
+        0x8000062D, 0x0000062E, 0x80000645, 0x00000633, 0x8000062C, 0x00000633,
+        0x8000062D, 0x00000633, 0x8000062E, 0x00000633, 0x80000645, 0x00000635,
+        0x8000062D, 0x00000635, 0x80000645, 0x00000636, 0x8000062C, 0x00000636,
+        0x8000062D, 0x00000636, 0x8000062E, 0x00000636, 0x80000645, 0x00000637,
+        0x8000062D, 0x00000637, 0x80000645, 0x00000638, 0x80000645, 0x00000639,
+        0x8000062C, 0x00000639, 0x80000645, 0x0000063A, 0x8000062C, 0x0000063A,
+        0x80000645, 0x00000641, 0x8000062C, 0x00000641, 0x8000062D, 0x00000641,
+        0x8000062E, 0x00000641, 0x80000645, 0x00000641, 0x80000649, 0x00000641,
+        0x8000064A, 0x00000642, 0x8000062D, 0x00000642, 0x80000645, 0x00000642,
+        0x80000649, 0x00000642, 0x8000064A, 0x00000643, 0x80000627, 0x00000643,
+        0x8000062C, 0x00000643, 0x8000062D, 0x00000643, 0x8000062E, 0x00000643,
+        0x80000644, 0x00000643, 0x80000645, 0x00000643, 0x80000649, 0x00000643,
+        0x8000064A, 0x00000644, 0x8000062C, 0x00000644, 0x8000062D, 0x00000644,
+        0x8000062E, 0x00000644, 0x80000645, 0x00000644, 0x80000649, 0x00000644,
+        0x8000064A, 0x00000645, 0x8000062C, 0x00000645, 0x8000062D, 0x00000645,
+        0x8000062E, 0x00000645, 0x80000645, 0x00000645, 0x80000649, 0x00000645,
+        0x8000064A, 0x00000646, 0x8000062C, 0x00000646, 0x8000062D, 0x00000646,
+        0x8000062E, 0x00000646, 0x80000645, 0x00000646, 0x80000649, 0x00000646,
+        0x8000064A, 0x00000647, 0x8000062C, 0x00000647, 0x80000645, 0x00000647,
+        0x80000649, 0x00000647, 0x8000064A, 0x0000064A, 0x8000062C, 0x0000064A,
+        0x8000062D, 0x0000064A, 0x8000062E, 0x0000064A, 0x80000645, 0x0000064A,
+        0x80000649, 0x0000064A, 0x8000064A, 0x00000630, 0x80000670, 0x00000631,
+        0x80000670, 0x00000649, 0x80000670, 0x00000020, 0x0000064C, 0x80000651,
+        0x00000020, 0x0000064D, 0x80000651, 0x00000020, 0x0000064E, 0x80000651,
+        0x00000020, 0x0000064F, 0x80000651, 0x00000020, 0x00000650, 0x80000651,
+        0x00000020, 0x00000651, 0x80000670, 0x0000064A, 0x00000654, 0x80000631,
+        0x0000064A, 0x00000654, 0x80000632, 0x0000064A, 0x00000654, 0x80000646,
+        0x00000628, 0x80000631, 0x00000628, 0x80000632, 0x00000628, 0x80000646,
+        0x0000062A, 0x80000631, 0x0000062A, 0x80000632, 0x0000062A, 0x80000646,
+        0x0000062B, 0x80000631, 0x0000062B, 0x80000632, 0x0000062B, 0x80000646,
+        0x00000645, 0x80000627, 0x00000646, 0x80000631, 0x00000646, 0x80000632,
+        0x00000646, 0x80000646, 0x0000064A, 0x80000631, 0x0000064A, 0x80000632,
+        0x0000064A, 0x80000646, 0x0000064A, 0x00000654, 0x8000062E, 0x0000064A,
+        0x00000654, 0x80000647, 0x00000628, 0x80000647, 0x0000062A, 0x80000647,
+        0x00000635, 0x8000062E, 0x00000644, 0x80000647, 0x00000646, 0x80000647,
+        0x00000647, 0x80000670, 0x0000064A, 0x80000647, 0x0000062B, 0x80000647,
+        0x00000633, 0x80000647, 0x00000634, 0x80000645, 0x00000634, 0x80000647,
+        0x00000640, 0x0000064E, 0x80000651, 0x00000640, 0x0000064F, 0x80000651,
+        0x00000640, 0x00000650, 0x80000651, 0x00000637, 0x80000649, 0x00000637,
+        0x8000064A, 0x00000639, 0x80000649, 0x00000639, 0x8000064A, 0x0000063A,
+        0x80000649, 0x0000063A, 0x8000064A, 0x00000633, 0x80000649, 0x00000633,
+        0x8000064A, 0x00000634, 0x80000649, 0x00000634, 0x8000064A, 0x0000062D,
+        0x80000649, 0x0000062D, 0x8000064A, 0x0000062C, 0x80000649, 0x0000062C,
+        0x8000064A, 0x0000062E, 0x80000649, 0x0000062E, 0x8000064A, 0x00000635,
+        0x80000649, 0x00000635, 0x8000064A, 0x00000636, 0x80000649, 0x00000636,
+        0x8000064A, 0x00000634, 0x8000062C, 0x00000634, 0x8000062D, 0x00000634,
+        0x8000062E, 0x00000634, 0x80000631, 0x00000633, 0x80000631, 0x00000635,
+        0x80000631, 0x00000636, 0x80000631, 0x00000627, 0x8000064B, 0x0000062A,
+        0x0000062C, 0x80000645, 0x0000062A, 0x0000062D, 0x8000062C, 0x0000062A,
+        0x0000062D, 0x80000645, 0x0000062A, 0x0000062E, 0x80000645, 0x0000062A,
+        0x00000645, 0x8000062C, 0x0000062A, 0x00000645, 0x8000062D, 0x0000062A,
+        0x00000645, 0x8000062E, 0x0000062C, 0x00000645, 0x8000062D, 0x0000062D,
+        0x00000645, 0x8000064A, 0x0000062D, 0x00000645, 0x80000649, 0x00000633,
+        0x0000062D, 0x8000062C, 0x00000633, 0x0000062C, 0x8000062D, 0x00000633,
+        0x0000062C, 0x80000649, 0x00000633, 0x00000645, 0x8000062D, 0x00000633,
+        0x00000645, 0x8000062C, 0x00000633, 0x00000645, 0x80000645, 0x00000635,
+        0x0000062D, 0x8000062D, 0x00000635, 0x00000645, 0x80000645, 0x00000634,
+        0x0000062D, 0x80000645, 0x00000634, 0x0000062C, 0x8000064A, 0x00000634,
+        0x00000645, 0x8000062E, 0x00000634, 0x00000645, 0x80000645, 0x00000636,
+        0x0000062D, 0x80000649, 0x00000636, 0x0000062E, 0x80000645, 0x00000637,
+        0x00000645, 0x8000062D, 0x00000637, 0x00000645, 0x80000645, 0x00000637,
+        0x00000645, 0x8000064A, 0x00000639, 0x0000062C, 0x80000645, 0x00000639,
+        0x00000645, 0x80000645, 0x00000639, 0x00000645, 0x80000649, 0x0000063A,
+        0x00000645, 0x80000645, 0x0000063A, 0x00000645, 0x8000064A, 0x0000063A,
+        0x00000645, 0x80000649, 0x00000641, 0x0000062E, 0x80000645, 0x00000642,
+        0x00000645, 0x8000062D, 0x00000642, 0x00000645, 0x80000645, 0x00000644,
+        0x0000062D, 0x80000645, 0x00000644, 0x0000062D, 0x8000064A, 0x00000644,
+        0x0000062D, 0x80000649, 0x00000644, 0x0000062C, 0x8000062C, 0x00000644,
+        0x0000062E, 0x80000645, 0x00000644, 0x00000645, 0x8000062D, 0x00000645,
+        0x0000062D, 0x8000062C, 0x00000645, 0x0000062D, 0x80000645, 0x00000645,
+        0x0000062D, 0x8000064A, 0x00000645, 0x0000062C, 0x8000062D, 0x00000645,
+        0x0000062C, 0x80000645, 0x00000645, 0x0000062E, 0x8000062C, 0x00000645,
+        0x0000062E, 0x80000645, 0x00000645, 0x0000062C, 0x8000062E, 0x00000647,
+        0x00000645, 0x8000062C, 0x00000647, 0x00000645, 0x80000645, 0x00000646,
+        0x0000062D, 0x80000645, 0x00000646, 0x0000062D, 0x80000649, 0x00000646,
+        0x0000062C, 0x80000645, 0x00000646, 0x0000062C, 0x80000649, 0x00000646,
+        0x00000645, 0x8000064A, 0x00000646, 0x00000645, 0x80000649, 0x0000064A,
+        0x00000645, 0x80000645, 0x00000628, 0x0000062E, 0x8000064A, 0x0000062A,
+        0x0000062C, 0x8000064A, 0x0000062A, 0x0000062C, 0x80000649, 0x0000062A,
+        0x0000062E, 0x8000064A, 0x0000062A, 0x0000062E, 0x80000649, 0x0000062A,
+        0x00000645, 0x8000064A, 0x0000062A, 0x00000645, 0x80000649, 0x0000062C,
+        0x00000645, 0x8000064A, 0x0000062C, 0x0000062D, 0x80000649, 0x0000062C,
+        0x00000645, 0x80000649, 0x00000633, 0x0000062E, 0x80000649, 0x00000635,
+        0x0000062D, 0x8000064A, 0x00000634, 0x0000062D, 0x8000064A, 0x00000636,
+        0x0000062D, 0x8000064A, 0x00000644, 0x0000062C, 0x8000064A, 0x00000644,
+        0x00000645, 0x8000064A, 0x0000064A, 0x0000062D, 0x8000064A, 0x0000064A,
+        0x0000062C, 0x8000064A, 0x0000064A, 0x00000645, 0x8000064A, 0x00000645,
+        0x00000645, 0x8000064A, 0x00000642, 0x00000645, 0x8000064A, 0x00000646,
+        0x0000062D, 0x8000064A, 0x00000639, 0x00000645, 0x8000064A, 0x00000643,
+        0x00000645, 0x8000064A, 0x00000646, 0x0000062C, 0x8000062D, 0x00000645,
+        0x0000062E, 0x8000064A, 0x00000644, 0x0000062C, 0x80000645, 0x00000643,
+        0x00000645, 0x80000645, 0x0000062C, 0x0000062D, 0x8000064A, 0x0000062D,
+        0x0000062C, 0x8000064A, 0x00000645, 0x0000062C, 0x8000064A, 0x00000641,
+        0x00000645, 0x8000064A, 0x00000628, 0x0000062D, 0x8000064A, 0x00000633,
+        0x0000062E, 0x8000064A, 0x00000646, 0x0000062C, 0x8000064A, 0x00000635,
+        0x00000644, 0x800006D2, 0x00000642, 0x00000644, 0x800006D2, 0x00000627,
+        0x00000644, 0x00000644, 0x80000647, 0x00000627, 0x00000643, 0x00000628,
+        0x80000631, 0x00000645, 0x0000062D, 0x00000645, 0x8000062F, 0x00000635,
+        0x00000644, 0x00000639, 0x80000645, 0x00000631, 0x00000633, 0x00000648,
+        0x80000644, 0x00000639, 0x00000644, 0x0000064A, 0x80000647, 0x00000648,
+        0x00000633, 0x00000644, 0x80000645, 0x00000635, 0x00000644, 0x80000649,
+        0x00000635, 0x00000644, 0x00000649, 0x00000020, 0x00000627, 0x00000644,
+        0x00000644, 0x00000647, 0x00000020, 0x00000639, 0x00000644, 0x0000064A,
+        0x00000647, 0x00000020, 0x00000648, 0x00000633, 0x00000644, 0x80000645,
+        0x0000062C, 0x00000644, 0x00000020, 0x0000062C, 0x00000644, 0x00000627,
+        0x00000644, 0x80000647, 0x00000631, 0x000006CC, 0x00000627, 0x80000644,
+        0x8000002C, 0x80003001, 0x80003002, 0x8000003A, 0x80000021, 0x8000003F,
+        0x80003016, 0x80003017, 0x80002014, 0x80002013, 0x8000005F, 0x8000007B,
+        0x8000007D, 0x80003014, 0x80003015, 0x80003010, 0x80003011, 0x8000300A,
+        0x8000300B, 0x8000300C, 0x8000300D, 0x8000300E, 0x8000300F, 0x8000005B,
+        0x8000005D, 0x80000023, 0x80000026, 0x8000002A, 0x8000002D, 0x8000003C,
+        0x8000003E, 0x8000005C, 0x80000024, 0x80000025, 0x80000040, 0x00000020,
+        0x8000064B, 0x00000640, 0x8000064B, 0x00000020, 0x8000064C, 0x00000020,
+        0x8000064D, 0x00000020, 0x8000064E, 0x00000640, 0x8000064E, 0x00000020,
+        0x8000064F, 0x00000640, 0x8000064F, 0x00000020, 0x80000650, 0x00000640,
+        0x80000650, 0x00000020, 0x80000651, 0x00000640, 0x80000651, 0x00000020,
+        0x80000652, 0x00000640, 0x80000652, 0x80000621, 0x80000627, 0x80000628,
+        0x80000629, 0x8000062A, 0x8000062B, 0x8000062C, 0x8000062D, 0x8000062E,
+        0x8000062F, 0x80000630, 0x80000631, 0x80000632, 0x80000633, 0x80000634,
+        0x80000635, 0x80000636, 0x80000637, 0x80000638, 0x80000639, 0x8000063A,
+        0x80000641, 0x80000642, 0x80000643, 0x80000644, 0x80000645, 0x80000646,
+        0x80000647, 0x80000648, 0x8000064A, 0x00000644, 0x00000627, 0x80000653,
+        0x00000644, 0x00000627, 0x80000654, 0x00000644, 0x00000627, 0x80000655,
+        0x00000644, 0x80000627, 0x80000022, 0x80000027, 0x8000002F, 0x8000005E,
+        0x8000007C, 0x8000007E, 0x80002985, 0x80002986, 0x800030FB, 0x800030A1,
+        0x800030A3, 0x800030A5, 0x800030A7, 0x800030A9, 0x800030E3, 0x800030E5,
+        0x800030E7, 0x800030C3, 0x800030FC, 0x800030F3, 0x80003099, 0x8000309A,
+        0x800000A2, 0x800000A3, 0x800000AC, 0x800000A6, 0x800000A5, 0x800020A9,
+        0x80002502, 0x80002190, 0x80002191, 0x80002192, 0x80002193, 0x800025A0,
+        0x800025CB, 0x800002D0, 0x800002D1, 0x800000E6, 0x80000299, 0x80000253,
+        0x800002A3, 0x8000AB66, 0x800002A5, 0x800002A4, 0x80000256, 0x80000257,
+        0x80001D91, 0x80000258, 0x8000025E, 0x800002A9, 0x80000264, 0x80000262,
+        0x80000260, 0x8000029B, 0x8000029C, 0x80000267, 0x80000284, 0x800002AA,
+        0x800002AB, 0x8000026C, 0x8001DF04, 0x8000A78E, 0x8000026E, 0x8001DF05,
+        0x8000028E, 0x8001DF06, 0x800000F8, 0x80000276, 0x80000277, 0x8000027A,
+        0x8001DF08, 0x8000027D, 0x8000027E, 0x80000280, 0x800002A8, 0x800002A6,
+        0x8000AB67, 0x800002A7, 0x80000288, 0x80002C71, 0x8000028F, 0x800002A1,
+        0x800002A2, 0x80000298, 0x800001C0, 0x800001C1, 0x800001C2, 0x8001DF0A,
+        0x8001DF1E, 0x00011099, 0x800110BA, 0x0001109B, 0x800110BA, 0x000110A5,
+        0x800110BA, 0x00011131, 0x80011127, 0x00011132, 0x80011127, 0x00011347,
+        0x8001133E, 0x00011347, 0x80011357, 0x000114B9, 0x800114BA, 0x000114B9,
+        0x800114B0, 0x000114B9, 0x800114BD, 0x000115B8, 0x800115AF, 0x000115B9,
+        0x800115AF, 0x00011935, 0x80011930, 0x0001D157, 0x8001D165, 0x0001D158,
+        0x8001D165, 0x0001D158, 0x0001D165, 0x8001D16E, 0x0001D158, 0x0001D165,
+        0x8001D16F, 0x0001D158, 0x0001D165, 0x8001D170, 0x0001D158, 0x0001D165,
+        0x8001D171, 0x0001D158, 0x0001D165, 0x8001D172, 0x0001D1B9, 0x8001D165,
+        0x0001D1BA, 0x8001D165, 0x0001D1B9, 0x0001D165, 0x8001D16E, 0x0001D1BA,
+        0x0001D165, 0x8001D16E, 0x0001D1B9, 0x0001D165, 0x8001D16F, 0x0001D1BA,
+        0x0001D165, 0x8001D16F, 0x80000131, 0x80000237, 0x80000391, 0x80000392,
+        0x80000394, 0x80000395, 0x80000396, 0x80000397, 0x80000399, 0x8000039A,
+        0x8000039B, 0x8000039C, 0x8000039D, 0x8000039E, 0x8000039F, 0x800003A1,
+        0x800003A4, 0x800003A6, 0x800003A7, 0x800003A8, 0x80002207, 0x800003B1,
+        0x800003B6, 0x800003B7, 0x800003BB, 0x800003BD, 0x800003BE, 0x800003BF,
+        0x800003C3, 0x800003C4, 0x800003C5, 0x800003C8, 0x800003C9, 0x80002202,
+        0x800003DC, 0x800003DD, 0x8000066E, 0x800006A1, 0x8000066F, 0x00000030,
+        0x8000002E, 0x00000030, 0x8000002C, 0x00000031, 0x8000002C, 0x00000032,
+        0x8000002C, 0x00000033, 0x8000002C, 0x00000034, 0x8000002C, 0x00000035,
+        0x8000002C, 0x00000036, 0x8000002C, 0x00000037, 0x8000002C, 0x00000038,
+        0x8000002C, 0x00000039, 0x8000002C, 0x00000028, 0x00000041, 0x80000029,
+        0x00000028, 0x00000042, 0x80000029, 0x00000028, 0x00000043, 0x80000029,
+        0x00000028, 0x00000044, 0x80000029, 0x00000028, 0x00000045, 0x80000029,
+        0x00000028, 0x00000046, 0x80000029, 0x00000028, 0x00000047, 0x80000029,
+        0x00000028, 0x00000048, 0x80000029, 0x00000028, 0x00000049, 0x80000029,
+        0x00000028, 0x0000004A, 0x80000029, 0x00000028, 0x0000004B, 0x80000029,
+        0x00000028, 0x0000004C, 0x80000029, 0x00000028, 0x0000004D, 0x80000029,
+        0x00000028, 0x0000004E, 0x80000029, 0x00000028, 0x0000004F, 0x80000029,
+        0x00000028, 0x00000050, 0x80000029, 0x00000028, 0x00000051, 0x80000029,
+        0x00000028, 0x00000052, 0x80000029, 0x00000028, 0x00000053, 0x80000029,
+        0x00000028, 0x00000054, 0x80000029, 0x00000028, 0x00000055, 0x80000029,
+        0x00000028, 0x00000056, 0x80000029, 0x00000028, 0x00000057, 0x80000029,
+        0x00000028, 0x00000058, 0x80000029, 0x00000028, 0x00000059, 0x80000029,
+        0x00000028, 0x0000005A, 0x80000029, 0x00003014, 0x00000053, 0x80003015,
+        0x00000043, 0x80000044, 0x00000057, 0x8000005A, 0x00000048, 0x80000056,
+        0x00000053, 0x80000044, 0x00000053, 0x80000053, 0x00000050, 0x00000050,
+        0x80000056, 0x00000057, 0x80000043, 0x0000004D, 0x80000043, 0x0000004D,
+        0x80000044, 0x0000004D, 0x80000052, 0x00000044, 0x8000004A, 0x0000307B,
+        0x8000304B, 0x000030B3, 0x800030B3, 0x80005B57, 0x800053CC, 0x8000591A,
+        0x800089E3, 0x80004EA4, 0x80006620, 0x80007121, 0x8000524D, 0x80005F8C,
+        0x8000518D, 0x800065B0, 0x8000521D, 0x80007D42, 0x80008CA9, 0x800058F0,
+        0x80005439, 0x80006F14, 0x80006295, 0x80006355, 0x8000904A, 0x80006307,
+        0x80006253, 0x80007981, 0x80007A7A, 0x80005408, 0x80006E80, 0x80007533,
+        0x80005272, 0x800055B6, 0x8000914D, 0x00003014, 0x0000672C, 0x80003015,
+        0x00003014, 0x00004E09, 0x80003015, 0x00003014, 0x00004E8C, 0x80003015,
+        0x00003014, 0x00005B89, 0x80003015, 0x00003014, 0x000070B9, 0x80003015,
+        0x00003014, 0x00006253, 0x80003015, 0x00003014, 0x000076D7, 0x80003015,
+        0x00003014, 0x000052DD, 0x80003015, 0x00003014, 0x00006557, 0x80003015,
+        0x80005F97, 0x800053EF, 0x80004E3D, 0x80004E38, 0x80004E41, 0x80020122,
+        0x80004F60, 0x80004FBB, 0x80005002, 0x8000507A, 0x80005099, 0x800050CF,
+        0x8000349E, 0x8002063A, 0x80005154, 0x80005164, 0x80005177, 0x8002051C,
+        0x800034B9, 0x80005167, 0x8002054B, 0x80005197, 0x800051A4, 0x80004ECC,
+        0x800051AC, 0x800291DF, 0x80005203, 0x800034DF, 0x8000523B, 0x80005246,
+        0x80005277, 0x80003515, 0x80005305, 0x80005306, 0x80005349, 0x8000535A,
+        0x80005373, 0x8000537D, 0x8000537F, 0x80020A2C, 0x80007070, 0x800053CA,
+        0x800053DF, 0x80020B63, 0x800053EB, 0x800053F1, 0x80005406, 0x8000549E,
+        0x80005438, 0x80005448, 0x80005468, 0x800054A2, 0x800054F6, 0x80005510,
+        0x80005553, 0x80005563, 0x80005584, 0x800055AB, 0x800055B3, 0x800055C2,
+        0x80005716, 0x80005717, 0x80005651, 0x80005674, 0x800058EE, 0x800057CE,
+        0x800057F4, 0x8000580D, 0x8000578B, 0x80005832, 0x80005831, 0x800058AC,
+        0x800214E4, 0x800058F2, 0x800058F7, 0x80005906, 0x80005922, 0x80005962,
+        0x800216A8, 0x800216EA, 0x800059EC, 0x80005A1B, 0x80005A27, 0x800059D8,
+        0x80005A66, 0x800036EE, 0x800036FC, 0x80005B08, 0x80005B3E, 0x800219C8,
+        0x80005BC3, 0x80005BD8, 0x80005BF3, 0x80021B18, 0x80005BFF, 0x80005C06,
+        0x80005F53, 0x80003781, 0x80005C60, 0x80005CC0, 0x80005C8D, 0x80021DE4,
+        0x80005D43, 0x80021DE6, 0x80005D6E, 0x80005D6B, 0x80005D7C, 0x80005DE1,
+        0x80005DE2, 0x8000382F, 0x80005DFD, 0x80005E28, 0x80005E3D, 0x80005E69,
+        0x80003862, 0x80022183, 0x8000387C, 0x80005EB0, 0x80005EB3, 0x80005EB6,
+        0x8002A392, 0x80022331, 0x80008201, 0x80005F22, 0x800038C7, 0x800232B8,
+        0x800261DA, 0x80005F62, 0x80005F6B, 0x800038E3, 0x80005F9A, 0x80005FCD,
+        0x80005FD7, 0x80005FF9, 0x80006081, 0x8000393A, 0x8000391C, 0x800226D4,
+        0x800060C7, 0x80006148, 0x8000614C, 0x8000617A, 0x800061B2, 0x800061A4,
+        0x800061AF, 0x800061DE, 0x80006210, 0x8000621B, 0x8000625D, 0x800062B1,
+        0x800062D4, 0x80006350, 0x80022B0C, 0x8000633D, 0x800062FC, 0x80006368,
+        0x80006383, 0x800063E4, 0x80022BF1, 0x80006422, 0x800063C5, 0x800063A9,
+        0x80003A2E, 0x80006469, 0x8000647E, 0x8000649D, 0x80006477, 0x80003A6C,
+        0x8000656C, 0x8002300A, 0x800065E3, 0x800066F8, 0x80006649, 0x80003B19,
+        0x80003B08, 0x80003AE4, 0x80005192, 0x80005195, 0x80006700, 0x8000669C,
+        0x800080AD, 0x800043D9, 0x80006721, 0x8000675E, 0x80006753, 0x800233C3,
+        0x80003B49, 0x800067FA, 0x80006785, 0x80006852, 0x8002346D, 0x8000688E,
+        0x8000681F, 0x80006914, 0x80006942, 0x800069A3, 0x800069EA, 0x80006AA8,
+        0x800236A3, 0x80006ADB, 0x80003C18, 0x80006B21, 0x800238A7, 0x80006B54,
+        0x80003C4E, 0x80006B72, 0x80006B9F, 0x80006BBB, 0x80023A8D, 0x80021D0B,
+        0x80023AFA, 0x80006C4E, 0x80023CBC, 0x80006CBF, 0x80006CCD, 0x80006C67,
+        0x80006D16, 0x80006D3E, 0x80006D69, 0x80006D78, 0x80006D85, 0x80023D1E,
+        0x80006D34, 0x80006E2F, 0x80006E6E, 0x80003D33, 0x80006EC7, 0x80023ED1,
+        0x80006DF9, 0x80006F6E, 0x80023F5E, 0x80023F8E, 0x80006FC6, 0x80007039,
+        0x8000701B, 0x80003D96, 0x8000704A, 0x8000707D, 0x80007077, 0x800070AD,
+        0x80020525, 0x80007145, 0x80024263, 0x8000719C, 0x800243AB, 0x80007228,
+        0x80007250, 0x80024608, 0x80007280, 0x80007295, 0x80024735, 0x80024814,
+        0x8000737A, 0x8000738B, 0x80003EAC, 0x800073A5, 0x80003EB8, 0x80007447,
+        0x8000745C, 0x80007485, 0x800074CA, 0x80003F1B, 0x80007524, 0x80024C36,
+        0x8000753E, 0x80024C92, 0x8002219F, 0x80007610, 0x80024FA1, 0x80024FB8,
+        0x80025044, 0x80003FFC, 0x80004008, 0x800250F3, 0x800250F2, 0x80025119,
+        0x80025133, 0x8000771E, 0x8000771F, 0x8000778B, 0x80004046, 0x80004096,
+        0x8002541D, 0x8000784E, 0x800040E3, 0x80025626, 0x8002569A, 0x800256C5,
+        0x800079EB, 0x8000412F, 0x80007A4A, 0x80007A4F, 0x8002597C, 0x80025AA7,
+        0x80007AEE, 0x80004202, 0x80025BAB, 0x80007BC6, 0x80007BC9, 0x80004227,
+        0x80025C80, 0x80007CD2, 0x800042A0, 0x80007CE8, 0x80007CE3, 0x80007D00,
+        0x80025F86, 0x80007D63, 0x80004301, 0x80007DC7, 0x80007E02, 0x80007E45,
+        0x80004334, 0x80026228, 0x80026247, 0x80004359, 0x800262D9, 0x80007F7A,
+        0x8002633E, 0x80007F95, 0x80007FFA, 0x800264DA, 0x80026523, 0x80008060,
+        0x800265A8, 0x80008070, 0x8002335F, 0x800043D5, 0x800080B2, 0x80008103,
+        0x8000440B, 0x8000813E, 0x80005AB5, 0x800267A7, 0x800267B5, 0x80023393,
+        0x8002339C, 0x80008204, 0x80008F9E, 0x8000446B, 0x80008291, 0x8000828B,
+        0x8000829D, 0x800052B3, 0x800082B1, 0x800082B3, 0x800082BD, 0x800082E6,
+        0x80026B3C, 0x8000831D, 0x80008363, 0x800083AD, 0x80008323, 0x800083BD,
+        0x800083E7, 0x80008353, 0x800083CA, 0x800083CC, 0x800083DC, 0x80026C36,
+        0x80026D6B, 0x80026CD5, 0x8000452B, 0x800084F1, 0x800084F3, 0x80008516,
+        0x800273CA, 0x80008564, 0x80026F2C, 0x8000455D, 0x80004561, 0x80026FB1,
+        0x800270D2, 0x8000456B, 0x80008650, 0x80008667, 0x80008669, 0x800086A9,
+        0x80008688, 0x8000870E, 0x800086E2, 0x80008728, 0x8000876B, 0x80008786,
+        0x800045D7, 0x800087E1, 0x80008801, 0x800045F9, 0x80008860, 0x80027667,
+        0x800088D7, 0x800088DE, 0x80004635, 0x800088FA, 0x800034BB, 0x800278AE,
+        0x80027966, 0x800046BE, 0x800046C7, 0x80008AA0, 0x80027CA8, 0x80008CAB,
+        0x80008CC1, 0x80008D1B, 0x80008D77, 0x80027F2F, 0x80020804, 0x80008DCB,
+        0x80008DBC, 0x80008DF0, 0x800208DE, 0x80008ED4, 0x800285D2, 0x800285ED,
+        0x80009094, 0x800090F1, 0x80009111, 0x8002872E, 0x8000911B, 0x80009238,
+        0x800092D7, 0x800092D8, 0x8000927C, 0x800093F9, 0x80009415, 0x80028BFA,
+        0x8000958B, 0x80004995, 0x800095B7, 0x80028D77, 0x800049E6, 0x800096C3,
+        0x80005DB2, 0x80009723, 0x80029145, 0x8002921A, 0x80004A6E, 0x80004A76,
+        0x800097E0, 0x8002940A, 0x80004AB2, 0x80029496, 0x80009829, 0x800295B6,
+        0x800098E2, 0x80004B33, 0x80009929, 0x800099A7, 0x800099C2, 0x800099FE,
+        0x80004BCE, 0x80029B30, 0x80009C40, 0x80009CFD, 0x80004CCE, 0x80004CED,
+        0x80009D67, 0x8002A0CE, 0x80004CF8, 0x8002A105, 0x8002A20E, 0x8002A291,
+        0x80004D56, 0x80009EFE, 0x80009F05, 0x80009F0F, 0x80009F16, 0x8002A600,
+    };
+};
+
+template <typename T>
+constexpr std::uint32_t decomposition_tables<T>::pool[];
+
+template <typename = void>
+struct composition_tables {
+    static constexpr std::uint64_t pairs[941] = {
+        0x0000F0006700226E, 0x0000F40067002260, 0x0000F8006700226F, 0x00010400600000C0,
+        0x00010400602000C1, 0x00010400604000C2, 0x00010400606000C3, 0x0001040060800100,
+        0x0001040060C00102, 0x0001040060E00226, 0x00010400610000C4, 0x0001040061201EA2,
+        0x00010400614000C5, 0x00010400618001CD, 0x0001040061E00200, 0x0001040062200202,
+        0x0001040064601EA0, 0x0001040064A01E00, 0x0001040065000104, 0x0001080060E01E02,
+        0x0001080064601E04, 0x0001080066201E06, 0x00010C0060200106, 0x00010C0060400108,
+        0x00010C0060E0010A, 0x00010C006180010C, 0x00010C0064E000C7, 0x0001100060E01E0A,
+        0x000110006180010E, 0x0001100064601E0C, 0x0001100064E01E10, 0x0001100065A01E12,
+        0x0001100066201E0E, 0x00011400600000C8, 0x00011400602000C9, 0x00011400604000CA,
+        0x0001140060601EBC, 0x0001140060800112, 0x0001140060C00114, 0x0001140060E00116,
+        0x00011400610000CB, 0x0001140061201EBA, 0x000114006180011A, 0x0001140061E00204,
+        0x0001140062200206, 0x0001140064601EB8, 0x0001140064E00228, 0x0001140065000118,
+        0x0001140065A01E18, 0x0001140066001E1A, 0x0001180060E01E1E, 0x00011C00602001F4,
+        0x00011C006040011C, 0x00011C0060801E20, 0x00011C0060C0011E, 0x00011C0060E00120,
+        0x00011C00618001E6, 0x00011C0064E00122, 0x0001200060400124, 0x0001200060E01E22,
+        0x0001200061001E26, 0x000120006180021E, 0x0001200064601E24, 0x0001200064E01E28,
+        0x0001200065C01E2A, 0x00012400600000CC, 0x00012400602000CD, 0x00012400604000CE,
+        0x0001240060600128, 0x000124006080012A, 0x0001240060C0012C, 0x0001240060E00130,
+        0x00012400610000CF, 0x0001240061201EC8, 0x00012400618001CF, 0x0001240061E00208,
+        0x000124006220020A, 0x0001240064601ECA, 0x000124006500012E, 0x0001240066001E2C,
+        0x0001280060400134, 0x00012C0060201E30, 0x00012C00618001E8, 0x00012C0064601E32,
+        0x00012C0064E00136, 0x00012C0066201E34, 0x0001300060200139, 0x000130006180013D,
+        0x0001300064601E36, 0x0001300064E0013B, 0x0001300065A01E3C, 0x0001300066201E3A,
+        0x0001340060201E3E, 0x0001340060E01E40, 0x0001340064601E42, 0x00013800600001F8,
+        0x0001380060200143, 0x00013800606000D1, 0x0001380060E01E44, 0x0001380061800147,
+        0x0001380064601E46, 0x0001380064E00145, 0x0001380065A01E4A, 0x0001380066201E48,
+        0x00013C00600000D2, 0x00013C00602000D3, 0x00013C00604000D4, 0x00013C00606000D5,
+        0x00013C006080014C, 0x00013C0060C0014E, 0x00013C0060E0022E, 0x00013C00610000D6,
+        0x00013C0061201ECE, 0x00013C0061600150, 0x00013C00618001D1, 0x00013C0061E0020C,
+        0x00013C006220020E, 0x00013C00636001A0, 0x00013C0064601ECC, 0x00013C00650001EA,
+        0x0001400060201E54, 0x0001400060E01E56, 0x0001480060200154, 0x0001480060E01E58,
+        0x0001480061800158, 0x0001480061E00210, 0x0001480062200212, 0x0001480064601E5A,
+        0x0001480064E00156, 0x0001480066201E5E, 0x00014C006020015A, 0x00014C006040015C,
+        0x00014C0060E01E60, 0x00014C0061800160, 0x00014C0064601E62, 0x00014C0064C00218,
+        0x00014C0064E0015E, 0x0001500060E01E6A, 0x0001500061800164, 0x0001500064601E6C,
+        0x0001500064C0021A, 0x0001500064E00162, 0x0001500065A01E70, 0x0001500066201E6E,
+        0x00015400600000D9, 0x00015400602000DA, 0x00015400604000DB, 0x0001540060600168,
+        0x000154006080016A, 0x0001540060C0016C, 0x00015400610000DC, 0x0001540061201EE6,
+        0x000154006140016E, 0x0001540061600170, 0x00015400618001D3, 0x0001540061E00214,
+        0x0001540062200216, 0x00015400636001AF, 0x0001540064601EE4, 0x0001540064801E72,
+        0x0001540065000172, 0x0001540065A01E76, 0x0001540066001E74, 0x0001580060601E7C,
+        0x0001580064601E7E, 0x00015C0060001E80, 0x00015C0060201E82, 0x00015C0060400174,
+        0x00015C0060E01E86, 0x00015C0061001E84, 0x00015C0064601E88, 0x0001600060E01E8A,
+        0x0001600061001E8C, 0x0001640060001EF2, 0x00016400602000DD, 0x0001640060400176,
+        0x0001640060601EF8, 0x0001640060800232, 0x0001640060E01E8E, 0x0001640061000178,
+        0x0001640061201EF6, 0x0001640064601EF4, 0x0001680060200179, 0x0001680060401E90,
+        0x0001680060E0017B, 0x000168006180017D, 0x0001680064601E92, 0x0001680066201E94,
+        0x00018400600000E0, 0x00018400602000E1, 0x00018400604000E2, 0x00018400606000E3,
+        0x0001840060800101, 0x0001840060C00103, 0x0001840060E00227, 0x00018400610000E4,
+        0x0001840061201EA3, 0x00018400614000E5, 0x00018400618001CE, 0x0001840061E00201,
+        0x0001840062200203, 0x0001840064601EA1, 0x0001840064A01E01, 0x0001840065000105,
+        0x0001880060E01E03, 0x0001880064601E05, 0x0001880066201E07, 0x00018C0060200107,
+        0x00018C0060400109, 0x00018C0060E0010B, 0x00018C006180010D, 0x00018C0064E000E7,
+        0x0001900060E01E0B, 0x000190006180010F, 0x0001900064601E0D, 0x0001900064E01E11,
+        0x0001900065A01E13, 0x0001900066201E0F, 0x00019400600000E8, 0x00019400602000E9,
+        0x00019400604000EA, 0x0001940060601EBD, 0x0001940060800113, 0x0001940060C00115,
+        0x0001940060E00117, 0x00019400610000EB, 0x0001940061201EBB, 0x000194006180011B,
+        0x0001940061E00205, 0x0001940062200207, 0x0001940064601EB9, 0x0001940064E00229,
+        0x0001940065000119, 0x0001940065A01E19, 0x0001940066001E1B, 0x0001980060E01E1F,
+        0x00019C00602001F5, 0x00019C006040011D, 0x00019C0060801E21, 0x00019C0060C0011F,
+        0x00019C0060E00121, 0x00019C00618001E7, 0x00019C0064E00123, 0x0001A00060400125,
+        0x0001A00060E01E23, 0x0001A00061001E27, 0x0001A0006180021F, 0x0001A00064601E25,
+        0x0001A00064E01E29, 0x0001A00065C01E2B, 0x0001A00066201E96, 0x0001A400600000EC,
+        0x0001A400602000ED, 0x0001A400604000EE, 0x0001A40060600129, 0x0001A4006080012B,
+        0x0001A40060C0012D, 0x0001A400610000EF, 0x0001A40061201EC9, 0x0001A400618001D0,
+        0x0001A40061E00209, 0x0001A4006220020B, 0x0001A40064601ECB, 0x0001A4006500012F,
+        0x0001A40066001E2D, 0x0001A80060400135, 0x0001A800618001F0, 0x0001AC0060201E31,
+        0x0001AC00618001E9, 0x0001AC0064601E33, 0x0001AC0064E00137, 0x0001AC0066201E35,
+        0x0001B0006020013A, 0x0001B0006180013E, 0x0001B00064601E37, 0x0001B00064E0013C,
+        0x0001B00065A01E3D, 0x0001B00066201E3B, 0x0001B40060201E3F, 0x0001B40060E01E41,
+        0x0001B40064601E43, 0x0001B800600001F9, 0x0001B80060200144, 0x0001B800606000F1,
+        0x0001B80060E01E45, 0x0001B80061800148, 0x0001B80064601E47, 0x0001B80064E00146,
+        0x0001B80065A01E4B, 0x0001B80066201E49, 0x0001BC00600000F2, 0x0001BC00602000F3,
+        0x0001BC00604000F4, 0x0001BC00606000F5, 0x0001BC006080014D, 0x0001BC0060C0014F,
+        0x0001BC0060E0022F, 0x0001BC00610000F6, 0x0001BC0061201ECF, 0x0001BC0061600151,
+        0x0001BC00618001D2, 0x0001BC0061E0020D, 0x0001BC006220020F, 0x0001BC00636001A1,
+        0x0001BC0064601ECD, 0x0001BC00650001EB, 0x0001C00060201E55, 0x0001C00060E01E57,
+        0x0001C80060200155, 0x0001C80060E01E59, 0x0001C80061800159, 0x0001C80061E00211,
+        0x0001C80062200213, 0x0001C80064601E5B, 0x0001C80064E00157, 0x0001C80066201E5F,
+        0x0001CC006020015B, 0x0001CC006040015D, 0x0001CC0060E01E61, 0x0001CC0061800161,
+        0x0001CC0064601E63, 0x0001CC0064C00219, 0x0001CC0064E0015F, 0x0001D00060E01E6B,
+        0x0001D00061001E97, 0x0001D00061800165, 0x0001D00064601E6D, 0x0001D00064C0021B,
+        0x0001D00064E00163, 0x0001D00065A01E71, 0x0001D00066201E6F, 0x0001D400600000F9,
+        0x0001D400602000FA, 0x0001D400604000FB, 0x0001D40060600169, 0x0001D4006080016B,
+        0x0001D40060C0016D, 0x0001D400610000FC, 0x0001D40061201EE7, 0x0001D4006140016F,
+        0x0001D40061600171, 0x0001D400618001D4, 0x0001D40061E00215, 0x0001D40062200217,
+        0x0001D400636001B0, 0x0001D40064601EE5, 0x0001D40064801E73, 0x0001D40065000173,
+        0x0001D40065A01E77, 0x0001D40066001E75, 0x0001D80060601E7D, 0x0001D80064601E7F,
+        0x0001DC0060001E81, 0x0001DC0060201E83, 0x0001DC0060400175, 0x0001DC0060E01E87,
+        0x0001DC0061001E85, 0x0001DC0061401E98, 0x0001DC0064601E89, 0x0001E00060E01E8B,
+        0x0001E00061001E8D, 0x0001E40060001EF3, 0x0001E400602000FD, 0x0001E40060400177,
+        0x0001E40060601EF9, 0x0001E40060800233, 0x0001E40060E01E8F, 0x0001E400610000FF,
+        0x0001E40061201EF7, 0x0001E40061401E99, 0x0001E40064601EF5, 0x0001E8006020017A,
+        0x0001E80060401E91, 0x0001E80060E0017C, 0x0001E8006180017E, 0x0001E80064601E93,
+        0x0001E80066201E95, 0x0002A00060001FED, 0x0002A00060200385, 0x0002A00068401FC1,
+        0x0003080060001EA6, 0x0003080060201EA4, 0x0003080060601EAA, 0x0003080061201EA8,
+        0x00031000608001DE, 0x00031400602001FA, 0x00031800602001FC, 0x00031800608001E2,
+        0x00031C0060201E08, 0x0003280060001EC0, 0x0003280060201EBE, 0x0003280060601EC4,
+        0x0003280061201EC2, 0x00033C0060201E2E, 0x0003500060001ED2, 0x0003500060201ED0,
+        0x0003500060601ED6, 0x0003500061201ED4, 0x0003540060201E4C, 0x000354006080022C,
+        0x0003540061001E4E, 0x000358006080022A, 0x00036000602001FE, 0x00037000600001DB,
+        0x00037000602001D7, 0x00037000608001D5, 0x00037000618001D9, 0x0003880060001EA7,
+        0x0003880060201EA5, 0x0003880060601EAB, 0x0003880061201EA9, 0x00039000608001DF,
+        0x00039400602001FB, 0x00039800602001FD, 0x00039800608001E3, 0x00039C0060201E09,
+        0x0003A80060001EC1, 0x0003A80060201EBF, 0x0003A80060601EC5, 0x0003A80061201EC3,
+        0x0003BC0060201E2F, 0x0003D00060001ED3, 0x0003D00060201ED1, 0x0003D00060601ED7,
+        0x0003D00061201ED5, 0x0003D40060201E4D, 0x0003D4006080022D, 0x0003D40061001E4F,
+        0x0003D8006080022B, 0x0003E000602001FF, 0x0003F000600001DC, 0x0003F000602001D8,
+        0x0003F000608001D6, 0x0003F000618001DA, 0x0004080060001EB0, 0x0004080060201EAE,
+        0x0004080060601EB4, 0x0004080061201EB2, 0x00040C0060001EB1, 0x00040C0060201EAF,
+        0x00040C0060601EB5, 0x00040C0061201EB3, 0x0004480060001E14, 0x0004480060201E16,
+        0x00044C0060001E15, 0x00044C0060201E17, 0x0005300060001E50, 0x0005300060201E52,
+        0x0005340060001E51, 0x0005340060201E53, 0x0005680060E01E64, 0x00056C0060E01E65,
+        0x0005800060E01E66, 0x0005840060E01E67, 0x0005A00060201E78, 0x0005A40060201E79,
+        0x0005A80061001E7A, 0x0005AC0061001E7B, 0x0005FC0060E01E9B, 0x0006800060001EDC,
+        0x0006800060201EDA, 0x0006800060601EE0, 0x0006800061201EDE, 0x0006800064601EE2,
+        0x0006840060001EDD, 0x0006840060201EDB, 0x0006840060601EE1, 0x0006840061201EDF,
+        0x0006840064601EE3, 0x0006BC0060001EEA, 0x0006BC0060201EE8, 0x0006BC0060601EEE,
+        0x0006BC0061201EEC, 0x0006BC0064601EF0, 0x0006C00060001EEB, 0x0006C00060201EE9,
+        0x0006C00060601EEF, 0x0006C00061201EED, 0x0006C00064601EF1, 0x0006DC00618001EE,
+        0x0007A800608001EC, 0x0007AC00608001ED, 0x00089800608001E0, 0x00089C00608001E1,
+        0x0008A00060C01E1C, 0x0008A40060C01E1D, 0x0008B80060800230, 0x0008BC0060800231,
+        0x000A4800618001EF, 0x000E440060001FBA, 0x000E440060200386, 0x000E440060801FB9,
+        0x000E440060C01FB8, 0x000E440062601F08, 0x000E440062801F09, 0x000E440068A01FBC,
+        0x000E540060001FC8, 0x000E540060200388, 0x000E540062601F18, 0x000E540062801F19,
+        0x000E5C0060001FCA, 0x000E5C0060200389, 0x000E5C0062601F28, 0x000E5C0062801F29,
+        0x000E5C0068A01FCC, 0x000E640060001FDA, 0x000E64006020038A, 0x000E640060801FD9,
+        0x000E640060C01FD8, 0x000E6400610003AA, 0x000E640062601F38, 0x000E640062801F39,
+        0x000E7C0060001FF8, 0x000E7C006020038C, 0x000E7C0062601F48, 0x000E7C0062801F49,
+        0x000E840062801FEC, 0x000E940060001FEA, 0x000E94006020038E, 0x000E940060801FE9,
+        0x000E940060C01FE8, 0x000E9400610003AB, 0x000E940062801F59, 0x000EA40060001FFA,
+        0x000EA4006020038F, 0x000EA40062601F68, 0x000EA40062801F69, 0x000EA40068A01FFC,
+        0x000EB00068A01FB4, 0x000EB80068A01FC4, 0x000EC40060001F70, 0x000EC400602003AC,
+        0x000EC40060801FB1, 0x000EC40060C01FB0, 0x000EC40062601F00, 0x000EC40062801F01,
+        0x000EC40068401FB6, 0x000EC40068A01FB3, 0x000ED40060001F72, 0x000ED400602003AD,
+        0x000ED40062601F10, 0x000ED40062801F11, 0x000EDC0060001F74, 0x000EDC00602003AE,
+        0x000EDC0062601F20, 0x000EDC0062801F21, 0x000EDC0068401FC6, 0x000EDC0068A01FC3,
+        0x000EE40060001F76, 0x000EE400602003AF, 0x000EE40060801FD1, 0x000EE40060C01FD0,
+        0x000EE400610003CA, 0x000EE40062601F30, 0x000EE40062801F31, 0x000EE40068401FD6,
+        0x000EFC0060001F78, 0x000EFC00602003CC, 0x000EFC0062601F40, 0x000EFC0062801F41,
+        0x000F040062601FE4, 0x000F040062801FE5, 0x000F140060001F7A, 0x000F1400602003CD,
+        0x000F140060801FE1, 0x000F140060C01FE0, 0x000F1400610003CB, 0x000F140062601F50,
+        0x000F140062801F51, 0x000F140068401FE6, 0x000F240060001F7C, 0x000F2400602003CE,
+        0x000F240062601F60, 0x000F240062801F61, 0x000F240068401FF6, 0x000F240068A01FF3,
+        0x000F280060001FD2, 0x000F280060200390, 0x000F280068401FD7, 0x000F2C0060001FE2,
+        0x000F2C00602003B0, 0x000F2C0068401FE7, 0x000F380068A01FF4, 0x000F4800602003D3,
+        0x000F4800610003D4, 0x0010180061000407, 0x0010400060C004D0, 0x00104000610004D2,
+        0x00104C0060200403, 0x0010540060000400, 0x0010540060C004D6, 0x0010540061000401,
+        0x0010580060C004C1, 0x00105800610004DC, 0x00105C00610004DE, 0x001060006000040D,
+        0x00106000608004E2, 0x0010600060C00419, 0x00106000610004E4, 0x001068006020040C,
+        0x00107800610004E6, 0x00108C00608004EE, 0x00108C0060C0040E, 0x00108C00610004F0,
+        0x00108C00616004F2, 0x00109C00610004F4, 0x0010AC00610004F8, 0x0010B400610004EC,
+        0x0010C00060C004D1, 0x0010C000610004D3, 0x0010CC0060200453, 0x0010D40060000450,
+        0x0010D40060C004D7, 0x0010D40061000451, 0x0010D80060C004C2, 0x0010D800610004DD,
+        0x0010DC00610004DF, 0x0010E0006000045D, 0x0010E000608004E3, 0x0010E00060C00439,
+        0x0010E000610004E5, 0x0010E8006020045C, 0x0010F800610004E7, 0x00110C00608004EF,
+        0x00110C0060C0045E, 0x00110C00610004F1, 0x00110C00616004F3, 0x00111C00610004F5,
+        0x00112C00610004F9, 0x00113400610004ED, 0x0011580061000457, 0x0011D00061E00476,
+        0x0011D40061E00477, 0x00136000610004DA, 0x00136400610004DB, 0x0013A000610004EA,
+        0x0013A400610004EB, 0x00189C00CA600622, 0x00189C00CA800623, 0x00189C00CAA00625,
+        0x00192000CA800624, 0x00192800CA800626, 0x001B0400CA8006C2, 0x001B4800CA8006D3,
+        0x001B5400CA8006C0, 0x0024A00127800929, 0x0024C00127800931, 0x0024CC0127800934,
+        0x00271C0137C009CB, 0x00271C013AE009CC, 0x002D1C0167C00B4B, 0x002D1C016AC00B48,
+        0x002D1C016AE00B4C, 0x002E48017AE00B94, 0x002F180177C00BCA, 0x002F18017AE00BCC,
+        0x002F1C0177C00BCB, 0x003118018AC00C48, 0x0032FC019AA00CC0, 0x0033180198400CCA,
+        0x003318019AA00CC7, 0x003318019AC00CC8, 0x003328019AA00CCB, 0x00351801A7C00D4A,
+        0x00351801AAE00D4C, 0x00351C01A7C00D4B, 0x00376401B9400DDA, 0x00376401B9E00DDC,
+        0x00376401BBE00DDE, 0x00377001B9400DDD, 0x0040940205C01026, 0x006C140366A01B06,
+        0x006C1C0366A01B08, 0x006C240366A01B0A, 0x006C2C0366A01B0C, 0x006C340366A01B0E,
+        0x006C440366A01B12, 0x006CE80366A01B3B, 0x006CF00366A01B3D, 0x006CF80366A01B40,
+        0x006CFC0366A01B41, 0x006D080366A01B43, 0x0078D80060801E38, 0x0078DC0060801E39,
+        0x0079680060801E5C, 0x00796C0060801E5D, 0x0079880060E01E68, 0x00798C0060E01E69,
+        0x007A800060401EAC, 0x007A800060C01EB6, 0x007A840060401EAD, 0x007A840060C01EB7,
+        0x007AE00060401EC6, 0x007AE40060401EC7, 0x007B300060401ED8, 0x007B340060401ED9,
+        0x007C000060001F02, 0x007C000060201F04, 0x007C000068401F06, 0x007C000068A01F80,
+        0x007C040060001F03, 0x007C040060201F05, 0x007C040068401F07, 0x007C040068A01F81,
+        0x007C080068A01F82, 0x007C0C0068A01F83, 0x007C100068A01F84, 0x007C140068A01F85,
+        0x007C180068A01F86, 0x007C1C0068A01F87, 0x007C200060001F0A, 0x007C200060201F0C,
+        0x007C200068401F0E, 0x007C200068A01F88, 0x007C240060001F0B, 0x007C240060201F0D,
+        0x007C240068401F0F, 0x007C240068A01F89, 0x007C280068A01F8A, 0x007C2C0068A01F8B,
+        0x007C300068A01F8C, 0x007C340068A01F8D, 0x007C380068A01F8E, 0x007C3C0068A01F8F,
+        0x007C400060001F12, 0x007C400060201F14, 0x007C440060001F13, 0x007C440060201F15,
+        0x007C600060001F1A, 0x007C600060201F1C, 0x007C640060001F1B, 0x007C640060201F1D,
+        0x007C800060001F22, 0x007C800060201F24, 0x007C800068401F26, 0x007C800068A01F90,
+        0x007C840060001F23, 0x007C840060201F25, 0x007C840068401F27, 0x007C840068A01F91,
+        0x007C880068A01F92, 0x007C8C0068A01F93, 0x007C900068A01F94, 0x007C940068A01F95,
+        0x007C980068A01F96, 0x007C9C0068A01F97, 0x007CA00060001F2A, 0x007CA00060201F2C,
+        0x007CA00068401F2E, 0x007CA00068A01F98, 0x007CA40060001F2B, 0x007CA40060201F2D,
+        0x007CA40068401F2F, 0x007CA40068A01F99, 0x007CA80068A01F9A, 0x007CAC0068A01F9B,
+        0x007CB00068A01F9C, 0x007CB40068A01F9D, 0x007CB80068A01F9E, 0x007CBC0068A01F9F,
+        0x007CC00060001F32, 0x007CC00060201F34, 0x007CC00068401F36, 0x007CC40060001F33,
+        0x007CC40060201F35, 0x007CC40068401F37, 0x007CE00060001F3A, 0x007CE00060201F3C,
+        0x007CE00068401F3E, 0x007CE40060001F3B, 0x007CE40060201F3D, 0x007CE40068401F3F,
+        0x007D000060001F42, 0x007D000060201F44, 0x007D040060001F43, 0x007D040060201F45,
+        0x007D200060001F4A, 0x007D200060201F4C, 0x007D240060001F4B, 0x007D240060201F4D,
+        0x007D400060001F52, 0x007D400060201F54, 0x007D400068401F56, 0x007D440060001F53,
+        0x007D440060201F55, 0x007D440068401F57, 0x007D640060001F5B, 0x007D640060201F5D,
+        0x007D640068401F5F, 0x007D800060001F62, 0x007D800060201F64, 0x007D800068401F66,
+        0x007D800068A01FA0, 0x007D840060001F63, 0x007D840060201F65, 0x007D840068401F67,
+        0x007D840068A01FA1, 0x007D880068A01FA2, 0x007D8C0068A01FA3, 0x007D900068A01FA4,
+        0x007D940068A01FA5, 0x007D980068A01FA6, 0x007D9C0068A01FA7, 0x007DA00060001F6A,
+        0x007DA00060201F6C, 0x007DA00068401F6E, 0x007DA00068A01FA8, 0x007DA40060001F6B,
+        0x007DA40060201F6D, 0x007DA40068401F6F, 0x007DA40068A01FA9, 0x007DA80068A01FAA,
+        0x007DAC0068A01FAB, 0x007DB00068A01FAC, 0x007DB40068A01FAD, 0x007DB80068A01FAE,
+        0x007DBC0068A01FAF, 0x007DC00068A01FB2, 0x007DD00068A01FC2, 0x007DF00068A01FF2,
+        0x007ED80068A01FB7, 0x007EFC0060001FCD, 0x007EFC0060201FCE, 0x007EFC0068401FCF,
+        0x007F180068A01FC7, 0x007FD80068A01FF7, 0x007FF80060001FDD, 0x007FF80060201FDE,
+        0x007FF80068401FDF, 0x008640006700219A, 0x008648006700219B, 0x00865000670021AE,
+        0x00874000670021CD, 0x00874800670021CF, 0x00875000670021CE, 0x00880C0067002204,
+        0x0088200067002209, 0x00882C006700220C, 0x00888C0067002224, 0x0088940067002226,
+        0x0088F00067002241, 0x00890C0067002244, 0x0089140067002247, 0x0089200067002249,
+        0x008934006700226D, 0x0089840067002262, 0x0089900067002270, 0x0089940067002271,
+        0x0089C80067002274, 0x0089CC0067002275, 0x0089D80067002278, 0x0089DC0067002279,
+        0x0089E80067002280, 0x0089EC0067002281, 0x0089F000670022E0, 0x0089F400670022E1,
+        0x008A080067002284, 0x008A0C0067002285, 0x008A180067002288, 0x008A1C0067002289,
+        0x008A4400670022E2, 0x008A4800670022E3, 0x008A8800670022AC, 0x008AA000670022AD,
+        0x008AA400670022AE, 0x008AAC00670022AF, 0x008AC800670022EA, 0x008ACC00670022EB,
+        0x008AD000670022EC, 0x008AD400670022ED, 0x00C1180613203094, 0x00C12C061320304C,
+        0x00C134061320304E, 0x00C13C0613203050, 0x00C1440613203052, 0x00C14C0613203054,
+        0x00C1540613203056, 0x00C15C0613203058, 0x00C164061320305A, 0x00C16C061320305C,
+        0x00C174061320305E, 0x00C17C0613203060, 0x00C1840613203062, 0x00C1900613203065,
+        0x00C1980613203067, 0x00C1A00613203069, 0x00C1BC0613203070, 0x00C1BC0613403071,
+        0x00C1C80613203073, 0x00C1C80613403074, 0x00C1D40613203076, 0x00C1D40613403077,
+        0x00C1E00613203079, 0x00C1E0061340307A, 0x00C1EC061320307C, 0x00C1EC061340307D,
+        0x00C274061320309E, 0x00C29806132030F4, 0x00C2AC06132030AC, 0x00C2B406132030AE,
+        0x00C2BC06132030B0, 0x00C2C406132030B2, 0x00C2CC06132030B4, 0x00C2D406132030B6,
+        0x00C2DC06132030B8, 0x00C2E406132030BA, 0x00C2EC06132030BC, 0x00C2F406132030BE,
+        0x00C2FC06132030C0, 0x00C30406132030C2, 0x00C31006132030C5, 0x00C31806132030C7,
+        0x00C32006132030C9, 0x00C33C06132030D0, 0x00C33C06134030D1, 0x00C34806132030D3,
+        0x00C34806134030D4, 0x00C35406132030D6, 0x00C35406134030D7, 0x00C36006132030D9,
+        0x00C36006134030DA, 0x00C36C06132030DC, 0x00C36C06134030DD, 0x00C3BC06132030F7,
+        0x00C3C006132030F8, 0x00C3C406132030F9, 0x00C3C806132030FA, 0x00C3F406132030FE,
+        0x044264221741109A, 0x04426C221741109C, 0x04429422174110AB, 0x0444C42224E1112E,
+        0x0444C82224E1112F, 0x044D1C2267C1134B, 0x044D1C226AE1134C, 0x0452E422960114BC,
+        0x0452E422974114BB, 0x0452E42297A114BE, 0x0456E022B5E115BA, 0x0456E422B5E115BB,
+        0x0464D42326011938,
+    };
+};
+
+template <typename T>
+constexpr std::uint64_t composition_tables<T>::pairs[];
+
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,1817 @@
+
+// Generated by tools/ucdgen.cpp -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_PROPERTY_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_PROPERTY_TABLES_HPP_INCLUDED
+
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+
+/// The Unicode General_Category property
+enum class general_category : std::uint8_t {
+    uppercase_letter, ///< Lu
+    lowercase_letter, ///< Ll
+    titlecase_letter, ///< Lt
+    modifier_letter, ///< Lm
+    other_letter, ///< Lo
+    nonspacing_mark, ///< Mn
+    spacing_mark, ///< Mc
+    enclosing_mark, ///< Me
+    decimal_number, ///< Nd
+    letter_number, ///< Nl
+    other_number, ///< No
+    connector_punctuation, ///< Pc
+    dash_punctuation, ///< Pd
+    open_punctuation, ///< Ps
+    close_punctuation, ///< Pe
+    initial_punctuation, ///< Pi
+    final_punctuation, ///< Pf
+    other_punctuation, ///< Po
+    math_symbol, ///< Sm
+    currency_symbol, ///< Sc
+    modifier_symbol, ///< Sk
+    other_symbol, ///< So
+    space_separator, ///< Zs
+    line_separator, ///< Zl
+    paragraph_separator, ///< Zp
+    control, ///< Cc
+    format, ///< Cf
+    surrogate, ///< Cs
+    private_use, ///< Co
+    unassigned, ///< Cn
+};
+
+/// The Unicode Script property
+enum class script : std::uint8_t {
+    unknown,
+    common,
+    inherited,
+    adlam,
+    ahom,
+    anatolian_hieroglyphs,
+    arabic,
+    armenian,
+    avestan,
+    balinese,
+    bamum,
+    bassa_vah,
+    batak,
+    bengali,
+    bhaiksuki,
+    bopomofo,
+    brahmi,
+    braille,
+    buginese,
+    buhid,
+    canadian_aboriginal,
+    carian,
+    caucasian_albanian,
+    chakma,
+    cham,
+    cherokee,
+    chorasmian,
+    coptic,
+    cuneiform,
+    cypriot,
+    cypro_minoan,
+    cyrillic,
+    deseret,
+    devanagari,
+    dives_akuru,
+    dogra,
+    duployan,
+    egyptian_hieroglyphs,
+    elbasan,
+    elymaic,
+    ethiopic,
+    georgian,
+    glagolitic,
+    gothic,
+    grantha,
+    greek,
+    gujarati,
+    gunjala_gondi,
+    gurmukhi,
+    han,
+    hangul,
+    hanifi_rohingya,
+    hanunoo,
+    hatran,
+    hebrew,
+    hiragana,
+    imperial_aramaic,
+    inscriptional_pahlavi,
+    inscriptional_parthian,
+    javanese,
+    kaithi,
+    kannada,
+    katakana,
+    kayah_li,
+    kharoshthi,
+    khitan_small_script,
+    khmer,
+    khojki,
+    khudawadi,
+    lao,
+    latin,
+    lepcha,
+    limbu,
+    linear_a,
+    linear_b,
+    lisu,
+    lycian,
+    lydian,
+    mahajani,
+    makasar,
+    malayalam,
+    mandaic,
+    manichaean,
+    marchen,
+    masaram_gondi,
+    medefaidrin,
+    meetei_mayek,
+    mende_kikakui,
+    meroitic_cursive,
+    meroitic_hieroglyphs,
+    miao,
+    modi,
+    mongolian,
+    mro,
+    multani,
+    myanmar,
+    nabataean,
+    nandinagari,
+    new_tai_lue,
+    newa,
+    nko,
+    nushu,
+    nyiakeng_puachue_hmong,
+    ogham,
+    ol_chiki,
+    old_hungarian,
+    old_italic,
+    old_north_arabian,
+    old_permic,
+    old_persian,
+    old_sogdian,
+    old_south_arabian,
+    old_turkic,
+    old_uyghur,
+    oriya,
+    osage,
+    osmanya,
+    pahawh_hmong,
+    palmyrene,
+    pau_cin_hau,
+    phags_pa,
+    phoenician,
+    psalter_pahlavi,
+    rejang,
+    runic,
+    samaritan,
+    saurashtra,
+    sharada,
+    shavian,
+    siddham,
+    signwriting,
+    sinhala,
+    sogdian,
+    sora_sompeng,
+    soyombo,
+    sundanese,
+    syloti_nagri,
+    syriac,
+    tagalog,
+    tagbanwa,
+    tai_le,
+    tai_tham,
+    tai_viet,
+    takri,
+    tamil,
+    tangsa,
+    tangut,
+    telugu,
+    thaana,
+    thai,
+    tibetan,
+    tifinagh,
+    tirhuta,
+    toto,
+    ugaritic,
+    vai,
+    vithkuqi,
+    wancho,
+    warang_citi,
+    yezidi,
+    yi,
+    zanabazar_square,
+};
+
+/// The Unicode East_Asian_Width property
+enum class east_asian_width : std::uint8_t {
+    neutral, ///< N
+    ambiguous, ///< A
+    halfwidth, ///< H
+    wide, ///< W
+    fullwidth, ///< F
+    narrow, ///< Na
+};
+
+namespace detail {
+
+// Bits of the binary properties in a property record
+enum property_flag : std::uint32_t {
+    flag_white_space = 1u << 24, // White_Space
+    flag_alphabetic = 1u << 25, // Alphabetic
+    flag_lowercase = 1u << 26, // Lowercase
+    flag_uppercase = 1u << 27, // Uppercase
+    flag_default_ignorable = 1u << 28, // Default_Ignorable_Code_Point
+    flag_emoji = 1u << 29, // Emoji
+    flag_emoji_presentation = 1u << 30, // Emoji_Presentation
+    flag_extended_pictographic = 1u << 31, // Extended_Pictographic
+};
+
+// The properties of each code point are packed into a record, as
+// general_category | script << 8 | east_asian_width << 16 | flags
+
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+// The tables are static members of a class template so that they may be
+// defined in a header and used in constant expressions.
+template <typename = void>
+struct property_tables {
+    static constexpr int shift1 = 5;
+    static constexpr int shift2 = 3;
+
+    static constexpr std::uint8_t stage1[4352] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+        48, 49, 50, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        54, 55, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 52, 68, 69, 70, 71, 72, 73,
+        74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+        90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+        106, 106, 106, 107, 108, 109, 101, 101, 101, 101, 101, 101, 101, 101, 101, 110,
+        111, 111, 111, 111, 112, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 113, 113, 114, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 115, 115, 116, 117, 101, 101, 118, 119,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 121, 120, 120, 120, 122, 123, 124, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 125,
+        126, 127, 128, 101, 101, 101, 101, 101, 101, 101, 101, 101, 129, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 130,
+        131, 132, 133, 134, 135, 136, 137, 138, 139, 139, 140, 101, 101, 101, 101, 141,
+        142, 143, 144, 101, 101, 101, 101, 145, 146, 147, 101, 101, 148, 149, 150, 101,
+        151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 163, 163, 164,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 165, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 166, 167, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 168, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 169, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 52, 52, 171, 170, 170, 170, 170, 172,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 173, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 172,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        174, 175, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 177,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 177,
+    };
+
+    static constexpr std::uint16_t stage2[5696] = {
+        0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+        12, 0, 0, 0, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 28, 30, 31, 32, 33, 34, 26, 29, 28, 26, 35,
+        36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 26, 26, 48, 26,
+        26, 26, 26, 26, 26, 26, 49, 50, 51, 26, 52, 53, 52, 53, 53, 53,
+        53, 53, 54, 53, 53, 53, 55, 56, 57, 58, 59, 60, 61, 62, 63, 63,
+        64, 64, 64, 64, 64, 64, 64, 64, 65, 66, 64, 64, 64, 64, 67, 68,
+        69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+        85, 86, 87, 87, 87, 87, 88, 88, 88, 88, 89, 90, 91, 91, 91, 91,
+        92, 93, 91, 91, 91, 91, 91, 91, 94, 95, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 96, 97, 97, 97, 98, 99, 100, 100, 100, 100,
+        100, 101, 102, 103, 103, 103, 104, 105, 106, 107, 108, 108, 108, 109, 110, 107,
+        111, 112, 113, 114, 115, 115, 115, 115, 116, 117, 118, 119, 120, 121, 122, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 123, 124, 125, 126, 120, 127,
+        128, 129, 130, 131, 131, 131, 132, 132, 133, 134, 115, 115, 115, 115, 115, 115,
+        135, 135, 135, 135, 136, 137, 138, 107, 139, 140, 141, 141, 141, 142, 143, 144,
+        145, 145, 146, 147, 148, 149, 150, 151, 152, 152, 152, 153, 131, 154, 115, 115,
+        115, 155, 156, 157, 115, 115, 115, 115, 115, 158, 159, 113, 160, 161, 113, 113,
+        162, 163, 163, 163, 163, 163, 163, 164, 165, 166, 167, 163, 168, 169, 170, 163,
+        171, 172, 173, 174, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+        186, 187, 188, 189, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 107,
+        200, 201, 202, 203, 203, 204, 205, 206, 207, 208, 209, 107, 210, 211, 212, 213,
+        214, 215, 216, 217, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 107,
+        228, 229, 230, 231, 232, 229, 233, 234, 235, 236, 237, 107, 238, 239, 240, 241,
+        242, 243, 244, 245, 245, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+        255, 256, 257, 258, 258, 257, 259, 260, 261, 262, 263, 264, 265, 266, 267, 107,
+        268, 269, 270, 271, 271, 271, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+        281, 282, 283, 284, 282, 282, 285, 286, 283, 287, 288, 289, 290, 291, 292, 107,
+        293, 294, 294, 294, 294, 294, 295, 296, 297, 298, 299, 300, 107, 107, 107, 107,
+        301, 302, 303, 303, 304, 303, 305, 306, 307, 308, 309, 310, 107, 107, 107, 107,
+        311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 319, 319, 319, 321, 322, 323,
+        324, 325, 326, 322, 326, 326, 326, 327, 328, 329, 330, 331, 107, 107, 107, 107,
+        332, 332, 332, 332, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 332,
+        343, 344, 336, 345, 346, 346, 346, 346, 347, 348, 349, 349, 349, 349, 349, 350,
+        351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 352, 353, 354, 354, 354,
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        355, 355, 355, 355, 355, 355, 355, 355, 355, 356, 357, 356, 355, 355, 355, 355,
+        355, 356, 355, 355, 355, 355, 356, 357, 356, 355, 357, 355, 355, 355, 355, 355,
+        355, 355, 356, 355, 355, 355, 355, 355, 355, 355, 355, 358, 359, 360, 361, 362,
+        355, 355, 363, 364, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 366, 367,
+        368, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369,
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369,
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369,
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369,
+        369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 370, 369, 369,
+        371, 372, 372, 373, 374, 374, 374, 374, 374, 374, 374, 374, 374, 375, 376, 377,
+        378, 378, 379, 380, 381, 381, 382, 107, 383, 383, 384, 107, 385, 386, 387, 107,
+        388, 388, 388, 388, 388, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+        399, 400, 401, 402, 403, 403, 403, 403, 404, 403, 403, 403, 403, 403, 403, 405,
+        406, 403, 403, 403, 403, 407, 369, 369, 369, 369, 369, 369, 369, 369, 408, 107,
+        409, 409, 409, 410, 411, 412, 413, 414, 415, 416, 417, 417, 417, 418, 419, 107,
+        420, 420, 420, 420, 420, 421, 420, 420, 420, 422, 423, 424, 425, 425, 425, 425,
+        426, 426, 427, 428, 429, 429, 429, 429, 429, 429, 430, 431, 432, 433, 434, 435,
+        436, 437, 436, 437, 438, 439, 440, 441, 442, 443, 107, 107, 107, 107, 107, 107,
+        444, 445, 445, 445, 445, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+        456, 457, 457, 457, 458, 459, 460, 461, 462, 462, 462, 462, 463, 464, 465, 466,
+        467, 467, 467, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 476, 476, 477,
+        90, 478, 346, 346, 346, 346, 346, 479, 480, 107, 481, 440, 482, 483, 484, 485,
+        53, 53, 53, 53, 486, 487, 55, 55, 55, 55, 55, 488, 489, 490, 53, 491,
+        53, 53, 53, 492, 55, 55, 55, 493, 440, 440, 440, 440, 494, 495, 496, 440,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 497, 498, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        499, 500, 501, 502, 499, 500, 499, 500, 501, 502, 499, 503, 499, 500, 499, 501,
+        499, 504, 499, 504, 499, 504, 505, 506, 507, 508, 509, 510, 499, 511, 512, 513,
+        514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+        530, 531, 55, 532, 533, 534, 533, 533, 535, 107, 440, 536, 537, 440, 538, 107,
+        539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+        555, 556, 557, 558, 559, 560, 561, 562, 561, 563, 564, 561, 565, 561, 566, 567,
+        568, 569, 570, 571, 572, 573, 574, 575, 567, 576, 577, 567, 578, 579, 567, 567,
+        579, 567, 580, 581, 580, 567, 567, 582, 567, 567, 567, 567, 567, 567, 567, 567,
+        561, 583, 584, 585, 586, 587, 561, 561, 561, 561, 561, 561, 561, 561, 561, 588,
+        561, 589, 561, 590, 567, 567, 591, 561, 561, 592, 561, 566, 586, 593, 594, 595,
+        561, 561, 561, 561, 596, 107, 107, 107, 561, 597, 107, 107, 598, 598, 598, 598,
+        598, 598, 598, 599, 600, 600, 601, 602, 603, 602, 604, 604, 604, 605, 598, 598,
+        600, 600, 600, 600, 600, 600, 600, 600, 600, 606, 600, 600, 600, 600, 606, 561,
+        600, 600, 607, 561, 608, 609, 610, 611, 612, 613, 562, 561, 607, 565, 561, 614,
+        615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 621, 629,
+        630, 561, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+        645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 561, 656, 657, 658, 598,
+        659, 659, 660, 561, 649, 561, 650, 661, 662, 567, 567, 567, 663, 664, 567, 567,
+        665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        567, 567, 567, 567, 567, 567, 666, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+        667, 668, 668, 669, 567, 567, 567, 567, 567, 567, 567, 670, 567, 567, 567, 671,
+        567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+        567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+        672, 561, 561, 673, 561, 561, 567, 567, 674, 675, 676, 562, 561, 561, 677, 561,
+        561, 561, 678, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+        679, 679, 679, 679, 679, 679, 680, 680, 680, 680, 680, 680, 681, 682, 683, 684,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 685, 686, 687, 688,
+        349, 349, 349, 349, 689, 690, 691, 691, 691, 691, 691, 691, 691, 692, 693, 694,
+        355, 355, 357, 107, 357, 357, 357, 357, 357, 357, 357, 357, 695, 695, 695, 695,
+        696, 697, 698, 699, 700, 701, 702, 703, 704, 702, 705, 706, 107, 107, 107, 107,
+        707, 707, 707, 708, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 709, 107,
+        707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707,
+        707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 710, 107, 107, 107, 711, 712,
+        713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 722, 722, 722, 722, 722, 722,
+        722, 722, 723, 724, 725, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 727,
+        728, 729, 729, 729, 729, 729, 730, 351, 351, 351, 351, 351, 731, 351, 351, 351,
+        351, 732, 733, 711, 729, 729, 729, 729, 711, 711, 711, 711, 712, 107, 726, 726,
+        734, 734, 734, 735, 736, 737, 711, 711, 711, 598, 738, 736, 734, 734, 734, 739,
+        736, 737, 740, 741, 711, 711, 738, 736, 711, 711, 742, 742, 742, 742, 742, 743,
+        742, 742, 742, 742, 742, 742, 742, 742, 742, 742, 742, 711, 711, 711, 711, 711,
+        711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711, 711,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 561, 561, 561, 561, 561, 561, 561, 561,
+        745, 745, 746, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        745, 747, 748, 748, 748, 748, 748, 748, 749, 107, 750, 750, 750, 750, 750, 751,
+        752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752,
+        752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752,
+        752, 753, 752, 752, 754, 755, 107, 107, 91, 91, 91, 91, 91, 756, 757, 758,
+        91, 91, 91, 759, 760, 760, 760, 760, 760, 760, 760, 760, 761, 762, 763, 107,
+        63, 63, 764, 765, 766, 26, 767, 26, 26, 26, 26, 26, 26, 26, 768, 769,
+        26, 770, 771, 26, 26, 772, 773, 26, 774, 775, 776, 777, 107, 107, 778, 779,
+        780, 781, 782, 782, 783, 784, 785, 786, 787, 787, 787, 787, 787, 787, 788, 107,
+        789, 790, 790, 790, 790, 790, 791, 792, 793, 794, 795, 796, 797, 797, 798, 799,
+        800, 801, 802, 802, 803, 804, 805, 805, 806, 807, 808, 809, 351, 351, 351, 810,
+        811, 812, 812, 812, 812, 812, 813, 814, 815, 816, 817, 818, 819, 332, 336, 820,
+        821, 821, 821, 821, 821, 822, 823, 107, 824, 825, 826, 827, 332, 332, 828, 829,
+        830, 830, 830, 830, 830, 830, 831, 832, 833, 107, 107, 834, 835, 836, 837, 107,
+        838, 838, 838, 107, 357, 357, 53, 53, 53, 53, 53, 839, 840, 841, 842, 842,
+        842, 842, 842, 842, 842, 842, 842, 842, 835, 835, 835, 835, 843, 844, 845, 846,
+        351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+        351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+        351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+        351, 351, 351, 351, 847, 107, 354, 354, 848, 849, 354, 354, 354, 354, 354, 850,
+        851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+        851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+        852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852,
+        852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 853, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 854, 855, 855, 855, 855,
+        856, 107, 857, 858, 108, 859, 860, 861, 862, 108, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 863, 864, 865, 107, 866, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 867, 868, 868, 115, 115, 115, 115, 115, 115,
+        115, 115, 869, 115, 115, 115, 115, 115, 115, 870, 107, 107, 107, 107, 115, 871,
+        872, 872, 873, 874, 440, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 885,
+        886, 887, 888, 889, 890, 891, 891, 892, 893, 894, 894, 895, 896, 897, 898, 897,
+        897, 897, 897, 899, 900, 901, 901, 902, 903, 903, 903, 904, 905, 906, 907, 908,
+        909, 910, 909, 909, 911, 909, 909, 912, 909, 913, 909, 913, 107, 107, 107, 107,
+        909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 914,
+        915, 659, 659, 659, 659, 659, 916, 561, 917, 917, 917, 917, 917, 917, 918, 919,
+        920, 921, 561, 922, 923, 107, 107, 107, 107, 107, 561, 561, 561, 561, 561, 924,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        925, 925, 925, 926, 927, 927, 927, 927, 927, 927, 928, 107, 929, 659, 659, 930,
+        931, 931, 931, 931, 932, 933, 934, 934, 935, 936, 937, 937, 937, 937, 938, 939,
+        940, 940, 940, 941, 942, 942, 942, 942, 943, 942, 944, 107, 107, 107, 107, 107,
+        945, 945, 945, 945, 945, 946, 946, 946, 946, 946, 947, 947, 947, 947, 947, 947,
+        948, 948, 948, 949, 950, 951, 952, 952, 952, 952, 953, 954, 954, 954, 954, 955,
+        956, 956, 956, 956, 956, 107, 957, 957, 957, 957, 957, 957, 958, 959, 960, 961,
+        960, 961, 962, 963, 964, 963, 964, 965, 107, 107, 107, 107, 107, 107, 107, 107,
+        966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966,
+        966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966,
+        966, 966, 966, 966, 966, 966, 967, 107, 966, 966, 968, 107, 966, 107, 107, 107,
+        969, 55, 55, 55, 55, 55, 970, 971, 107, 107, 107, 107, 107, 107, 107, 107,
+        972, 973, 974, 974, 974, 974, 975, 976, 977, 977, 978, 979, 980, 980, 981, 982,
+        983, 983, 983, 984, 985, 986, 107, 107, 107, 107, 107, 107, 987, 987, 988, 989,
+        990, 990, 991, 992, 993, 993, 993, 994, 107, 107, 107, 107, 107, 107, 107, 107,
+        995, 995, 995, 995, 996, 996, 996, 997, 998, 998, 999, 998, 998, 998, 998, 998,
+        1000, 1001, 1002, 1003, 1004, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1011, 1011, 1012,
+        1013, 1013, 1013, 1014, 107, 107, 107, 107, 1015, 1016, 1015, 1015, 1017, 1018, 1019, 107,
+        1020, 1020, 1020, 1020, 1020, 1020, 1021, 1022, 1023, 1023, 1024, 1025, 1026, 1026, 1027, 1028,
+        1029, 1029, 1030, 1031, 107, 1032, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1034, 107, 107, 107, 107, 107, 107,
+        1035, 1035, 1035, 1035, 1035, 1035, 1036, 107, 1037, 1037, 1037, 1037, 1037, 1037, 1038, 1039,
+        1040, 1040, 1040, 1040, 1041, 107, 1042, 1043, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 1044, 1044, 1044, 1045,
+        1046, 1046, 1046, 1046, 1046, 1047, 1048, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1049, 1049, 1049, 1050, 1051, 107, 1052, 1052, 1053, 1054, 1055, 1056, 107, 107, 1057, 1057,
+        1058, 1059, 107, 107, 107, 107, 1060, 1060, 1061, 1062, 107, 107, 1063, 1063, 1064, 107,
+        1065, 1066, 1066, 1066, 1066, 1066, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
+        1076, 1077, 1077, 1077, 1077, 1077, 1078, 1079, 1080, 1081, 1082, 1082, 1082, 1083, 1084, 1085,
+        1086, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 107, 1093, 1093, 1093, 1093, 1094, 107,
+        1095, 1096, 1096, 1096, 1096, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 107,
+        1106, 1106, 1107, 1106, 1106, 1108, 1109, 1110, 107, 107, 107, 107, 107, 107, 107, 107,
+        1111, 1112, 1113, 1114, 1113, 1115, 1116, 1116, 1116, 1116, 1116, 1117, 1118, 1119, 1120, 1121,
+        1122, 1123, 1124, 1125, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1134, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 107, 107, 107,
+        1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 107, 1147, 1148, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1149, 1149, 1149, 1149, 1149, 1150, 1151, 1152, 1153, 1154, 1154, 1155, 107, 107, 107, 107,
+        1156, 1156, 1156, 1156, 1156, 1156, 1157, 1158, 1159, 107, 1160, 1161, 1162, 1163, 107, 107,
+        1164, 1164, 1164, 1164, 1164, 1165, 1166, 1167, 1168, 1169, 107, 107, 107, 107, 107, 107,
+        1170, 1170, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1177, 1177, 1177, 1177, 1177, 1178, 1179, 1180, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 1181, 1181, 1181, 1181, 1182, 1182, 1182, 1182, 1183, 1184, 1185, 1186,
+        1187, 1188, 1189, 1190, 1190, 1190, 1191, 1192, 1193, 107, 1194, 1195, 107, 107, 107, 107,
+        107, 107, 107, 107, 1196, 1197, 1196, 1196, 1196, 1196, 1198, 1199, 1200, 107, 107, 107,
+        1201, 1202, 1203, 1203, 1203, 1203, 1204, 1205, 1206, 107, 1207, 1208, 1209, 1209, 1209, 1209,
+        1209, 1210, 1211, 1212, 1213, 107, 369, 369, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1216, 1217, 1216, 1216, 1216, 1218, 1219, 1220, 1221, 107, 1222, 1223, 1224, 1225, 1226, 1227,
+        1227, 1227, 1228, 1229, 1229, 1230, 1231, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1232, 1233, 1234, 1234, 1234, 1234, 1235, 1236, 1237, 107, 1238, 1239, 1240, 1241, 1242, 1242,
+        1242, 1243, 1244, 1245, 1246, 1247, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 1248, 1248, 1249, 1250,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 1251, 107, 1252, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
+        1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259,
+        1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259,
+        1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259,
+        1259, 1259, 1259, 1260, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1263, 107,
+        1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259,
+        1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1264, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 107,
+        1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267,
+        1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267,
+        1267, 1267, 1267, 1267, 1267, 1268, 1269, 1270, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271,
+        1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271,
+        1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760,
+        760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760,
+        760, 760, 760, 760, 760, 760, 760, 1273, 1274, 1274, 1274, 1275, 1276, 1277, 1278, 1278,
+        1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1280, 1281, 1282, 1282, 1282, 1283, 1284, 107,
+        1285, 1285, 1285, 1285, 1285, 1285, 1286, 1287, 1288, 107, 1289, 1290, 1291, 1285, 1285, 1292,
+        1285, 1285, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294,
+        1295, 1295, 1296, 1297, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1301, 1301, 1301, 1301,
+        1301, 1302, 1303, 1304, 107, 107, 107, 107, 107, 107, 107, 107, 1305, 107, 1306, 107,
+        1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,
+        1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,
+        1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,
+        1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 107,
+        1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+        1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+        1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+        1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 107, 107, 107, 107, 107,
+        1307, 1310, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 1311, 1312,
+        1313, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722,
+        722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722, 722,
+        722, 722, 722, 722, 1314, 107, 107, 107, 107, 107, 1315, 107, 1316, 107, 1317, 1317,
+        1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
+        1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317,
+        1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1318,
+        1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1320, 1319, 1321,
+        1319, 1322, 1319, 1323, 1324, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        440, 440, 440, 440, 440, 1325, 440, 440, 1326, 107, 561, 561, 561, 561, 561, 561,
+        561, 561, 561, 561, 561, 561, 561, 561, 1327, 107, 107, 107, 107, 107, 107, 107,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 1328, 107,
+        561, 561, 561, 561, 596, 1329, 561, 561, 561, 561, 561, 561, 1330, 1331, 1332, 1333,
+        1334, 1335, 561, 561, 561, 1336, 561, 561, 561, 561, 561, 561, 561, 597, 107, 107,
+        920, 920, 920, 920, 920, 920, 920, 920, 1337, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 659, 659, 930, 107,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 596, 107, 659, 659, 659, 1338,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1339, 1339, 1339, 1340, 1341, 1341, 1342, 1339, 1339, 1343, 1344, 1341, 1341, 1339, 1339, 1339,
+        1340, 1341, 1341, 1345, 1346, 1347, 1343, 1348, 1349, 1341, 1339, 1339, 1339, 1340, 1341, 1341,
+        1350, 1351, 1352, 1353, 1341, 1341, 1341, 1354, 1355, 1356, 1357, 1341, 1341, 1342, 1339, 1339,
+        1343, 1341, 1341, 1341, 1339, 1339, 1339, 1340, 1341, 1341, 1342, 1339, 1339, 1343, 1341, 1341,
+        1341, 1339, 1339, 1339, 1340, 1341, 1341, 1342, 1339, 1339, 1343, 1341, 1341, 1341, 1339, 1339,
+        1339, 1340, 1341, 1341, 1358, 1339, 1339, 1339, 1359, 1341, 1341, 1360, 1361, 1339, 1339, 1362,
+        1341, 1341, 1363, 1342, 1339, 1339, 1364, 1341, 1341, 1365, 1366, 1339, 1339, 1367, 1341, 1341,
+        1341, 1368, 1339, 1339, 1339, 1359, 1341, 1341, 1360, 1369, 1370, 1370, 1370, 1370, 1370, 1370,
+        1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+        1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+        1372, 1372, 1372, 1372, 1372, 1372, 1373, 1374, 1372, 1372, 1372, 1372, 1372, 1375, 1376, 1371,
+        1377, 1378, 107, 1379, 1380, 1372, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        53, 1381, 53, 856, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1382, 1383, 1383, 1384, 1385, 1386, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1387, 1387, 1387, 1387, 1387, 1388, 1389, 1390, 1391, 1392, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 1393, 1393, 1393, 1394, 107, 107, 1395, 1395, 1395, 1395, 1395, 1396, 1397, 1398,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 357, 1399, 355, 357,
+        1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,
+        1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400, 1401, 1402, 1403, 107, 107, 107, 107, 107,
+        1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1407, 1408, 1409, 1410, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 1411, 659,
+        659, 659, 659, 659, 659, 1412, 1413, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1411, 659, 659, 659, 659, 1414, 659, 1415, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        1416, 115, 115, 115, 1417, 1418, 1419, 1420, 1421, 1422, 1417, 1423, 1417, 1419, 1419, 1424,
+        115, 1425, 115, 1426, 1427, 1425, 115, 1426, 107, 107, 107, 107, 107, 107, 1428, 107,
+        1429, 621, 621, 621, 621, 1430, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+        621, 621, 1430, 1431, 621, 1432, 1433, 621, 1433, 1434, 1433, 621, 621, 621, 1435, 1431,
+        598, 1436, 600, 600, 600, 1437, 602, 602, 602, 1438, 602, 602, 602, 1439, 1440, 1441,
+        602, 1442, 1443, 1444, 600, 1445, 1431, 1431, 1431, 1431, 1431, 1431, 1446, 1447, 1447, 1447,
+        1448, 1431, 711, 1449, 711, 1450, 1451, 1452, 711, 1453, 1454, 1431, 1455, 1431, 1431, 1431,
+        1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+        624, 624, 624, 624, 1456, 1457, 1458, 624, 624, 624, 624, 624, 624, 624, 624, 1459,
+        624, 624, 1460, 1461, 624, 624, 624, 624, 624, 1462, 1463, 1464, 624, 624, 1465, 1466,
+        624, 624, 624, 624, 624, 624, 624, 1467, 1468, 624, 624, 624, 624, 624, 624, 624,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 1469,
+        624, 624, 624, 624, 624, 624, 624, 1470, 1471, 1472, 624, 624, 624, 626, 1473, 1474,
+        626, 1475, 1476, 621, 1477, 1478, 1479, 1480, 1481, 621, 1482, 1483, 1484, 1485, 1486, 1487,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 561, 561, 561, 561, 561, 561,
+        624, 624, 624, 624, 624, 624, 624, 624, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 1496, 1431,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 1497, 1498, 624, 1499, 1500, 1431,
+        561, 1496, 561, 561, 561, 561, 561, 561, 561, 1431, 561, 1501, 561, 561, 561, 561,
+        561, 1431, 561, 561, 561, 1502, 1503, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+        561, 1504, 624, 624, 624, 624, 624, 1505, 1506, 624, 624, 624, 624, 624, 624, 624,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624,
+        621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 1430, 1431, 621, 1435, 1495, 1495,
+        1507, 1431, 624, 624, 624, 1495, 624, 1508, 1509, 1431, 624, 1454, 624, 1431, 1507, 1431,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+        561, 561, 1510, 561, 561, 561, 561, 561, 561, 597, 107, 107, 107, 107, 1370, 1511,
+        1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+        1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+        1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+        1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1512,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 855, 855, 855, 855,
+        744, 744, 744, 744, 744, 744, 744, 1513, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 853, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 854, 855, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 744, 1513, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        744, 744, 744, 853, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 1514,
+        744, 744, 744, 744, 744, 744, 744, 744, 744, 1515, 855, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+        1516, 907, 907, 907, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+        907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+        872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+        872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 907, 907,
+        907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+        907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+        852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852,
+        852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 1517,
+    };
+
+    static constexpr std::uint16_t stage3[12144] = {
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 403, 403, 403, 403, 403, 16, 16,
+        406, 395, 395, 793, 397, 395, 395, 395, 393, 394, 793, 396, 395, 392, 395, 395,
+        792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 395, 395, 396, 396, 396, 395,
+        395, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+        779, 779, 779, 393, 395, 394, 398, 391, 398, 755, 755, 755, 755, 755, 755, 755,
+        755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 393, 396, 394, 396, 16,
+        16, 16, 16, 16, 16, 403, 16, 16, 400, 349, 397, 397, 351, 397, 399, 349,
+        352, 803, 752, 9, 396, 787, 805, 398, 353, 350, 345, 345, 352, 724, 349, 349,
+        352, 345, 752, 10, 345, 345, 345, 349, 766, 766, 766, 766, 766, 766, 776, 766,
+        766, 766, 766, 766, 766, 766, 766, 766, 776, 766, 766, 766, 766, 766, 766, 350,
+        776, 766, 766, 766, 766, 766, 776, 750, 750, 750, 737, 737, 737, 737, 750, 737,
+        750, 750, 750, 737, 750, 750, 737, 737, 750, 737, 750, 750, 737, 737, 737, 350,
+        750, 750, 750, 737, 750, 737, 750, 737, 766, 750, 766, 737, 766, 737, 766, 737,
+        766, 737, 766, 737, 766, 737, 766, 737, 766, 750, 766, 750, 766, 737, 766, 737,
+        766, 737, 766, 750, 766, 737, 766, 737, 766, 737, 766, 737, 766, 737, 776, 750,
+        766, 750, 776, 750, 766, 737, 766, 737, 750, 766, 737, 766, 737, 766, 737, 776,
+        750, 776, 750, 766, 750, 766, 737, 766, 750, 750, 776, 750, 766, 750, 766, 737,
+        766, 737, 776, 750, 766, 737, 766, 737, 766, 766, 737, 766, 737, 766, 737, 737,
+        737, 766, 766, 737, 766, 737, 766, 766, 737, 766, 766, 766, 737, 737, 766, 766,
+        766, 766, 737, 766, 766, 737, 766, 766, 766, 737, 737, 737, 766, 766, 737, 766,
+        766, 737, 766, 737, 766, 737, 766, 766, 737, 766, 737, 737, 766, 737, 766, 766,
+        737, 766, 766, 766, 737, 766, 737, 766, 766, 737, 737, 534, 766, 737, 737, 737,
+        534, 534, 534, 534, 766, 532, 737, 766, 532, 737, 766, 532, 737, 766, 750, 766,
+        750, 766, 750, 766, 750, 766, 750, 766, 750, 766, 750, 766, 750, 737, 766, 737,
+        737, 766, 532, 737, 766, 737, 766, 766, 766, 737, 766, 737, 737, 737, 737, 737,
+        737, 737, 766, 766, 737, 766, 766, 737, 737, 766, 737, 766, 766, 766, 766, 737,
+        737, 750, 737, 737, 737, 737, 737, 737, 737, 737, 737, 737, 737, 737, 737, 737,
+        737, 737, 737, 737, 534, 737, 737, 737, 738, 738, 738, 738, 738, 738, 738, 738,
+        738, 407, 407, 407, 407, 407, 407, 407, 725, 725, 14, 14, 352, 14, 407, 701,
+        407, 701, 701, 701, 407, 701, 407, 407, 701, 407, 14, 14, 14, 14, 14, 14,
+        352, 352, 352, 352, 14, 352, 14, 352, 738, 738, 738, 738, 738, 14, 14, 14,
+        14, 14, 64, 64, 407, 14, 407, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 747, 354, 354,
+        354, 354, 354, 354, 354, 354, 354, 788, 765, 735, 765, 735, 407, 113, 765, 735,
+        0, 0, 736, 735, 735, 735, 11, 765, 0, 0, 0, 0, 113, 14, 765, 11,
+        765, 765, 765, 0, 765, 0, 765, 765, 735, 775, 775, 775, 775, 775, 775, 775,
+        775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 0, 775, 775, 775, 775, 775,
+        775, 775, 765, 765, 735, 735, 735, 735, 735, 749, 749, 749, 749, 749, 749, 749,
+        749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 735, 749, 749, 749, 749, 749,
+        749, 749, 735, 735, 735, 735, 735, 765, 735, 735, 765, 765, 765, 735, 735, 735,
+        765, 735, 765, 735, 765, 735, 765, 735, 765, 735, 760, 729, 760, 729, 760, 729,
+        760, 729, 760, 729, 760, 729, 760, 729, 735, 735, 735, 735, 765, 735, 112, 765,
+        735, 765, 765, 735, 735, 765, 765, 765, 761, 774, 761, 761, 761, 761, 761, 761,
+        761, 761, 761, 761, 761, 761, 761, 761, 774, 774, 774, 774, 774, 774, 774, 774,
+        748, 748, 748, 748, 748, 748, 748, 748, 730, 748, 730, 730, 730, 730, 730, 730,
+        730, 730, 730, 730, 730, 730, 730, 730, 761, 730, 761, 730, 761, 730, 761, 730,
+        761, 730, 90, 87, 87, 18, 18, 87, 88, 88, 761, 730, 761, 730, 761, 730,
+        761, 761, 730, 761, 730, 761, 730, 761, 730, 761, 730, 761, 730, 761, 730, 730,
+        0, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758,
+        758, 758, 758, 758, 758, 758, 758, 0, 0, 419, 38, 38, 38, 38, 38, 38,
+        727, 727, 727, 727, 727, 727, 727, 727, 727, 38, 37, 0, 0, 40, 40, 39,
+        0, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 128, 502,
+        129, 502, 502, 129, 502, 502, 129, 502, 0, 0, 0, 0, 0, 0, 0, 0,
+        501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 0, 0, 0, 0, 501,
+        501, 501, 501, 129, 129, 0, 0, 0, 36, 36, 36, 36, 36, 17, 32, 32,
+        32, 31, 31, 33, 11, 31, 35, 35, 418, 418, 418, 418, 418, 418, 418, 418,
+        418, 418, 418, 11, 783, 31, 31, 11, 417, 417, 417, 417, 417, 417, 417, 417,
+        407, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 409, 409, 409, 409, 409,
+        409, 409, 409, 409, 409, 409, 418, 418, 28, 418, 418, 418, 418, 418, 418, 418,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 31, 31, 31, 31, 417, 417,
+        409, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 31, 417, 418, 418,
+        418, 418, 418, 418, 418, 17, 35, 28, 28, 418, 418, 418, 418, 416, 416, 418,
+        418, 35, 28, 28, 28, 418, 417, 417, 29, 29, 417, 417, 417, 35, 35, 417,
+        291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 0, 292,
+        653, 654, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653,
+        654, 654, 654, 654, 654, 654, 654, 654, 290, 290, 290, 290, 290, 290, 290, 290,
+        290, 290, 290, 0, 0, 653, 653, 653, 677, 677, 677, 677, 677, 677, 677, 677,
+        677, 677, 677, 677, 677, 677, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+        678, 677, 0, 0, 0, 0, 0, 0, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594,
+        594, 594, 594, 220, 220, 220, 220, 220, 220, 220, 220, 220, 593, 593, 224, 222,
+        222, 222, 593, 0, 0, 220, 223, 223, 627, 627, 627, 627, 627, 627, 627, 627,
+        627, 627, 627, 627, 627, 627, 628, 628, 260, 260, 626, 628, 628, 628, 628, 628,
+        628, 628, 628, 628, 626, 628, 628, 628, 626, 628, 628, 628, 628, 260, 0, 0,
+        261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 0,
+        555, 555, 555, 555, 555, 555, 555, 555, 555, 180, 180, 180, 0, 0, 181, 0,
+        653, 653, 653, 0, 0, 0, 0, 0, 34, 417, 417, 417, 417, 417, 417, 0,
+        36, 36, 0, 0, 0, 0, 0, 0, 28, 28, 28, 28, 28, 28, 28, 28,
+        417, 416, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 418, 418, 418, 418,
+        28, 28, 17, 418, 418, 418, 418, 418, 418, 418, 28, 28, 28, 28, 28, 28,
+        463, 463, 463, 464, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462,
+        462, 462, 463, 464, 91, 462, 464, 464, 464, 463, 463, 463, 463, 463, 463, 463,
+        463, 464, 464, 464, 464, 91, 464, 464, 462, 18, 18, 18, 18, 463, 463, 463,
+        462, 462, 463, 463, 11, 11, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+        93, 461, 462, 462, 462, 462, 462, 462, 430, 431, 432, 432, 0, 430, 430, 430,
+        430, 430, 430, 430, 430, 0, 0, 430, 430, 0, 0, 430, 430, 430, 430, 430,
+        430, 430, 430, 430, 430, 430, 430, 430, 430, 0, 430, 430, 430, 430, 430, 430,
+        430, 0, 430, 0, 0, 0, 430, 430, 430, 430, 0, 0, 54, 430, 432, 432,
+        432, 431, 431, 431, 431, 0, 0, 432, 432, 0, 0, 432, 432, 54, 430, 0,
+        0, 0, 0, 0, 0, 0, 0, 432, 0, 0, 0, 0, 430, 430, 0, 430,
+        430, 430, 431, 431, 0, 0, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        430, 430, 58, 58, 56, 56, 56, 56, 56, 56, 59, 58, 430, 57, 54, 0,
+        0, 493, 493, 494, 0, 492, 492, 492, 492, 492, 492, 0, 0, 0, 0, 492,
+        492, 0, 0, 492, 492, 492, 492, 492, 492, 492, 492, 492, 492, 492, 492, 492,
+        492, 0, 492, 492, 492, 492, 492, 492, 492, 0, 492, 492, 0, 492, 492, 0,
+        492, 492, 0, 0, 121, 0, 494, 494, 494, 493, 493, 0, 0, 0, 0, 493,
+        493, 0, 0, 493, 493, 121, 0, 0, 0, 493, 0, 0, 0, 0, 0, 0,
+        0, 492, 492, 492, 492, 0, 492, 0, 0, 0, 0, 0, 0, 0, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 493, 493, 492, 492, 492, 493, 123, 0,
+        0, 487, 487, 488, 0, 486, 486, 486, 486, 486, 486, 486, 486, 486, 0, 486,
+        486, 486, 0, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+        486, 0, 486, 486, 486, 486, 486, 486, 486, 0, 486, 486, 0, 486, 486, 486,
+        486, 486, 0, 0, 115, 486, 488, 488, 488, 487, 487, 487, 487, 487, 0, 487,
+        487, 488, 0, 488, 488, 115, 0, 0, 486, 0, 0, 0, 0, 0, 0, 0,
+        486, 486, 487, 487, 0, 0, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+        117, 118, 0, 0, 0, 0, 0, 0, 0, 486, 487, 487, 487, 115, 115, 115,
+        0, 611, 612, 612, 0, 610, 610, 610, 610, 610, 610, 610, 610, 0, 0, 610,
+        610, 0, 0, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+        610, 0, 610, 610, 610, 610, 610, 610, 610, 0, 610, 610, 0, 610, 610, 610,
+        610, 610, 0, 0, 241, 610, 612, 611, 612, 611, 611, 611, 611, 0, 0, 612,
+        612, 0, 0, 612, 612, 241, 0, 0, 0, 0, 0, 0, 0, 241, 611, 612,
+        0, 0, 0, 0, 610, 610, 0, 610, 610, 610, 611, 611, 0, 0, 242, 242,
+        242, 242, 242, 242, 242, 242, 242, 242, 244, 610, 243, 243, 243, 243, 243, 243,
+        0, 0, 671, 670, 0, 670, 670, 670, 670, 670, 670, 0, 0, 0, 670, 670,
+        670, 0, 670, 670, 670, 670, 0, 0, 0, 670, 670, 0, 670, 0, 670, 670,
+        0, 0, 0, 670, 670, 0, 0, 0, 670, 670, 670, 670, 670, 670, 670, 670,
+        670, 670, 0, 0, 0, 0, 672, 672, 671, 672, 672, 0, 0, 0, 672, 672,
+        672, 0, 672, 672, 672, 304, 0, 0, 670, 0, 0, 0, 0, 0, 0, 672,
+        0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+        306, 306, 306, 309, 309, 309, 309, 309, 309, 308, 309, 0, 0, 0, 0, 0,
+        675, 676, 676, 676, 311, 674, 674, 674, 674, 674, 674, 674, 674, 0, 674, 674,
+        674, 0, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674,
+        674, 674, 0, 0, 311, 674, 675, 675, 675, 676, 676, 676, 676, 0, 675, 675,
+        675, 0, 675, 675, 675, 311, 0, 0, 0, 0, 0, 0, 0, 675, 675, 0,
+        674, 674, 674, 0, 0, 674, 0, 0, 674, 674, 675, 675, 0, 0, 312, 312,
+        312, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0, 0, 0, 0, 0, 314,
+        313, 313, 313, 313, 313, 313, 313, 315, 512, 513, 514, 514, 144, 512, 512, 512,
+        512, 512, 512, 512, 512, 0, 512, 512, 512, 0, 512, 512, 512, 512, 512, 512,
+        512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 0, 512, 512, 512,
+        512, 512, 0, 0, 142, 512, 514, 513, 514, 514, 514, 514, 514, 0, 513, 514,
+        514, 0, 514, 514, 513, 142, 0, 0, 0, 0, 0, 0, 0, 514, 514, 0,
+        0, 0, 0, 0, 0, 512, 512, 0, 512, 512, 513, 513, 0, 0, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 0, 512, 512, 0, 0, 0, 0, 0,
+        553, 553, 554, 554, 552, 552, 552, 552, 552, 552, 552, 552, 552, 0, 552, 552,
+        552, 0, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+        552, 552, 552, 176, 176, 552, 554, 554, 554, 553, 553, 553, 553, 0, 554, 554,
+        554, 0, 554, 554, 554, 176, 552, 179, 0, 0, 0, 0, 552, 552, 552, 554,
+        178, 178, 178, 178, 178, 178, 178, 552, 552, 552, 553, 553, 0, 0, 177, 177,
+        177, 177, 177, 177, 177, 177, 177, 177, 178, 178, 178, 178, 178, 178, 178, 178,
+        178, 179, 552, 552, 552, 552, 552, 552, 0, 640, 641, 641, 0, 639, 639, 639,
+        639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 0,
+        0, 0, 639, 639, 639, 639, 639, 639, 639, 639, 0, 639, 639, 639, 639, 639,
+        639, 639, 639, 639, 0, 639, 0, 0, 0, 0, 274, 0, 0, 0, 0, 641,
+        641, 641, 640, 640, 640, 0, 640, 0, 641, 641, 641, 641, 641, 641, 641, 641,
+        0, 0, 0, 0, 0, 0, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+        0, 0, 641, 641, 277, 0, 0, 0, 0, 680, 680, 680, 680, 680, 680, 680,
+        680, 680, 680, 680, 680, 680, 680, 680, 680, 681, 680, 680, 681, 681, 681, 681,
+        681, 681, 681, 0, 0, 0, 0, 13, 680, 680, 680, 680, 680, 680, 679, 316,
+        316, 316, 316, 316, 316, 681, 316, 318, 317, 317, 317, 317, 317, 317, 317, 317,
+        317, 317, 318, 318, 0, 0, 0, 0, 0, 530, 530, 0, 530, 0, 530, 530,
+        530, 530, 530, 0, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+        530, 530, 530, 530, 0, 530, 0, 530, 530, 531, 530, 530, 531, 531, 531, 531,
+        531, 531, 162, 531, 531, 530, 0, 0, 530, 530, 530, 530, 530, 0, 529, 0,
+        162, 162, 162, 162, 162, 531, 0, 0, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 0, 0, 530, 530, 530, 530, 682, 326, 326, 326, 325, 325, 325, 325,
+        325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 326, 325, 326, 326, 326,
+        319, 319, 326, 326, 326, 326, 326, 326, 321, 321, 321, 321, 321, 321, 321, 321,
+        321, 321, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 326, 319, 326, 319,
+        326, 319, 323, 324, 323, 324, 320, 320, 682, 682, 682, 682, 682, 682, 682, 682,
+        0, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 0, 0, 0,
+        0, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 684,
+        683, 683, 319, 319, 319, 325, 319, 319, 682, 682, 682, 682, 682, 683, 683, 683,
+        683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 0, 326, 326,
+        326, 326, 326, 326, 326, 326, 319, 326, 326, 326, 326, 326, 326, 0, 326, 326,
+        325, 325, 325, 325, 325, 15, 15, 15, 15, 325, 325, 0, 0, 0, 0, 0,
+        582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 582, 584, 584, 583, 583, 583,
+        583, 584, 583, 583, 583, 583, 583, 207, 584, 207, 207, 584, 584, 583, 583, 582,
+        208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209,
+        582, 582, 582, 582, 582, 582, 584, 584, 583, 583, 582, 582, 582, 582, 583, 583,
+        583, 582, 584, 584, 584, 582, 582, 584, 584, 584, 584, 584, 584, 584, 582, 582,
+        582, 583, 583, 583, 583, 582, 582, 582, 582, 582, 583, 584, 584, 583, 583, 584,
+        584, 584, 584, 584, 584, 583, 582, 584, 208, 208, 584, 584, 584, 583, 210, 210,
+        763, 763, 763, 763, 763, 763, 763, 763, 763, 763, 763, 763, 763, 763, 0, 763,
+        0, 0, 0, 0, 0, 763, 0, 0, 733, 733, 733, 733, 733, 733, 733, 733,
+        733, 733, 733, 11, 477, 733, 733, 733, 712, 712, 712, 712, 712, 712, 712, 712,
+        712, 712, 712, 712, 712, 712, 712, 791, 789, 495, 495, 495, 495, 495, 495, 495,
+        495, 495, 495, 495, 495, 495, 495, 495, 476, 476, 476, 476, 476, 476, 476, 476,
+        476, 0, 476, 476, 476, 476, 0, 0, 476, 476, 476, 476, 476, 476, 476, 0,
+        476, 476, 476, 0, 0, 104, 104, 104, 106, 106, 106, 106, 106, 106, 106, 106,
+        106, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 0, 0, 0, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 0, 0, 0, 0, 0, 0, 759, 759, 759, 759, 759, 759, 759, 759,
+        759, 759, 759, 759, 759, 759, 0, 0, 728, 728, 728, 728, 728, 728, 0, 0,
+        71, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444,
+        444, 444, 444, 444, 444, 73, 72, 444, 404, 597, 597, 597, 597, 597, 597, 597,
+        597, 597, 597, 597, 597, 597, 597, 597, 597, 597, 597, 228, 229, 0, 0, 0,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 11, 11, 11, 625, 625,
+        625, 624, 624, 624, 624, 624, 624, 624, 624, 0, 0, 0, 0, 0, 0, 0,
+        655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 656, 656, 293, 294, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 655, 498, 498, 498, 498, 498, 498, 498, 498,
+        498, 498, 499, 499, 125, 11, 11, 0, 442, 442, 442, 442, 442, 442, 442, 442,
+        442, 442, 443, 443, 0, 0, 0, 0, 657, 657, 657, 657, 657, 657, 657, 657,
+        657, 657, 657, 657, 657, 0, 657, 657, 657, 0, 658, 658, 0, 0, 0, 0,
+        520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 784, 784, 522, 521,
+        521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522, 521, 522,
+        522, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 154, 154, 154, 519,
+        154, 154, 154, 155, 520, 151, 0, 0, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 0, 0, 0, 0, 0, 0, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 0, 0, 0, 0, 0, 0, 203, 203, 11, 11, 203, 11, 202, 203,
+        203, 203, 203, 785, 785, 785, 786, 785, 201, 201, 201, 201, 201, 201, 201, 201,
+        201, 201, 0, 0, 0, 0, 0, 0, 577, 577, 577, 577, 577, 577, 577, 577,
+        577, 577, 577, 576, 577, 577, 577, 577, 577, 0, 0, 0, 0, 0, 0, 0,
+        577, 577, 577, 577, 577, 578, 578, 577, 577, 578, 577, 0, 0, 0, 0, 0,
+        444, 444, 444, 444, 444, 444, 0, 0, 539, 539, 539, 539, 539, 539, 539, 539,
+        539, 539, 539, 539, 539, 539, 539, 0, 540, 540, 540, 541, 541, 541, 541, 540,
+        540, 541, 541, 541, 0, 0, 0, 0, 541, 541, 540, 541, 541, 541, 541, 541,
+        541, 167, 167, 167, 0, 0, 0, 0, 170, 0, 0, 0, 169, 169, 168, 168,
+        168, 168, 168, 168, 168, 168, 168, 168, 659, 659, 659, 659, 659, 659, 659, 659,
+        659, 659, 659, 659, 659, 659, 0, 0, 659, 659, 659, 659, 659, 0, 0, 0,
+        589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 0, 0, 0, 0,
+        589, 589, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 215, 0, 0, 0, 216, 216, 156, 156, 156, 156, 156, 156, 156, 156,
+        439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 440,
+        440, 441, 441, 440, 0, 0, 70, 70, 661, 661, 661, 661, 661, 661, 661, 661,
+        661, 661, 661, 661, 661, 663, 662, 663, 662, 662, 662, 662, 662, 662, 662, 0,
+        295, 663, 662, 663, 663, 662, 662, 662, 662, 662, 662, 662, 662, 663, 663, 663,
+        663, 663, 663, 662, 662, 295, 295, 295, 295, 295, 295, 295, 295, 0, 0, 295,
+        296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 0, 0, 0, 0, 0, 0,
+        297, 297, 297, 297, 297, 297, 297, 660, 297, 297, 297, 297, 297, 297, 0, 0,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 409,
+        409, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 409, 409, 409, 0,
+        422, 422, 422, 422, 423, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421,
+        421, 421, 421, 421, 42, 423, 422, 422, 422, 422, 422, 423, 422, 423, 423, 423,
+        423, 423, 422, 423, 43, 421, 421, 421, 421, 421, 421, 421, 421, 0, 0, 0,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45,
+        45, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 46, 46, 46, 46, 46, 46, 46, 46, 46, 45, 45, 0,
+        648, 648, 649, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647,
+        647, 649, 648, 648, 648, 648, 649, 649, 648, 648, 285, 284, 648, 648, 647, 647,
+        286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 647, 647, 647, 647, 647, 647,
+        427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 51, 429,
+        428, 428, 429, 429, 429, 428, 429, 428, 428, 428, 52, 52, 0, 0, 0, 0,
+        0, 0, 0, 0, 53, 53, 53, 53, 536, 536, 536, 536, 536, 536, 536, 536,
+        536, 536, 536, 536, 538, 538, 538, 538, 538, 538, 538, 538, 537, 537, 537, 537,
+        537, 537, 537, 537, 538, 538, 537, 164, 0, 0, 0, 166, 166, 166, 166, 166,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 0, 0, 0, 536, 536, 536,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 599, 599, 599, 599, 599, 599,
+        599, 599, 599, 599, 599, 599, 599, 599, 598, 598, 598, 598, 598, 598, 231, 231,
+        730, 0, 0, 0, 0, 0, 0, 0, 763, 763, 763, 0, 0, 763, 763, 763,
+        287, 287, 287, 287, 287, 287, 287, 287, 18, 18, 18, 11, 18, 18, 18, 18,
+        18, 2, 18, 18, 18, 18, 18, 18, 18, 408, 408, 408, 408, 18, 408, 408,
+        408, 408, 408, 408, 18, 408, 408, 2, 18, 18, 408, 0, 0, 0, 0, 0,
+        737, 737, 737, 737, 737, 737, 735, 735, 735, 735, 735, 730, 738, 738, 738, 738,
+        738, 738, 738, 738, 738, 736, 736, 736, 736, 736, 738, 738, 738, 738, 736, 736,
+        736, 736, 736, 737, 737, 737, 737, 737, 731, 737, 737, 737, 737, 737, 737, 737,
+        737, 737, 737, 738, 738, 738, 738, 738, 738, 738, 738, 738, 738, 738, 738, 736,
+        18, 18, 18, 18, 18, 18, 18, 409, 409, 409, 409, 409, 409, 409, 409, 409,
+        409, 409, 409, 409, 409, 18, 18, 18, 766, 737, 766, 737, 766, 737, 737, 737,
+        737, 737, 737, 737, 737, 737, 766, 737, 735, 735, 735, 735, 735, 735, 735, 735,
+        765, 765, 765, 765, 765, 765, 765, 765, 735, 735, 735, 735, 735, 735, 0, 0,
+        765, 765, 765, 765, 765, 765, 0, 0, 0, 765, 0, 765, 0, 765, 0, 765,
+        484, 484, 484, 484, 484, 484, 484, 484, 735, 735, 735, 735, 735, 0, 735, 735,
+        765, 765, 765, 765, 484, 113, 735, 113, 113, 113, 735, 735, 735, 0, 735, 735,
+        765, 765, 765, 765, 484, 113, 113, 113, 735, 735, 735, 735, 0, 0, 735, 735,
+        765, 765, 765, 765, 0, 113, 113, 113, 765, 765, 765, 765, 765, 113, 113, 113,
+        0, 0, 735, 735, 735, 0, 735, 735, 765, 765, 765, 765, 484, 113, 113, 0,
+        400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 781, 782, 782, 781, 781,
+        346, 6, 6, 346, 346, 346, 349, 11, 347, 348, 7, 9, 347, 348, 7, 9,
+        349, 349, 349, 11, 349, 349, 349, 349, 401, 402, 781, 781, 781, 781, 781, 400,
+        349, 11, 349, 349, 11, 349, 11, 11, 11, 9, 10, 349, 801, 11, 349, 5,
+        5, 11, 11, 11, 12, 7, 8, 11, 11, 801, 11, 11, 11, 11, 11, 11,
+        11, 11, 12, 11, 5, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 400,
+        781, 781, 781, 781, 781, 780, 781, 781, 781, 781, 781, 781, 781, 781, 781, 781,
+        4, 738, 0, 0, 345, 4, 4, 4, 4, 4, 12, 12, 12, 7, 8, 751,
+        4, 345, 345, 345, 345, 4, 4, 4, 4, 4, 12, 12, 12, 7, 8, 0,
+        738, 738, 738, 738, 738, 0, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 359, 13, 13, 351, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+        18, 18, 18, 18, 18, 19, 19, 19, 19, 18, 19, 19, 19, 18, 18, 18,
+        18, 0, 0, 0, 0, 0, 0, 0, 15, 15, 756, 353, 15, 353, 15, 756,
+        15, 353, 724, 756, 756, 756, 724, 724, 756, 756, 756, 745, 15, 756, 353, 15,
+        12, 756, 756, 756, 756, 756, 15, 15, 15, 353, 805, 15, 756, 15, 775, 15,
+        756, 15, 766, 776, 756, 756, 15, 724, 756, 756, 766, 756, 724, 408, 408, 408,
+        408, 809, 15, 15, 724, 724, 756, 756, 12, 12, 12, 12, 12, 756, 724, 724,
+        724, 724, 15, 12, 15, 15, 737, 15, 4, 4, 4, 345, 345, 4, 4, 4,
+        4, 4, 4, 345, 345, 345, 345, 4, 777, 777, 777, 777, 777, 777, 777, 777,
+        777, 777, 777, 777, 767, 767, 767, 767, 753, 753, 753, 753, 753, 753, 753, 753,
+        753, 753, 739, 739, 739, 739, 739, 739, 535, 535, 535, 766, 737, 535, 535, 535,
+        535, 345, 15, 15, 0, 0, 0, 0, 350, 350, 350, 350, 804, 805, 805, 805,
+        805, 805, 12, 12, 15, 15, 15, 15, 12, 15, 15, 12, 15, 15, 12, 15,
+        15, 803, 803, 15, 15, 15, 12, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        353, 353, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 12, 12,
+        15, 15, 350, 15, 350, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 353,
+        15, 15, 15, 15, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        350, 12, 350, 350, 12, 12, 12, 350, 350, 12, 12, 350, 12, 12, 12, 350,
+        12, 350, 12, 12, 12, 350, 12, 12, 12, 12, 350, 12, 12, 350, 350, 350,
+        350, 12, 12, 350, 12, 350, 12, 350, 350, 350, 350, 350, 350, 12, 350, 12,
+        12, 12, 12, 12, 350, 350, 350, 350, 12, 12, 12, 12, 350, 350, 12, 12,
+        350, 12, 12, 12, 350, 12, 12, 12, 12, 12, 350, 12, 12, 12, 12, 12,
+        350, 350, 12, 12, 350, 350, 350, 350, 12, 12, 350, 350, 12, 12, 350, 350,
+        12, 12, 12, 12, 12, 350, 12, 12, 12, 350, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 350, 7, 8, 7, 8, 15, 15, 15, 15,
+        15, 15, 353, 15, 15, 15, 15, 15, 15, 15, 812, 812, 15, 15, 15, 15,
+        12, 12, 15, 15, 15, 15, 15, 15, 803, 365, 366, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 12, 15, 15, 15, 797, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 12, 12, 12, 12, 12, 12, 12, 12, 12, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 803, 15, 812, 812, 812, 812, 803, 803, 803,
+        812, 803, 803, 812, 15, 15, 15, 15, 803, 803, 803, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 0, 0, 0, 0, 0,
+        345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 353, 353, 353, 353,
+        353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 773, 773,
+        773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 810, 773, 773, 773, 773, 773,
+        746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 4, 345, 345, 345, 345, 345,
+        353, 353, 353, 353, 15, 15, 15, 15, 15, 15, 353, 353, 353, 353, 15, 15,
+        353, 353, 15, 353, 353, 353, 353, 353, 353, 353, 803, 803, 15, 15, 15, 15,
+        15, 15, 353, 353, 15, 15, 805, 350, 15, 15, 15, 15, 353, 353, 15, 15,
+        805, 350, 15, 15, 15, 15, 353, 353, 353, 15, 15, 353, 15, 15, 353, 353,
+        12, 12, 12, 802, 802, 811, 811, 12, 803, 803, 803, 803, 803, 799, 353, 797,
+        797, 799, 797, 797, 797, 797, 805, 799, 797, 803, 797, 15, 812, 812, 797, 797,
+        803, 797, 797, 797, 799, 803, 799, 797, 803, 797, 803, 803, 797, 797, 803, 797,
+        797, 797, 803, 797, 797, 797, 803, 803, 797, 797, 797, 797, 797, 797, 797, 797,
+        803, 803, 803, 797, 797, 797, 797, 797, 805, 797, 805, 797, 797, 797, 797, 797,
+        812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 797, 797, 797, 797,
+        797, 797, 797, 797, 797, 797, 797, 803, 805, 799, 797, 805, 799, 805, 803, 799,
+        805, 799, 799, 797, 799, 799, 797, 798, 797, 797, 797, 803, 797, 797, 803, 812,
+        797, 797, 797, 797, 797, 797, 15, 15, 797, 797, 803, 812, 803, 803, 803, 803,
+        797, 803, 797, 803, 803, 797, 799, 799, 803, 812, 797, 797, 797, 797, 797, 803,
+        797, 797, 812, 812, 797, 797, 797, 797, 803, 803, 797, 797, 797, 797, 797, 797,
+        797, 797, 797, 797, 797, 812, 812, 799, 797, 797, 797, 797, 812, 812, 799, 799,
+        805, 799, 799, 799, 799, 799, 812, 805, 799, 805, 799, 805, 812, 799, 799, 799,
+        799, 799, 799, 799, 799, 799, 799, 799, 799, 799, 797, 799, 797, 797, 797, 797,
+        799, 805, 812, 799, 799, 799, 799, 799, 805, 805, 812, 812, 805, 812, 799, 805,
+        805, 805, 812, 799, 799, 812, 799, 799, 797, 797, 803, 797, 797, 812, 15, 15,
+        803, 803, 812, 812, 803, 803, 797, 803, 797, 797, 803, 15, 803, 15, 803, 15,
+        15, 15, 15, 15, 15, 803, 15, 15, 15, 803, 15, 15, 15, 15, 15, 15,
+        812, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 803, 803, 15, 15, 15,
+        15, 15, 15, 15, 15, 353, 15, 15, 15, 15, 15, 15, 803, 15, 15, 803,
+        15, 15, 15, 15, 812, 15, 812, 15, 15, 15, 15, 812, 812, 812, 15, 812,
+        15, 15, 15, 803, 803, 797, 797, 797, 7, 8, 7, 8, 7, 8, 7, 8,
+        7, 8, 7, 8, 7, 8, 345, 345, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 15, 812, 812, 812, 15, 15, 15, 15, 15, 15, 15, 812,
+        12, 12, 12, 12, 12, 7, 8, 12, 12, 12, 12, 12, 12, 12, 393, 394,
+        393, 394, 393, 394, 393, 394, 7, 8, 69, 69, 69, 69, 69, 69, 69, 69,
+        12, 12, 12, 12, 802, 802, 12, 12, 12, 12, 12, 7, 8, 393, 394, 7,
+        8, 7, 8, 7, 8, 7, 8, 7, 8, 12, 12, 12, 12, 12, 12, 12,
+        7, 8, 7, 8, 12, 12, 12, 12, 12, 12, 12, 12, 7, 8, 12, 12,
+        15, 15, 15, 15, 15, 803, 803, 803, 15, 15, 15, 812, 812, 15, 15, 15,
+        12, 12, 12, 12, 12, 15, 15, 12, 12, 12, 12, 12, 12, 15, 15, 15,
+        812, 15, 15, 15, 15, 812, 353, 353, 15, 15, 15, 15, 0, 0, 15, 15,
+        15, 15, 15, 15, 15, 15, 0, 15, 764, 764, 764, 764, 764, 764, 764, 764,
+        734, 734, 734, 734, 734, 734, 734, 734, 766, 737, 766, 766, 766, 737, 737, 766,
+        737, 766, 737, 766, 737, 766, 766, 766, 766, 737, 766, 737, 737, 766, 737, 737,
+        737, 737, 737, 737, 738, 738, 766, 766, 760, 729, 760, 729, 729, 84, 84, 84,
+        84, 84, 84, 760, 729, 760, 729, 81, 81, 81, 760, 729, 0, 0, 0, 0,
+        0, 83, 83, 83, 83, 82, 83, 83, 733, 733, 733, 733, 733, 733, 0, 733,
+        0, 0, 0, 0, 0, 733, 0, 0, 686, 686, 686, 686, 686, 686, 686, 686,
+        0, 0, 0, 0, 0, 0, 0, 685, 328, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 327, 460, 460, 460, 460, 460, 460, 460, 460,
+        11, 11, 9, 10, 9, 10, 11, 11, 11, 9, 10, 11, 9, 10, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 6, 11, 11, 6, 11, 9, 10, 11, 11,
+        9, 10, 7, 8, 7, 8, 7, 8, 7, 8, 11, 11, 11, 11, 11, 407,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 11, 11, 11, 11,
+        6, 11, 7, 11, 11, 11, 11, 11, 15, 15, 11, 11, 11, 7, 8, 7,
+        8, 7, 8, 7, 8, 6, 0, 0, 374, 374, 374, 374, 374, 374, 374, 374,
+        374, 374, 0, 374, 374, 374, 374, 374, 374, 374, 374, 374, 0, 0, 0, 0,
+        374, 374, 374, 374, 374, 374, 0, 0, 371, 371, 371, 371, 371, 371, 371, 371,
+        371, 371, 371, 371, 0, 0, 0, 0, 405, 367, 367, 367, 371, 708, 706, 711,
+        365, 366, 365, 366, 365, 366, 365, 366, 365, 366, 371, 371, 365, 366, 365, 366,
+        365, 366, 365, 366, 364, 365, 366, 366, 371, 711, 711, 711, 711, 711, 711, 711,
+        711, 711, 372, 372, 372, 372, 375, 375, 806, 705, 705, 705, 705, 705, 371, 371,
+        711, 711, 711, 708, 706, 807, 371, 15, 0, 714, 714, 714, 714, 714, 714, 714,
+        714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 0,
+        0, 372, 372, 370, 370, 713, 713, 714, 364, 716, 716, 716, 716, 716, 716, 716,
+        716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 367, 705, 715, 715, 716,
+        0, 0, 0, 0, 0, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707, 707,
+        0, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 791, 712, 712, 712,
+        712, 712, 712, 712, 712, 712, 712, 0, 371, 371, 362, 362, 362, 362, 371, 371,
+        376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 0,
+        362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 371, 371, 371, 371, 371, 371,
+        371, 362, 362, 362, 362, 362, 362, 362, 376, 376, 376, 376, 376, 376, 376, 371,
+        371, 371, 371, 371, 371, 371, 371, 808, 371, 808, 371, 371, 371, 371, 371, 371,
+        378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 371,
+        709, 709, 709, 709, 709, 709, 709, 709, 723, 723, 723, 723, 723, 723, 723, 723,
+        723, 723, 723, 723, 723, 722, 723, 723, 723, 723, 723, 723, 723, 0, 0, 0,
+        380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 0,
+        545, 545, 545, 545, 545, 545, 545, 545, 544, 544, 544, 544, 544, 544, 171, 171,
+        693, 693, 693, 693, 693, 693, 693, 693, 693, 693, 693, 693, 692, 335, 335, 335,
+        334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 693, 693, 0, 0, 0, 0,
+        761, 730, 761, 730, 761, 730, 459, 87, 88, 88, 88, 89, 460, 460, 460, 460,
+        460, 460, 460, 460, 87, 87, 89, 458, 761, 730, 761, 730, 731, 731, 460, 460,
+        424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 425, 425,
+        425, 425, 425, 425, 425, 425, 425, 425, 47, 47, 48, 48, 48, 48, 48, 48,
+        14, 14, 14, 14, 14, 14, 14, 407, 407, 407, 407, 407, 407, 407, 407, 407,
+        14, 14, 766, 737, 766, 737, 766, 737, 737, 737, 766, 737, 766, 737, 766, 737,
+        738, 737, 737, 737, 737, 737, 737, 737, 737, 766, 737, 766, 737, 766, 766, 737,
+        407, 14, 14, 766, 737, 766, 737, 534, 766, 737, 766, 737, 737, 737, 766, 737,
+        766, 737, 766, 766, 766, 766, 766, 737, 766, 766, 766, 766, 766, 737, 766, 737,
+        766, 737, 766, 737, 766, 766, 766, 766, 737, 766, 737, 0, 0, 0, 0, 0,
+        766, 737, 0, 737, 0, 737, 766, 737, 766, 737, 0, 0, 0, 0, 0, 0,
+        0, 0, 533, 533, 533, 766, 737, 534, 738, 738, 737, 534, 534, 534, 534, 534,
+        650, 650, 651, 650, 650, 650, 288, 650, 650, 650, 650, 651, 650, 650, 650, 650,
+        650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 652, 652, 651, 651, 652,
+        289, 289, 289, 289, 288, 0, 0, 0, 4, 4, 4, 4, 4, 4, 15, 15,
+        13, 15, 0, 0, 0, 0, 0, 0, 618, 618, 618, 618, 618, 618, 618, 618,
+        618, 618, 618, 618, 253, 253, 253, 253, 631, 631, 629, 629, 629, 629, 629, 629,
+        629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 631, 631, 631, 631,
+        631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 262, 630, 0, 0,
+        0, 0, 0, 0, 0, 0, 264, 264, 263, 263, 263, 263, 263, 263, 263, 263,
+        263, 263, 0, 0, 0, 0, 0, 0, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 462, 462, 462, 462, 462, 462, 93, 93, 93, 462, 93, 462, 462, 463,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 515, 515, 515, 515, 515, 515,
+        515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 516, 516,
+        516, 516, 516, 145, 145, 145, 11, 147, 621, 621, 621, 621, 621, 621, 621, 621,
+        621, 621, 621, 621, 621, 621, 621, 622, 622, 622, 622, 622, 622, 622, 622, 622,
+        622, 622, 623, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259,
+        712, 712, 712, 712, 712, 0, 0, 0, 507, 507, 507, 508, 506, 506, 506, 506,
+        506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 135, 508, 508, 507, 507,
+        507, 507, 508, 508, 507, 507, 508, 508, 136, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 0, 407, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 0, 0, 0, 0, 138, 138, 582, 582, 582, 582, 582, 583, 581, 582,
+        208, 208, 582, 582, 582, 582, 582, 0, 450, 450, 450, 450, 450, 450, 450, 450,
+        450, 451, 451, 451, 451, 451, 451, 452, 452, 451, 451, 452, 452, 451, 451, 0,
+        450, 450, 450, 451, 450, 450, 450, 450, 450, 450, 450, 450, 451, 452, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 79, 79, 79, 79,
+        581, 582, 582, 582, 582, 582, 582, 210, 210, 210, 582, 584, 583, 584, 582, 582,
+        665, 665, 665, 665, 665, 665, 665, 665, 666, 665, 666, 666, 666, 665, 665, 666,
+        666, 665, 665, 665, 665, 665, 666, 298, 665, 298, 665, 0, 0, 0, 0, 0,
+        0, 0, 0, 665, 665, 664, 299, 299, 563, 563, 563, 563, 563, 563, 563, 563,
+        563, 563, 563, 565, 564, 564, 565, 565, 194, 194, 563, 562, 562, 565, 191, 0,
+        0, 476, 476, 476, 476, 476, 476, 0, 737, 737, 737, 14, 738, 738, 738, 738,
+        737, 737, 737, 737, 737, 735, 737, 737, 737, 533, 14, 14, 0, 0, 0, 0,
+        728, 728, 728, 728, 728, 728, 728, 728, 563, 563, 563, 565, 565, 564, 565, 565,
+        564, 565, 565, 194, 192, 191, 0, 0, 193, 193, 193, 193, 193, 193, 193, 193,
+        193, 193, 0, 0, 0, 0, 0, 0, 712, 712, 712, 712, 0, 0, 0, 0,
+        495, 495, 495, 495, 495, 495, 495, 0, 0, 0, 0, 495, 495, 495, 495, 495,
+        495, 495, 495, 495, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        344, 344, 344, 344, 344, 344, 344, 344, 709, 709, 709, 709, 709, 709, 361, 361,
+        709, 709, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+        737, 737, 737, 737, 737, 737, 737, 0, 0, 0, 0, 727, 727, 727, 727, 727,
+        0, 0, 0, 0, 0, 501, 502, 501, 501, 130, 501, 501, 501, 501, 501, 501,
+        501, 501, 501, 501, 501, 501, 501, 0, 501, 501, 501, 501, 501, 0, 501, 0,
+        501, 501, 0, 501, 501, 0, 501, 501, 417, 417, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0,
+        0, 0, 0, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 8, 7,
+        35, 35, 35, 35, 35, 35, 35, 35, 0, 0, 417, 417, 417, 417, 417, 417,
+        0, 0, 0, 0, 0, 0, 0, 35, 417, 417, 417, 417, 33, 35, 35, 35,
+        788, 788, 788, 788, 788, 788, 788, 788, 367, 367, 367, 367, 367, 367, 367, 365,
+        366, 367, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 87, 87,
+        367, 364, 364, 363, 363, 365, 366, 365, 366, 365, 366, 365, 366, 365, 366, 365,
+        366, 365, 366, 365, 366, 367, 367, 365, 366, 367, 367, 367, 367, 363, 363, 363,
+        367, 367, 367, 0, 367, 367, 367, 367, 364, 365, 366, 365, 366, 365, 366, 367,
+        367, 367, 368, 364, 368, 368, 368, 0, 367, 369, 367, 367, 0, 0, 0, 0,
+        417, 417, 417, 417, 417, 0, 417, 417, 417, 417, 417, 417, 417, 0, 0, 781,
+        0, 386, 386, 386, 388, 386, 386, 386, 384, 385, 386, 387, 386, 383, 386, 386,
+        381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 386, 386, 387, 387, 387, 386,
+        386, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778, 778,
+        778, 778, 778, 384, 386, 385, 389, 382, 389, 754, 754, 754, 754, 754, 754, 754,
+        754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 384, 387, 385, 387, 384,
+        385, 357, 355, 356, 357, 357, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+        702, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 702, 702,
+        790, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+        703, 703, 703, 703, 703, 703, 703, 0, 0, 0, 703, 703, 703, 703, 703, 703,
+        0, 0, 703, 703, 703, 0, 0, 0, 388, 388, 387, 389, 390, 388, 388, 0,
+        360, 358, 358, 358, 358, 360, 360, 0, 780, 780, 780, 780, 780, 780, 780, 780,
+        780, 17, 17, 17, 15, 353, 0, 0, 543, 543, 543, 543, 543, 543, 543, 543,
+        543, 543, 543, 543, 0, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 0,
+        543, 543, 543, 0, 543, 543, 0, 543, 543, 543, 543, 543, 543, 543, 0, 0,
+        543, 543, 543, 0, 0, 0, 0, 0, 11, 11, 11, 0, 0, 0, 0, 4,
+        4, 4, 4, 4, 0, 0, 0, 15, 485, 485, 485, 485, 485, 485, 485, 485,
+        485, 485, 485, 485, 485, 111, 111, 111, 111, 114, 114, 114, 114, 114, 114, 114,
+        114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 111, 111, 114, 114, 114, 0,
+        15, 15, 15, 15, 15, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0,
+        15, 15, 15, 15, 15, 18, 0, 0, 546, 546, 546, 546, 546, 546, 546, 546,
+        546, 546, 546, 546, 546, 0, 0, 0, 445, 445, 445, 445, 445, 445, 445, 445,
+        445, 0, 0, 0, 0, 0, 0, 0, 18, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 0, 0, 0, 0, 600, 600, 600, 600, 600, 600, 600, 600,
+        233, 233, 233, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 600, 600, 600,
+        479, 479, 479, 479, 479, 479, 479, 479, 479, 480, 479, 479, 479, 479, 479, 479,
+        479, 479, 480, 0, 0, 0, 0, 0, 602, 602, 602, 602, 602, 602, 602, 602,
+        602, 602, 602, 602, 602, 602, 603, 603, 603, 603, 603, 0, 0, 0, 0, 0,
+        691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 0, 333,
+        604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 0, 0, 0, 0,
+        235, 605, 605, 605, 605, 605, 0, 0, 762, 762, 762, 762, 762, 762, 762, 762,
+        732, 732, 732, 732, 732, 732, 732, 732, 635, 635, 635, 635, 635, 635, 635, 635,
+        613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 0, 0,
+        245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 0, 0, 0, 0, 0, 0,
+        770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 0, 0, 0, 0,
+        742, 742, 742, 742, 742, 742, 742, 742, 742, 742, 742, 742, 0, 0, 0, 0,
+        474, 474, 474, 474, 474, 474, 474, 474, 446, 446, 446, 446, 446, 446, 446, 446,
+        446, 446, 446, 446, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74,
+        771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 0, 771, 771, 771, 771,
+        771, 771, 771, 0, 771, 771, 0, 743, 743, 743, 743, 743, 743, 743, 743, 743,
+        743, 743, 0, 743, 743, 743, 743, 743, 743, 743, 0, 743, 743, 0, 0, 0,
+        542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 0,
+        542, 542, 542, 542, 542, 542, 0, 0, 738, 533, 533, 738, 738, 738, 0, 738,
+        738, 0, 738, 738, 738, 738, 738, 738, 738, 738, 738, 0, 0, 0, 0, 0,
+        456, 456, 456, 456, 456, 456, 0, 0, 456, 0, 456, 456, 456, 456, 456, 456,
+        456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 0, 456,
+        456, 0, 0, 0, 456, 0, 0, 456, 503, 503, 503, 503, 503, 503, 503, 503,
+        503, 503, 503, 503, 503, 503, 0, 132, 131, 131, 131, 131, 131, 131, 131, 131,
+        616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 252,
+        252, 251, 251, 251, 251, 251, 251, 251, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 0, 0, 0, 0, 0, 0, 0, 0, 211,
+        211, 211, 211, 211, 211, 211, 211, 211, 500, 500, 500, 500, 500, 500, 500, 500,
+        500, 500, 500, 0, 500, 500, 0, 0, 0, 0, 0, 126, 126, 126, 126, 126,
+        619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 254, 254,
+        254, 254, 254, 254, 0, 0, 0, 255, 547, 547, 547, 547, 547, 547, 547, 547,
+        547, 547, 0, 0, 0, 0, 0, 172, 568, 568, 568, 568, 568, 568, 568, 568,
+        567, 567, 567, 567, 567, 567, 567, 567, 0, 0, 0, 0, 197, 197, 567, 567,
+        197, 197, 197, 197, 197, 197, 197, 197, 0, 0, 197, 197, 197, 197, 197, 197,
+        517, 518, 518, 518, 0, 518, 518, 0, 0, 0, 0, 0, 518, 518, 518, 518,
+        517, 517, 517, 517, 0, 517, 517, 517, 0, 517, 517, 517, 517, 517, 517, 517,
+        517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 0, 0,
+        148, 148, 148, 0, 0, 0, 0, 148, 149, 149, 149, 149, 149, 149, 149, 149,
+        149, 0, 0, 0, 0, 0, 0, 0, 150, 150, 150, 150, 150, 150, 150, 150,
+        150, 0, 0, 0, 0, 0, 0, 0, 607, 607, 607, 607, 607, 607, 607, 607,
+        607, 607, 607, 607, 607, 237, 237, 238, 601, 601, 601, 601, 601, 601, 601, 601,
+        601, 601, 601, 601, 601, 234, 234, 234, 556, 556, 556, 556, 556, 556, 556, 556,
+        185, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 182, 182, 0,
+        0, 0, 0, 183, 183, 183, 183, 183, 184, 184, 184, 184, 184, 184, 184, 0,
+        420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 0, 0,
+        0, 41, 41, 41, 41, 41, 41, 41, 505, 505, 505, 505, 505, 505, 505, 505,
+        505, 505, 505, 505, 505, 505, 0, 0, 134, 134, 134, 134, 134, 134, 134, 134,
+        504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 0, 0, 0, 0, 0,
+        133, 133, 133, 133, 133, 133, 133, 133, 620, 620, 620, 620, 620, 620, 620, 620,
+        620, 620, 0, 0, 0, 0, 0, 0, 0, 257, 257, 257, 257, 0, 0, 0,
+        0, 256, 256, 256, 256, 256, 256, 256, 608, 608, 608, 608, 608, 608, 608, 608,
+        608, 0, 0, 0, 0, 0, 0, 0, 769, 769, 769, 769, 769, 769, 769, 769,
+        769, 769, 769, 0, 0, 0, 0, 0, 741, 741, 741, 741, 741, 741, 741, 741,
+        741, 741, 741, 0, 0, 0, 0, 0, 0, 0, 232, 232, 232, 232, 232, 232,
+        496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 497, 497, 497, 497,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 0, 0, 0, 0, 0, 0,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0,
+        696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 0, 697, 697, 341, 0, 0,
+        696, 696, 0, 0, 0, 0, 0, 0, 606, 606, 606, 606, 606, 606, 606, 606,
+        606, 606, 606, 606, 606, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 606,
+        642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 278, 278,
+        278, 278, 278, 278, 278, 278, 278, 278, 278, 279, 279, 279, 279, 280, 280, 280,
+        280, 280, 0, 0, 0, 0, 0, 0, 609, 609, 609, 609, 609, 609, 609, 609,
+        609, 609, 239, 239, 239, 239, 240, 240, 240, 240, 0, 0, 0, 0, 0, 0,
+        453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 80, 80, 80,
+        80, 80, 80, 80, 0, 0, 0, 0, 475, 475, 475, 475, 475, 475, 475, 475,
+        475, 475, 475, 475, 475, 475, 475, 0, 438, 437, 438, 436, 436, 436, 436, 436,
+        436, 436, 436, 436, 436, 436, 436, 436, 437, 437, 437, 437, 437, 437, 437, 437,
+        437, 437, 437, 437, 437, 437, 65, 68, 68, 68, 68, 68, 68, 68, 0, 0,
+        0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        65, 436, 436, 437, 437, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65,
+        139, 139, 511, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+        511, 511, 511, 510, 510, 510, 510, 511, 511, 139, 139, 140, 140, 141, 140, 140,
+        140, 140, 510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 141, 0, 0,
+        643, 643, 643, 643, 643, 643, 643, 643, 643, 0, 0, 0, 0, 0, 0, 0,
+        281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 0, 0, 0, 0, 0, 0,
+        448, 448, 448, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447,
+        447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 449, 448, 448, 448,
+        448, 448, 448, 75, 75, 0, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+        77, 77, 77, 77, 447, 449, 449, 447, 548, 548, 548, 548, 548, 548, 548, 548,
+        548, 548, 548, 173, 174, 174, 548, 0, 633, 633, 634, 632, 632, 632, 632, 632,
+        632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 634, 634, 634, 633, 633,
+        633, 633, 633, 633, 633, 633, 633, 634, 266, 632, 632, 632, 632, 268, 268, 268,
+        268, 265, 265, 265, 265, 268, 634, 633, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 632, 268, 632, 268, 268, 268, 0, 276, 276, 276, 276, 276, 276, 276,
+        276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 0, 0, 0,
+        523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 0, 523, 523, 523, 523, 523,
+        523, 523, 523, 523, 525, 525, 525, 524, 524, 524, 525, 525, 524, 158, 157, 524,
+        159, 159, 159, 159, 159, 159, 524, 0, 580, 580, 580, 580, 580, 580, 580, 0,
+        580, 0, 580, 580, 580, 580, 0, 580, 580, 580, 580, 580, 580, 580, 580, 580,
+        580, 580, 580, 580, 580, 580, 0, 580, 580, 206, 0, 0, 0, 0, 0, 0,
+        526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 527,
+        528, 528, 528, 527, 527, 527, 527, 527, 527, 160, 160, 0, 0, 0, 0, 0,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 0, 0, 0, 0, 0,
+        482, 482, 483, 483, 0, 481, 481, 481, 481, 481, 481, 481, 481, 0, 0, 481,
+        481, 0, 0, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481,
+        481, 0, 481, 481, 481, 481, 481, 481, 481, 0, 481, 481, 0, 481, 481, 481,
+        481, 481, 0, 18, 108, 481, 483, 483, 482, 483, 483, 483, 483, 0, 0, 483,
+        483, 0, 0, 483, 483, 109, 0, 0, 481, 0, 0, 0, 0, 0, 0, 483,
+        0, 0, 0, 0, 0, 481, 481, 481, 481, 481, 483, 483, 0, 0, 108, 108,
+        108, 108, 108, 108, 108, 0, 0, 0, 590, 590, 590, 590, 590, 590, 590, 590,
+        590, 590, 590, 590, 590, 592, 592, 592, 591, 591, 591, 591, 591, 591, 591, 591,
+        592, 592, 217, 591, 591, 592, 217, 590, 590, 590, 590, 219, 219, 219, 219, 219,
+        218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 219, 219, 0, 219, 217, 590,
+        590, 590, 0, 0, 0, 0, 0, 0, 687, 687, 687, 687, 687, 687, 687, 687,
+        689, 689, 689, 688, 688, 688, 688, 688, 688, 689, 688, 689, 689, 689, 689, 688,
+        688, 689, 329, 329, 687, 687, 331, 687, 330, 330, 330, 330, 330, 330, 330, 330,
+        330, 330, 0, 0, 0, 0, 0, 0, 636, 636, 636, 636, 636, 636, 636, 636,
+        636, 636, 636, 636, 636, 636, 636, 638, 638, 638, 637, 637, 637, 637, 0, 0,
+        638, 638, 638, 638, 637, 637, 638, 269, 269, 270, 270, 270, 270, 270, 270, 270,
+        270, 270, 270, 270, 270, 270, 270, 270, 636, 636, 636, 636, 637, 637, 0, 0,
+        573, 573, 573, 573, 573, 573, 573, 573, 575, 575, 575, 574, 574, 574, 574, 574,
+        574, 574, 574, 575, 575, 574, 575, 198, 574, 200, 200, 200, 573, 0, 0, 0,
+        199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 0, 0, 0, 0, 0, 0,
+        203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 0, 0, 0,
+        667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 668, 669, 668, 669, 669,
+        668, 668, 668, 668, 668, 668, 301, 300, 667, 303, 0, 0, 0, 0, 0, 0,
+        302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 0, 0, 0, 0, 0, 0,
+        412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 0, 0, 413, 413, 413,
+        414, 414, 413, 413, 413, 413, 414, 413, 413, 413, 413, 23, 0, 0, 0, 0,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 26, 26, 26, 27,
+        412, 412, 412, 412, 412, 412, 412, 0, 468, 468, 468, 468, 468, 468, 468, 468,
+        468, 468, 468, 468, 470, 470, 470, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+        470, 98, 98, 99, 0, 0, 0, 0, 772, 772, 772, 772, 772, 772, 772, 772,
+        744, 744, 744, 744, 744, 744, 744, 744, 339, 339, 339, 339, 339, 339, 339, 339,
+        339, 339, 340, 340, 340, 340, 340, 340, 340, 340, 340, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 695, 465, 465, 465, 465, 465, 465, 465, 0,
+        0, 465, 0, 0, 465, 465, 465, 465, 465, 465, 465, 465, 0, 465, 465, 0,
+        465, 465, 465, 465, 465, 465, 465, 465, 467, 467, 467, 467, 467, 467, 0, 467,
+        467, 0, 0, 466, 466, 95, 94, 465, 467, 465, 467, 94, 97, 97, 97, 0,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0,
+        586, 586, 586, 586, 586, 586, 586, 586, 0, 0, 586, 586, 586, 586, 586, 586,
+        586, 588, 588, 588, 587, 587, 587, 587, 0, 0, 587, 587, 588, 588, 588, 588,
+        212, 586, 213, 586, 588, 0, 0, 0, 698, 699, 699, 699, 699, 699, 699, 699,
+        699, 699, 699, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698,
+        698, 698, 698, 342, 342, 699, 699, 699, 699, 700, 698, 699, 699, 699, 699, 343,
+        343, 343, 343, 343, 343, 343, 343, 342, 644, 645, 645, 645, 645, 645, 645, 646,
+        646, 645, 645, 645, 644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 644,
+        644, 644, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 646,
+        282, 282, 283, 283, 283, 644, 283, 283, 283, 283, 283, 0, 0, 0, 0, 0,
+        617, 617, 617, 617, 617, 617, 617, 617, 617, 0, 0, 0, 0, 0, 0, 0,
+        433, 433, 433, 433, 433, 433, 433, 433, 433, 0, 433, 433, 433, 433, 433, 433,
+        433, 433, 433, 433, 433, 433, 433, 435, 434, 434, 434, 434, 434, 434, 434, 0,
+        434, 434, 434, 434, 434, 434, 435, 60, 433, 63, 63, 63, 63, 63, 0, 0,
+        61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0,
+        186, 186, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557,
+        0, 0, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+        0, 559, 558, 558, 558, 558, 558, 558, 558, 559, 558, 558, 559, 558, 558, 0,
+        560, 560, 560, 560, 560, 560, 560, 0, 560, 560, 0, 560, 560, 560, 560, 560,
+        560, 560, 560, 560, 560, 560, 560, 560, 560, 561, 561, 561, 561, 561, 561, 0,
+        0, 0, 561, 0, 561, 561, 0, 561, 561, 561, 187, 561, 187, 187, 560, 561,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0, 0, 0, 0, 0, 0,
+        489, 489, 489, 489, 489, 489, 0, 489, 489, 0, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 491, 491, 491, 491, 491, 0,
+        490, 490, 0, 491, 491, 490, 491, 119, 489, 0, 0, 0, 0, 0, 0, 0,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 0, 0, 0, 0, 0,
+        549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 550, 550, 551, 551, 175,
+        175, 0, 0, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 0, 0,
+        306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 309, 309, 309,
+        309, 309, 309, 309, 309, 308, 308, 308, 308, 309, 309, 309, 309, 309, 309, 309,
+        309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 307, 454, 454, 454, 454, 454, 454, 454, 454,
+        454, 454, 0, 0, 0, 0, 0, 0, 455, 455, 455, 455, 455, 455, 455, 455,
+        455, 455, 455, 455, 455, 455, 455, 0, 85, 85, 85, 85, 85, 0, 0, 0,
+        454, 454, 454, 454, 0, 0, 0, 0, 457, 457, 457, 457, 457, 457, 457, 457,
+        457, 86, 86, 0, 0, 0, 0, 0, 473, 473, 473, 473, 473, 473, 473, 473,
+        473, 473, 473, 473, 473, 473, 473, 0, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 0, 0, 0, 0, 0, 0, 0, 415, 415, 415, 415, 415, 415, 415, 415,
+        415, 415, 415, 415, 415, 415, 415, 0, 424, 0, 0, 0, 0, 0, 0, 0,
+        579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 0,
+        204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 0, 0, 0, 0, 205, 205,
+        673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 0,
+        310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 0, 0, 0, 0, 0, 0,
+        426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 0, 0,
+        49, 49, 49, 49, 49, 50, 0, 0, 615, 615, 615, 615, 615, 615, 615, 615,
+        246, 246, 246, 246, 246, 246, 246, 249, 249, 249, 249, 249, 250, 250, 250, 250,
+        614, 614, 614, 614, 249, 250, 0, 0, 247, 247, 247, 247, 247, 247, 247, 247,
+        247, 247, 0, 248, 248, 248, 248, 248, 248, 248, 0, 615, 615, 615, 615, 615,
+        0, 0, 0, 0, 0, 615, 615, 615, 768, 768, 768, 768, 768, 768, 768, 768,
+        740, 740, 740, 740, 740, 740, 740, 740, 189, 189, 189, 189, 189, 189, 189, 189,
+        189, 189, 189, 189, 189, 189, 189, 190, 190, 190, 190, 0, 0, 0, 0, 0,
+        570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 0, 0, 0, 0, 571,
+        570, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572,
+        0, 0, 0, 0, 0, 0, 0, 571, 571, 571, 571, 569, 569, 569, 569, 569,
+        569, 569, 569, 569, 569, 569, 569, 569, 720, 718, 373, 708, 379, 0, 0, 0,
+        710, 710, 0, 0, 0, 0, 0, 0, 721, 721, 721, 721, 721, 721, 721, 721,
+        717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 717, 0, 0,
+        721, 0, 0, 0, 0, 0, 0, 0, 715, 715, 715, 715, 0, 715, 715, 715,
+        715, 715, 715, 715, 0, 715, 715, 0, 716, 714, 714, 714, 714, 714, 714, 714,
+        716, 716, 716, 0, 0, 0, 0, 0, 714, 714, 714, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 716, 716, 716, 716, 719, 719, 719, 719, 719, 719, 719, 719,
+        719, 719, 719, 719, 0, 0, 0, 0, 471, 471, 471, 471, 471, 471, 471, 471,
+        471, 471, 471, 0, 0, 0, 0, 0, 471, 471, 471, 471, 471, 0, 0, 0,
+        471, 0, 0, 0, 0, 0, 0, 0, 471, 471, 0, 0, 102, 100, 472, 101,
+        781, 781, 781, 781, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 0, 0,
+        18, 18, 18, 18, 18, 18, 18, 0, 15, 15, 15, 15, 0, 0, 0, 0,
+        15, 15, 15, 15, 15, 15, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 2, 2, 18, 18, 18, 15, 15, 15, 2, 2, 2,
+        2, 2, 2, 781, 781, 781, 781, 781, 781, 781, 781, 18, 18, 18, 18, 18,
+        18, 18, 18, 15, 15, 18, 18, 18, 18, 18, 18, 18, 15, 15, 15, 15,
+        15, 15, 18, 18, 18, 18, 15, 15, 114, 114, 110, 110, 110, 114, 0, 0,
+        4, 0, 0, 0, 0, 0, 0, 0, 756, 756, 756, 756, 756, 756, 756, 756,
+        756, 756, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724, 724,
+        724, 724, 724, 724, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 724, 724,
+        724, 724, 724, 724, 724, 0, 724, 724, 724, 724, 724, 724, 756, 0, 756, 756,
+        0, 0, 756, 0, 0, 756, 756, 0, 0, 756, 756, 756, 756, 0, 756, 756,
+        724, 724, 0, 724, 0, 724, 724, 724, 724, 724, 724, 724, 0, 724, 724, 724,
+        724, 724, 724, 724, 756, 756, 0, 756, 756, 756, 756, 0, 0, 756, 756, 756,
+        756, 756, 756, 756, 756, 0, 756, 756, 756, 756, 756, 756, 756, 0, 724, 724,
+        756, 756, 0, 756, 756, 756, 756, 0, 756, 756, 756, 756, 756, 0, 756, 0,
+        0, 0, 756, 756, 756, 756, 756, 756, 756, 0, 724, 724, 724, 724, 724, 724,
+        724, 724, 724, 724, 724, 724, 0, 0, 756, 12, 724, 724, 724, 724, 724, 724,
+        724, 724, 724, 12, 724, 724, 724, 724, 724, 724, 756, 756, 756, 756, 756, 756,
+        756, 756, 756, 12, 724, 724, 724, 724, 724, 724, 724, 724, 724, 12, 724, 724,
+        756, 756, 756, 756, 756, 12, 724, 724, 724, 724, 724, 724, 724, 724, 724, 12,
+        724, 724, 724, 724, 724, 724, 756, 756, 756, 756, 756, 756, 756, 756, 756, 12,
+        724, 12, 724, 724, 724, 724, 724, 724, 724, 724, 756, 724, 0, 0, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 273, 273, 273, 273, 273, 273, 273, 273,
+        271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 273,
+        273, 273, 273, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 273, 273, 273,
+        273, 273, 273, 273, 273, 271, 273, 273, 273, 273, 273, 273, 271, 273, 273, 272,
+        272, 272, 272, 272, 0, 0, 0, 0, 0, 0, 0, 271, 271, 271, 271, 271,
+        0, 271, 271, 271, 271, 271, 271, 271, 737, 737, 534, 737, 737, 737, 737, 737,
+        478, 478, 478, 478, 478, 478, 478, 0, 478, 478, 478, 478, 478, 478, 478, 478,
+        478, 0, 0, 478, 478, 478, 478, 478, 478, 478, 0, 478, 478, 0, 478, 478,
+        478, 478, 478, 0, 0, 0, 0, 0, 596, 596, 596, 596, 596, 596, 596, 596,
+        596, 596, 596, 596, 596, 0, 0, 0, 225, 225, 225, 225, 225, 225, 225, 595,
+        595, 595, 595, 595, 595, 595, 0, 0, 226, 226, 226, 226, 226, 226, 226, 226,
+        226, 226, 0, 0, 0, 0, 596, 227, 690, 690, 690, 690, 690, 690, 690, 690,
+        690, 690, 690, 690, 690, 690, 332, 0, 694, 694, 694, 694, 694, 694, 694, 694,
+        694, 694, 694, 694, 336, 336, 336, 336, 337, 337, 337, 337, 337, 337, 337, 337,
+        337, 337, 0, 0, 0, 0, 0, 338, 476, 476, 476, 476, 0, 476, 476, 0,
+        566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 0, 0, 196,
+        196, 196, 196, 196, 196, 196, 196, 196, 195, 195, 195, 195, 195, 195, 195, 0,
+        757, 757, 757, 757, 757, 757, 757, 757, 757, 757, 726, 726, 726, 726, 726, 726,
+        726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 20, 20, 20, 411,
+        20, 20, 20, 410, 0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 0, 0, 0, 0, 22, 22, 0, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 15, 4, 4, 4, 13, 4, 4, 4, 4, 0, 0, 0,
+        4, 4, 4, 4, 4, 4, 15, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+        417, 417, 417, 417, 0, 417, 417, 417, 0, 417, 417, 0, 417, 0, 0, 417,
+        0, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 0, 417, 417, 417, 417,
+        0, 417, 0, 417, 0, 0, 0, 0, 0, 0, 417, 0, 0, 0, 0, 417,
+        0, 417, 0, 417, 0, 417, 417, 417, 0, 417, 0, 417, 0, 417, 0, 417,
+        0, 417, 417, 417, 417, 0, 417, 0, 417, 417, 0, 417, 417, 417, 417, 417,
+        417, 417, 417, 417, 0, 0, 0, 0, 0, 417, 417, 417, 0, 417, 417, 417,
+        32, 32, 0, 0, 0, 0, 0, 0, 797, 797, 797, 797, 812, 797, 797, 797,
+        797, 797, 797, 797, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796,
+        797, 797, 797, 797, 797, 797, 797, 796, 796, 797, 797, 797, 797, 797, 797, 797,
+        797, 797, 797, 797, 797, 797, 797, 812, 797, 797, 797, 797, 797, 797, 796, 796,
+        345, 345, 345, 4, 4, 797, 797, 797, 353, 353, 353, 353, 353, 353, 15, 797,
+        773, 773, 353, 353, 353, 353, 353, 353, 773, 773, 15, 15, 797, 797, 797, 797,
+        810, 810, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 810, 810,
+        773, 773, 353, 353, 353, 353, 812, 353, 353, 812, 812, 812, 812, 812, 812, 812,
+        812, 812, 812, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 797, 796, 796,
+        796, 796, 796, 796, 796, 796, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794,
+        377, 812, 808, 796, 796, 796, 796, 796, 371, 371, 812, 371, 371, 371, 371, 371,
+        371, 371, 371, 371, 371, 371, 371, 812, 371, 371, 812, 812, 812, 812, 812, 808,
+        812, 812, 812, 371, 796, 796, 796, 796, 371, 796, 796, 796, 796, 796, 796, 796,
+        812, 812, 796, 796, 796, 796, 796, 796, 800, 800, 800, 800, 800, 800, 796, 796,
+        812, 803, 797, 797, 803, 803, 803, 803, 803, 803, 803, 803, 803, 812, 812, 812,
+        812, 812, 812, 812, 812, 812, 803, 812, 812, 812, 812, 812, 812, 803, 812, 812,
+        812, 812, 812, 812, 797, 797, 803, 803, 797, 803, 803, 803, 797, 797, 803, 803,
+        812, 812, 812, 803, 803, 803, 803, 812, 812, 812, 812, 812, 803, 803, 803, 803,
+        803, 803, 803, 803, 803, 803, 803, 803, 812, 797, 797, 803, 812, 803, 797, 803,
+        812, 812, 812, 795, 795, 795, 795, 795, 812, 812, 812, 812, 812, 812, 812, 803,
+        812, 803, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 803, 797, 812,
+        812, 812, 812, 812, 812, 812, 15, 15, 15, 15, 15, 15, 15, 15, 797, 797,
+        797, 803, 803, 812, 812, 812, 812, 797, 803, 797, 797, 803, 803, 803, 803, 803,
+        803, 803, 812, 797, 797, 797, 797, 797, 797, 797, 803, 803, 803, 803, 797, 797,
+        803, 797, 797, 797, 797, 812, 812, 797, 797, 797, 797, 797, 812, 803, 797, 797,
+        803, 797, 797, 797, 797, 797, 797, 797, 797, 803, 803, 797, 797, 797, 797, 797,
+        797, 797, 797, 797, 803, 797, 797, 797, 797, 797, 803, 803, 803, 797, 797, 797,
+        797, 803, 803, 803, 797, 797, 797, 797, 797, 797, 797, 797, 803, 803, 803, 797,
+        797, 803, 797, 803, 797, 797, 797, 797, 803, 797, 797, 797, 797, 797, 797, 803,
+        797, 797, 797, 803, 797, 797, 797, 797, 797, 797, 803, 812, 812, 812, 812, 812,
+        812, 812, 812, 812, 812, 812, 797, 797, 797, 797, 797, 803, 812, 803, 803, 803,
+        812, 812, 812, 797, 797, 812, 812, 812, 796, 796, 796, 796, 796, 812, 812, 812,
+        803, 803, 803, 803, 803, 803, 797, 797, 797, 803, 797, 812, 812, 796, 796, 796,
+        803, 797, 797, 803, 812, 812, 812, 812, 812, 812, 812, 812, 812, 796, 796, 796,
+        15, 15, 15, 15, 796, 796, 796, 796, 15, 15, 15, 15, 15, 797, 797, 797,
+        797, 796, 796, 796, 796, 796, 796, 796, 812, 812, 812, 812, 796, 796, 796, 796,
+        812, 796, 796, 796, 796, 796, 796, 796, 15, 15, 796, 796, 796, 796, 796, 796,
+        15, 15, 15, 15, 15, 15, 796, 796, 797, 797, 796, 796, 796, 796, 796, 796,
+        15, 15, 15, 15, 812, 812, 812, 812, 812, 812, 812, 15, 812, 812, 812, 812,
+        812, 812, 812, 812, 812, 812, 15, 812, 812, 812, 812, 812, 812, 812, 812, 796,
+        812, 812, 812, 796, 796, 796, 796, 796, 812, 812, 812, 812, 812, 812, 796, 796,
+        15, 15, 15, 0, 15, 15, 15, 15, 3, 3, 0, 0, 0, 0, 0, 0,
+        796, 796, 796, 796, 796, 796, 0, 0, 709, 361, 361, 361, 361, 361, 361, 361,
+        361, 361, 361, 361, 361, 361, 0, 0, 709, 709, 709, 361, 361, 361, 361, 361,
+        780, 781, 780, 780, 780, 780, 780, 780, 344, 344, 344, 344, 344, 344, 0, 0,
+    };
+
+    static constexpr std::uint32_t results[813] = {
+        0x0000001D, 0x0000001B, 0x00000106, 0x00000108, 0x0000010A, 0x0000010B,
+        0x0000010C, 0x0000010D, 0x0000010E, 0x0000010F, 0x00000110, 0x00000111,
+        0x00000112, 0x00000113, 0x00000114, 0x00000115, 0x00000119, 0x0000011A,
+        0x00000205, 0x00000207, 0x00000305, 0x00000308, 0x00000311, 0x00000405,
+        0x00000408, 0x0000040A, 0x00000411, 0x00000415, 0x00000605, 0x00000608,
+        0x0000060A, 0x00000611, 0x00000612, 0x00000613, 0x00000614, 0x00000615,
+        0x0000061A, 0x0000070C, 0x00000711, 0x00000713, 0x00000715, 0x00000811,
+        0x00000905, 0x00000906, 0x00000908, 0x00000911, 0x00000915, 0x00000A05,
+        0x00000A11, 0x00000B05, 0x00000B11, 0x00000C05, 0x00000C06, 0x00000C11,
+        0x00000D05, 0x00000D08, 0x00000D0A, 0x00000D11, 0x00000D13, 0x00000D15,
+        0x00000E05, 0x00000E08, 0x00000E0A, 0x00000E11, 0x00000F14, 0x00001005,
+        0x00001008, 0x0000100A, 0x00001011, 0x00001115, 0x00001211, 0x0000140C,
+        0x00001411, 0x00001415, 0x00001611, 0x00001705, 0x00001708, 0x00001711,
+        0x00001808, 0x00001811, 0x00001A0A, 0x00001B05, 0x00001B0A, 0x00001B11,
+        0x00001B15, 0x00001C11, 0x00001E11, 0x00001F05, 0x00001F07, 0x00001F11,
+        0x00001F15, 0x00002105, 0x00002108, 0x00002111, 0x00002205, 0x00002206,
+        0x00002208, 0x00002211, 0x00002305, 0x00002311, 0x00002405, 0x00002411,
+        0x00002415, 0x0000251A, 0x00002805, 0x0000280A, 0x00002811, 0x00002815,
+        0x00002C05, 0x00002C06, 0x00002D05, 0x00002D0A, 0x00002D12, 0x00002D14,
+        0x00002D15, 0x00002E05, 0x00002E08, 0x00002E11, 0x00002E13, 0x00002F05,
+        0x00002F08, 0x00003005, 0x00003008, 0x00003011, 0x00003308, 0x00003406,
+        0x0000350A, 0x00003605, 0x0000360C, 0x00003611, 0x00003612, 0x0000380A,
+        0x00003811, 0x0000390A, 0x00003A0A, 0x00003B05, 0x00003B06, 0x00003B08,
+        0x00003B11, 0x00003C05, 0x00003C11, 0x00003C1A, 0x00003D05, 0x00003D08,
+        0x00003D11, 0x00003F05, 0x00003F08, 0x00003F11, 0x00004005, 0x0000400A,
+        0x00004011, 0x00004205, 0x00004208, 0x0000420A, 0x00004211, 0x00004213,
+        0x00004215, 0x00004305, 0x00004306, 0x00004311, 0x00004405, 0x00004408,
+        0x00004505, 0x00004508, 0x00004705, 0x00004708, 0x00004711, 0x00004805,
+        0x00004808, 0x00004811, 0x00004815, 0x00004B11, 0x00004D11, 0x00004E05,
+        0x00004E11, 0x00004F11, 0x00005005, 0x00005008, 0x0000500A, 0x00005015,
+        0x00005105, 0x00005111, 0x00005205, 0x0000520A, 0x00005211, 0x00005215,
+        0x00005311, 0x00005405, 0x00005408, 0x0000550A, 0x00005511, 0x00005605,
+        0x00005606, 0x00005608, 0x00005611, 0x00005705, 0x0000570A, 0x0000580A,
+        0x00005B05, 0x00005B08, 0x00005B11, 0x00005C08, 0x00005C0C, 0x00005C11,
+        0x00005D08, 0x00005D11, 0x00005E11, 0x00005F05, 0x00005F08, 0x00005F11,
+        0x00005F15, 0x0000600A, 0x00006105, 0x00006111, 0x00006208, 0x0000620A,
+        0x00006215, 0x00006305, 0x00006308, 0x00006311, 0x00006405, 0x00006408,
+        0x00006411, 0x00006413, 0x00006415, 0x00006605, 0x00006608, 0x00006615,
+        0x0000670D, 0x0000670E, 0x00006808, 0x00006811, 0x0000690A, 0x00006A0A,
+        0x00006B0A, 0x00006D11, 0x00006E0A, 0x00006F0A, 0x00006F11, 0x00007105,
+        0x00007111, 0x00007205, 0x00007208, 0x0000720A, 0x00007215, 0x00007408,
+        0x00007505, 0x00007508, 0x0000750A, 0x00007511, 0x00007515, 0x0000760A,
+        0x00007615, 0x00007811, 0x0000790A, 0x00007911, 0x00007A0A, 0x00007A11,
+        0x00007B06, 0x00007B11, 0x00007D05, 0x00007D11, 0x00007E05, 0x00007E08,
+        0x00007E11, 0x00007F05, 0x00007F06, 0x00007F08, 0x00007F11, 0x00008105,
+        0x00008111, 0x00008205, 0x00008211, 0x00008215, 0x00008305, 0x00008308,
+        0x0000830A, 0x00008311, 0x00008405, 0x0000840A, 0x00008411, 0x00008508,
+        0x00008605, 0x00008611, 0x00008705, 0x00008706, 0x00008708, 0x00008711,
+        0x00008805, 0x00008815, 0x00008905, 0x00008911, 0x0000891A, 0x00008A05,
+        0x00008A06, 0x00008D05, 0x00008D08, 0x00008D11, 0x00008E05, 0x00008E11,
+        0x00008F05, 0x00008F06, 0x00008F08, 0x00008F11, 0x00009005, 0x00009008,
+        0x0000900A, 0x00009011, 0x00009013, 0x00009015, 0x00009108, 0x00009305,
+        0x00009308, 0x0000930A, 0x00009311, 0x00009315, 0x00009505, 0x00009508,
+        0x00009511, 0x00009605, 0x00009606, 0x00009608, 0x0000960A, 0x0000960D,
+        0x0000960E, 0x00009611, 0x00009615, 0x00009705, 0x00009711, 0x00009805,
+        0x00009808, 0x00009811, 0x00009905, 0x00009A11, 0x00009B08, 0x00009B11,
+        0x00009D05, 0x00009D08, 0x00009D13, 0x00009E08, 0x00009E0A, 0x00009F0C,
+        0x0000A105, 0x0000A111, 0x0001001C, 0x0001010A, 0x0001010C, 0x0001010F,
+        0x00010110, 0x00010111, 0x00010112, 0x00010113, 0x00010114, 0x00010115,
+        0x00010205, 0x0002010D, 0x0002010E, 0x00020111, 0x00020112, 0x00020113,
+        0x00020115, 0x0003001D, 0x0003010A, 0x0003010B, 0x0003010C, 0x0003010D,
+        0x0003010E, 0x00030111, 0x00030112, 0x00030113, 0x00030114, 0x00030115,
+        0x00030205, 0x00033111, 0x00033115, 0x00033206, 0x00033215, 0x00033715,
+        0x00033E15, 0x00034105, 0x0003A015, 0x00040108, 0x0004010B, 0x0004010C,
+        0x0004010D, 0x0004010E, 0x00040111, 0x00040112, 0x00040113, 0x00040114,
+        0x00040115, 0x0005010B, 0x0005010C, 0x0005010D, 0x0005010E, 0x00050111,
+        0x00050112, 0x00050113, 0x00050114, 0x00050115, 0x01000116, 0x01000117,
+        0x01000118, 0x01000119, 0x01006716, 0x01040116, 0x01050116, 0x02000103,
+        0x02000104, 0x02000205, 0x02000303, 0x02000305, 0x02000404, 0x02000405,
+        0x02000406, 0x02000504, 0x02000603, 0x02000604, 0x02000605, 0x02000703,
+        0x02000804, 0x02000904, 0x02000905, 0x02000906, 0x02000A04, 0x02000A09,
+        0x02000B04, 0x02000C04, 0x02000C05, 0x02000C06, 0x02000D04, 0x02000D05,
+        0x02000D06, 0x02000E04, 0x02000E05, 0x02000E06, 0x02001004, 0x02001005,
+        0x02001006, 0x02001204, 0x02001205, 0x02001206, 0x02001304, 0x02001305,
+        0x02001404, 0x02001504, 0x02001604, 0x02001704, 0x02001705, 0x02001706,
+        0x02001804, 0x02001805, 0x02001806, 0x02001A04, 0x02001C04, 0x02001C09,
+        0x02001D04, 0x02001E04, 0x02001F03, 0x02001F04, 0x02001F05, 0x02002103,
+        0x02002104, 0x02002105, 0x02002106, 0x02002204, 0x02002205, 0x02002206,
+        0x02002304, 0x02002305, 0x02002306, 0x02002404, 0x02002405, 0x02002504,
+        0x02002604, 0x02002704, 0x02002804, 0x02002903, 0x02002A05, 0x02002B04,
+        0x02002B09, 0x02002C04, 0x02002C05, 0x02002C06, 0x02002D02, 0x02002D09,
+        0x02002E04, 0x02002E05, 0x02002E06, 0x02002F04, 0x02002F05, 0x02002F06,
+        0x02003004, 0x02003005, 0x02003006, 0x02003204, 0x02003304, 0x02003305,
+        0x02003404, 0x02003405, 0x02003504, 0x02003604, 0x02003605, 0x02003804,
+        0x02003904, 0x02003A04, 0x02003B04, 0x02003B05, 0x02003B06, 0x02003C04,
+        0x02003C05, 0x02003C06, 0x02003D04, 0x02003D05, 0x02003D06, 0x02003F04,
+        0x02003F05, 0x02004004, 0x02004005, 0x02004203, 0x02004204, 0x02004205,
+        0x02004206, 0x02004304, 0x02004305, 0x02004306, 0x02004404, 0x02004405,
+        0x02004406, 0x02004503, 0x02004504, 0x02004505, 0x02004602, 0x02004603,
+        0x02004604, 0x02004609, 0x02004704, 0x02004705, 0x02004706, 0x02004804,
+        0x02004805, 0x02004806, 0x02004904, 0x02004A04, 0x02004B03, 0x02004B04,
+        0x02004C04, 0x02004D04, 0x02004E04, 0x02004F04, 0x02004F05, 0x02004F06,
+        0x02005004, 0x02005005, 0x02005006, 0x02005104, 0x02005204, 0x02005304,
+        0x02005305, 0x02005306, 0x02005404, 0x02005405, 0x02005603, 0x02005604,
+        0x02005605, 0x02005606, 0x02005704, 0x02005804, 0x02005904, 0x02005A03,
+        0x02005A04, 0x02005A05, 0x02005A06, 0x02005B04, 0x02005B05, 0x02005B06,
+        0x02005C03, 0x02005C04, 0x02005C05, 0x02005D04, 0x02005E04, 0x02005F03,
+        0x02005F04, 0x02005F05, 0x02005F06, 0x02006004, 0x02006104, 0x02006105,
+        0x02006106, 0x02006204, 0x02006304, 0x02006305, 0x02006306, 0x02006403,
+        0x02006404, 0x02006603, 0x02006604, 0x02006704, 0x02006803, 0x02006804,
+        0x02006A04, 0x02006B04, 0x02006C04, 0x02006C05, 0x02006D04, 0x02006D09,
+        0x02006E04, 0x02006F04, 0x02007004, 0x02007104, 0x02007204, 0x02007205,
+        0x02007206, 0x02007404, 0x02007503, 0x02007504, 0x02007604, 0x02007704,
+        0x02007804, 0x02007904, 0x02007A04, 0x02007B04, 0x02007B05, 0x02007B06,
+        0x02007C04, 0x02007C09, 0x02007D03, 0x02007D04, 0x02007D05, 0x02007E04,
+        0x02007E05, 0x02007E06, 0x02007F04, 0x02007F05, 0x02007F06, 0x02008004,
+        0x02008104, 0x02008105, 0x02008106, 0x02008304, 0x02008305, 0x02008306,
+        0x02008404, 0x02008504, 0x02008604, 0x02008605, 0x02008606, 0x02008704,
+        0x02008705, 0x02008706, 0x02008804, 0x02008805, 0x02008806, 0x02008904,
+        0x02008905, 0x02008A04, 0x02008A05, 0x02008B04, 0x02008B05, 0x02008C04,
+        0x02008D03, 0x02008D04, 0x02008D05, 0x02008D06, 0x02008E03, 0x02008E04,
+        0x02008E05, 0x02008F04, 0x02008F05, 0x02008F06, 0x02009004, 0x02009005,
+        0x02009006, 0x02009104, 0x02009304, 0x02009305, 0x02009306, 0x02009404,
+        0x02009405, 0x02009503, 0x02009504, 0x02009505, 0x02009604, 0x02009605,
+        0x02009606, 0x02009703, 0x02009704, 0x02009804, 0x02009805, 0x02009806,
+        0x02009904, 0x02009A04, 0x02009B03, 0x02009B04, 0x02009D04, 0x02009E04,
+        0x02009F04, 0x02009F05, 0x0200A104, 0x0200A105, 0x0200A106, 0x02010103,
+        0x02020103, 0x02023204, 0x02023E04, 0x02030103, 0x02030104, 0x02030F04,
+        0x02033103, 0x02033104, 0x02033106, 0x02033109, 0x02033204, 0x02033703,
+        0x02033704, 0x02033E03, 0x02033E04, 0x02034104, 0x02036503, 0x02036504,
+        0x02039203, 0x02039204, 0x0203A003, 0x0203A004, 0x06000101, 0x06000103,
+        0x06000301, 0x06000701, 0x06001901, 0x06001B01, 0x06001F01, 0x06001F03,
+        0x06002001, 0x06002901, 0x06002A01, 0x06002D01, 0x06002D03, 0x06004601,
+        0x06004603, 0x06004609, 0x06005501, 0x06006901, 0x06007301, 0x06009C01,
+        0x06009E01, 0x06010101, 0x06010115, 0x06010205, 0x06011F01, 0x06012D01,
+        0x06014601, 0x06014603, 0x06014604, 0x06014609, 0x06044601, 0x06054601,
+        0x0A000100, 0x0A000300, 0x0A000700, 0x0A001900, 0x0A001B00, 0x0A001F00,
+        0x0A002000, 0x0A002900, 0x0A002A00, 0x0A002D00, 0x0A004600, 0x0A004609,
+        0x0A005500, 0x0A006900, 0x0A007300, 0x0A009C00, 0x0A009E00, 0x0A010115,
+        0x0A011F00, 0x0A012D00, 0x0A014600, 0x0A014609, 0x0A044600, 0x0A054600,
+        0x1000001D, 0x1000011A, 0x1000021A, 0x1000061A, 0x10004205, 0x10005C05,
+        0x10005C1A, 0x1001011A, 0x10010205, 0x12003204, 0x12023204, 0x12033204,
+        0x20050108, 0x20050111, 0x60000115, 0x60030114, 0x8000001D, 0x80000115,
+        0x80010112, 0x80010115, 0x80030115, 0xA0000111, 0xA0000112, 0xA0000115,
+        0xA0010112, 0xA0010115, 0xA003010C, 0xA0030111, 0xA0030115, 0xA6000101,
+        0xAA010115, 0xE0030112, 0xE0030115,
+    };
+};
+
+template <typename T>
+constexpr int property_tables<T>::shift1;
+
+template <typename T>
+constexpr int property_tables<T>::shift2;
+
+template <typename T>
+constexpr std::uint8_t property_tables<T>::stage1[];
+
+template <typename T>
+constexpr std::uint16_t property_tables<T>::stage2[];
+
+template <typename T>
+constexpr std::uint16_t property_tables<T>::stage3[];
+
+template <typename T>
+constexpr std::uint32_t property_tables<T>::results[];
+
+constexpr std::uint32_t property_lookup(char32_t c)
+{
+    using t = property_tables<>;
+    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+}
+
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,146 @@
+
+#ifndef TCB_UNICODE_DETAIL_SEGMENT_VIEW_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_SEGMENT_VIEW_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// A segment of text (such as a grapheme cluster or a word), as a range of
+/// the code units it was found in, which are in the encoding InEncoding
+///
+template <typename Iter, typename InEncoding = detail::iter_value_t<Iter>>
+class text_segment {
+public:
+    constexpr text_segment() = default;
+
+    constexpr text_segment(Iter first, Iter last)
+        : first_(first), last_(last) {}
+
+    constexpr Iter begin() const { return first_; }
+
+    constexpr Iter end() const { return last_; }
+
+    constexpr bool empty() const { return first_ == last_; }
+
+    template <typename Container,
+              typename = std::enable_if_t<detail::is_compatible_container_v<Container, Iter, Iter>>>
+    constexpr operator Container() const
+    {
+        return Container(first_, last_);
+    }
+
+private:
+    Iter first_{};
+    Iter last_{};
+};
+
+namespace detail {
+
+///
+/// A view of the segments of [first, last), where `Segmenter::next(first,
+/// last)` returns the end of the segment starting at `first`, which must be
+/// a boundary, and `Segmenter::encoding` is the encoding of the code units.
+/// The segments are found one at a time as the view is iterated.
+///
+template <typename Iter, typename Sentinel, typename Segmenter>
+class segment_view {
+private:
+    struct iterator {
+        using value_type = text_segment<Iter, typename Segmenter::encoding>;
+        using difference_type = typename std::iterator_traits<Iter>::difference_type;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr iterator() = default;
+
+        iterator(Iter first, Sentinel last)
+            : last_(last)
+        {
+            advance(first);
+        }
+
+        constexpr reference operator*() const
+        {
+            return segment_;
+        }
+
+        constexpr pointer operator->() const
+        {
+            return &segment_;
+        }
+
+        iterator& operator++()
+        {
+            advance(segment_.end());
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator temp{*this};
+            this->operator++();
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return segment_.begin() == other.segment_.begin();
+        }
+
+        bool operator!=(const iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        void advance(Iter first)
+        {
+            segment_ = value_type{first, first == last_ ? first : Segmenter::next(first, last_)};
+        }
+
+        value_type segment_{};
+        Sentinel last_{};
+    };
+
+public:
+    constexpr segment_view() = default;
+
+    constexpr segment_view(Iter first, Sentinel last)
+        : first_(first), last_(last) {}
+
+    iterator begin() const { return iterator{first_, last_}; }
+
+    iterator cbegin() const { return begin(); }
+
+    iterator end() const { return iterator{end_iterator(first_, last_), last_}; }
+
+    iterator cend() const { return end(); }
+
+private:
+    static Iter end_iterator(Iter, Iter last) { return last; }
+
+    template <typename S>
+    static Iter end_iterator(Iter first, S last)
+    {
+        while (first != last)
+            ++first;
+        return first;
+    }
+
+    Iter first_{};
+    Sentinel last_{};
+};
+
+} // end namespace detail
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
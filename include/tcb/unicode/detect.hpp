@@ -0,0 +1,256 @@
+
+#ifndef TCB_UNICODE_DETECT_HPP_INCLUDED
+#define TCB_UNICODE_DETECT_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// The result of detect_encoding(): the encoding, and the size in bytes of
+/// the byte order mark (if any) which should be skipped before decoding.
+/// Converts implicitly to `encoding`, so it can be passed straight to the
+/// byte buffer conversion functions and utf_transcoder.
+///
+struct detected_encoding {
+    encoding enc = encoding::utf8;
+    std::size_t bom_size = 0;
+
+    constexpr operator encoding() const { return enc; }
+};
+
+namespace detail {
+
+///
+/// Counts the zero bytes at each byte offset modulo 4 in [data, data + size),
+/// examining a machine word at a time
+///
+inline std::array<std::size_t, 4> count_zero_bytes(const unsigned char* data,
+                                                   std::size_t size)
+{
+    constexpr std::uint64_t low7 = 0x7F7F7F7F7F7F7F7Fu;
+    constexpr std::uint64_t ones = 0x0101010101010101u;
+
+    std::array<std::size_t, 4> counts{{}};
+    std::size_t i = 0;
+
+    while (size - i >= 8) {
+        // Each byte lane of the accumulator counts up to 255 words
+        std::uint64_t acc = 0;
+        for (int k = 0; k < 255 && size - i >= 8; k++, i += 8) {
+            std::uint64_t w;
+            std::memcpy(&w, data + i, sizeof(w));
+            // High bit set in exactly the bytes which are zero
+            const std::uint64_t z = ~(((w & low7) + low7) | w | low7);
+            acc += (z >> 7) & ones;
+        }
+        for (int lane = 0; lane < 8; lane++) {
+            const int offset = native_little_endian ? lane : 7 - lane;
+            counts[offset % 4] += (acc >> (8 * lane)) & 0xFF;
+        }
+    }
+    for (; i < size; i++) {
+        counts[i % 4] += data[i] == 0;
+    }
+    return counts;
+}
+
+///
+/// Returns true if [data, data + size) is valid UTF-8, except that if
+/// `truncated` is true it may end part way through a sequence
+///
+inline bool is_valid_utf8_sample(const unsigned char* data, std::size_t size,
+                                 bool truncated)
+{
+    const char* first = reinterpret_cast<const char*>(data);
+    const char* last = first + size;
+
+    while (first != last) {
+        first += ascii_prefix_length(first, last);
+        while (first != last && !is_ascii_unit(*first)) {
+            const code_point c = utf_traits<char>::decode(first, last);
+            if (c == illegal || (c == incomplete && !truncated))
+                return false;
+        }
+    }
+    return true;
+}
+
+///
+/// Returns true if the code units in [data, data + size) are well-formed
+/// UTF-16 in the given byte order, except that if `truncated` is true the
+/// last code unit may be an unpaired leading surrogate
+///
+inline bool is_valid_utf16_sample(const unsigned char* data, std::size_t size,
+                                  bool big_endian, bool truncated)
+{
+    const std::size_t units = size / 2;
+    const int hi = big_endian ? 0 : 1;
+
+    for (std::size_t i = 0; i < units; i++) {
+        const unsigned char h = data[2 * i + hi];
+        if (h < 0xD8 || h > 0xDF)
+            continue;
+        if (h > 0xDB)
+            return false;
+        if (++i == units)
+            return truncated;
+        const unsigned char h2 = data[2 * i + hi];
+        if (h2 < 0xDC || h2 > 0xDF)
+            return false;
+    }
+    return true;
+}
+
+///
+/// Looks for UTF-16 in a sample with no zero bytes to go by, such as CJK text
+/// with no ASCII. Single-byte text has the same mix of bytes at even and odd
+/// offsets, and practically never contains C0 controls other than
+/// whitespace. The high bytes of UTF-16 code units cluster in the blocks of
+/// a few scripts, while the low bytes are spread evenly, so include controls.
+/// Returns the offset of the high bytes (0 for big endian or 1 for little
+/// endian), or -1 if the sample does not look like UTF-16.
+///
+inline int utf16_high_byte_offset(const unsigned char* data, std::size_t size)
+{
+    const std::size_t units = size / 2;
+    if (units < 8)
+        return -1;
+
+    std::size_t counts[2][256] = {};
+    std::size_t controls = 0;
+    for (std::size_t i = 0; i < 2 * units; i++) {
+        const unsigned char b = data[i];
+        ++counts[i % 2][b];
+        controls += b != 0 && b < 0x20 && (b < '\t' || b > '\r');
+    }
+
+    // The high bytes are at the offset where bytes repeat most often
+    unsigned long long clustering[2] = {};
+    for (int b = 0; b < 256; b++) {
+        clustering[0] += static_cast<unsigned long long>(counts[0][b]) * counts[0][b];
+        clustering[1] += static_cast<unsigned long long>(counts[1][b]) * counts[1][b];
+    }
+    if (clustering[0] == clustering[1])
+        return -1;
+    const int high = clustering[1] > clustering[0] ? 1 : 0;
+
+    // A single block (kana, Cyrillic, ...) may not give any controls, but
+    // then one byte makes up most of the high bytes and few of the low bytes
+    bool dominant = false;
+    for (int b = 0; b < 256; b++) {
+        dominant = dominant || (counts[high][b] > units / 2 &&
+                                counts[1 - high][b] <= units / 8);
+    }
+
+    return controls * 64 >= units || dominant ? high : -1;
+}
+
+inline bool is_valid_utf32_sample(const unsigned char* data, std::size_t size,
+                                  bool big_endian)
+{
+    for (std::size_t i = 0; i + 4 <= size; i += 4) {
+        const code_point c = big_endian
+            ? (code_point(data[i]) << 24) | (data[i + 1] << 16) | (data[i + 2] << 8) | data[i + 3]
+            : (code_point(data[i + 3]) << 24) | (data[i + 2] << 16) | (data[i + 1] << 8) | data[i];
+        if (!is_valid_codepoint(c))
+            return false;
+    }
+    return true;
+}
+
+} // end namespace detail
+
+///
+/// Guesses the encoding of the text in [data, data + size). A byte order
+/// mark is used if present. Otherwise, up to `sample_size` bytes are
+/// examined: the distribution of zero bytes by position identifies UTF-32
+/// and UTF-16 (confirmed by checking that the code units or surrogates are
+/// well-formed), and text which is valid UTF-8 is reported as such. Failing
+/// that, UTF-16 with no zero bytes is recognised by the clustering of the
+/// high bytes of its code units. Anything else is assumed to be Latin-1.
+///
+template <typename Byte,
+          typename = std::enable_if_t<detail::is_byte_type<Byte>::value>>
+detected_encoding detect_encoding(const Byte* data, std::size_t size,
+                                  std::size_t sample_size = 65536)
+{
+    const auto p = reinterpret_cast<const unsigned char*>(data);
+
+    // Byte order marks. UTF-32LE must be tested before UTF-16LE.
+    if (size >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+        return {encoding::utf8, 3};
+    if (size >= 4 && p[0] == 0xFF && p[1] == 0xFE && p[2] == 0 && p[3] == 0)
+        return {encoding::utf32le, 4};
+    if (size >= 4 && p[0] == 0 && p[1] == 0 && p[2] == 0xFE && p[3] == 0xFF)
+        return {encoding::utf32be, 4};
+    if (size >= 2 && p[0] == 0xFF && p[1] == 0xFE)
+        return {encoding::utf16le, 2};
+    if (size >= 2 && p[0] == 0xFE && p[1] == 0xFF)
+        return {encoding::utf16be, 2};
+
+    const bool truncated = size > sample_size;
+    const std::size_t n = truncated ? sample_size : size;
+
+    const auto zeros = detail::count_zero_bytes(p, n);
+    const std::size_t even_zeros = zeros[0] + zeros[2];
+    const std::size_t odd_zeros = zeros[1] + zeros[3];
+
+    // UTF-32 always has a zero high byte, and at least one more zero byte
+    // for BMP characters
+    if (n >= 4 && n % 4 == 0 && (truncated || size % 4 == 0)) {
+        const std::size_t units = n / 4;
+        if (zeros[3] == units && zeros[2] > units / 2 &&
+            detail::is_valid_utf32_sample(p, n, false)) {
+            return {encoding::utf32le, 0};
+        }
+        if (zeros[0] == units && zeros[1] > units / 2 &&
+            detail::is_valid_utf32_sample(p, n, true)) {
+            return {encoding::utf32be, 0};
+        }
+    }
+
+    // UTF-16 text with Latin characters has zero high bytes, but (nearly)
+    // no zero low bytes
+    if (n % 2 == 0 || truncated) {
+        if (odd_zeros > 4 * even_zeros &&
+            detail::is_valid_utf16_sample(p, n, false, truncated)) {
+            return {encoding::utf16le, 0};
+        }
+        if (even_zeros > 4 * odd_zeros &&
+            detail::is_valid_utf16_sample(p, n, true, truncated)) {
+            return {encoding::utf16be, 0};
+        }
+    }
+
+    if (detail::is_valid_utf8_sample(p, n, truncated))
+        return {encoding::utf8, 0};
+
+    // UTF-16 text in other scripts, such as CJK, may have no zero bytes
+    if (n % 2 == 0 || truncated) {
+        const int high = detail::utf16_high_byte_offset(p, n);
+        if (high >= 0 &&
+            detail::is_valid_utf16_sample(p, n, high == 0, truncated)) {
+            return {high == 0 ? encoding::utf16be : encoding::utf16le, 0};
+        }
+    }
+
+    return {encoding::latin1, 0};
+}
+
+template <typename String>
+detected_encoding detect_encoding(const String& str)
+{
+    return detect_encoding(str.data(), str.size());
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
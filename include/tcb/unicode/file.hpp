@@ -0,0 +1,227 @@
+
+#ifndef TCB_UNICODE_FILE_HPP_INCLUDED
+#define TCB_UNICODE_FILE_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+[[noreturn]] inline void throw_errno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+struct file_descriptor {
+    explicit file_descriptor(int fd) : fd(fd) {}
+
+    file_descriptor(const file_descriptor&) = delete;
+    file_descriptor& operator=(const file_descriptor&) = delete;
+
+    ~file_descriptor()
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    int fd;
+};
+
+struct memory_map {
+    memory_map(int fd, std::size_t size, int prot, int flags)
+            : size(size)
+    {
+        void* p = ::mmap(nullptr, size, prot, flags, fd, 0);
+        if (p == MAP_FAILED)
+            throw_errno("mmap");
+        data = static_cast<unsigned char*>(p);
+    }
+
+    memory_map(const memory_map&) = delete;
+    memory_map& operator=(const memory_map&) = delete;
+
+    ~memory_map()
+    {
+        ::munmap(data, size);
+    }
+
+    unsigned char* data = nullptr;
+    std::size_t size;
+};
+
+///
+/// Converts the `in_size` bytes at `in` from encoding `from` to encoding
+/// `to`, writing `prefix` followed by the result to the (empty) file `out_fd`
+///
+inline void transcode_to_file(const unsigned char* in, std::size_t in_size, encoding from,
+                              int out_fd, encoding to, unsigned num_threads,
+                              const std::string& prefix)
+{
+    if (in_size == 0 && prefix.empty())
+        return;
+
+    // Split the input into chunks, each beginning on a code point boundary
+    if (num_threads == 0)
+        num_threads = 1;
+    std::vector<std::size_t> bounds{0};
+    for (unsigned i = 1; i < num_threads; i++) {
+        const std::size_t pos = next_code_point_boundary(in, in_size, in_size / num_threads * i, from);
+        if (pos > bounds.back() && pos < in_size)
+            bounds.push_back(pos);
+    }
+    bounds.push_back(in_size);
+    const std::size_t num_chunks = bounds.size() - 1;
+
+    auto run = [num_chunks](auto&& func) {
+        std::vector<std::thread> threads;
+        try {
+            for (std::size_t i = 1; i < num_chunks; i++) {
+                threads.emplace_back(func, i);
+            }
+            func(0);
+        }
+        catch (...) {
+            // Destroying a joinable thread would terminate the program
+            for (auto& t : threads) {
+                t.join();
+            }
+            throw;
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    };
+
+    // First pass: measure the output size of each chunk
+    std::vector<std::size_t> offsets(num_chunks + 1);
+    offsets[0] = prefix.size();
+    run([&](std::size_t i) {
+        offsets[i + 1] = transcode_bytes<false>(
+            in + bounds[i], bounds[i + 1] - bounds[i],
+            from, nullptr, to, true).produced;
+    });
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    const std::size_t out_size = offsets.back();
+    if (out_size == 0)
+        return;
+
+    if (::ftruncate(out_fd, static_cast<off_t>(out_size)) < 0)
+        throw_errno("ftruncate");
+
+    memory_map out_map{out_fd, out_size, PROT_READ | PROT_WRITE, MAP_SHARED};
+    std::copy(prefix.begin(), prefix.end(), out_map.data);
+
+    // Second pass: convert each chunk directly into its place in the output
+    run([&](std::size_t i) {
+        transcode_bytes<true>(
+            in + bounds[i], bounds[i + 1] - bounds[i],
+            from, out_map.data + offsets[i], to, true);
+    });
+}
+
+/// Removes the file at `path` on destruction, unless released
+struct file_remover {
+    explicit file_remover(std::string path) : path(std::move(path)) {}
+
+    file_remover(const file_remover&) = delete;
+    file_remover& operator=(const file_remover&) = delete;
+
+    ~file_remover()
+    {
+        if (!path.empty())
+            ::unlink(path.c_str());
+    }
+
+    std::string path;
+};
+
+} // end namespace detail
+
+///
+/// Converts the file at `in_path` from encoding `from` to encoding `to`,
+/// writing the result to `out_path`. The input is memory mapped, and the
+/// output size is computed up front so that the output can be memory mapped
+/// too. If `num_threads` is greater than one, the input is split into that
+/// many chunks at code point boundaries which are converted in parallel.
+/// The first `skip` bytes of the input, such as a byte order mark, are
+/// left out, and the bytes of `prefix`, such as a byte order mark in the
+/// output encoding, are written before the converted text. The input and output may be the same file, in which case the
+/// output is written to a temporary file in the same directory which then
+/// replaces it. Throws std::system_error on I/O failure.
+///
+inline void transcode_file(const std::string& in_path, const std::string& out_path,
+                           encoding from, encoding to, unsigned num_threads = 1,
+                           std::size_t skip = 0,
+                           const std::string& prefix = std::string{})
+{
+    detail::file_descriptor in_fd{::open(in_path.c_str(), O_RDONLY)};
+    if (in_fd.fd < 0)
+        detail::throw_errno("open");
+
+    struct ::stat st{};
+    if (::fstat(in_fd.fd, &st) < 0)
+        detail::throw_errno("fstat");
+    const std::size_t in_size = static_cast<std::size_t>(st.st_size);
+
+    std::unique_ptr<detail::memory_map> in_map;
+    if (in_size != 0) {
+        in_map.reset(new detail::memory_map{in_fd.fd, in_size, PROT_READ, MAP_PRIVATE});
+        ::madvise(in_map->data, in_size, MADV_SEQUENTIAL);
+    }
+
+    // Truncating the output would destroy the input if they are the same
+    struct ::stat out_st{};
+    const bool same_file = ::stat(out_path.c_str(), &out_st) == 0 &&
+                           out_st.st_dev == st.st_dev && out_st.st_ino == st.st_ino;
+
+    detail::file_remover temp{std::string{}};
+    int fd;
+    if (same_file) {
+        std::string name = out_path + ".XXXXXX";
+        fd = ::mkstemp(&name[0]);
+        if (fd < 0)
+            detail::throw_errno("mkstemp");
+        temp.path = name;
+        ::fchmod(fd, out_st.st_mode & 07777);
+    }
+    else {
+        fd = ::open(out_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+        if (fd < 0)
+            detail::throw_errno("open");
+    }
+    detail::file_descriptor out_fd{fd};
+
+    skip = std::min(skip, in_size);
+    detail::transcode_to_file(in_map ? in_map->data + skip : nullptr, in_size - skip, from,
+                              out_fd.fd, to, num_threads, prefix);
+
+    if (same_file) {
+        if (::rename(temp.path.c_str(), out_path.c_str()) < 0)
+            detail::throw_errno("rename");
+        temp.path.clear();
+    }
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,237 @@
+
+#ifndef TCB_UNICODE_GRAPHEMES_HPP_INCLUDED
+#define TCB_UNICODE_GRAPHEMES_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/break_tables.hpp>
+#include <tcb/unicode/detail/segment_view.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Extended grapheme cluster segmentation, as in Unicode Standard Annex #29
+/// (version 14.0).
+///
+/// Boundaries are found directly in the code units of the input, which may
+/// be in any encoding this library reads; nothing is converted to UTF-32.
+/// Each code point is looked up once, and the rules are applied with a table
+/// of the properties each property joins with, plus a little state for the
+/// emoji ZWJ sequence and regional indicator rules. A code point other than
+/// CR followed by an ASCII code unit always ends a cluster, so in ASCII text
+/// only one code unit of lookahead is examined per cluster.
+///
+/// Ill-formed sequences are treated as U+FFFD.
+///
+
+namespace detail {
+
+constexpr std::uint16_t grapheme_bit(grapheme_cluster_break b)
+{
+    return static_cast<std::uint16_t>(1u << static_cast<unsigned>(b));
+}
+
+///
+/// Returns the set of properties which do not begin a new cluster after a
+/// code point with property `prev`, under rules GB3 to GB9b
+///
+constexpr std::uint16_t grapheme_joins(grapheme_cluster_break prev)
+{
+    using gcb = grapheme_cluster_break;
+    // GB9, GB9a
+    constexpr std::uint16_t extenders = grapheme_bit(gcb::extend) |
+                                        grapheme_bit(gcb::zwj) |
+                                        grapheme_bit(gcb::spacing_mark);
+    switch (prev) {
+    case gcb::cr: // GB3, GB4
+        return grapheme_bit(gcb::lf);
+    case gcb::lf: // GB4
+    case gcb::control:
+        return 0;
+    case gcb::prepend: // GB9b, except before GB5
+        return static_cast<std::uint16_t>(~(grapheme_bit(gcb::cr) | grapheme_bit(gcb::lf) |
+                                            grapheme_bit(gcb::control)));
+    case gcb::l: // GB6
+        return extenders | grapheme_bit(gcb::l) | grapheme_bit(gcb::v) |
+               grapheme_bit(gcb::lv) | grapheme_bit(gcb::lvt);
+    case gcb::lv: // GB7
+    case gcb::v:
+        return extenders | grapheme_bit(gcb::v) | grapheme_bit(gcb::t);
+    case gcb::lvt: // GB8
+    case gcb::t:
+        return extenders | grapheme_bit(gcb::t);
+    default:
+        return extenders;
+    }
+}
+
+template <typename = void>
+struct grapheme_rules {
+    using gcb = grapheme_cluster_break;
+
+    static constexpr std::uint16_t joins[] = {
+        grapheme_joins(gcb::other), grapheme_joins(gcb::cr),
+        grapheme_joins(gcb::lf), grapheme_joins(gcb::control),
+        grapheme_joins(gcb::extend), grapheme_joins(gcb::zwj),
+        grapheme_joins(gcb::regional_indicator), grapheme_joins(gcb::prepend),
+        grapheme_joins(gcb::spacing_mark), grapheme_joins(gcb::l),
+        grapheme_joins(gcb::v), grapheme_joins(gcb::t),
+        grapheme_joins(gcb::lv), grapheme_joins(gcb::lvt),
+        grapheme_joins(gcb::extended_pictographic),
+    };
+};
+
+template <typename T>
+constexpr std::uint16_t grapheme_rules<T>::joins[];
+
+inline grapheme_cluster_break get_grapheme_cluster_break(code_point c)
+{
+    return static_cast<grapheme_cluster_break>(grapheme_cluster_break_lookup(c));
+}
+
+///
+/// The state of the segmentation between two code points, beyond the
+/// property of the first
+///
+class grapheme_state {
+public:
+    using gcb = grapheme_cluster_break;
+
+    explicit grapheme_state(gcb first)
+        : prev_(first),
+          emoji_(first == gcb::extended_pictographic ? in_emoji : none),
+          odd_ri_(first == gcb::regional_indicator) {}
+
+    /// Returns whether there is a boundary before a code point with property
+    /// `next`, and moves past it
+    bool is_boundary(gcb next)
+    {
+        bool joined;
+        if (prev_ == gcb::regional_indicator && next == gcb::regional_indicator) {
+            // GB12, GB13
+            joined = odd_ri_;
+        }
+        else if (emoji_ == after_zwj && next == gcb::extended_pictographic) {
+            // GB11
+            joined = true;
+        }
+        else {
+            joined = (grapheme_rules<>::joins[static_cast<int>(prev_)] & grapheme_bit(next)) != 0;
+        }
+
+        odd_ri_ = next == gcb::regional_indicator && !(prev_ == next && odd_ri_);
+        if (next == gcb::extended_pictographic)
+            emoji_ = in_emoji;
+        else if (next == gcb::zwj && emoji_ == in_emoji)
+            emoji_ = after_zwj;
+        else if (next != gcb::extend || emoji_ != in_emoji)
+            emoji_ = none;
+        prev_ = next;
+        return !joined;
+    }
+
+private:
+    enum emoji_state : std::uint8_t {
+        none,
+        in_emoji,  // after Extended_Pictographic Extend*
+        after_zwj, // after Extended_Pictographic Extend* ZWJ
+    };
+
+    gcb prev_;
+    emoji_state emoji_;
+    bool odd_ri_; // whether prev_ is an unpaired regional indicator
+};
+
+template <typename InEncoding>
+struct grapheme_segmenter {
+    using encoding = InEncoding;
+
+    template <typename Iter, typename Sentinel>
+    static Iter next(Iter first, Sentinel last)
+    {
+        code_point c = decode(first, last);
+        grapheme_state state{get_grapheme_cluster_break(c)};
+
+        while (first != last) {
+            // Nothing joins a preceding ASCII code point other than CR
+            if (c < 0x80 && c != '\r' && is_ascii_unit(*first))
+                return first;
+
+            Iter after = first;
+            c = decode(after, last);
+            if (state.is_boundary(get_grapheme_cluster_break(c)))
+                return first;
+            first = after;
+        }
+        return first;
+    }
+
+private:
+    template <typename Iter, typename Sentinel>
+    static code_point decode(Iter& first, Sentinel last)
+    {
+        return replace_invalid<InEncoding, InEncoding>(utf_traits<InEncoding>::decode(first, last));
+    }
+};
+
+} // end namespace detail
+
+///
+/// A view of the extended grapheme clusters of a sequence of code units, as
+/// text_segments of the underlying iterators
+///
+template <typename Iter, typename Sentinel,
+          typename InEncoding = detail::iter_value_t<Iter>>
+using grapheme_view = detail::segment_view<Iter, Sentinel, detail::grapheme_segmenter<InEncoding>>;
+
+///
+/// Returns the end of the extended grapheme cluster which starts at `first`
+///
+template <typename Iter, typename Sentinel>
+Iter next_grapheme_boundary(Iter first, Sentinel last)
+{
+    return first == last ? first
+        : detail::grapheme_segmenter<detail::iter_value_t<Iter>>::next(first, last);
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+Iter next_grapheme_boundary(Iter first, Sentinel last)
+{
+    return first == last ? first : detail::grapheme_segmenter<InEncoding>::next(first, last);
+}
+
+template <typename Iter, typename Sentinel>
+grapheme_view<Iter, Sentinel> graphemes(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename String>
+auto graphemes(const String& str)
+{
+    return graphemes(std::cbegin(str), std::cend(str));
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+grapheme_view<Iter, Sentinel, InEncoding> graphemes(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+auto graphemes(const String& str)
+{
+    return graphemes<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
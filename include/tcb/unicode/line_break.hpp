@@ -0,0 +1,425 @@
+
+#ifndef TCB_UNICODE_LINE_BREAK_HPP_INCLUDED
+#define TCB_UNICODE_LINE_BREAK_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/break_tables.hpp>
+#include <tcb/unicode/detail/segment_view.hpp>
+#include <tcb/unicode/properties.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Line breaking opportunities, as in Unicode Standard Annex #14 (version
+/// 14.0), with the default rules and no tailoring.
+///
+/// line_breaks() divides text into the segments between break
+/// opportunities, each ending with any spaces after it; a line may be
+/// broken after any segment, and must be broken after one for which
+/// is_mandatory_break() is true. The segments are ranges of the input code
+/// units, in any encoding this library reads, and are found one at a time
+/// with a single code point of lookahead.
+///
+/// The decision between two classes is made with a pair table, built at
+/// compile time from the rules, which says whether the pair breaks when
+/// adjacent and when separated by spaces. The state is only the class
+/// before any spaces and the one before that; combining marks take the
+/// class of the character they follow (rule LB9).
+///
+/// Ill-formed sequences are treated as U+FFFD.
+///
+
+namespace detail {
+
+constexpr std::uint64_t line_bit(line_break b)
+{
+    return std::uint64_t{1} << static_cast<unsigned>(b);
+}
+
+constexpr bool is_line_break_in(line_break b, std::uint64_t set)
+{
+    return (line_bit(b) & set) != 0;
+}
+
+constexpr std::uint64_t line_hard = line_bit(line_break::bk) | line_bit(line_break::cr) |
+                                    line_bit(line_break::lf) | line_bit(line_break::nl);
+constexpr std::uint64_t line_letters = line_bit(line_break::al) | line_bit(line_break::hl);
+constexpr std::uint64_t line_jamo = line_bit(line_break::jl) | line_bit(line_break::jv) |
+                                    line_bit(line_break::jt) | line_bit(line_break::h2) |
+                                    line_bit(line_break::h3);
+
+///
+/// Returns whether there is a break opportunity before `after`, following
+/// `before` with or without spaces in between, under the rules from LB8 to
+/// LB31 which depend only on the classes
+///
+constexpr bool line_breaks_between(line_break before, line_break after, bool spaces)
+{
+    using lb = line_break;
+    constexpr auto closing = line_bit(lb::cl) | line_bit(lb::cp);
+    constexpr auto ideographs = line_bit(lb::id) | line_bit(lb::eb) | line_bit(lb::em);
+    constexpr auto affixes = line_bit(lb::pr) | line_bit(lb::po);
+
+    // LB8
+    if (before == lb::zw)
+        return true;
+    // LB11
+    if (after == lb::wj || (before == lb::wj && !spaces))
+        return false;
+    // LB12, LB12a
+    if (!spaces && (before == lb::gl ||
+                    (after == lb::gl && before != lb::ba && before != lb::hy)))
+        return false;
+    // LB13
+    if (is_line_break_in(after, closing | line_bit(lb::ex) | line_bit(lb::is) | line_bit(lb::sy)))
+        return false;
+    // LB14 to LB17
+    if (before == lb::op ||
+        (before == lb::qu && after == lb::op) ||
+        (is_line_break_in(before, closing) && after == lb::ns) ||
+        (before == lb::b2 && after == lb::b2))
+        return false;
+    // LB18
+    if (spaces || before == lb::sp)
+        return true;
+    // LB19
+    if (after == lb::qu || before == lb::qu)
+        return false;
+    // LB20
+    if (after == lb::cb || before == lb::cb)
+        return true;
+    // LB21, LB21b, LB22
+    if (is_line_break_in(after, line_bit(lb::ba) | line_bit(lb::hy) | line_bit(lb::ns) |
+                                line_bit(lb::in)) ||
+        before == lb::bb || (before == lb::sy && after == lb::hl))
+        return false;
+    // LB23, LB23a, LB24
+    if ((is_line_break_in(before, line_letters) &&
+         (after == lb::nu || is_line_break_in(after, affixes))) ||
+        (before == lb::nu && is_line_break_in(after, line_letters)) ||
+        (before == lb::pr && is_line_break_in(after, ideographs)) ||
+        (is_line_break_in(before, ideographs) && after == lb::po) ||
+        (is_line_break_in(before, affixes) && is_line_break_in(after, line_letters)))
+        return false;
+    // LB25, in the form of example 7 of UAX #14, which the Unicode test
+    // data follows; the parts which look further back or ahead than a
+    // pair are applied by the segmenter
+    if ((is_line_break_in(before, affixes | line_bit(lb::op) | line_bit(lb::hy)) &&
+         after == lb::nu) ||
+        (before == lb::nu && is_line_break_in(after, affixes | line_bit(lb::nu))))
+        return false;
+    // LB26, LB27
+    if ((before == lb::jl && is_line_break_in(after, line_jamo & ~line_bit(lb::jt))) ||
+        ((before == lb::jv || before == lb::h2) && (after == lb::jv || after == lb::jt)) ||
+        ((before == lb::jt || before == lb::h3) && after == lb::jt) ||
+        (is_line_break_in(before, line_jamo) && after == lb::po) ||
+        (before == lb::pr && is_line_break_in(after, line_jamo)))
+        return false;
+    // LB28, LB29
+    if (is_line_break_in(before, line_letters | line_bit(lb::is)) &&
+        is_line_break_in(after, line_letters))
+        return false;
+    // LB30b, for Emoji_Base
+    if (before == lb::eb && after == lb::em)
+        return false;
+    // LB31 (LB30, LB30a and the rest of LB30b depend on more than classes)
+    return true;
+}
+
+enum class line_break_action : std::uint8_t {
+    direct,     // a break, with or without spaces in between
+    indirect,   // a break only if there are spaces in between
+    prohibited, // no break, with or without spaces in between
+};
+
+constexpr int line_break_count = static_cast<int>(line_break::ri) + 1;
+
+struct line_pair_table {
+    line_break_action actions[line_break_count][line_break_count];
+
+    constexpr line_pair_table() : actions{}
+    {
+        for (int b = 0; b < line_break_count; b++) {
+            for (int a = 0; a < line_break_count; a++) {
+                const auto before = static_cast<line_break>(b);
+                const auto after = static_cast<line_break>(a);
+                actions[b][a] = line_breaks_between(before, after, false)
+                                    ? line_break_action::direct
+                                    : line_breaks_between(before, after, true)
+                                          ? line_break_action::indirect
+                                          : line_break_action::prohibited;
+            }
+        }
+    }
+};
+
+template <typename = void>
+struct line_rules {
+    static constexpr line_pair_table pairs{};
+};
+
+template <typename T>
+constexpr line_pair_table line_rules<T>::pairs;
+
+inline line_break get_line_break(code_point c)
+{
+    return static_cast<line_break>(line_break_lookup(c));
+}
+
+inline bool is_east_asian_wide(code_point c)
+{
+    const auto ea = get_east_asian_width(c);
+    return ea == east_asian_width::fullwidth || ea == east_asian_width::wide ||
+           ea == east_asian_width::halfwidth;
+}
+
+template <typename InEncoding>
+struct line_break_segmenter {
+    using encoding = InEncoding;
+    using lb = line_break;
+
+    template <typename Iter, typename Sentinel>
+    static Iter next(Iter first, Sentinel last)
+    {
+        code_point c = decode(first, last);
+        state st;
+        st.raw = get_line_break(c);
+        st.prev = st.raw == lb::cm || st.raw == lb::zwj ? lb::al : st.raw;
+        st.prev_c = c;
+        st.spaces = st.raw == lb::sp;
+        st.odd_ri = st.raw == lb::ri;
+        st.number = st.raw == lb::nu ? in_number : no_number;
+
+        while (first != last) {
+            // LB4, LB5
+            if (st.raw == lb::bk || st.raw == lb::lf || st.raw == lb::nl)
+                return first;
+
+            Iter after = first;
+            const code_point next_c = decode(after, last);
+            const lb next_raw = get_line_break(next_c);
+
+            if (st.raw == lb::cr) {
+                if (next_raw != lb::lf)
+                    return first;
+                st.raw = next_raw;
+                first = after;
+                continue;
+            }
+
+            // LB6, LB7
+            if (is_line_break_in(next_raw, line_hard | line_bit(lb::sp))) {
+                st.spaces = st.spaces || next_raw == lb::sp;
+                st.raw = next_raw;
+                first = after;
+                continue;
+            }
+            if (next_raw == lb::zw) {
+                st.prev = st.raw = next_raw;
+                st.spaces = false;
+                first = after;
+                continue;
+            }
+
+            // LB9
+            const bool is_mark = next_raw == lb::cm || next_raw == lb::zwj;
+            if (is_mark && !st.spaces && st.prev != lb::zw) {
+                st.raw = next_raw;
+                first = after;
+                continue;
+            }
+            // LB10
+            const lb next = is_mark ? lb::al : next_raw;
+
+            bool is_break;
+            if (st.prev == lb::zw) {
+                // LB8
+                is_break = true;
+            }
+            else if (st.raw == lb::zwj) {
+                // LB8a
+                is_break = false;
+            }
+            else {
+                const line_break_action action =
+                    line_rules<>::pairs.actions[static_cast<int>(st.prev)][static_cast<int>(next)];
+                is_break = action == line_break_action::direct ||
+                           (action == line_break_action::indirect && st.spaces);
+                if (is_break && !st.spaces)
+                    is_break = !joins(st, next, next_c, after, last);
+            }
+            if (is_break)
+                return first;
+
+            st.advance(next, next_c, next_raw);
+            first = after;
+        }
+        return first;
+    }
+
+private:
+    enum number_state : std::uint8_t {
+        no_number,
+        in_number,    // after NU (NU | SY | IS)*
+        after_number, // after NU (NU | SY | IS)* (CL | CP)
+    };
+
+    struct state {
+        lb raw;                  // the class of the last code point
+        lb prev;                 // the class before any spaces, after LB9 and LB10
+        lb before_prev = lb::sp; // and the one before that, for LB21a
+        code_point prev_c;       // the code point with class prev
+        bool spaces;             // whether there are spaces after prev
+        bool odd_ri;             // whether prev is an unpaired regional indicator
+        number_state number;     // for LB25
+
+        void advance(lb next, code_point next_c, lb next_raw)
+        {
+            const bool adjacent = !spaces;
+            odd_ri = next == lb::ri && !(adjacent && prev == lb::ri && odd_ri);
+            if (next == lb::nu)
+                number = in_number;
+            else if (next == lb::sy || next == lb::is)
+                number = adjacent && number == in_number ? in_number : no_number;
+            else if (next == lb::cl || next == lb::cp)
+                number = adjacent && number == in_number ? after_number : no_number;
+            else
+                number = no_number;
+            before_prev = adjacent ? prev : lb::sp;
+            prev = next;
+            prev_c = next_c;
+            raw = next_raw;
+            spaces = false;
+        }
+    };
+
+    /// Applies the rules which the pair table cannot, to adjacent classes
+    /// which it would break between
+    template <typename Iter, typename Sentinel>
+    static bool joins(const state& st, lb next, code_point next_c, Iter after, Sentinel last)
+    {
+        // LB21a
+        if (st.before_prev == lb::hl && (st.prev == lb::hy || st.prev == lb::ba))
+            return next != lb::cb;
+        // LB25
+        if (st.number != no_number &&
+            (next == lb::po || next == lb::pr ||
+             (st.number == in_number && is_line_break_in(next, line_bit(lb::nu) | line_bit(lb::sy) |
+                                                               line_bit(lb::is)))))
+            return true;
+        if ((st.prev == lb::pr || st.prev == lb::po) && (next == lb::op || next == lb::hy))
+            return lookahead(after, last) == lb::nu;
+        // LB30
+        if ((is_line_break_in(st.prev, line_letters | line_bit(lb::nu)) && next == lb::op &&
+             !is_east_asian_wide(next_c)) ||
+            (st.prev == lb::cp && is_line_break_in(next, line_letters | line_bit(lb::nu)) &&
+             !is_east_asian_wide(st.prev_c)))
+            return true;
+        // LB30a
+        if (st.prev == lb::ri && next == lb::ri)
+            return st.odd_ri;
+        // LB30b
+        return next == lb::em && is_extended_pictographic(st.prev_c) &&
+               get_general_category(st.prev_c) == general_category::unassigned;
+    }
+
+    /// Returns the class of the next code point other than a combining mark
+    template <typename Iter, typename Sentinel>
+    static lb lookahead(Iter first, Sentinel last)
+    {
+        while (first != last) {
+            const lb next = get_line_break(decode(first, last));
+            if (next != lb::cm && next != lb::zwj)
+                return next;
+        }
+        return lb::al;
+    }
+
+    template <typename Iter, typename Sentinel>
+    static code_point decode(Iter& first, Sentinel last)
+    {
+        return replace_invalid<InEncoding, InEncoding>(utf_traits<InEncoding>::decode(first, last));
+    }
+};
+
+} // end namespace detail
+
+///
+/// A view of the segments between line break opportunities in a sequence
+/// of code units, as text_segments of the underlying iterators
+///
+template <typename Iter, typename Sentinel,
+          typename InEncoding = detail::iter_value_t<Iter>>
+using line_break_view = detail::segment_view<Iter, Sentinel, detail::line_break_segmenter<InEncoding>>;
+
+///
+/// Returns the next line break opportunity after `first`, which must be the
+/// start of the text or a break opportunity
+///
+template <typename Iter, typename Sentinel>
+Iter next_line_break(Iter first, Sentinel last)
+{
+    return first == last ? first
+        : detail::line_break_segmenter<detail::iter_value_t<Iter>>::next(first, last);
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+Iter next_line_break(Iter first, Sentinel last)
+{
+    return first == last ? first : detail::line_break_segmenter<InEncoding>::next(first, last);
+}
+
+template <typename Iter, typename Sentinel>
+line_break_view<Iter, Sentinel> line_breaks(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename String>
+auto line_breaks(const String& str)
+{
+    return line_breaks(std::cbegin(str), std::cend(str));
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+line_break_view<Iter, Sentinel, InEncoding> line_breaks(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+auto line_breaks(const String& str)
+{
+    return line_breaks<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
+///
+/// Returns whether a segment from line_breaks() ends with a mandatory
+/// break, that is with a line feed, carriage return, next line, line or
+/// paragraph separator, vertical tab or form feed. (The end of the text is
+/// also a mandatory break, and this does not check for it.) The segment is
+/// decoded in the encoding of the view it came from.
+///
+template <typename Iter, typename InEncoding>
+bool is_mandatory_break(const text_segment<Iter, InEncoding>& segment)
+{
+    detail::line_break last_class = detail::line_break::al;
+    for (Iter it = segment.begin(); it != segment.end(); ) {
+        last_class = detail::get_line_break(detail::replace_invalid<InEncoding, InEncoding>(
+            detail::utf_traits<InEncoding>::decode(it, segment.end())));
+    }
+    return detail::is_line_break_in(last_class, detail::line_hard);
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
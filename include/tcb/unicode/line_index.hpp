@@ -0,0 +1,196 @@
+
+#ifndef TCB_UNICODE_LINE_INDEX_HPP_INCLUDED
+#define TCB_UNICODE_LINE_INDEX_HPP_INCLUDED
+
+#include <tcb/unicode/rope.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// A zero-based position in text, as a line number and a column within the
+/// line, measured in some rope_metric
+///
+struct line_column {
+    std::size_t line = 0;
+    std::size_t column = 0;
+
+    friend bool operator==(const line_column& lhs, const line_column& rhs)
+    {
+        return lhs.line == rhs.line && lhs.column == rhs.column;
+    }
+
+    friend bool operator!=(const line_column& lhs, const line_column& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+///
+/// An index of the line starts in a UTF-8 buffer, for converting between
+/// byte offsets and (line, column) positions, with columns counted in bytes,
+/// code points or UTF-16 units (as the Language Server Protocol requires).
+///
+/// The index is built in a single pass which skips eight bytes at a time
+/// where they hold no line terminator and no non-ASCII byte. It also records
+/// which lines are pure ASCII. Finding a line takes O(log lines), and the
+/// columns of ASCII lines are then found in O(1); other lines are measured
+/// from their start, a word at a time.
+///
+/// Lines end with CR LF, a lone LF or a lone CR, which belongs to the line it
+/// ends; CR LF counts as a single terminator. The index
+/// refers to the text it was built from, which must outlive it and must be
+/// well formed UTF-8.
+///
+class line_index {
+public:
+    using size_type = std::size_t;
+
+    line_index() = default;
+
+    line_index(const char* first, const char* last)
+        : first_(first), last_(last)
+    {
+        build();
+    }
+
+    explicit line_index(const std::string& str)
+        : line_index(str.data(), str.data() + str.size())
+    {}
+
+    size_type line_count() const { return starts_.size(); }
+
+    /// Returns the byte offset of the start of `line`
+    size_type line_start(size_type line) const { return starts_[line]; }
+
+    /// Returns the byte offset of the end of `line`, before its terminator
+    size_type line_end(size_type line) const
+    {
+        size_type end = line + 1 < starts_.size() ? starts_[line + 1] : size();
+        if (end > starts_[line] && first_[end - 1] == '\n')
+            --end;
+        if (end > starts_[line] && first_[end - 1] == '\r')
+            --end;
+        return end;
+    }
+
+    /// Returns whether `line` consists only of ASCII
+    bool is_ascii_line(size_type line) const { return ascii_[line] != 0; }
+
+    size_type size() const { return static_cast<size_type>(last_ - first_); }
+
+    /// Returns the line containing `byte_offset`, which is clamped to the end
+    size_type line_of(size_type byte_offset) const
+    {
+        const auto it = std::upper_bound(starts_.begin(), starts_.end(), byte_offset);
+        return static_cast<size_type>(it - starts_.begin()) - 1;
+    }
+
+    ///
+    /// Converts a byte offset to a line and column, with the column measured
+    /// in `unit`. An offset in the middle of a code point is moved back to
+    /// its start.
+    ///
+    line_column to_line_column(size_type byte_offset,
+                               rope_metric unit = rope_metric::utf16_units) const
+    {
+        byte_offset = std::min(byte_offset, size());
+        const size_type line = line_of(byte_offset);
+        const size_type start = starts_[line];
+        if (ascii_[line])
+            return {line, byte_offset - start};
+
+        const size_type b = detail::utf8_offset_of(first_ + start, last_, rope_metric::bytes,
+                                                   byte_offset - start);
+        if (unit == rope_metric::bytes)
+            return {line, b};
+        return {line, detail::count_utf8_metrics(first_ + start, first_ + start + b).get(unit)};
+    }
+
+    ///
+    /// Converts a line and column, measured in `unit`, to a byte offset. A
+    /// column past the end of the line refers to the end of the line, and a
+    /// line past the end to the end of the text.
+    ///
+    size_type to_offset(line_column pos, rope_metric unit = rope_metric::utf16_units) const
+    {
+        if (pos.line >= starts_.size())
+            return size();
+        const size_type start = starts_[pos.line];
+        const size_type end = line_end(pos.line);
+        if (ascii_[pos.line])
+            return start + std::min(pos.column, end - start);
+        return start + detail::utf8_offset_of(first_ + start, first_ + end, unit, pos.column);
+    }
+
+private:
+    void build()
+    {
+        constexpr std::uint64_t top = 0x8080808080808080u;
+        constexpr std::uint64_t low7 = 0x7F7F7F7F7F7F7F7Fu;
+        constexpr std::uint64_t line_feeds = 0x0A0A0A0A0A0A0A0Au;
+        constexpr std::uint64_t returns = 0x0D0D0D0D0D0D0D0Du;
+
+        starts_.assign(1, 0);
+        ascii_.clear();
+        bool ascii = true;
+
+        // A CR followed by a LF is left for the LF to end the line
+        auto scan_byte = [&](const char* p) {
+            if (*p == '\n' || (*p == '\r' && (p + 1 == last_ || p[1] != '\n'))) {
+                ascii_.push_back(ascii);
+                starts_.push_back(static_cast<size_type>(p + 1 - first_));
+                ascii = true;
+            }
+            else if (!detail::is_ascii_unit(*p)) {
+                ascii = false;
+            }
+        };
+
+        const char* p = first_;
+        while (last_ - p >= 8) {
+            std::uint64_t w;
+            std::memcpy(&w, p, sizeof(w));
+            const std::uint64_t x = w ^ line_feeds;
+            const std::uint64_t y = w ^ returns;
+            // Top bits are set for CRs, LFs and non-ASCII bytes
+            const std::uint64_t terminators = (~(((x & low7) + low7) | x) |
+                                               ~(((y & low7) + low7) | y)) & top;
+            const std::uint64_t interesting = terminators | (w & top);
+            if (interesting == 0) {
+                p += 8;
+                continue;
+            }
+            // A word of non-ASCII with no terminator needs only one flag
+            if (terminators == 0) {
+                ascii = false;
+                p += 8;
+                continue;
+            }
+            for (const char* e = p + 8; p != e; ++p) {
+                scan_byte(p);
+            }
+        }
+        for (; p != last_; ++p) {
+            scan_byte(p);
+        }
+        ascii_.push_back(ascii);
+    }
+
+    const char* first_ = nullptr;
+    const char* last_ = nullptr;
+    std::vector<size_type> starts_{0};
+    std::vector<unsigned char> ascii_{1};
+};
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,673 @@
+
+#ifndef TCB_UNICODE_NORMALIZATION_HPP_INCLUDED
+#define TCB_UNICODE_NORMALIZATION_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/normalization_tables.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Unicode normalization forms, as in Unicode Standard Annex #15 (version
+/// 14.0).
+///
+/// Text is normalized a segment at a time, where a segment runs from one
+/// starter which nothing before it can affect to the next. Each code point
+/// of a segment is replaced by its full decomposition (with one table
+/// lookup, as the tables hold decompositions already applied recursively),
+/// the combining marks are put in canonical order, and for NFC and NFKC the
+/// result is recomposed, looking up each pair which could compose in a
+/// sorted table of primary composites. Hangul syllables are decomposed and
+/// composed arithmetically.
+///
+/// Most text is already normalized, so normalize() first runs the quick
+/// check algorithm, which looks up a single packed record for each code
+/// point (runs of ASCII in contiguous input are skipped a machine word at a
+/// time, and code points below the first which may not be normalized are
+/// not looked up at all). If that succeeds, its argument is returned as it
+/// is, without being copied; otherwise the text before the last stable
+/// starter is copied, and only the rest is normalized.
+///
+/// Ill-formed sequences are replaced by U+FFFD, and are never considered to
+/// be normalized.
+///
+
+enum class normalization_form {
+    nfc,  ///< Canonical decomposition followed by canonical composition
+    nfd,  ///< Canonical decomposition
+    nfkc, ///< Compatibility decomposition followed by canonical composition
+    nfkd, ///< Compatibility decomposition
+};
+
+/// The result of the quick check for a normalization form
+enum class quick_check_result {
+    yes,   ///< The text is normalized
+    no,    ///< The text is not normalized
+    maybe, ///< The text must be normalized to find out
+};
+
+/// Returns the Canonical_Combining_Class property of `c`
+constexpr std::uint8_t canonical_combining_class(char32_t c)
+{
+    return static_cast<std::uint8_t>(detail::normalization_lookup(c) & 0xFF);
+}
+
+namespace detail {
+
+template <normalization_form Form>
+struct normalization_traits;
+
+template <>
+struct normalization_traits<normalization_form::nfc> {
+    static constexpr bool compose = true;
+    static constexpr bool compat = false;
+    static constexpr std::uint16_t no_flag = flag_nfc_qc_no;
+    static constexpr std::uint16_t maybe_flag = flag_nfc_qc_maybe;
+    // All code points below this are starters which are normalized
+    static constexpr code_point first_unstable = 0x300;
+};
+
+template <>
+struct normalization_traits<normalization_form::nfd> {
+    static constexpr bool compose = false;
+    static constexpr bool compat = false;
+    static constexpr std::uint16_t no_flag = flag_nfd_qc_no;
+    static constexpr std::uint16_t maybe_flag = 0;
+    static constexpr code_point first_unstable = 0xC0;
+};
+
+template <>
+struct normalization_traits<normalization_form::nfkc> {
+    static constexpr bool compose = true;
+    static constexpr bool compat = true;
+    static constexpr std::uint16_t no_flag = flag_nfkc_qc_no;
+    static constexpr std::uint16_t maybe_flag = flag_nfkc_qc_maybe;
+    static constexpr code_point first_unstable = 0xA0;
+};
+
+template <>
+struct normalization_traits<normalization_form::nfkd> {
+    static constexpr bool compose = false;
+    static constexpr bool compat = true;
+    static constexpr std::uint16_t no_flag = flag_nfkd_qc_no;
+    static constexpr std::uint16_t maybe_flag = 0;
+    static constexpr code_point first_unstable = 0xA0;
+};
+
+constexpr code_point hangul_s_base = 0xAC00;
+constexpr code_point hangul_l_base = 0x1100;
+constexpr code_point hangul_v_base = 0x1161;
+constexpr code_point hangul_t_base = 0x11A7;
+constexpr code_point hangul_l_count = 19;
+constexpr code_point hangul_v_count = 21;
+constexpr code_point hangul_t_count = 28;
+constexpr code_point hangul_s_count = hangul_l_count * hangul_v_count * hangul_t_count;
+
+constexpr bool is_hangul_syllable(code_point c)
+{
+    return c >= hangul_s_base && c < hangul_s_base + hangul_s_count;
+}
+
+///
+/// A buffer of code points, which keeps up to 32 in place before moving
+/// them to the heap, so that most segments of text need no allocation
+///
+class code_point_buffer {
+public:
+    code_point* data() { return heap_.empty() ? local_ : heap_.data(); }
+
+    const code_point* data() const { return heap_.empty() ? local_ : heap_.data(); }
+
+    std::size_t size() const { return size_; }
+
+    code_point operator[](std::size_t i) const { return data()[i]; }
+
+    void push_back(code_point c)
+    {
+        if (heap_.empty()) {
+            if (size_ < local_size) {
+                local_[size_++] = c;
+                return;
+            }
+            heap_.assign(local_, local_ + size_);
+        }
+        heap_.push_back(c);
+        ++size_;
+    }
+
+    /// Removes the code points in [first, last)
+    void erase(std::size_t first, std::size_t last)
+    {
+        code_point* p = data();
+        std::copy(p + last, p + size_, p + first);
+        size_ -= last - first;
+        if (!heap_.empty())
+            heap_.resize(size_);
+    }
+
+private:
+    static constexpr std::size_t local_size = 32;
+
+    code_point local_[local_size];
+    std::vector<code_point> heap_;
+    std::size_t size_ = 0;
+};
+
+/// Appends the full canonical (or, if `Compat`, compatibility)
+/// decomposition of `c` to `out`
+template <bool Compat>
+void decompose(code_point c, code_point_buffer& out)
+{
+    if (is_hangul_syllable(c)) {
+        const code_point s = c - hangul_s_base;
+        out.push_back(hangul_l_base + s / (hangul_v_count * hangul_t_count));
+        out.push_back(hangul_v_base + s % (hangul_v_count * hangul_t_count) / hangul_t_count);
+        if (s % hangul_t_count != 0)
+            out.push_back(hangul_t_base + s % hangul_t_count);
+        return;
+    }
+
+    const std::uint16_t offset = decomposition_offset_lookup(c);
+    const bool canonical = (normalization_lookup(c) & flag_nfd_qc_no) != 0;
+    if (offset == 0 || (!Compat && !canonical)) {
+        out.push_back(c);
+        return;
+    }
+
+    // The compatibility decomposition of a code point with a canonical
+    // mapping is that of each code point of its canonical decomposition
+    const std::uint32_t* p = decomposition_tables<>::pool + offset;
+    do {
+        const code_point d = *p & 0x1FFFFF;
+        if (Compat && canonical)
+            decompose<true>(d, out);
+        else
+            out.push_back(d);
+    } while ((*p++ & 0x80000000) == 0);
+}
+
+/// Sorts each run of non-starters in [first, last) by combining class,
+/// keeping code points of the same class in order
+inline void canonical_order(code_point* first, code_point* last)
+{
+    for (code_point* p = first; p != last; ++p) {
+        const code_point c = *p;
+        const auto ccc = canonical_combining_class(c);
+        if (ccc == 0)
+            continue;
+        code_point* q = p;
+        while (q != first && canonical_combining_class(q[-1]) > ccc) {
+            *q = q[-1];
+            --q;
+        }
+        *q = c;
+    }
+}
+
+/// Returns the primary composite of `first` and `second`, or zero if there
+/// is none
+inline code_point compose_pair(code_point first, code_point second)
+{
+    if (second >= hangul_v_base && second < hangul_v_base + hangul_v_count &&
+        first >= hangul_l_base && first < hangul_l_base + hangul_l_count) {
+        return hangul_s_base + ((first - hangul_l_base) * hangul_v_count +
+                                (second - hangul_v_base)) * hangul_t_count;
+    }
+    if (second > hangul_t_base && second < hangul_t_base + hangul_t_count &&
+        is_hangul_syllable(first) && (first - hangul_s_base) % hangul_t_count == 0) {
+        return first + (second - hangul_t_base);
+    }
+    if ((normalization_lookup(second) & flag_nfc_qc_maybe) == 0)
+        return 0;
+
+    using t = composition_tables<>;
+    const std::uint64_t key = std::uint64_t{first} << 21 | second;
+    const std::uint64_t* p = std::lower_bound(
+        std::begin(t::pairs), std::end(t::pairs), key,
+        [](std::uint64_t pair, std::uint64_t k) { return (pair >> 21) < k; });
+    return p != std::end(t::pairs) && (*p >> 21) == key ? static_cast<code_point>(*p & 0x1FFFFF) : 0;
+}
+
+/// Applies canonical composition to [first, last), which must be in
+/// canonical order, returning the new end
+inline code_point* canonical_compose(code_point* first, code_point* last)
+{
+    if (first == last)
+        return last;
+
+    code_point* starter = canonical_combining_class(*first) == 0 ? first : nullptr;
+    // A code point is blocked from the starter by one of the same or a
+    // higher class since it; 256 blocks everything
+    unsigned last_class = starter ? 0 : 256;
+    code_point* out = first + 1;
+    for (code_point* p = first + 1; p != last; ++p) {
+        const code_point c = *p;
+        const unsigned ccc = canonical_combining_class(c);
+        if (starter && (last_class < ccc || last_class == 0)) {
+            const code_point composite = compose_pair(*starter, c);
+            if (composite != 0) {
+                *starter = composite;
+                continue;
+            }
+        }
+        if (ccc == 0)
+            starter = out;
+        last_class = ccc;
+        *out++ = c;
+    }
+    return out;
+}
+
+///
+/// Normalizes text one segment at a time, reading no more than one code
+/// point past the end of each segment
+///
+template <normalization_form Form>
+class segment_normalizer {
+    using traits = normalization_traits<Form>;
+
+public:
+    const code_point* begin() const { return buffer_.data(); }
+
+    const code_point* end() const { return buffer_.data() + ready_; }
+
+    std::size_t size() const { return ready_; }
+
+    ///
+    /// Replaces the current segment with the next, read from `first`.
+    /// Returns false if there is none.
+    ///
+    template <typename InEncoding, typename Iter, typename Sentinel>
+    bool next(Iter& first, Sentinel last)
+    {
+        // The buffer holds the decomposition of the code point which ended
+        // the previous segment, which begins this one
+        buffer_.erase(0, ready_);
+        ready_ = 0;
+        while (first != last) {
+            const std::size_t start = buffer_.size();
+            const code_point c = decode<InEncoding>(first, last);
+            if (c < 0x80)
+                buffer_.push_back(c);
+            else
+                decompose<traits::compat>(c, buffer_);
+            if (start != 0 && (c < 0x80 || is_segment_start(buffer_[start]))) {
+                ready_ = start;
+                break;
+            }
+        }
+        if (ready_ == 0)
+            ready_ = buffer_.size();
+        if (ready_ == 0)
+            return false;
+
+        code_point* p = buffer_.data();
+        canonical_order(p, p + ready_);
+        if (traits::compose) {
+            const std::size_t n = static_cast<std::size_t>(canonical_compose(p, p + ready_) - p);
+            buffer_.erase(n, ready_);
+            ready_ = n;
+        }
+        return true;
+    }
+
+private:
+    template <typename InEncoding, typename Iter, typename Sentinel>
+    static code_point decode(Iter& first, Sentinel last)
+    {
+        return replace_invalid<InEncoding, char32_t>(utf_traits<InEncoding>::decode(first, last));
+    }
+
+    /// Returns whether a segment can begin with `c`, a fully decomposed
+    /// code point: nothing before a starter is reordered after it, and
+    /// nothing composes with one which cannot be the second of a pair
+    static bool is_segment_start(code_point c)
+    {
+        return (normalization_lookup(c) & (0xFF | traits::maybe_flag)) == 0;
+    }
+
+    code_point_buffer buffer_;
+    std::size_t ready_ = 0;
+};
+
+template <typename Iter, typename Sentinel>
+bool skip_ascii(Iter&, Sentinel, Iter&)
+{
+    return false;
+}
+
+/// Moves `first` past a run of ASCII, setting `last_unit` to the last of
+/// it, and returns whether there was one
+template <typename CharT>
+bool skip_ascii(const CharT*& first, const CharT* last, const CharT*& last_unit)
+{
+    const std::size_t n = ascii_prefix_length(first, last);
+    if (n == 0)
+        return false;
+    first += n;
+    last_unit = first - 1;
+    return true;
+}
+
+///
+/// Runs the quick check for `Form` over [first, last). Unless the result is
+/// yes, `stable` is set to a position before which the text is normalized
+/// and from which it can be normalized independently.
+///
+template <normalization_form Form, typename InEncoding, typename Iter, typename Sentinel>
+quick_check_result check_normalized(Iter first, Sentinel last, Iter& stable)
+{
+    using traits = normalization_traits<Form>;
+
+    auto result = quick_check_result::yes;
+    unsigned last_class = 0;
+    stable = first;
+    while (first != last) {
+        Iter ascii = first;
+        if (skip_ascii(first, last, ascii)) {
+            if (result == quick_check_result::yes)
+                stable = ascii;
+            last_class = 0;
+            continue;
+        }
+
+        const Iter here = first;
+        const code_point c = utf_traits<InEncoding>::decode(first, last);
+        if (c < traits::first_unstable) {
+            if (result == quick_check_result::yes)
+                stable = here;
+            last_class = 0;
+            continue;
+        }
+        if (!is_valid_codepoint(c))
+            return quick_check_result::no;
+
+        const std::uint16_t record = normalization_lookup(c);
+        const unsigned ccc = record & 0xFF;
+        if ((ccc != 0 && last_class > ccc) || (record & traits::no_flag) != 0)
+            return quick_check_result::no;
+        if ((record & traits::maybe_flag) != 0)
+            result = quick_check_result::maybe;
+        else if (ccc == 0 && result == quick_check_result::yes)
+            stable = here;
+        last_class = ccc;
+    }
+    return result;
+}
+
+/// Returns [first, last) normalized, given a position `stable` as found by
+/// check_normalized()
+template <normalization_form Form, typename String, typename Iter>
+String normalize_from(Iter first, Iter stable, Iter last)
+{
+    using encoding = iter_value_t<Iter>;
+
+    String result(first, stable);
+    auto out = std::back_inserter(result);
+    segment_normalizer<Form> normalizer;
+    while (normalizer.template next<encoding>(stable, last)) {
+        for (code_point c : normalizer)
+            out = utf_traits<encoding>::encode(c, out);
+    }
+    return result;
+}
+
+template <normalization_form Form, typename String>
+String normalize_string(String str, std::true_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+
+    const encoding* first = str.data();
+    const encoding* last = first + str.size();
+    const encoding* stable;
+    if (check_normalized<Form, encoding>(first, last, stable) == quick_check_result::yes)
+        return str;
+    return normalize_from<Form, String>(first, stable, last);
+}
+
+template <normalization_form Form, typename String>
+String normalize_string(String str, std::false_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+
+    auto first = std::cbegin(str);
+    decltype(first) stable;
+    if (check_normalized<Form, encoding>(first, std::cend(str), stable) == quick_check_result::yes)
+        return str;
+    return normalize_from<Form, String>(first, stable, std::cend(str));
+}
+
+template <normalization_form Form, typename String>
+quick_check_result check_string(const String& str, std::true_type /*contiguous*/)
+{
+    using encoding = range_value_t<String>;
+    const encoding* stable;
+    return check_normalized<Form, encoding>(str.data(), str.data() + str.size(), stable);
+}
+
+template <normalization_form Form, typename String>
+quick_check_result check_string(const String& str, std::false_type /*contiguous*/)
+{
+    auto stable = std::cbegin(str);
+    return check_normalized<Form, range_value_t<String>>(std::cbegin(str), std::cend(str), stable);
+}
+
+///
+/// A view of the code points of a sequence of code units in a
+/// normalization form, normalized as the view is iterated
+///
+template <typename Iter, typename Sentinel, normalization_form Form, typename InEncoding>
+class normalization_view {
+private:
+    struct iterator {
+        using value_type = char32_t;
+        using difference_type = typename std::iterator_traits<Iter>::difference_type;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator() = default;
+
+        iterator(Iter first, Sentinel last)
+            : first_(first), last_(last)
+        {
+            normalizer_.template next<InEncoding>(first_, last_);
+        }
+
+        reference operator*() const
+        {
+            return normalizer_.begin()[idx_];
+        }
+
+        pointer operator->() const
+        {
+            return normalizer_.begin() + idx_;
+        }
+
+        iterator& operator++()
+        {
+            if (++idx_ == normalizer_.size()) {
+                normalizer_.template next<InEncoding>(first_, last_);
+                idx_ = 0;
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator temp{*this};
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return (done() && other.done()) ||
+                   (first_ == other.first_ && idx_ == other.idx_ &&
+                    normalizer_.size() == other.normalizer_.size());
+        }
+
+        bool operator!=(const iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        bool done() const
+        {
+            return first_ == last_ && idx_ == normalizer_.size();
+        }
+
+        Iter first_{};
+        Sentinel last_{};
+        segment_normalizer<Form> normalizer_;
+        std::size_t idx_ = 0;
+    };
+
+public:
+    constexpr normalization_view() = default;
+
+    constexpr normalization_view(Iter first, Sentinel last)
+        : first_(first), last_(last) {}
+
+    iterator begin() const { return iterator{first_, last_}; }
+
+    iterator end() const { return iterator{last_, last_}; }
+
+    template <typename Container,
+              typename = std::enable_if_t<is_compatible_container_v<Container, iterator, iterator>>>
+    operator Container() const
+    {
+        return Container(begin(), end());
+    }
+
+private:
+    Iter first_{};
+    Sentinel last_{};
+};
+
+} // end namespace detail
+
+template <typename Iter, typename Sentinel, normalization_form Form,
+          typename InEncoding = detail::iter_value_t<Iter>>
+using normalization_view = detail::normalization_view<Iter, Sentinel, Form, InEncoding>;
+
+///
+/// Returns whether [first, last) is in normalization form `Form`, if that
+/// can be found without normalizing it
+///
+template <normalization_form Form, typename Iter, typename Sentinel>
+quick_check_result quick_check(Iter first, Sentinel last)
+{
+    Iter stable = first;
+    return detail::check_normalized<Form, detail::iter_value_t<Iter>>(first, last, stable);
+}
+
+template <normalization_form Form, typename String>
+quick_check_result quick_check(const String& str)
+{
+    return detail::check_string<Form>(str, detail::has_contiguous_data<String>{});
+}
+
+///
+/// Returns `str` in normalization form `Form`. If it is normalized already,
+/// it is returned unchanged, and if passed as an rvalue, not copied.
+///
+template <normalization_form Form, typename String>
+std::decay_t<String> normalize(String&& str)
+{
+    return detail::normalize_string<Form, std::decay_t<String>>(
+        std::forward<String>(str), detail::has_contiguous_data<std::decay_t<String>>{});
+}
+
+/// Returns whether `str` is in normalization form `Form`
+template <normalization_form Form, typename String>
+bool is_normalized(const String& str)
+{
+    switch (quick_check<Form>(str)) {
+    case quick_check_result::yes:
+        return true;
+    case quick_check_result::no:
+        return false;
+    default:
+        return normalize<Form>(str) == str;
+    }
+}
+
+template <typename String>
+std::decay_t<String> to_nfc(String&& str)
+{
+    return normalize<normalization_form::nfc>(std::forward<String>(str));
+}
+
+template <typename String>
+std::decay_t<String> to_nfd(String&& str)
+{
+    return normalize<normalization_form::nfd>(std::forward<String>(str));
+}
+
+template <typename String>
+std::decay_t<String> to_nfkc(String&& str)
+{
+    return normalize<normalization_form::nfkc>(std::forward<String>(str));
+}
+
+template <typename String>
+std::decay_t<String> to_nfkd(String&& str)
+{
+    return normalize<normalization_form::nfkd>(std::forward<String>(str));
+}
+
+///
+/// Returns a view of the code points of [first, last) in normalization form
+/// `Form`, which are found as the view is iterated
+///
+template <normalization_form Form, typename Iter, typename Sentinel>
+normalization_view<Iter, Sentinel, Form> as_normalized(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <normalization_form Form, typename String>
+auto as_normalized(const String& str)
+{
+    return as_normalized<Form>(std::cbegin(str), std::cend(str));
+}
+
+template <typename String>
+auto as_nfc(const String& str)
+{
+    return as_normalized<normalization_form::nfc>(str);
+}
+
+template <typename String>
+auto as_nfd(const String& str)
+{
+    return as_normalized<normalization_form::nfd>(str);
+}
+
+template <typename String>
+auto as_nfkc(const String& str)
+{
+    return as_normalized<normalization_form::nfkc>(str);
+}
+
+template <typename String>
+auto as_nfkd(const String& str)
+{
+    return as_normalized<normalization_form::nfkd>(str);
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,129 @@
+
+#ifndef TCB_UNICODE_PROPERTIES_HPP_INCLUDED
+#define TCB_UNICODE_PROPERTIES_HPP_INCLUDED
+
+#include <tcb/unicode/detail/property_tables.hpp>
+
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Character properties from the Unicode Character Database, version 14.0.
+///
+/// Lookups take a few table reads (the tables are about 43 KB in total, and
+/// are generated by tools/ucdgen.cpp from the files in data/ucd), and
+/// can be used in constant expressions. Values above U+10FFFF have the
+/// properties of an unassigned code point.
+///
+
+namespace detail {
+
+constexpr bool has_property_flag(char32_t c, std::uint32_t flag)
+{
+    return (property_lookup(c) & flag) != 0;
+}
+
+} // end namespace detail
+
+constexpr general_category get_general_category(char32_t c)
+{
+    return static_cast<general_category>(detail::property_lookup(c) & 0xFF);
+}
+
+constexpr script get_script(char32_t c)
+{
+    return static_cast<script>((detail::property_lookup(c) >> 8) & 0xFF);
+}
+
+constexpr east_asian_width get_east_asian_width(char32_t c)
+{
+    return static_cast<east_asian_width>((detail::property_lookup(c) >> 16) & 0xFF);
+}
+
+/// Returns whether the general category of `c` is Lu, Ll, Lt, Lm or Lo
+constexpr bool is_letter(char32_t c)
+{
+    return get_general_category(c) <= general_category::other_letter;
+}
+
+/// Returns whether the general category of `c` is Mn, Mc or Me
+constexpr bool is_mark(char32_t c)
+{
+    return get_general_category(c) >= general_category::nonspacing_mark &&
+           get_general_category(c) <= general_category::enclosing_mark;
+}
+
+/// Returns whether the general category of `c` is Nd, Nl or No
+constexpr bool is_number(char32_t c)
+{
+    return get_general_category(c) >= general_category::decimal_number &&
+           get_general_category(c) <= general_category::other_number;
+}
+
+/// Returns whether the general category of `c` is Pc, Pd, Ps, Pe, Pi, Pf or Po
+constexpr bool is_punctuation(char32_t c)
+{
+    return get_general_category(c) >= general_category::connector_punctuation &&
+           get_general_category(c) <= general_category::other_punctuation;
+}
+
+/// Returns whether the general category of `c` is Sm, Sc, Sk or So
+constexpr bool is_symbol(char32_t c)
+{
+    return get_general_category(c) >= general_category::math_symbol &&
+           get_general_category(c) <= general_category::other_symbol;
+}
+
+/// Returns whether the general category of `c` is Zs, Zl or Zp
+constexpr bool is_separator(char32_t c)
+{
+    return get_general_category(c) >= general_category::space_separator &&
+           get_general_category(c) <= general_category::paragraph_separator;
+}
+
+constexpr bool is_white_space(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_white_space);
+}
+
+constexpr bool is_alphabetic(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_alphabetic);
+}
+
+constexpr bool is_lowercase(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_lowercase);
+}
+
+constexpr bool is_uppercase(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_uppercase);
+}
+
+constexpr bool is_default_ignorable(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_default_ignorable);
+}
+
+constexpr bool is_emoji(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_emoji);
+}
+
+constexpr bool is_emoji_presentation(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_emoji_presentation);
+}
+
+constexpr bool is_extended_pictographic(char32_t c)
+{
+    return detail::has_property_flag(c, detail::flag_extended_pictographic);
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
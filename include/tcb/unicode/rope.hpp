@@ -0,0 +1,570 @@
+
+#ifndef TCB_UNICODE_ROPE_HPP_INCLUDED
+#define TCB_UNICODE_ROPE_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/validate.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// The quantities by which a position in a rope may be given
+///
+enum class rope_metric {
+    bytes,       ///< UTF-8 code units
+    code_points, ///< Unicode code points
+    utf16_units, ///< UTF-16 code units
+    lines        ///< Line feeds: position `n` is the start of line `n`
+};
+
+///
+/// The size of some UTF-8 text in each of the rope metrics
+///
+struct rope_metrics {
+    std::size_t bytes = 0;
+    std::size_t code_points = 0;
+    std::size_t utf16_units = 0;
+    std::size_t newlines = 0;
+
+    std::size_t get(rope_metric m) const
+    {
+        switch (m) {
+        case rope_metric::bytes: return bytes;
+        case rope_metric::code_points: return code_points;
+        case rope_metric::utf16_units: return utf16_units;
+        default: return newlines;
+        }
+    }
+
+    friend rope_metrics operator+(rope_metrics lhs, const rope_metrics& rhs)
+    {
+        lhs.bytes += rhs.bytes;
+        lhs.code_points += rhs.code_points;
+        lhs.utf16_units += rhs.utf16_units;
+        lhs.newlines += rhs.newlines;
+        return lhs;
+    }
+};
+
+namespace detail {
+
+// Counts the bytes of an eight-byte word whose top bit is set in `w`
+inline std::size_t count_top_bits(std::uint64_t w)
+{
+    return static_cast<std::size_t>((((w >> 7) & 0x0101010101010101u) * 0x0101010101010101u) >> 56);
+}
+
+///
+/// Measures the well formed UTF-8 text [first, last), examining eight bytes
+/// at a time. Code points are the bytes which are not continuation bytes,
+/// and each four-byte lead adds a second UTF-16 unit.
+///
+inline rope_metrics count_utf8_metrics(const char* first, const char* last)
+{
+    constexpr std::uint64_t top = 0x8080808080808080u;
+    constexpr std::uint64_t low7 = 0x7F7F7F7F7F7F7F7Fu;
+    constexpr std::uint64_t newlines = 0x0A0A0A0A0A0A0A0Au;
+
+    std::size_t continuations = 0;
+    std::size_t four_byte_leads = 0;
+    std::size_t line_feeds = 0;
+
+    const char* p = first;
+    for (; last - p >= 8; p += 8) {
+        std::uint64_t w;
+        std::memcpy(&w, p, sizeof(w));
+        // 10xxxxxx
+        continuations += count_top_bits(w & ~(w << 1) & top);
+        // 11110xxx
+        four_byte_leads += count_top_bits(w & (w << 1) & (w << 2) & (w << 3) & top);
+        // Bytes equal to '\n' become zero; the top bit is set for the others
+        const std::uint64_t x = w ^ newlines;
+        line_feeds += 8 - count_top_bits((((x & low7) + low7) | x) & top);
+    }
+    for (; p != last; ++p) {
+        const auto c = static_cast<unsigned char>(*p);
+        continuations += (c & 0xC0) == 0x80;
+        four_byte_leads += c >= 0xF0;
+        line_feeds += c == '\n';
+    }
+
+    rope_metrics m;
+    m.bytes = static_cast<std::size_t>(last - first);
+    m.code_points = m.bytes - continuations;
+    m.utf16_units = m.code_points + four_byte_leads;
+    m.newlines = line_feeds;
+    return m;
+}
+
+///
+/// Returns the byte offset in the UTF-8 text [first, last) of the position
+/// `n` as measured by `m`. A byte or UTF-16 position in the middle of a
+/// code point is moved back to its start.
+///
+inline std::size_t utf8_offset_of(const char* first, const char* last,
+                                  rope_metric m, std::size_t n)
+{
+    const char* p = first;
+    switch (m) {
+    case rope_metric::bytes:
+        p = first + std::min(n, static_cast<std::size_t>(last - first));
+        while (p != first && p != last && utf_traits<char>::is_trail(*p))
+            --p;
+        break;
+    case rope_metric::code_points:
+        for (; p != last; ++p) {
+            if (utf_traits<char>::is_lead(*p) && n-- == 0)
+                break;
+        }
+        break;
+    case rope_metric::utf16_units:
+        for (; p != last; ++p) {
+            if (utf_traits<char>::is_lead(*p)) {
+                const std::size_t units = static_cast<unsigned char>(*p) >= 0xF0 ? 2 : 1;
+                if (n < units)
+                    break;
+                n -= units;
+            }
+        }
+        break;
+    case rope_metric::lines:
+        while (n > 0 && p != last) {
+            if (*p++ == '\n')
+                --n;
+        }
+        break;
+    }
+    return static_cast<std::size_t>(p - first);
+}
+
+} // end namespace detail
+
+///
+/// A persistent text buffer for editors: UTF-8 text held in the leaves of a
+/// balanced (AVL) binary tree. Leaves are chunks of at most max_leaf_size
+/// bytes, split evenly at code point boundaries and merged again when edits
+/// leave neighbouring leaves small enough to share one. Every node caches the
+/// bytes, code points, UTF-16 units and line feeds below it. Positions may
+/// therefore be given in any rope_metric, and insertion, erasure, slicing
+/// and conversion between metrics all take O(log n) time.
+///
+/// Nodes are immutable and shared, so copying a rope or taking a slice of
+/// it is cheap, and edits only copy the path to the nodes they change.
+///
+/// Text which is not well formed UTF-8 has any ill-formed sequences
+/// replaced with U+FFFD on insertion.
+///
+class rope {
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type max_leaf_size = 1024;
+
+    rope() = default;
+
+    explicit rope(const char* str)
+        : rope(std::string(str))
+    {}
+
+    explicit rope(const std::string& str)
+        : root_(build(str))
+    {}
+
+    /// Returns the sizes of the whole text
+    rope_metrics metrics() const { return root_ ? root_->metrics : rope_metrics{}; }
+
+    size_type size() const { return metrics().bytes; }
+    size_type code_points() const { return metrics().code_points; }
+    size_type utf16_size() const { return metrics().utf16_units; }
+    size_type line_count() const { return metrics().newlines + 1; }
+    bool empty() const { return size() == 0; }
+
+    ///
+    /// Returns the byte offset of the position `n` measured in `m`, which is
+    /// clamped to the end of the text
+    ///
+    size_type to_byte_offset(rope_metric m, size_type n) const
+    {
+        if (m == rope_metric::lines && n == 0)
+            return 0;
+        size_type offset = 0;
+        const node* p = root_.get();
+        while (p && !p->is_leaf()) {
+            const size_type left = p->left->metrics.get(m);
+            const bool go_left = m == rope_metric::lines ? n <= left : n < left;
+            if (go_left) {
+                p = p->left.get();
+            }
+            else {
+                n -= left;
+                offset += p->left->metrics.bytes;
+                p = p->right.get();
+            }
+        }
+        if (!p)
+            return 0;
+        return offset + detail::utf8_offset_of(p->leaf.data(), p->leaf.data() + p->leaf.size(), m, n);
+    }
+
+    ///
+    /// Returns the sizes of the text before `byte_offset`. In particular,
+    /// `measure(b).newlines` is the (zero-based) line containing `b`.
+    ///
+    rope_metrics measure(size_type byte_offset) const
+    {
+        rope_metrics total;
+        const node* p = root_.get();
+        while (p && !p->is_leaf()) {
+            if (byte_offset < p->left->metrics.bytes) {
+                p = p->left.get();
+            }
+            else {
+                byte_offset -= p->left->metrics.bytes;
+                total = total + p->left->metrics;
+                p = p->right.get();
+            }
+        }
+        if (!p)
+            return total;
+        byte_offset = std::min(byte_offset, p->leaf.size());
+        return total + detail::count_utf8_metrics(p->leaf.data(), p->leaf.data() + byte_offset);
+    }
+
+    /// Converts the position `n` measured in `from` to the metric `to`
+    size_type convert(rope_metric from, size_type n, rope_metric to) const
+    {
+        return measure(to_byte_offset(from, n)).get(to);
+    }
+
+    /// Inserts `str` at the position `pos` measured in `m`
+    void insert(rope_metric m, size_type pos, const std::string& str)
+    {
+        if (str.empty())
+            return;
+        if (!root_) {
+            root_ = build(str);
+            return;
+        }
+        root_ = insert_at(root_, to_byte_offset(m, pos), valid_utf8(str));
+    }
+
+    void insert(size_type byte_offset, const std::string& str)
+    {
+        insert(rope_metric::bytes, byte_offset, str);
+    }
+
+    /// Erases the text between the positions `first` and `last` measured in `m`
+    void erase(rope_metric m, size_type first, size_type last)
+    {
+        const size_type b1 = to_byte_offset(m, first);
+        const size_type b2 = to_byte_offset(m, last);
+        if (b1 >= b2)
+            return;
+        auto lhs = split(root_, b1);
+        auto rhs = split(lhs.second, b2 - b1);
+        root_ = join(lhs.first, rhs.second);
+    }
+
+    void erase(size_type first_byte, size_type last_byte)
+    {
+        erase(rope_metric::bytes, first_byte, last_byte);
+    }
+
+    /// Returns the text between the positions `first` and `last` measured in
+    /// `m`, sharing nodes with this rope
+    rope slice(rope_metric m, size_type first, size_type last) const
+    {
+        const size_type b1 = to_byte_offset(m, first);
+        const size_type b2 = to_byte_offset(m, last);
+        rope result;
+        if (b1 < b2)
+            result.root_ = split(split(root_, b1).second, b2 - b1).first;
+        return result;
+    }
+
+    rope slice(size_type first_byte, size_type last_byte) const
+    {
+        return slice(rope_metric::bytes, first_byte, last_byte);
+    }
+
+    /// Appends `other`, sharing its nodes
+    void append(const rope& other)
+    {
+        root_ = join(root_, other.root_);
+    }
+
+    /// Calls `f(const char*, size_t)` for each leaf, in order
+    template <typename Func>
+    void for_each_chunk(Func f) const
+    {
+        for_each_chunk(root_.get(), f);
+    }
+
+    std::string str() const
+    {
+        std::string out;
+        out.reserve(size());
+        for_each_chunk([&out](const char* p, size_type n) { out.append(p, n); });
+        return out;
+    }
+
+    friend bool operator==(const rope& lhs, const rope& rhs)
+    {
+        return lhs.size() == rhs.size() && lhs.str() == rhs.str();
+    }
+
+    friend bool operator!=(const rope& lhs, const rope& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    struct node;
+    using node_ptr = std::shared_ptr<const node>;
+
+    struct node {
+        rope_metrics metrics;
+        int height = 0;
+        node_ptr left;
+        node_ptr right;
+        std::string leaf;
+
+        bool is_leaf() const { return height == 0; }
+    };
+
+    static int height(const node_ptr& n) { return n ? n->height : -1; }
+
+    static node_ptr make_leaf(std::string str)
+    {
+        auto n = std::make_shared<node>();
+        n->metrics = detail::count_utf8_metrics(str.data(), str.data() + str.size());
+        n->leaf = std::move(str);
+        return n;
+    }
+
+    static node_ptr make_node(node_ptr left, node_ptr right)
+    {
+        auto n = std::make_shared<node>();
+        n->metrics = left->metrics + right->metrics;
+        n->height = std::max(left->height, right->height) + 1;
+        n->left = std::move(left);
+        n->right = std::move(right);
+        return n;
+    }
+
+    static node_ptr rotate_left(const node_ptr& n)
+    {
+        return make_node(make_node(n->left, n->right->left), n->right->right);
+    }
+
+    static node_ptr rotate_right(const node_ptr& n)
+    {
+        return make_node(n->left->left, make_node(n->left->right, n->right));
+    }
+
+    static const node* first_leaf(const node* n)
+    {
+        while (!n->is_leaf())
+            n = n->left.get();
+        return n;
+    }
+
+    static const node* last_leaf(const node* n)
+    {
+        while (!n->is_leaf())
+            n = n->right.get();
+        return n;
+    }
+
+    static node_ptr drop_first_leaf(const node_ptr& n)
+    {
+        if (n->is_leaf())
+            return nullptr;
+        return join_trees(drop_first_leaf(n->left), n->right);
+    }
+
+    static node_ptr drop_last_leaf(const node_ptr& n)
+    {
+        if (n->is_leaf())
+            return nullptr;
+        return join_trees(n->left, drop_last_leaf(n->right));
+    }
+
+    // Joins two trees, merging the leaves either side of the join when they
+    // fit in one, so that repeated small edits do not fragment the text.
+    // Finding and dropping the edge leaves takes O(log n) time, so edits call
+    // this once for each seam they make, rather than at every level.
+    static node_ptr join(const node_ptr& lhs, const node_ptr& rhs)
+    {
+        if (!lhs)
+            return rhs;
+        if (!rhs)
+            return lhs;
+        const node* l = last_leaf(lhs.get());
+        const node* r = first_leaf(rhs.get());
+        if (l->leaf.size() + r->leaf.size() <= max_leaf_size) {
+            auto merged = make_leaf(l->leaf + r->leaf);
+            return join_trees(join_trees(drop_last_leaf(lhs), std::move(merged)),
+                              drop_first_leaf(rhs));
+        }
+        return join_trees(lhs, rhs);
+    }
+
+    // Joins trees whose heights differ by any amount, in time proportional
+    // to the difference
+    static node_ptr join_trees(const node_ptr& lhs, const node_ptr& rhs)
+    {
+        if (!lhs)
+            return rhs;
+        if (!rhs)
+            return lhs;
+        if (lhs->height > rhs->height + 1)
+            return join_right(lhs, rhs);
+        if (rhs->height > lhs->height + 1)
+            return join_left(lhs, rhs);
+        return make_node(lhs, rhs);
+    }
+
+    static node_ptr join_right(const node_ptr& lhs, const node_ptr& rhs)
+    {
+        if (lhs->right->height <= rhs->height + 1) {
+            auto t = make_node(lhs->right, rhs);
+            if (t->height <= lhs->left->height + 1)
+                return make_node(lhs->left, t);
+            return rotate_left(make_node(lhs->left, rotate_right(t)));
+        }
+        auto t = join_right(lhs->right, rhs);
+        auto t2 = make_node(lhs->left, t);
+        if (t->height <= lhs->left->height + 1)
+            return t2;
+        return rotate_left(t2);
+    }
+
+    static node_ptr join_left(const node_ptr& lhs, const node_ptr& rhs)
+    {
+        if (rhs->left->height <= lhs->height + 1) {
+            auto t = make_node(lhs, rhs->left);
+            if (t->height <= rhs->right->height + 1)
+                return make_node(t, rhs->right);
+            return rotate_right(make_node(rotate_left(t), rhs->right));
+        }
+        auto t = join_left(lhs, rhs->left);
+        auto t2 = make_node(t, rhs->right);
+        if (t->height <= rhs->right->height + 1)
+            return t2;
+        return rotate_right(t2);
+    }
+
+    // Splits at a byte offset, which must be a code point boundary. The
+    // pieces are reassembled with join_trees, so the leaves either side of the
+    // cut are left for the caller to merge.
+    static std::pair<node_ptr, node_ptr> split(const node_ptr& n, size_type offset)
+    {
+        if (!n)
+            return {};
+        if (offset == 0)
+            return {nullptr, n};
+        if (offset >= n->metrics.bytes)
+            return {n, nullptr};
+        if (n->is_leaf())
+            return {make_leaf(n->leaf.substr(0, offset)), make_leaf(n->leaf.substr(offset))};
+
+        const size_type left_size = n->left->metrics.bytes;
+        if (offset < left_size) {
+            auto parts = split(n->left, offset);
+            return {parts.first, join_trees(parts.second, n->right)};
+        }
+        auto parts = split(n->right, offset - left_size);
+        return {join_trees(n->left, parts.first), parts.second};
+    }
+
+    // Inserts well formed UTF-8 by rebuilding the leaf holding `offset`. If
+    // that takes more than one leaf, each is about half full or more, so there
+    // is nothing to merge with the neighbours and join_trees suffices.
+    static node_ptr insert_at(const node_ptr& n, size_type offset, const std::string& str)
+    {
+        if (n->is_leaf()) {
+            std::string s = n->leaf;
+            s.insert(offset, str);
+            return build_valid(s);
+        }
+        const size_type left_size = n->left->metrics.bytes;
+        if (offset <= left_size)
+            return join_trees(insert_at(n->left, offset, str), n->right);
+        return join_trees(n->left, insert_at(n->right, offset - left_size, str));
+    }
+
+    static std::string valid_utf8(const std::string& str)
+    {
+        if (validate_utf8(str))
+            return str;
+        return to_u8string(str);
+    }
+
+    // Builds a balanced tree of leaves from well formed UTF-8. The text is
+    // shared evenly between as few leaves as will hold it, so that a leaf
+    // which overflows by one byte splits in half rather than leaving a
+    // one-byte leaf behind.
+    static node_ptr build_valid(const std::string& str)
+    {
+        std::vector<node_ptr> level;
+        size_type leaves = (str.size() + max_leaf_size - 1) / max_leaf_size;
+        size_type pos = 0;
+        while (pos < str.size()) {
+            const size_type remaining = str.size() - pos;
+            const size_type share = (remaining + leaves - 1) / leaves;
+            size_type end = pos + (share < max_leaf_size ? share : max_leaf_size);
+            while (end < str.size() && detail::utf_traits<char>::is_trail(str[end]))
+                --end;
+            level.push_back(make_leaf(str.substr(pos, end - pos)));
+            pos = end;
+            if (leaves > 1)
+                --leaves;
+        }
+        while (level.size() > 1) {
+            std::vector<node_ptr> next;
+            for (size_type i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(join_trees(level[i], level[i + 1]));
+            }
+            if (level.size() % 2 != 0)
+                next.back() = join_trees(next.back(), level.back());
+            level = std::move(next);
+        }
+        return level.empty() ? nullptr : level.front();
+    }
+
+    static node_ptr build(const std::string& str)
+    {
+        return build_valid(valid_utf8(str));
+    }
+
+    template <typename Func>
+    static void for_each_chunk(const node* n, Func& f)
+    {
+        if (!n)
+            return;
+        if (n->is_leaf()) {
+            f(n->leaf.data(), n->leaf.size());
+            return;
+        }
+        for_each_chunk(n->left.get(), f);
+        for_each_chunk(n->right.get(), f);
+    }
+
+    node_ptr root_;
+};
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,93 @@
+
+#ifndef TCB_UNICODE_STREAMBUF_HPP_INCLUDED
+#define TCB_UNICODE_STREAMBUF_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <streambuf>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// A read-only stream buffer which pulls blocks of text from another stream
+/// buffer using sgetn(), transcodes them to OutCharT and presents the result
+/// as its get area, for use with std::basic_istream<OutCharT>.
+///
+template <typename InCharT, typename OutCharT,
+          typename InTraits = std::char_traits<InCharT>,
+          typename OutTraits = std::char_traits<OutCharT>>
+class transcoding_streambuf : public std::basic_streambuf<OutCharT, OutTraits> {
+public:
+    using source_type = std::basic_streambuf<InCharT, InTraits>;
+    using char_type = OutCharT;
+    using traits_type = OutTraits;
+    using int_type = typename traits_type::int_type;
+
+    static constexpr std::size_t default_buffer_size = 16384;
+
+    explicit transcoding_streambuf(source_type* source,
+                                   std::size_t buffer_size = default_buffer_size)
+            : source_(source),
+              // Must be able to hold at least one complete code point
+              in_capacity_(std::max<std::size_t>(buffer_size,
+                                                 detail::utf_traits<InCharT>::max_width)),
+              in_buf_(new InCharT[in_capacity_]),
+              out_buf_(new OutCharT[detail::max_converted_size<OutCharT>(in_capacity_)])
+    {}
+
+    transcoding_streambuf(const transcoding_streambuf&) = delete;
+    transcoding_streambuf& operator=(const transcoding_streambuf&) = delete;
+
+    source_type* source() const { return source_; }
+
+protected:
+    int_type underflow() override
+    {
+        if (this->gptr() < this->egptr())
+            return traits_type::to_int_type(*this->gptr());
+
+        if (!source_)
+            return traits_type::eof();
+
+        while (true) {
+            const std::streamsize n =
+                source_->sgetn(in_buf_.get() + in_size_,
+                               static_cast<std::streamsize>(in_capacity_ - in_size_));
+            const bool eof = n <= 0;
+            if (n > 0)
+                in_size_ += static_cast<std::size_t>(n);
+
+            const InCharT* in_end = in_buf_.get() + in_size_;
+            const auto res = detail::convert_block<InCharT, OutCharT>(
+                in_buf_.get(), in_end, out_buf_.get(), eof);
+
+            // Keep any incomplete trailing sequence for the next block
+            in_size_ = static_cast<std::size_t>(in_end - res.in);
+            std::memmove(in_buf_.get(), res.in, in_size_ * sizeof(InCharT));
+
+            if (res.out != out_buf_.get()) {
+                this->setg(out_buf_.get(), out_buf_.get(), res.out);
+                return traits_type::to_int_type(*this->gptr());
+            }
+
+            if (eof)
+                return traits_type::eof();
+        }
+    }
+
+private:
+    source_type* source_ = nullptr;
+    std::size_t in_capacity_;
+    std::size_t in_size_ = 0;
+    std::unique_ptr<InCharT[]> in_buf_;
+    std::unique_ptr<OutCharT[]> out_buf_;
+};
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,251 @@
+
+#ifndef TCB_UNICODE_TEXT_HPP_INCLUDED
+#define TCB_UNICODE_TEXT_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+template <typename CharT>
+struct is_utf_char : std::integral_constant<bool,
+    std::is_same<CharT, char>::value ||
+    std::is_same<CharT, char16_t>::value ||
+    std::is_same<CharT, char32_t>::value> {};
+
+// Whether String holds contiguous char, char16_t or char32_t code units
+template <typename String, typename = void>
+struct is_contiguous_utf_string : std::false_type {};
+
+template <typename String>
+struct is_contiguous_utf_string<String, std::enable_if_t<has_contiguous_data<String>::value>>
+    : is_utf_char<std::remove_cv_t<std::remove_pointer_t<
+          decltype(std::declval<const String&>().data())>>> {};
+
+} // end namespace detail
+
+///
+/// An immutable, reference counted string which keeps the encoding it was
+/// constructed with and converts to the other UTF encodings on demand. Each
+/// conversion happens at most once, the first time it is asked for, and the
+/// result is cached and shared by every copy; after that, asking for it
+/// again costs no more than a pointer load. Conversions may be requested
+/// from several threads at once.
+///
+/// Text in the original encoding is stored as it was given, but conversions
+/// replace any ill-formed sequences with U+FFFD.
+///
+class text {
+public:
+    using size_type = std::size_t;
+
+    text() = default;
+
+    template <typename CharT,
+              typename = std::enable_if_t<detail::is_utf_char<CharT>::value>>
+    text(const CharT* str)
+        : text(std::basic_string<CharT>(str))
+    {}
+
+    template <typename CharT,
+              typename = std::enable_if_t<detail::is_utf_char<CharT>::value>>
+    explicit text(std::basic_string<CharT>&& str)
+        : rep_(std::make_shared<rep>())
+    {
+        rep_->original_width = sizeof(CharT);
+        rep_->set(std::move(str));
+    }
+
+    /// Copies a UTF-8, UTF-16 or UTF-32 string, keeping its encoding, or
+    /// converts any other input accepted by to_u8string() to UTF-8
+    template <typename String,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<String>, text>::value &&
+                                          !std::is_array<String>::value &&
+                                          !std::is_pointer<String>::value>>
+    explicit text(const String& str)
+        : text(copy_or_convert(str, detail::is_contiguous_utf_string<String>{}))
+    {}
+
+    /// Returns the size in bytes of the code units of the original encoding:
+    /// 1 for UTF-8, 2 for UTF-16 or 4 for UTF-32
+    int original_width() const noexcept
+    {
+        return rep_ ? rep_->original_width : 1;
+    }
+
+    bool empty() const noexcept
+    {
+        return !rep_ || rep_->empty();
+    }
+
+    const std::string& u8string() const { return get<char>(); }
+    const std::u16string& u16string() const { return get<char16_t>(); }
+    const std::u32string& u32string() const { return get<char32_t>(); }
+
+    /// Returns the text in the UTF encoding with code units of type CharT
+    template <typename CharT>
+    const std::basic_string<CharT>& str() const { return get<CharT>(); }
+
+    /// Returns whether two texts hold the same code points, counting each
+    /// ill-formed sequence as U+FFFD
+    friend bool operator==(const text& lhs, const text& rhs)
+    {
+        if (lhs.rep_ == rhs.rep_)
+            return true;
+        return lhs.visit_original([&rhs](const auto& a) {
+            return rhs.visit_original([&a](const auto& b) {
+                return equal_code_points(a, b);
+            });
+        });
+    }
+
+    friend bool operator!=(const text& lhs, const text& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Calls f with the string in the original encoding
+    template <typename F>
+    auto visit_original(F f) const -> decltype(f(std::string{}))
+    {
+        if (!rep_)
+            return f(std::string{});
+        switch (rep_->original_width) {
+        case 1: return f(rep_->utf8.str);
+        case 2: return f(rep_->utf16.str);
+        default: return f(rep_->utf32.str);
+        }
+    }
+
+    // Compares the code points of two strings without converting either.
+    // The originals are not validated, so identical code units are the only
+    // shortcut: otherwise both sides are decoded, with replacement, so that
+    // the result is the same whichever way round the texts are compared.
+    template <typename CharT1, typename CharT2>
+    static bool equal_code_points(const std::basic_string<CharT1>& a,
+                                  const std::basic_string<CharT2>& b)
+    {
+        if (sizeof(CharT1) == sizeof(CharT2) && a.size() == b.size() &&
+            std::equal(a.begin(), a.end(), b.begin(),
+                       [](CharT1 x, CharT2 y) { return x == static_cast<CharT1>(y); }))
+            return true;
+
+        const CharT1* p = a.data();
+        const CharT1* const p_end = p + a.size();
+        const CharT2* q = b.data();
+        const CharT2* const q_end = q + b.size();
+        while (p != p_end && q != q_end) {
+            if (detail::is_ascii_unit(*p) && detail::is_ascii_unit(*q)) {
+                if (static_cast<char32_t>(*p++) != static_cast<char32_t>(*q++))
+                    return false;
+                continue;
+            }
+            const auto c1 = detail::replace_invalid<CharT1, char32_t>(
+                detail::utf_traits<CharT1>::decode(p, p_end));
+            const auto c2 = detail::replace_invalid<CharT2, char32_t>(
+                detail::utf_traits<CharT2>::decode(q, q_end));
+            if (c1 != c2)
+                return false;
+        }
+        return p == p_end && q == q_end;
+    }
+
+    template <typename String>
+    static auto copy_or_convert(const String& str, std::true_type)
+    {
+        using char_type = std::remove_cv_t<std::remove_pointer_t<decltype(str.data())>>;
+        return std::basic_string<char_type>(str.data(), str.size());
+    }
+
+    template <typename String>
+    static std::string copy_or_convert(const String& str, std::false_type)
+    {
+        return to_u8string(str);
+    }
+
+    template <typename CharT>
+    struct slot {
+        std::basic_string<CharT> str;
+        std::once_flag once;
+    };
+
+    struct rep {
+        slot<char> utf8;
+        slot<char16_t> utf16;
+        slot<char32_t> utf32;
+        int original_width = 1;
+
+        slot<char>& get(char) { return utf8; }
+        slot<char16_t>& get(char16_t) { return utf16; }
+        slot<char32_t>& get(char32_t) { return utf32; }
+
+        template <typename CharT>
+        void set(std::basic_string<CharT>&& str)
+        {
+            slot<CharT>& s = get(CharT{});
+            std::call_once(s.once, [&] { s.str = std::move(str); });
+        }
+
+        bool empty() const
+        {
+            switch (original_width) {
+            case 1: return utf8.str.empty();
+            case 2: return utf16.str.empty();
+            default: return utf32.str.empty();
+            }
+        }
+
+        template <typename OutCharT, typename InCharT>
+        std::basic_string<OutCharT> convert_from(const slot<InCharT>& in) const
+        {
+            return detail::to_utf_string_contiguous<OutCharT, InCharT>(
+                in.str.data(), in.str.data() + in.str.size());
+        }
+
+        // The original slot was filled on construction, so its flag is
+        // already set and this never converts a text to itself
+        template <typename CharT>
+        const std::basic_string<CharT>& materialize()
+        {
+            slot<CharT>& s = get(CharT{});
+            std::call_once(s.once, [this, &s] {
+                switch (original_width) {
+                case 1: s.str = convert_from<CharT>(utf8); break;
+                case 2: s.str = convert_from<CharT>(utf16); break;
+                default: s.str = convert_from<CharT>(utf32); break;
+                }
+            });
+            return s.str;
+        }
+    };
+
+    template <typename CharT>
+    const std::basic_string<CharT>& get() const
+    {
+        static_assert(detail::is_utf_char<CharT>::value,
+                      "text can only be converted to char, char16_t or char32_t strings");
+        if (!rep_) {
+            static const std::basic_string<CharT> empty_str;
+            return empty_str;
+        }
+        return rep_->template materialize<CharT>();
+    }
+
+    std::shared_ptr<rep> rep_;
+};
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
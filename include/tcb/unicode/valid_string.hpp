@@ -0,0 +1,289 @@
+
+#ifndef TCB_UNICODE_VALID_STRING_HPP_INCLUDED
+#define TCB_UNICODE_VALID_STRING_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/validate.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Encoding tag for UTF text which the caller guarantees to be well formed,
+/// for example `to_u16string<assume_valid<char>>(str)`. Decoding uses
+/// `decode_valid()`, skipping all checks: the behaviour is undefined if the
+/// text is not in fact valid.
+///
+template <typename CharT>
+struct assume_valid {};
+
+namespace detail {
+
+template <typename CharT>
+struct is_encoding_tag<assume_valid<CharT>> : std::true_type {};
+
+template <typename CharT>
+struct utf_traits<assume_valid<CharT>, 1> : utf_traits<CharT> {
+    // The only check needed is for a sequence which runs past the end of a
+    // block, so that block-wise conversion can resume at its start
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        if (utf_traits<CharT>::trail_length(*current) >= last - current)
+            return incomplete;
+        return utf_traits<CharT>::decode_valid(current);
+    }
+};
+
+} // end namespace detail
+
+template <typename CharT>
+class basic_valid_string;
+
+///
+/// A non-owning view of UTF-8, UTF-16 or UTF-32 text (according to the size
+/// of CharT) which is known to be well formed. Views can only be obtained
+/// from a basic_valid_string, or from make_valid_view() which validates its
+/// input, so conversions from them never need to check the input again.
+///
+template <typename CharT>
+class basic_valid_view {
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using const_iterator = const CharT*;
+    using iterator = const_iterator;
+
+    constexpr basic_valid_view() = default;
+
+    constexpr const CharT* data() const noexcept { return data_; }
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr const_iterator begin() const noexcept { return data_; }
+    constexpr const_iterator end() const noexcept { return data_ + size_; }
+
+    std::basic_string<CharT> str() const { return {data_, size_}; }
+
+    friend bool operator==(basic_valid_view lhs, basic_valid_view rhs)
+    {
+        return lhs.size_ == rhs.size_ &&
+               std::char_traits<CharT>::compare(lhs.data_, rhs.data_, lhs.size_) == 0;
+    }
+
+    friend bool operator!=(basic_valid_view lhs, basic_valid_view rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    template <typename>
+    friend class basic_valid_string;
+
+    template <typename C>
+    friend struct valid_view_result;
+
+    constexpr basic_valid_view(const CharT* data, size_type size)
+        : data_(data), size_(size) {}
+
+    const CharT* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+using valid_utf8_view = basic_valid_view<char>;
+using valid_utf16_view = basic_valid_view<char16_t>;
+using valid_utf32_view = basic_valid_view<char32_t>;
+
+///
+/// The result of make_valid_view(): the view if the input was well formed,
+/// or the offset in code units of the first ill-formed sequence
+///
+template <typename CharT>
+struct valid_view_result {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    basic_valid_view<CharT> view;
+
+    std::size_t error_position = npos;
+
+    explicit operator bool() const { return error_position == npos; }
+
+    valid_view_result(const CharT* first, const CharT* last)
+    {
+        const CharT* bad = find_invalid_utf(first, last);
+        if (bad == last)
+            view = basic_valid_view<CharT>(first, static_cast<std::size_t>(last - first));
+        else
+            error_position = static_cast<std::size_t>(bad - first);
+    }
+};
+
+///
+/// Validates [first, last) in bulk, returning a view of it if it is well
+/// formed UTF
+///
+template <typename CharT>
+valid_view_result<CharT> make_valid_view(const CharT* first, const CharT* last)
+{
+    return {first, last};
+}
+
+template <typename String,
+          typename = std::enable_if_t<detail::has_contiguous_data<String>::value>>
+auto make_valid_view(const String& str)
+{
+    return make_valid_view(str.data(), str.data() + str.size());
+}
+
+///
+/// An owning string of UTF-8, UTF-16 or UTF-32 text (according to the size
+/// of CharT) which is known to be well formed. The constructor validates its
+/// input once, in bulk, replacing any ill-formed sequences with U+FFFD; input
+/// in a different encoding is converted. Afterwards, conversions and views
+/// decode with `decode_valid()`.
+///
+template <typename CharT>
+class basic_valid_string {
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using const_iterator = typename std::basic_string<CharT>::const_iterator;
+    using iterator = const_iterator;
+
+    basic_valid_string() = default;
+
+    template <typename String,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<String>, basic_valid_string>::value>>
+    explicit basic_valid_string(const String& str)
+        : str_(make(str, std::is_same<detail::range_value_t<String>, CharT>{}))
+    {}
+
+    explicit basic_valid_string(std::basic_string<CharT>&& str)
+        : str_(find_invalid_utf(str.data(), str.data() + str.size()) == str.data() + str.size()
+                   ? std::move(str)
+                   : to_utf_string<CharT>(str.data(), str.data() + str.size()))
+    {}
+
+    /// Converts from a valid string in another encoding without checking
+    template <typename OtherCharT>
+    explicit basic_valid_string(basic_valid_view<OtherCharT> other)
+        : str_(detail::to_utf_string_contiguous<CharT, assume_valid<OtherCharT>>(
+              other.data(), other.data() + other.size()))
+    {}
+
+    basic_valid_string(basic_valid_view<CharT> other)
+        : str_(other.data(), other.size())
+    {}
+
+    const std::basic_string<CharT>& str() const noexcept { return str_; }
+    const CharT* data() const noexcept { return str_.data(); }
+    size_type size() const noexcept { return str_.size(); }
+    bool empty() const noexcept { return str_.empty(); }
+
+    const_iterator begin() const noexcept { return str_.begin(); }
+    const_iterator end() const noexcept { return str_.end(); }
+
+    basic_valid_view<CharT> view() const noexcept { return {str_.data(), str_.size()}; }
+    operator basic_valid_view<CharT>() const noexcept { return view(); }
+
+    friend bool operator==(const basic_valid_string& lhs, const basic_valid_string& rhs)
+    {
+        return lhs.str_ == rhs.str_;
+    }
+
+    friend bool operator!=(const basic_valid_string& lhs, const basic_valid_string& rhs)
+    {
+        return lhs.str_ != rhs.str_;
+    }
+
+private:
+    // Same encoding: copy if valid, otherwise convert with replacement
+    template <typename String>
+    static std::basic_string<CharT> make(const String& str, std::true_type)
+    {
+        const CharT* first = str.data();
+        const CharT* last = first + str.size();
+        if (find_invalid_utf(first, last) == last)
+            return std::basic_string<CharT>(first, last);
+        return to_utf_string<CharT>(first, last);
+    }
+
+    // Conversion always produces well formed output
+    template <typename String>
+    static std::basic_string<CharT> make(const String& str, std::false_type)
+    {
+        return detail::to_utf_string_range<CharT, detail::range_value_t<String>>(
+            str, detail::has_contiguous_data<String>{});
+    }
+
+    std::basic_string<CharT> str_;
+};
+
+using valid_utf8_string = basic_valid_string<char>;
+using valid_utf16_string = basic_valid_string<char16_t>;
+using valid_utf32_string = basic_valid_string<char32_t>;
+
+// Views and conversions of valid text decode without checking
+
+template <typename CharT>
+auto as_utf8(basic_valid_view<CharT> v)
+{
+    return as_utf8<assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+auto as_utf16(basic_valid_view<CharT> v)
+{
+    return as_utf16<assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+auto as_utf32(basic_valid_view<CharT> v)
+{
+    return as_utf32<assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+std::string to_u8string(basic_valid_view<CharT> v)
+{
+    return detail::to_utf_string_contiguous<char, assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+std::u16string to_u16string(basic_valid_view<CharT> v)
+{
+    return detail::to_utf_string_contiguous<char16_t, assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+std::u32string to_u32string(basic_valid_view<CharT> v)
+{
+    return detail::to_utf_string_contiguous<char32_t, assume_valid<CharT>>(v.begin(), v.end());
+}
+
+template <typename CharT>
+auto as_utf8(const basic_valid_string<CharT>& s) { return as_utf8(s.view()); }
+
+template <typename CharT>
+auto as_utf16(const basic_valid_string<CharT>& s) { return as_utf16(s.view()); }
+
+template <typename CharT>
+auto as_utf32(const basic_valid_string<CharT>& s) { return as_utf32(s.view()); }
+
+template <typename CharT>
+std::string to_u8string(const basic_valid_string<CharT>& s) { return to_u8string(s.view()); }
+
+template <typename CharT>
+std::u16string to_u16string(const basic_valid_string<CharT>& s) { return to_u16string(s.view()); }
+
+template <typename CharT>
+std::u32string to_u32string(const basic_valid_string<CharT>& s) { return to_u32string(s.view()); }
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
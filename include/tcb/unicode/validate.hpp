@@ -0,0 +1,266 @@
+
+#ifndef TCB_UNICODE_VALIDATE_HPP_INCLUDED
+#define TCB_UNICODE_VALIDATE_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+namespace detail {
+
+template <typename CharT>
+using enable_if_utf16_unit_t = std::enable_if_t<sizeof(CharT) == 2 && std::is_integral<CharT>::value>;
+
+///
+/// Returns whether any of the 16 code units at p is a surrogate, examining
+/// four code units per 64-bit word
+///
+template <typename CharT>
+inline bool has_surrogate16(const CharT* p)
+{
+    constexpr std::uint64_t high_bits = 0xF800F800F800F800u;
+    constexpr std::uint64_t surrogates = 0xD800D800D800D800u;
+    constexpr std::uint64_t ones = 0x0001000100010001u;
+    constexpr std::uint64_t top = 0x8000800080008000u;
+
+    std::uint64_t any = 0;
+    for (int i = 0; i < 4; i++) {
+        std::uint64_t w;
+        std::memcpy(&w, p + 4 * i, sizeof(w));
+        // Lanes holding a surrogate become zero...
+        const std::uint64_t x = (w & high_bits) ^ surrogates;
+        // ...and the top bit of each zero lane is set
+        any |= (x - ones) & ~x & top;
+    }
+    return any != 0;
+}
+
+///
+/// Examines the code unit at `p`, returning the number of units in the well
+/// formed sequence it begins (one or two), or zero if it is a lone surrogate
+///
+template <typename CharT>
+inline int utf16_sequence_length(const CharT* p, const CharT* last)
+{
+    const auto c = static_cast<std::uint16_t>(*p);
+    if ((c & 0xF800) != 0xD800)
+        return 1;
+    if (c <= 0xDBFF && last - p >= 2 &&
+        (static_cast<std::uint16_t>(p[1]) & 0xFC00) == 0xDC00)
+        return 2;
+    return 0;
+}
+
+///
+/// Calls `on_invalid(p)` for each lone surrogate in [first, last), stopping
+/// early if it returns false. Blocks of 16 code units without surrogates are
+/// skipped after a single check; only blocks containing a surrogate are
+/// examined a unit at a time.
+///
+template <typename CharT, typename Func>
+const CharT* for_each_lone_surrogate(const CharT* first, const CharT* last, Func on_invalid)
+{
+    while (first != last) {
+        const CharT* block_end = last;
+        if (last - first >= 16) {
+            if (!has_surrogate16(first)) {
+                first += 16;
+                continue;
+            }
+            block_end = first + 16;
+        }
+        // A pair starting at the end of a block may extend into the next
+        while (first < block_end) {
+            const int n = utf16_sequence_length(first, last);
+            if (n == 0) {
+                if (!on_invalid(first))
+                    return first;
+                ++first;
+            }
+            else {
+                first += n;
+            }
+        }
+    }
+    return last;
+}
+
+template <typename CharT>
+using enable_if_utf8_unit_t = std::enable_if_t<sizeof(CharT) == 1 && std::is_integral<CharT>::value>;
+
+template <typename CharT>
+using enable_if_utf32_unit_t = std::enable_if_t<sizeof(CharT) == 4 && std::is_integral<CharT>::value>;
+
+} // end namespace detail
+
+///
+/// Returns a pointer to the start of the first ill-formed sequence in the
+/// UTF-8 text [first, last), or `last` if the text is well formed. Runs of
+/// ASCII are skipped a word at a time.
+///
+template <typename CharT, typename = detail::enable_if_utf8_unit_t<CharT>>
+const CharT* find_invalid_utf8(const CharT* first, const CharT* last)
+{
+    while (first != last) {
+        first += detail::ascii_prefix_length(first, last);
+        while (first != last && !detail::is_ascii_unit(*first)) {
+            const CharT* p = first;
+            const detail::code_point c = detail::utf_traits<char>::decode(p, last);
+            if (c == detail::illegal || c == detail::incomplete)
+                return first;
+            first = p;
+        }
+    }
+    return last;
+}
+
+template <typename CharT, typename = detail::enable_if_utf8_unit_t<CharT>>
+bool validate_utf8(const CharT* first, const CharT* last)
+{
+    return find_invalid_utf8(first, last) == last;
+}
+
+template <typename String,
+          typename = detail::enable_if_utf8_unit_t<detail::range_value_t<String>>>
+bool validate_utf8(const String& str)
+{
+    return validate_utf8(str.data(), str.data() + str.size());
+}
+
+///
+/// Returns a pointer to the first value in [first, last) which is a
+/// surrogate or greater than U+10FFFF, or `last` if there is none
+///
+template <typename CharT, typename = detail::enable_if_utf32_unit_t<CharT>>
+const CharT* find_invalid_utf32(const CharT* first, const CharT* last)
+{
+    // Check 16 values at a time with a branch-free, vectorisable reduction
+    while (last - first >= 16) {
+        bool bad = false;
+        for (int i = 0; i < 16; i++) {
+            const auto c = static_cast<std::uint32_t>(first[i]);
+            bad |= (c > 0x10FFFF) | ((c & 0xFFFFF800) == 0xD800);
+        }
+        if (bad)
+            break;
+        first += 16;
+    }
+    for (; first != last; ++first) {
+        if (!detail::is_valid_codepoint(static_cast<std::uint32_t>(*first)))
+            return first;
+    }
+    return last;
+}
+
+template <typename CharT, typename = detail::enable_if_utf32_unit_t<CharT>>
+bool validate_utf32(const CharT* first, const CharT* last)
+{
+    return find_invalid_utf32(first, last) == last;
+}
+
+template <typename String,
+          typename = detail::enable_if_utf32_unit_t<detail::range_value_t<String>>>
+bool validate_utf32(const String& str)
+{
+    return validate_utf32(str.data(), str.data() + str.size());
+}
+
+///
+/// Returns a pointer to the first lone surrogate in the UTF-16 text
+/// [first, last), or `last` if the text is well formed
+///
+template <typename CharT, typename = detail::enable_if_utf16_unit_t<CharT>>
+const CharT* find_invalid_utf16(const CharT* first, const CharT* last)
+{
+    return detail::for_each_lone_surrogate(first, last, [](const CharT*) { return false; });
+}
+
+///
+/// Returns whether the UTF-16 text [first, last) is well formed, that is,
+/// contains no unpaired surrogates
+///
+template <typename CharT, typename = detail::enable_if_utf16_unit_t<CharT>>
+bool validate_utf16(const CharT* first, const CharT* last)
+{
+    return find_invalid_utf16(first, last) == last;
+}
+
+template <typename String,
+          typename = detail::enable_if_utf16_unit_t<detail::range_value_t<String>>>
+bool validate_utf16(const String& str)
+{
+    return validate_utf16(str.data(), str.data() + str.size());
+}
+
+///
+/// Replaces each lone surrogate in the UTF-16 text [first, last) with
+/// U+FFFD, in place, and returns the number of replacements made
+///
+template <typename CharT, typename = detail::enable_if_utf16_unit_t<CharT>>
+std::size_t to_well_formed_utf16(CharT* first, CharT* last)
+{
+    std::size_t count = 0;
+    detail::for_each_lone_surrogate(
+        static_cast<const CharT*>(first), static_cast<const CharT*>(last),
+        [first, &count](const CharT* p) {
+            first[p - first] = static_cast<CharT>(detail::replacement_character);
+            ++count;
+            return true;
+        });
+    return count;
+}
+
+template <typename CharT, typename Traits, typename Alloc,
+          typename = detail::enable_if_utf16_unit_t<CharT>>
+std::size_t to_well_formed_utf16(std::basic_string<CharT, Traits, Alloc>& str)
+{
+    return to_well_formed_utf16(&str[0], &str[0] + str.size());
+}
+
+namespace detail {
+
+template <typename CharT>
+const CharT* find_invalid_utf(const CharT* first, const CharT* last,
+                              std::integral_constant<std::size_t, 1>)
+{
+    return find_invalid_utf8(first, last);
+}
+
+template <typename CharT>
+const CharT* find_invalid_utf(const CharT* first, const CharT* last,
+                              std::integral_constant<std::size_t, 2>)
+{
+    return find_invalid_utf16(first, last);
+}
+
+template <typename CharT>
+const CharT* find_invalid_utf(const CharT* first, const CharT* last,
+                              std::integral_constant<std::size_t, 4>)
+{
+    return find_invalid_utf32(first, last);
+}
+
+} // end namespace detail
+
+///
+/// Returns a pointer to the first ill-formed code unit sequence in
+/// [first, last), which is UTF-8, UTF-16 or UTF-32 according to the size of
+/// CharT, or `last` if there is none
+///
+template <typename CharT>
+const CharT* find_invalid_utf(const CharT* first, const CharT* last)
+{
+    return detail::find_invalid_utf(first, last, std::integral_constant<std::size_t, sizeof(CharT)>{});
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,299 @@
+
+#ifndef TCB_UNICODE_WIDTH_HPP_INCLUDED
+#define TCB_UNICODE_WIDTH_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/width_tables.hpp>
+#include <tcb/unicode/graphemes.hpp>
+#include <tcb/unicode/properties.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// The width of text in the columns of a terminal or other fixed-width
+/// display.
+///
+/// Widths are measured per extended grapheme cluster, as the widest code
+/// point in the cluster: East Asian Wide and Fullwidth characters (which
+/// include the emoji shown as emoji by default) take two columns; marks,
+/// format and control characters (including tab and newline), default
+/// ignorable code points and conjoining Hangul vowels and final consonants
+/// take none; and everything else, including characters of ambiguous East
+/// Asian width, takes one. A cluster with U+FE0F VARIATION SELECTOR-16 after
+/// an emoji is shown as an emoji, and so is two columns wide, as is a pair
+/// of regional indicators.
+///
+/// The width of each code point is found with a single table lookup (the
+/// table is about 7.5 KB and is generated by tools/ucdgen.cpp). Runs of
+/// ASCII in contiguous input are counted a machine word at a time, without
+/// being decoded.
+///
+/// Ill-formed sequences are treated as U+FFFD, which is one column wide.
+///
+
+namespace detail {
+
+inline unsigned get_display_width(code_point c)
+{
+    return display_width_lookup(c);
+}
+
+template <typename CharT>
+constexpr bool is_printable_ascii(CharT c)
+{
+    return c >= 0x20 && c < 0x7F;
+}
+
+/// Returns the width of the n ASCII code units at p
+template <typename CharT>
+inline std::size_t ascii_width(const CharT* p, std::size_t n)
+{
+    // Branch-free, so that the compiler can vectorise it
+    std::size_t width = 0;
+    for (std::size_t i = 0; i < n; i++)
+        width += is_printable_ascii(p[i]);
+    return width;
+}
+
+template <typename InEncoding>
+struct width_measurer {
+    ///
+    /// Returns the end of the grapheme cluster starting at `first`, which
+    /// must not be `last`, and sets `width` to its width
+    ///
+    template <typename Iter, typename Sentinel>
+    static Iter next(Iter first, Sentinel last, unsigned& width)
+    {
+        const code_point base = decode(first, last);
+        code_point c = base;
+        grapheme_state state{get_grapheme_cluster_break(c)};
+        width = get_display_width(c);
+
+        while (first != last) {
+            // Nothing joins a preceding ASCII code point other than CR
+            if (c < 0x80 && c != '\r' && is_ascii_unit(*first))
+                return first;
+
+            Iter after = first;
+            c = decode(after, last);
+            if (state.is_boundary(get_grapheme_cluster_break(c)))
+                return first;
+            if (c == 0xFE0F && is_emoji(base))
+                width = 2;
+            else if (get_display_width(c) > width)
+                width = get_display_width(c);
+            first = after;
+        }
+        return first;
+    }
+
+private:
+    template <typename Iter, typename Sentinel>
+    static code_point decode(Iter& first, Sentinel last)
+    {
+        return replace_invalid<InEncoding, InEncoding>(utf_traits<InEncoding>::decode(first, last));
+    }
+};
+
+///
+/// Moves `first` past whole grapheme clusters for as long as `width` plus
+/// their width is at most `limit`, adding their width to `width`. Returns
+/// whether it stopped before `last`.
+///
+template <typename InEncoding, typename Iter, typename Sentinel>
+bool advance_width(Iter& first, Sentinel last, std::size_t& width, std::size_t limit)
+{
+    while (first != last) {
+        unsigned w;
+        const Iter next = width_measurer<InEncoding>::next(first, last, w);
+        if (width + w > limit)
+            return true;
+        width += w;
+        first = next;
+    }
+    return false;
+}
+
+template <typename InEncoding, typename CharT>
+bool advance_width(const CharT*& first, const CharT* last, std::size_t& width,
+                   std::size_t limit)
+{
+    while (first != last) {
+        // Each ASCII code unit but the last in a run is a cluster by itself
+        // (the last may be followed by a mark or variation selector)
+        std::size_t n = ascii_prefix_length(first, last);
+        if (n > 1 || first + n == last) {
+            if (first + n != last)
+                --n;
+            const std::size_t w = ascii_width(first, n);
+            if (width + w > limit) {
+                while (width + is_printable_ascii(*first) <= limit) {
+                    width += is_printable_ascii(*first);
+                    ++first;
+                }
+                return true;
+            }
+            width += w;
+            first += n;
+            if (first == last)
+                break;
+        }
+
+        unsigned w;
+        const CharT* next = width_measurer<InEncoding>::next(first, last, w);
+        if (width + w > limit)
+            return true;
+        width += w;
+        first = next;
+    }
+    return false;
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel>
+std::size_t measure_width(Iter first, Sentinel last)
+{
+    std::size_t width = 0;
+    advance_width<InEncoding>(first, last, width, SIZE_MAX);
+    return width;
+}
+
+template <typename InEncoding, typename String>
+std::size_t measure_string_width(const String& str, std::true_type /*contiguous*/)
+{
+    return measure_width<InEncoding>(str.data(), str.data() + str.size());
+}
+
+template <typename InEncoding, typename String>
+std::size_t measure_string_width(const String& str, std::false_type /*contiguous*/)
+{
+    return measure_width<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
+template <typename String, typename Iter>
+String truncate_range(Iter first, Iter last, std::size_t columns, const String& ellipsis)
+{
+    using encoding = iter_value_t<Iter>;
+
+    const std::size_t ellipsis_width =
+        measure_string_width<encoding>(ellipsis, has_contiguous_data<String>{});
+    const std::size_t limit = ellipsis_width < columns ? columns - ellipsis_width : 0;
+
+    std::size_t width = 0;
+    Iter cut = first;
+    if (!advance_width<encoding>(cut, last, width, limit))
+        return String(first, last);
+    Iter rest = cut;
+    if (!advance_width<encoding>(rest, last, width, columns))
+        return String(first, last);
+
+    // Too wide, even with the ellipsis alone
+    if (ellipsis_width > columns)
+        return truncate_range(std::cbegin(ellipsis), std::cend(ellipsis), columns, String{});
+
+    String result(first, cut);
+    result.insert(result.end(), std::cbegin(ellipsis), std::cend(ellipsis));
+    return result;
+}
+
+template <typename String>
+String truncate_string(const String& str, std::size_t columns, const String& ellipsis,
+                       std::true_type /*contiguous*/)
+{
+    return truncate_range(str.data(), str.data() + str.size(), columns, ellipsis);
+}
+
+template <typename String>
+String truncate_string(const String& str, std::size_t columns, const String& ellipsis,
+                       std::false_type /*contiguous*/)
+{
+    return truncate_range(std::cbegin(str), std::cend(str), columns, ellipsis);
+}
+
+} // end namespace detail
+
+///
+/// Returns the number of columns taken by the text [first, last) on a
+/// terminal
+///
+template <typename Iter, typename Sentinel>
+std::size_t display_width(Iter first, Sentinel last)
+{
+    return detail::measure_width<detail::iter_value_t<Iter>>(first, last);
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::size_t display_width(Iter first, Sentinel last)
+{
+    return detail::measure_width<InEncoding>(first, last);
+}
+
+template <typename String>
+std::size_t display_width(const String& str)
+{
+    return detail::measure_string_width<detail::range_value_t<String>>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+std::size_t display_width(const String& str)
+{
+    return detail::measure_string_width<InEncoding>(str, detail::has_contiguous_data<String>{});
+}
+
+///
+/// Returns the end of the longest sequence of whole grapheme clusters
+/// starting at `first` which fits in `columns` columns
+///
+template <typename Iter, typename Sentinel>
+Iter find_width_boundary(Iter first, Sentinel last, std::size_t columns)
+{
+    std::size_t width = 0;
+    detail::advance_width<detail::iter_value_t<Iter>>(first, last, width, columns);
+    return first;
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+Iter find_width_boundary(Iter first, Sentinel last, std::size_t columns)
+{
+    std::size_t width = 0;
+    detail::advance_width<InEncoding>(first, last, width, columns);
+    return first;
+}
+
+///
+/// Returns `str` if it fits in `columns` columns, or else its longest
+/// prefix of whole grapheme clusters which fits in `columns` columns
+/// together with `ellipsis`, followed by `ellipsis`
+///
+template <typename String>
+String truncate_to_width(const String& str, std::size_t columns, const String& ellipsis)
+{
+    return detail::truncate_string(str, columns, ellipsis, detail::has_contiguous_data<String>{});
+}
+
+template <typename String>
+String truncate_to_width(const String& str, std::size_t columns,
+                         const detail::range_value_t<String>* ellipsis)
+{
+    return truncate_to_width(str, columns, String(ellipsis));
+}
+
+template <typename String>
+String truncate_to_width(const String& str, std::size_t columns)
+{
+    return truncate_to_width(str, columns, String{});
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
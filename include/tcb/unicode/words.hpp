@@ -0,0 +1,461 @@
+
+#ifndef TCB_UNICODE_WORDS_HPP_INCLUDED
+#define TCB_UNICODE_WORDS_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detail/break_tables.hpp>
+#include <tcb/unicode/detail/segment_view.hpp>
+#include <tcb/unicode/properties.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Word boundaries, as in Unicode Standard Annex #29 (version 14.0).
+///
+/// As with graphemes(), the segments are ranges of the input code units,
+/// found without converting or allocating. Every code point belongs to a
+/// segment: the text between words (spaces and punctuation) forms segments
+/// too, and is_word_segment() tells the two apart.
+///
+/// The rules which look at one code point either side of a boundary are a
+/// table of the properties each property joins with, and the rest (letters
+/// or digits separated by punctuation such as "can't" or "3.14", and
+/// regional indicator pairs) keep the property before last or look ahead
+/// one code point. ASCII code points are classified through a small table,
+/// runs of ASCII letters and digits are skipped a code unit at a time, and
+/// an ASCII segment which no further rule could extend is returned before
+/// any state for those rules is set up.
+///
+/// Ill-formed sequences are treated as U+FFFD.
+///
+
+namespace detail {
+
+constexpr std::uint32_t word_bit(word_break b)
+{
+    return 1u << static_cast<unsigned>(b);
+}
+
+constexpr bool is_word_break_in(word_break b, std::uint32_t set)
+{
+    return (word_bit(b) & set) != 0;
+}
+
+// AHLetter, MidNumLetQ, and those which WB4 skips over
+constexpr std::uint32_t word_ahletter = word_bit(word_break::aletter) |
+                                        word_bit(word_break::hebrew_letter);
+constexpr std::uint32_t word_midnumletq = word_bit(word_break::midnumlet) |
+                                          word_bit(word_break::single_quote);
+constexpr std::uint32_t word_ignored = word_bit(word_break::extend) |
+                                       word_bit(word_break::format) |
+                                       word_bit(word_break::zwj);
+
+///
+/// Returns the set of properties which join a preceding (non-ignored) code
+/// point with property `prev` under rules WB5, WB7a, WB8 to WB10 and WB13 to
+/// WB13b
+///
+constexpr std::uint32_t word_joins(word_break prev)
+{
+    using wb = word_break;
+    switch (prev) {
+    case wb::aletter: // WB5, WB9, WB13a
+        return word_ahletter | word_bit(wb::numeric) | word_bit(wb::extendnumlet);
+    case wb::hebrew_letter: // WB5, WB7a, WB9, WB13a
+        return word_ahletter | word_bit(wb::single_quote) | word_bit(wb::numeric) |
+               word_bit(wb::extendnumlet);
+    case wb::numeric: // WB8, WB10, WB13a
+        return word_ahletter | word_bit(wb::numeric) | word_bit(wb::extendnumlet);
+    case wb::katakana: // WB13, WB13a
+        return word_bit(wb::katakana) | word_bit(wb::extendnumlet);
+    case wb::extendnumlet: // WB13a, WB13b
+        return word_ahletter | word_bit(wb::numeric) | word_bit(wb::katakana) |
+               word_bit(wb::extendnumlet);
+    default:
+        return 0;
+    }
+}
+
+template <typename = void>
+struct word_rules {
+    using wb = word_break;
+
+    static constexpr std::uint32_t joins[] = {
+        word_joins(wb::other), word_joins(wb::cr), word_joins(wb::lf),
+        word_joins(wb::newline), word_joins(wb::extend), word_joins(wb::zwj),
+        word_joins(wb::regional_indicator), word_joins(wb::format),
+        word_joins(wb::katakana), word_joins(wb::hebrew_letter),
+        word_joins(wb::aletter), word_joins(wb::single_quote),
+        word_joins(wb::double_quote), word_joins(wb::midnumlet),
+        word_joins(wb::midletter), word_joins(wb::midnum),
+        word_joins(wb::numeric), word_joins(wb::extendnumlet),
+        word_joins(wb::wsegspace),
+    };
+};
+
+template <typename T>
+constexpr std::uint32_t word_rules<T>::joins[];
+
+constexpr word_break classify_ascii_word_break(code_point c)
+{
+    using wb = word_break;
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+        return wb::aletter;
+    if (c >= '0' && c <= '9')
+        return wb::numeric;
+    switch (c) {
+    case '_': return wb::extendnumlet;
+    case '\n': return wb::lf;
+    case '\v': case '\f': return wb::newline;
+    case '\r': return wb::cr;
+    case ' ': return wb::wsegspace;
+    case '"': return wb::double_quote;
+    case '\'': return wb::single_quote;
+    case ',': case ';': return wb::midnum;
+    case '.': return wb::midnumlet;
+    case ':': return wb::midletter;
+    default: return wb::other;
+    }
+}
+
+// The Word_Break property of ASCII, without the three-stage lookup
+struct ascii_word_breaks {
+    word_break values[0x80];
+
+    constexpr ascii_word_breaks() : values{}
+    {
+        for (code_point c = 0; c < 0x80; c++)
+            values[c] = classify_ascii_word_break(c);
+    }
+};
+
+template <typename = void>
+struct word_ascii_table {
+    static constexpr ascii_word_breaks table{};
+};
+
+template <typename T>
+constexpr ascii_word_breaks word_ascii_table<T>::table;
+
+// Letters, digits and underscores, which join each other
+constexpr std::uint32_t word_alnum = word_ahletter | word_bit(word_break::numeric) |
+                                     word_bit(word_break::extendnumlet);
+// Punctuation which may join letters or digits with WB6, WB7 or WB11
+constexpr std::uint32_t word_mid = word_midnumletq | word_bit(word_break::midletter) |
+                                   word_bit(word_break::midnum) |
+                                   word_bit(word_break::double_quote);
+
+inline word_break get_word_break(code_point c)
+{
+    return c < 0x80 ? word_ascii_table<>::table.values[c]
+                    : static_cast<word_break>(word_break_lookup(c));
+}
+
+// The Word_Break property of a code unit which is known to be ASCII
+template <typename CharT>
+inline word_break ascii_word_break(CharT c)
+{
+    return word_ascii_table<>::table.values[static_cast<unsigned char>(c)];
+}
+
+// Whether each byte is an ASCII letter, digit or underscore
+struct ascii_alnum_bytes {
+    bool values[0x100];
+
+    constexpr ascii_alnum_bytes() : values{}
+    {
+        for (code_point c = 0; c < 0x80; c++)
+            values[c] = is_word_break_in(classify_ascii_word_break(c), word_alnum);
+    }
+};
+
+template <typename = void>
+struct word_alnum_table {
+    static constexpr ascii_alnum_bytes table{};
+};
+
+template <typename T>
+constexpr ascii_alnum_bytes word_alnum_table<T>::table;
+
+// Tests a code unit with one table lookup, as the runs of letters and
+// digits which make up most ASCII text are scanned
+template <typename CharT>
+inline bool is_ascii_alnum_unit(CharT c)
+{
+    return is_ascii_unit(c) &&
+           word_alnum_table<>::table.values[static_cast<unsigned char>(c)];
+}
+
+inline bool is_ascii_alnum_unit(char c)
+{
+    return word_alnum_table<>::table.values[static_cast<unsigned char>(c)];
+}
+
+template <typename InEncoding>
+struct word_segmenter {
+    using encoding = InEncoding;
+    using wb = word_break;
+
+    template <typename Iter, typename Sentinel>
+    static Iter next(Iter first, Sentinel last)
+    {
+        code_point c;
+        wb raw;                     // the property before the boundary
+        wb before_prev = wb::other; // the property before prev, below
+
+        if (is_ascii_unit(*first)) {
+            // Most segments of ASCII text are a run of letters and digits or
+            // a single space or symbol, ended by an ASCII unit which cannot
+            // continue it. Those are found here without setting up the
+            // state for the general rules.
+            raw = ascii_word_break(*first);
+            Iter unit = first;
+            ++first;
+            if (is_word_break_in(raw, word_alnum)) {
+                while (first != last && is_ascii_alnum_unit(*first)) {
+                    unit = first;
+                    ++first;
+                }
+                if (first == last)
+                    return first;
+                if (is_ascii_unit(*first) &&
+                    !is_word_break_in(ascii_word_break(*first), word_mid))
+                    return first;
+                raw = before_prev = ascii_word_break(*unit);
+            }
+            else if (first == last) {
+                return first;
+            }
+            else if (is_ascii_unit(*first) && raw != wb::cr &&
+                     !is_word_break_in(raw, word_mid) &&
+                     !(raw == wb::wsegspace && ascii_word_break(*first) == wb::wsegspace)) {
+                return first;
+            }
+            c = static_cast<code_point>(*unit);
+        }
+        else {
+            c = decode(first, last);
+            raw = get_word_break(c);
+        }
+        wb prev = raw; // raw, skipping those ignored by WB4
+        bool odd_ri = raw == wb::regional_indicator;
+
+        while (first != last) {
+            // Pairs of ASCII code points are decided here unless they might
+            // be part of a longer rule (CR LF, or punctuation in a word)
+            if (c < 0x80 && is_ascii_unit(*first)) {
+                const wb next = ascii_word_break(*first);
+                if (is_word_break_in(raw, word_alnum) && is_word_break_in(next, word_alnum)) {
+                    // Runs of letters and digits. The property before last
+                    // only matters after punctuation, so it is not tracked
+                    // through the run.
+                    Iter unit;
+                    do {
+                        unit = first;
+                        ++first;
+                    } while (first != last && is_ascii_alnum_unit(*first));
+                    raw = ascii_word_break(*unit);
+                    before_prev = prev = raw;
+                    continue;
+                }
+                if (raw == wb::wsegspace && next == wb::wsegspace) {
+                    // WB3d
+                    ++first;
+                    before_prev = prev;
+                    continue;
+                }
+                if (is_word_break_in(raw, word_alnum)
+                        ? !is_word_break_in(next, word_mid)
+                        : raw != wb::cr && !(is_word_break_in(raw, word_mid) &&
+                                             is_word_break_in(next, word_alnum))) {
+                    return first;
+                }
+            }
+
+            Iter after = first;
+            const code_point next_c = decode(after, last);
+            const wb next = get_word_break(next_c);
+
+            if (raw == wb::cr && next == wb::lf) {
+                // WB3
+            }
+            else if (raw == wb::cr || raw == wb::lf || raw == wb::newline ||
+                     next == wb::cr || next == wb::lf || next == wb::newline) {
+                // WB3a, WB3b
+                return first;
+            }
+            else if (raw == wb::zwj && is_extended_pictographic(next_c)) {
+                // WB3c
+            }
+            else if (raw == wb::wsegspace && next == wb::wsegspace) {
+                // WB3d
+            }
+            else if (is_word_break_in(next, word_ignored)) {
+                // WB4
+                raw = next;
+                c = next_c;
+                first = after;
+                continue;
+            }
+            else if (!joins(before_prev, prev, next, after, last, odd_ri)) {
+                return first;
+            }
+
+            odd_ri = next == wb::regional_indicator && !(prev == next && odd_ri);
+            before_prev = prev;
+            raw = prev = next;
+            c = next_c;
+            first = after;
+        }
+        return first;
+    }
+
+private:
+    /// Applies rules WB5 to WB16 to a pair of non-ignored code points
+    template <typename Iter, typename Sentinel>
+    static bool joins(wb before_prev, wb prev, wb next, Iter after, Sentinel last, bool odd_ri)
+    {
+        if (is_word_break_in(next, word_rules<>::joins[static_cast<int>(prev)]))
+            return true;
+
+        switch (next) {
+        case wb::midletter:
+        case wb::midnumlet:
+        case wb::single_quote:
+        case wb::midnum:
+        case wb::double_quote:
+            break;
+        case wb::aletter:
+        case wb::hebrew_letter:
+            // WB7, WB7c
+            return (is_word_break_in(before_prev, word_ahletter) &&
+                    (prev == wb::midletter || is_word_break_in(prev, word_midnumletq))) ||
+                   (before_prev == wb::hebrew_letter && prev == wb::double_quote &&
+                    next == wb::hebrew_letter);
+        case wb::numeric:
+            // WB11
+            return before_prev == wb::numeric &&
+                   (prev == wb::midnum || is_word_break_in(prev, word_midnumletq));
+        case wb::regional_indicator:
+            // WB15, WB16
+            return prev == wb::regional_indicator && odd_ri;
+        default:
+            return false;
+        }
+
+        // WB6, WB7b and WB12 look past the punctuation
+        const bool letter_mid = next == wb::midletter || is_word_break_in(next, word_midnumletq);
+        const bool number_mid = next == wb::midnum || is_word_break_in(next, word_midnumletq);
+        if (is_word_break_in(prev, word_ahletter) && letter_mid) {
+            return is_word_break_in(lookahead(after, last), word_ahletter);
+        }
+        if (prev == wb::hebrew_letter && next == wb::double_quote) {
+            return lookahead(after, last) == wb::hebrew_letter;
+        }
+        if (prev == wb::numeric && number_mid) {
+            return lookahead(after, last) == wb::numeric;
+        }
+        return false;
+    }
+
+    /// Returns the property of the next code point not ignored by WB4
+    template <typename Iter, typename Sentinel>
+    static wb lookahead(Iter first, Sentinel last)
+    {
+        while (first != last) {
+            const wb next = get_word_break(decode(first, last));
+            if (!is_word_break_in(next, word_ignored))
+                return next;
+        }
+        return wb::other;
+    }
+
+    template <typename Iter, typename Sentinel>
+    static code_point decode(Iter& first, Sentinel last)
+    {
+        if (is_ascii_unit(*first))
+            return static_cast<code_point>(*first++);
+        return replace_invalid<InEncoding, InEncoding>(utf_traits<InEncoding>::decode(first, last));
+    }
+};
+
+} // end namespace detail
+
+///
+/// A view of the word boundary segments of a sequence of code units, as
+/// text_segments of the underlying iterators
+///
+template <typename Iter, typename Sentinel,
+          typename InEncoding = detail::iter_value_t<Iter>>
+using word_view = detail::segment_view<Iter, Sentinel, detail::word_segmenter<InEncoding>>;
+
+///
+/// Returns the next word boundary after `first`, which must be a boundary
+///
+template <typename Iter, typename Sentinel>
+Iter next_word_boundary(Iter first, Sentinel last)
+{
+    return first == last ? first
+        : detail::word_segmenter<detail::iter_value_t<Iter>>::next(first, last);
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+Iter next_word_boundary(Iter first, Sentinel last)
+{
+    return first == last ? first : detail::word_segmenter<InEncoding>::next(first, last);
+}
+
+template <typename Iter, typename Sentinel>
+word_view<Iter, Sentinel> words(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename String>
+auto words(const String& str)
+{
+    return words(std::cbegin(str), std::cend(str));
+}
+
+template <typename InEncoding, typename Iter, typename Sentinel,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+word_view<Iter, Sentinel, InEncoding> words(Iter first, Sentinel last)
+{
+    return {first, last};
+}
+
+template <typename InEncoding, typename String,
+          typename = std::enable_if_t<detail::is_encoding_tag<InEncoding>::value>>
+auto words(const String& str)
+{
+    return words<InEncoding>(std::cbegin(str), std::cend(str));
+}
+
+///
+/// Returns whether a segment from words() is a word, that is whether it
+/// contains a letter, number, ideograph or kana, rather than only spaces,
+/// punctuation and symbols. The segment is decoded in the encoding of the
+/// view it came from.
+///
+template <typename Iter, typename InEncoding>
+bool is_word_segment(const text_segment<Iter, InEncoding>& segment)
+{
+    for (Iter it = segment.begin(); it != segment.end(); ) {
+        const char32_t c = detail::replace_invalid<InEncoding, InEncoding>(
+            detail::utf_traits<InEncoding>::decode(it, segment.end()));
+        if (is_letter(c) || is_number(c))
+            return true;
+    }
+    return false;
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,454 @@
+
+#ifndef TCB_UNICODE_WTF8_HPP_INCLUDED
+#define TCB_UNICODE_WTF8_HPP_INCLUDED
+
+#include <tcb/unicode.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace tcb {
+namespace unicode {
+
+///
+/// Encoding tags for the UTF-8 and UTF-16 variants which can carry lone
+/// surrogates, and so round-trip Windows file names and Java strings. Like
+/// `latin1`, they may be used wherever a code unit type is accepted, for
+/// example `to_utf_string<wtf8, char16_t, wtf16>(...)` or
+/// `to_u16string<mutf8>(str)`.
+///
+/// Lone surrogates pass between wtf8, wtf16 and mutf8 unchanged. Converting
+/// them to UTF-8, UTF-16, UTF-32 or CESU-8 replaces them with U+FFFD.
+///
+
+/// WTF-8: UTF-8, extended to encode lone surrogates as three bytes
+struct wtf8 {};
+
+/// WTF-16: UTF-16 which may contain unpaired surrogates (as produced by
+/// Windows file system APIs and JavaScript strings)
+struct wtf16 {};
+
+/// CESU-8: supplementary code points are encoded as a surrogate pair of
+/// three-byte sequences rather than as four bytes
+struct cesu8 {};
+
+/// Modified UTF-8, as used by Java serialisation and JNI: CESU-8 which
+/// encodes NUL as C0 80 and may contain lone surrogates
+struct mutf8 {};
+
+namespace detail {
+
+template <>
+struct is_encoding_tag<wtf8> : std::true_type {};
+
+template <>
+struct is_encoding_tag<wtf16> : std::true_type {};
+
+template <>
+struct is_encoding_tag<cesu8> : std::true_type {};
+
+template <>
+struct is_encoding_tag<mutf8> : std::true_type {};
+
+template <>
+struct allows_surrogates<wtf8> : std::true_type {};
+
+template <>
+struct allows_surrogates<wtf16> : std::true_type {};
+
+template <>
+struct allows_surrogates<mutf8> : std::true_type {};
+
+template <>
+struct encodes_ascii_directly<mutf8> : std::false_type {};
+
+constexpr bool is_lead_surrogate(code_point c)
+{
+    return c >= 0xD800 && c <= 0xDBFF;
+}
+
+constexpr bool is_trail_surrogate(code_point c)
+{
+    return c >= 0xDC00 && c <= 0xDFFF;
+}
+
+constexpr code_point combine_surrogates(code_point lead, code_point trail)
+{
+    return 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00);
+}
+
+// A sentinel for input which is known to be valid, so that decoding
+// never needs to check for the end
+struct unbounded_sentinel {};
+
+template <typename It>
+constexpr bool operator==(const It&, unbounded_sentinel) { return false; }
+
+template <typename It>
+constexpr bool operator!=(const It&, unbounded_sentinel) { return true; }
+
+///
+/// Decodes one sequence of "generalised UTF-8", which is UTF-8 but with
+/// surrogate code points permitted
+///
+template <typename It, typename S>
+code_point decode_generalized_utf8(It& p, S e)
+{
+    if (p == e)
+        return incomplete;
+
+    const unsigned char lead = static_cast<unsigned char>(*p++);
+    const int trail_size = utf_traits<char>::trail_length(static_cast<char>(lead));
+
+    if (trail_size < 0)
+        return illegal;
+    if (trail_size == 0)
+        return lead;
+
+    code_point c = lead & ((1 << (6 - trail_size)) - 1);
+    for (int i = 0; i < trail_size; i++) {
+        if (p == e)
+            return incomplete;
+        const unsigned char tmp = static_cast<unsigned char>(*p);
+        if ((tmp & 0xC0) != 0x80)
+            return illegal;
+        ++p;
+        c = (c << 6) | (tmp & 0x3F);
+    }
+
+    if (c > 0x10FFFF || utf_traits<char>::width(c) != trail_size + 1)
+        return illegal;
+
+    return c;
+}
+
+template <typename It>
+It encode_generalized_utf8(code_point u, It out)
+{
+    if (u < 0x80) {
+        *out++ = static_cast<char>(u);
+    }
+    else if (u < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (u >> 6));
+        *out++ = static_cast<char>(0x80 | (u & 0x3F));
+    }
+    else if (u < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (u >> 12));
+        *out++ = static_cast<char>(0x80 | ((u >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (u & 0x3F));
+    }
+    else {
+        *out++ = static_cast<char>(0xF0 | (u >> 18));
+        *out++ = static_cast<char>(0x80 | ((u >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((u >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (u & 0x3F));
+    }
+    return out;
+}
+
+///
+/// Decodes CESU-8, joining a surrogate pair of three-byte sequences into a
+/// single code point. Lone surrogates are returned as they are if
+/// `AllowSurrogates`, and are otherwise illegal.
+///
+template <bool AllowSurrogates, typename It, typename S>
+code_point decode_cesu8(It& p, S e)
+{
+    It start = p;
+    const code_point c = decode_generalized_utf8(p, e);
+
+    // Four-byte sequences are not used
+    if (c >= 0x10000 && c <= 0x10FFFF) {
+        p = start;
+        ++p;
+        return illegal;
+    }
+
+    if (is_lead_surrogate(c)) {
+        // A lead surrogate at the very end is returned alone (or is
+        // incomplete, for CESU-8), but a truncated trail is incomplete
+        It q = p;
+        if (q == e)
+            return AllowSurrogates ? c : incomplete;
+        const code_point c2 = decode_generalized_utf8(q, e);
+        if (is_trail_surrogate(c2)) {
+            p = q;
+            return combine_surrogates(c, c2);
+        }
+        if (c2 == incomplete) {
+            p = q;
+            return incomplete;
+        }
+    }
+
+    if (!AllowSurrogates && c >= 0xD800 && c <= 0xDFFF)
+        return illegal;
+
+    return c;
+}
+
+template <typename It>
+It encode_cesu8(code_point u, It out)
+{
+    if (u >= 0x10000) {
+        out = encode_generalized_utf8(0xD800 + ((u - 0x10000) >> 10), out);
+        return encode_generalized_utf8(0xDC00 + ((u - 0x10000) & 0x3FF), out);
+    }
+    return encode_generalized_utf8(u, out);
+}
+
+///
+/// Traits shared by the UTF-8 variants, which differ in how they decode and
+/// encode a single code point
+///
+template <typename Derived, int MaxWidth>
+struct utf8_variant_traits {
+    typedef char char_type;
+
+    static int trail_length(char_type c)
+    {
+        return utf_traits<char>::trail_length(c);
+    }
+
+    static constexpr bool is_trail(char_type c)
+    {
+        return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+    }
+
+    static constexpr bool is_lead(char_type c)
+    {
+        return !is_trail(c);
+    }
+
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        return Derived::decode(current, unbounded_sentinel{});
+    }
+
+    static constexpr int max_width = MaxWidth;
+
+    static encoded_chars<char_type, MaxWidth> encode(code_point u)
+    {
+        char buf[MaxWidth] = {};
+        const int n = static_cast<int>(Derived::encode(u, buf) - buf);
+        encoded_chars<char_type, MaxWidth> chars;
+        for (int i = 0; i < n; i++) {
+            chars.push_back(buf[i]);
+        }
+        return chars;
+    }
+};
+
+///
+/// Returns whether the generalised UTF-8 sequence at `p` is, or may be once
+/// it is complete, that of a trail surrogate
+///
+template <typename It, typename S>
+bool is_trail_surrogate_sequence(It p, S e)
+{
+    if (p == e || static_cast<unsigned char>(*p) != 0xED)
+        return false;
+    ++p;
+    if (p == e)
+        return true;
+    if ((static_cast<unsigned char>(*p) & 0xF0) != 0xB0)
+        return false;
+    ++p;
+    return p == e || (static_cast<unsigned char>(*p) & 0xC0) == 0x80;
+}
+
+template <>
+struct utf_traits<wtf8, 1> : utf8_variant_traits<utf_traits<wtf8, 1>, 4> {
+    using utf8_variant_traits::encode;
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        const code_point c = decode_generalized_utf8(current, last);
+
+        // A surrogate pair must be written as a single four-byte sequence:
+        // a lead surrogate followed by a trail surrogate is ill-formed
+        if (is_lead_surrogate(c) && is_trail_surrogate_sequence(current, last)) {
+            const code_point c2 = decode_generalized_utf8(current, last);
+            return c2 == incomplete ? incomplete : illegal;
+        }
+        return c;
+    }
+
+    // Valid input has no surrogate pairs, and a lone lead surrogate may
+    // come last, so must not be looked past
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        return decode_generalized_utf8(current, unbounded_sentinel{});
+    }
+
+    static int width(code_point u)
+    {
+        return utf_traits<char>::width(u);
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        return encode_generalized_utf8(u, out);
+    }
+};
+
+template <>
+struct utf_traits<cesu8, 1> : utf8_variant_traits<utf_traits<cesu8, 1>, 6> {
+    using utf8_variant_traits::encode;
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        return decode_cesu8<false>(current, last);
+    }
+
+    static int width(code_point u)
+    {
+        return u >= 0x10000 ? 6 : utf_traits<char>::width(u);
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        return encode_cesu8(u, out);
+    }
+};
+
+template <>
+struct utf_traits<mutf8, 1> : utf8_variant_traits<utf_traits<mutf8, 1>, 6> {
+    using utf8_variant_traits::encode;
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        // NUL is written as the overlong sequence C0 80
+        if (current != last && static_cast<unsigned char>(*current) == 0xC0) {
+            It p = current;
+            ++p;
+            if (p == last) {
+                current = p;
+                return incomplete;
+            }
+            if (static_cast<unsigned char>(*p) == 0x80) {
+                current = ++p;
+                return 0;
+            }
+        }
+        return decode_cesu8<true>(current, last);
+    }
+
+    static int width(code_point u)
+    {
+        return u == 0 ? 2 : u >= 0x10000 ? 6 : utf_traits<char>::width(u);
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        if (u == 0) {
+            *out++ = static_cast<char>(0xC0);
+            *out++ = static_cast<char>(0x80);
+            return out;
+        }
+        return encode_cesu8(u, out);
+    }
+};
+
+template <>
+struct utf_traits<wtf16, 1> {
+    typedef char16_t char_type;
+
+    static constexpr int trail_length(char_type c)
+    {
+        return is_lead_surrogate(c) ? 1 : 0;
+    }
+
+    // Trail surrogates may stand alone, so every unit may begin a code point
+    static constexpr bool is_trail(char_type /*c*/)
+    {
+        return false;
+    }
+
+    static constexpr bool is_lead(char_type /*c*/)
+    {
+        return true;
+    }
+
+    template <typename It, typename S>
+    static code_point decode(It& current, S last)
+    {
+        if (current == last)
+            return incomplete;
+
+        const code_point w1 = static_cast<char16_t>(*current++);
+        if (!is_lead_surrogate(w1) || current == last)
+            return w1;
+
+        const code_point w2 = static_cast<char16_t>(*current);
+        if (!is_trail_surrogate(w2))
+            return w1;
+        ++current;
+        return combine_surrogates(w1, w2);
+    }
+
+    template <typename It>
+    static code_point decode_valid(It& current)
+    {
+        const code_point w1 = static_cast<char16_t>(*current++);
+        if (!is_lead_surrogate(w1))
+            return w1;
+        return combine_surrogates(w1, static_cast<char16_t>(*current++));
+    }
+
+    static constexpr int max_width = 2;
+
+    static constexpr int width(code_point u)
+    {
+        return u >= 0x10000 ? 2 : 1;
+    }
+
+    template <typename It>
+    static It encode(code_point u, It out)
+    {
+        if (u >= 0x10000) {
+            *out++ = static_cast<char16_t>(0xD800 + ((u - 0x10000) >> 10));
+            *out++ = static_cast<char16_t>(0xDC00 + ((u - 0x10000) & 0x3FF));
+        }
+        else {
+            *out++ = static_cast<char16_t>(u);
+        }
+        return out;
+    }
+
+    static encoded_chars<char_type> encode(code_point u)
+    {
+        if (u >= 0x10000)
+            return {static_cast<char16_t>(0xD800 + ((u - 0x10000) >> 10)),
+                    static_cast<char16_t>(0xDC00 + ((u - 0x10000) & 0x3FF))};
+        return {static_cast<char16_t>(u)};
+    }
+
+}; // wtf16
+
+} // end namespace detail
+
+///
+/// Converts text between any of the encodings accepted by to_utf_string(),
+/// including the tags above, with both encodings given explicitly
+///
+template <typename OutEncoding, typename InEncoding, typename String,
+          typename = std::enable_if_t<!detail::is_istream<String>::value>>
+std::basic_string<detail::char_type_t<OutEncoding>> transcode(const String& str)
+{
+    return detail::to_utf_string_range<OutEncoding, InEncoding>(
+        str, detail::has_contiguous_data<String>{});
+}
+
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
@@ -0,0 +1,210 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/case.hpp>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace tcb::unicode;
+
+namespace {
+
+std::size_t allocations = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+    template <typename U>
+    struct rebind { using other = counting_allocator<U>; };
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+using counted_string = std::basic_string<char, std::char_traits<char>, counting_allocator<char>>;
+
+}
+
+TEST_CASE("Simple case mappings of code points")
+{
+    static_assert(simple_lowercase(U'A') == U'a', "");
+    REQUIRE(simple_lowercase(U'\u0130') == U'i');
+    REQUIRE(simple_uppercase(U'é') == U'É');
+    REQUIRE(simple_uppercase(U'ß') == U'ß');
+    REQUIRE(simple_uppercase(U'\U00010428') == U'\U00010400');
+    REQUIRE(simple_case_fold(U'ẞ') == U'ß');
+    REQUIRE(simple_case_fold(U'ς') == U'σ');
+    REQUIRE(simple_case_fold(U'1') == U'1');
+    REQUIRE(simple_case_fold(0x110000) == 0x110000);
+}
+
+TEST_CASE("ASCII case mapping")
+{
+    const std::string str = "The Quick Brown Fox Jumps Over The Lazy Dog @[`{ 0123456789";
+    REQUIRE(to_lower(str) == "the quick brown fox jumps over the lazy dog @[`{ 0123456789");
+    REQUIRE(to_upper(str) == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG @[`{ 0123456789");
+    REQUIRE(case_fold(str) == to_lower(str));
+    REQUIRE(to_upper(std::u16string{u"Mixed Case Text in UTF-16"}) == u"MIXED CASE TEXT IN UTF-16");
+    REQUIRE(to_lower(std::u32string{U"Mixed Case Text in UTF-32"}) == U"mixed case text in utf-32");
+    REQUIRE(to_lower(std::string{}).empty());
+}
+
+TEST_CASE("Case mapping of text which is not ASCII")
+{
+    REQUIRE(to_upper(std::string{u8"Straße café σοφία"}) ==
+            u8"STRASSE CAFÉ ΣΟΦ\u038AΑ");
+    REQUIRE(to_lower(std::string{u8"ПРИВЕТ, World"}) ==
+            u8"привет, world");
+    REQUIRE(to_lower(std::u16string{u"\U00010400\U00010401 Deseret"}) ==
+            u"\U00010428\U00010429 deseret");
+    REQUIRE(to_upper(std::u32string{U"ﬃ \u0149 \u0390"}) ==
+            U"FFI \u02BCN Ι\u0308\u0301");
+    // Unconditional mappings only
+    REQUIRE(to_lower(std::string{u8"\u0130STANBUL ΟΣ"}) ==
+            u8"i\u0307stanbul οσ");
+}
+
+TEST_CASE("Full and simple case folding")
+{
+    const std::u32string str = U"Maße ẞ Σσς \u0130";
+    REQUIRE(case_fold(str) == U"masse ss σσσ i\u0307");
+    REQUIRE(case_fold(str, case_mapping::simple) == U"maße ß σσσ \u0130");
+    REQUIRE(to_upper(str, case_mapping::simple) == U"MAßE ẞ ΣΣΣ \u0130");
+    REQUIRE(to_lower(std::string{u8"\u0130"}, case_mapping::simple) == "i");
+}
+
+TEST_CASE("Case mapping grows the result when it must")
+{
+    std::string str;
+    for (int i = 0; i < 100; i++)
+        str += u8"ß\u0390";
+    std::string expected;
+    for (int i = 0; i < 100; i++)
+        expected += u8"SSΙ\u0308\u0301";
+    REQUIRE(to_upper(str) == expected);
+
+    // Lowercase U+023A is one byte longer in UTF-8
+    REQUIRE(to_lower(std::string(50, 'A') + u8"ȺȺ") ==
+            std::string(50, 'a') + u8"ⱥⱥ");
+}
+
+TEST_CASE("Case mapping allocates once unless a mapping grows the text")
+{
+    counted_string str;
+    for (int i = 0; i < 10000; i++)
+        str += u8"ПРИВЕТ, World! ";
+    const counted_string expected = [] {
+        counted_string s;
+        for (int i = 0; i < 10000; i++)
+            s += u8"привет, world! ";
+        return s;
+    }();
+
+    allocations = 0;
+    const counted_string lower = to_lower(str);
+    REQUIRE(allocations == 1);
+    REQUIRE(lower == expected);
+    REQUIRE(lower.capacity() < str.size() + 64);
+
+    // Uppercase U+0390 is three code points, and four bytes longer, so
+    // the result must grow once
+    const counted_string longer = str + u8"\u0390";
+    allocations = 0;
+    const counted_string upper = to_upper(longer);
+    REQUIRE(allocations == 2);
+    REQUIRE(upper.size() == longer.size() + 4);
+}
+
+TEST_CASE("Case mapping of other containers")
+{
+    const std::list<char> list = {'A', '\xC3', '\x9F'};
+    REQUIRE((to_upper(list) == std::list<char>{'A', 'S', 'S'}));
+    const std::vector<char16_t> vec = {u'É', u'T', u'É'};
+    REQUIRE((to_lower(vec) == std::vector<char16_t>{u'é', u't', u'é'}));
+}
+
+TEST_CASE("Ill-formed sequences are replaced when mapping case")
+{
+    REQUIRE(to_upper(std::string{"a\xFF" "b"}) == u8"A\uFFFDB");
+    REQUIRE(case_fold(std::u16string{u'X', char16_t(0xD800)}) == u"x\uFFFD");
+    REQUIRE((to_lower(std::list<char>{'\xC3'}) == std::list<char>{'\xEF', '\xBF', '\xBD'}));
+}
+
+TEST_CASE("Comparison ignoring case")
+{
+    REQUIRE(equal_ignore_case(std::string{"Hello, World"}, "hELLO, wORLD"));
+    REQUIRE_FALSE(equal_ignore_case(std::string{"Hello"}, "Hello!"));
+    REQUIRE(equal_ignore_case(std::string{u8"Straße"}, u8"STRASSE"));
+    REQUIRE(equal_ignore_case(std::u32string{U"ΣΊΣΥΦΟΣ"}, U"σίσυφος"));
+    REQUIRE(equal_ignore_case(std::string{}, ""));
+
+    REQUIRE(compare_ignore_case(std::string{"apple"}, "BANANA") < 0);
+    REQUIRE(compare_ignore_case(std::string{"Banana"}, "apple") > 0);
+    REQUIRE(compare_ignore_case(std::string{"abc"}, "ABCD") < 0);
+    REQUIRE(compare_ignore_case(std::string{u8"maße"}, u8"MASSE") == 0);
+    REQUIRE(compare_ignore_case(std::string{u8"maßf"}, u8"MASSE") > 0);
+
+    // Long runs of ASCII, with differences before and after the last word
+    const std::string upper = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG";
+    std::string lower = "the quick brown fox jumps over the lazy dog";
+    REQUIRE(equal_ignore_case(upper, lower));
+    lower[40] = 'x';
+    REQUIRE(compare_ignore_case(upper, lower) < 0);
+    lower[40] = 'd';
+    lower[3] = '_';
+    REQUIRE(compare_ignore_case(upper, lower) < 0);
+    lower[3] = ' ';
+    REQUIRE(equal_ignore_case(upper + u8"ÉTÉ" + upper, lower + u8"été" + lower));
+}
+
+TEST_CASE("Comparison ignoring case of text in different encodings")
+{
+    const std::string utf8 = u8"Ελληνικά and English";
+    const std::u16string utf16 = u"ΕΛΛΗΝΙΚΆ AND ENGLISH";
+    REQUIRE(equal_ignore_case(utf8.begin(), utf8.end(), utf16.begin(), utf16.end()));
+    REQUIRE(compare_ignore_case(utf16.begin(), utf16.end() - 1, utf8.begin(), utf8.end()) < 0);
+    const std::list<char> list(utf8.begin(), utf8.end());
+    REQUIRE(equal_ignore_case(list.begin(), list.end(), utf16.begin(), utf16.end()));
+}
+
+TEST_CASE("Hashing ignoring case")
+{
+    const std::string str = u8"The Straße to ΣΊΣΥΦΟΣ's house";
+    const std::string folded = u8"the strasse to σίσυφοσ's house";
+    REQUIRE(hash_ignore_case(str) == hash_ignore_case(folded));
+    REQUIRE(hash_ignore_case(to_u16string(str)) == hash_ignore_case(folded));
+    REQUIRE(hash_ignore_case(to_u32string(str)) == hash_ignore_case(folded));
+    const std::list<char> list(str.begin(), str.end());
+    REQUIRE(hash_ignore_case(list) == hash_ignore_case(folded));
+
+    REQUIRE(hash_ignore_case(std::string{"a"}) != hash_ignore_case(std::string{"b"}));
+    REQUIRE(hash_ignore_case(std::string{"a"}) != hash_ignore_case(std::string(1, '\0') + "a"));
+    REQUIRE(hash_ignore_case(std::string{}) != hash_ignore_case(std::string(1, '\0')));
+}
+
+TEST_CASE("Function objects for containers with case-insensitive keys")
+{
+    std::unordered_map<std::string, int, ignore_case_hash, ignore_case_equal_to> map;
+    map["Content-Type"] = 1;
+    map["content-length"] = 2;
+    map["CONTENT-TYPE"] = 3;
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.at("content-type") == 3);
+    REQUIRE(map.count(u8"Content-Length") == 1);
+
+    std::map<std::string, int, ignore_case_less> ordered = {{"b", 1}, {"A", 2}, {"C", 3}, {"a", 4}};
+    REQUIRE(ordered.size() == 3);
+    REQUIRE(ordered.begin()->first == "A");
+}
@@ -0,0 +1,67 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/cjk.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("Shift_JIS can be decoded and encoded")
+{
+    const std::string sjis = "\x93\xfa\x96{\x8c\xea\x83" "e\x83L\x83X\x83g \xb6\xc0\xb6\xc5 abc";
+    const std::string utf8 = u8"日本語テキスト ｶﾀｶﾅ abc";
+
+    REQUIRE(to_u8string<shift_jis>(sjis) == utf8);
+    REQUIRE(to_u16string<shift_jis>(sjis) == to_u16string(utf8));
+    REQUIRE(to_u8string(as_utf8<shift_jis>(sjis)) == utf8);
+    REQUIRE(to_multibyte<shift_jis>(utf8) == sjis);
+    REQUIRE(to_multibyte<shift_jis>(to_u32string(utf8)) == sjis);
+
+    // Unmappable code points
+    REQUIRE(to_multibyte<shift_jis>(std::string(u8"a한😎")) == "a??");
+
+    // A lone lead byte, and an unmapped pair followed by ASCII
+    REQUIRE(to_u8string<shift_jis>(std::string("a\x93")) == u8"a�");
+    REQUIRE(to_u8string<shift_jis>(std::string("\x85" "ab")) == u8"�ab");
+    REQUIRE(to_u8string<shift_jis>(std::string("\x80xy")) == u8"�xy");
+}
+
+TEST_CASE("GB18030 can be decoded and encoded")
+{
+    const std::string gb = "\xd6\xd0\xce\xc4\xce\xc4\xb1\xbe \xa2\xe3 \x94\x39\xfe\x30 \xa8\xa6";
+    const std::string utf8 = u8"中文文本 € 😎 é";
+
+    REQUIRE(to_u8string<gb18030>(gb) == utf8);
+    REQUIRE(to_u32string<gb18030>(gb) == to_u32string(utf8));
+    REQUIRE(to_multibyte<gb18030>(utf8) == gb);
+    REQUIRE(to_multibyte<gb18030>(to_u16string(utf8)) == gb);
+
+    // Four-byte codes in the BMP
+    REQUIRE(to_u32string<gb18030>(std::string("\x81\x30\x81\x30")) == U"\u0080");
+    REQUIRE(to_u32string<gb18030>(std::string("\x84\x31\xa4\x39")) == U"￿");
+    REQUIRE(to_multibyte<gb18030>(std::u32string(U"\u0080￿")) == "\x81\x30\x81\x30\x84\x31\xa4\x39");
+
+    // Every code point round trips
+    std::u32string all;
+    for (char32_t c = 0; c < 0x110000; c += (c < 0x10000 ? 1 : 97)) {
+        if (c < 0xD800 || c > 0xDFFF) {
+            all += c;
+        }
+    }
+    REQUIRE(to_u32string<gb18030>(to_multibyte<gb18030>(all)) == all);
+
+    // Truncated four-byte code: only the lead byte is consumed
+    REQUIRE(to_u8string<gb18030>(std::string("\x81\x30" "a")) == u8"�0a");
+    REQUIRE(to_u8string<gb18030>(std::string("\x81\x30\x81")) == u8"�");
+}
+
+TEST_CASE("EUC-KR can be decoded and encoded")
+{
+    const std::string euc = "\xc7\xd1\xb1\xb9\xbe\xee \xc5\xd8\xbd\xba\xc6\xae";
+    const std::string utf8 = u8"한국어 텍스트";
+
+    REQUIRE(to_u8string<euc_kr>(euc) == utf8);
+    REQUIRE(to_u16string(as_utf16<euc_kr>(euc)) == to_u16string(utf8));
+    REQUIRE(to_multibyte<euc_kr>(utf8) == euc);
+    REQUIRE(to_multibyte<euc_kr>(std::string(u8"日本語テキスト")).size() == 14);
+    REQUIRE(to_u8string<euc_kr>(std::string("\xc7")) == u8"�");
+}
@@ -0,0 +1,51 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/codepages.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("Single-byte code pages can be decoded")
+{
+    REQUIRE(to_u8string<windows1252>(std::string("\x80 caf\xE9")) == u8"€ café");
+    REQUIRE(to_u16string<windows1251>(std::string("\xCF\xF0\xE8\xE2\xE5\xF2")) == u"Привет");
+    REQUIRE(to_u32string<koi8_r>(std::string("\xF0\xD2\xC9\xD7\xC5\xD4")) == U"Привет");
+    REQUIRE(to_u8string<iso8859_2>(std::string("Za\xBF\xF3\xB3\xE6")) == u8"Zażółć");
+    REQUIRE(to_u8string<iso8859_15>(std::string("\xA4")) == u8"€");
+
+    // Undefined bytes become U+FFFD
+    REQUIRE(to_u8string<windows1252>(std::string("a\x81z")) == u8"a�z");
+    REQUIRE(to_u16string<windows1252>(std::string("a\x81z")) == u"a�z");
+
+    // Views decode a code point at a time
+    const std::string koi8 = "\xF0\xD2\xC9\xD7\xC5\xD4";
+    REQUIRE(to_u8string(as_utf8<koi8_r>(koi8)) == u8"Привет");
+    REQUIRE(to_u16string(as_utf16<koi8_r>(koi8.begin(), koi8.end())) == u"Привет");
+}
+
+TEST_CASE("Single-byte code pages can be encoded")
+{
+    REQUIRE(to_codepage<windows1252>(std::string(u8"€ café")) == "\x80 caf\xE9");
+    REQUIRE(to_codepage<windows1251>(std::u16string(u"Привет")) == "\xCF\xF0\xE8\xE2\xE5\xF2");
+    REQUIRE(to_codepage<koi8_r>(std::u32string(U"Привет")) == "\xF0\xD2\xC9\xD7\xC5\xD4");
+
+    // Code points the code page can't represent become '?'
+    REQUIRE(to_codepage<windows1252>(std::string(u8"aЖ😎b")) == "a??b");
+
+    // Between code pages, via Latin-1
+    REQUIRE(to_latin1(to_u8string<windows1252>(std::string("caf\xE9"))) == "caf\xE9");
+    REQUIRE(to_u8string<latin1>(to_codepage<iso8859_15>(std::string(u8"café"))) == u8"café");
+}
+
+TEST_CASE("Code page tables round trip")
+{
+    std::string all;
+    for (int i = 0; i < 256; i++) {
+        if (i != 0x81 && i != 0x8D && i != 0x8F && i != 0x90 && i != 0x9D) {
+            all += static_cast<char>(i);
+        }
+    }
+    REQUIRE(to_codepage<windows1252>(to_u8string<windows1252>(all)) == all);
+    REQUIRE(to_codepage<windows1252>(to_u16string<windows1252>(all)) == all);
+    REQUIRE(to_codepage<windows1252>(to_u32string<windows1252>(all)) == all);
+}
@@ -0,0 +1,74 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/compact_string.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("compact_string stores text in the narrowest width")
+{
+    const compact_string ascii{std::string("hello")};
+    REQUIRE(ascii.width() == 1);
+    REQUIRE(ascii.size() == 5);
+    REQUIRE(ascii[1] == U'e');
+
+    const compact_string latin{std::string(u8"café")};
+    REQUIRE(latin.width() == 1);
+    REQUIRE(latin.size() == 4);
+    REQUIRE(latin[3] == U'é');
+
+    const compact_string bmp{std::u16string(u"a€你")};
+    REQUIRE(bmp.width() == 2);
+    REQUIRE(bmp.size() == 3);
+    REQUIRE(bmp[2] == U'你');
+
+    const compact_string astral{std::u32string(U"a😎b")};
+    REQUIRE(astral.width() == 4);
+    REQUIRE(astral.size() == 3);
+    REQUIRE(astral[1] == U'😎');
+
+    // UTF-16 with a surrogate pair needs four bytes
+    const compact_string pair{std::u16string(u"x😎")};
+    REQUIRE(pair.width() == 4);
+    REQUIRE(pair == compact_string(U"x😎"));
+
+    REQUIRE(compact_string().empty());
+    REQUIRE(compact_string("abc").size() == 3);
+    REQUIRE(compact_string(u"é") == compact_string(U"é"));
+    REQUIRE(compact_string(U"é").width() == 1);
+    REQUIRE(compact_string(std::string(u8"é")) != compact_string(std::string(u8"e")));
+}
+
+TEST_CASE("compact_string replaces ill-formed input")
+{
+    const compact_string lone{std::u16string({u'a', static_cast<char16_t>(0xD800)})};
+    REQUIRE(lone.width() == 2);
+    REQUIRE(lone[1] == U'�');
+
+    const compact_string bad{std::u32string({U'a', static_cast<char32_t>(0x110000)})};
+    REQUIRE(bad.width() == 2);
+    REQUIRE(bad[1] == U'�');
+
+    REQUIRE(compact_string{std::string("a\xFF")}[1] == U'�');
+}
+
+TEST_CASE("compact_string converts to UTF")
+{
+    const std::string text = u8"$€0123456789你好abcdefghijklmnopqrstuvwxyz😎";
+
+    for (const compact_string& s : {compact_string{std::string("plain ASCII text")},
+                                    compact_string{std::string(u8"Latin-1 café")},
+                                    compact_string{std::string(u8"BMP €你好")},
+                                    compact_string{text}}) {
+        const std::u32string u32 = to_u32string(s);
+        REQUIRE(u32.size() == s.size());
+        REQUIRE(to_u8string(s) == to_u8string(u32));
+        REQUIRE(to_u16string(s) == to_u16string(u32));
+        REQUIRE(std::u32string(s.begin(), s.end()) == u32);
+        REQUIRE(to_u8string(as_utf8(s)) == to_u8string(u32));
+        REQUIRE(compact_string{to_u8string(s)} == s);
+    }
+
+    const compact_string latin{to_u32string(std::string(u8"naïve"))};
+    REQUIRE(latin.visit([](const auto* p, std::size_t n) { return n * sizeof(*p); }) == 5);
+}
@@ -0,0 +1,85 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/detect.hpp>
+
+using namespace tcb::unicode;
+
+#define TEST_STRING "$€0123456789你好abcdefghijklmnopqrstuvwxyz\U0001F60E"
+
+namespace {
+
+const std::string u8 = u8"" TEST_STRING;
+
+std::string with_bom(encoding e)
+{
+    return to_bytes(std::string(u8"﻿" TEST_STRING), e);
+}
+
+}
+
+TEST_CASE("detect_encoding recognises byte order marks")
+{
+    for (encoding e : {encoding::utf8, encoding::utf16le, encoding::utf16be,
+                       encoding::utf32le, encoding::utf32be}) {
+        const std::string bytes = with_bom(e);
+        const detected_encoding d = detect_encoding(bytes);
+        REQUIRE(d.enc == e);
+        REQUIRE(d.bom_size == to_bytes(std::string(u8"﻿"), e).size());
+        REQUIRE(to_u8string(bytes.data() + d.bom_size, bytes.size() - d.bom_size, d) == u8);
+    }
+}
+
+TEST_CASE("detect_encoding guesses encodings without a byte order mark")
+{
+    for (encoding e : {encoding::utf8, encoding::utf16le, encoding::utf16be,
+                       encoding::utf32le, encoding::utf32be}) {
+        const std::string bytes = to_bytes(u8, e);
+        const detected_encoding d = detect_encoding(bytes);
+        REQUIRE(d.enc == e);
+        REQUIRE(d.bom_size == 0);
+    }
+
+    REQUIRE(detect_encoding(std::string("plain ASCII")).enc == encoding::utf8);
+    REQUIRE(detect_encoding(std::string("caf\xE9 cr\xE8me")).enc == encoding::latin1);
+}
+
+TEST_CASE("detect_encoding recognises UTF-16 with no zero bytes")
+{
+    const std::string japanese = u8"日本語のテキストです。これは文字コードを判定するための"
+                                 u8"試験的な文章であり、平仮名と片仮名と漢字が混在しています。";
+    const std::string chinese = u8"这段用于编码检测的简体中文文字，其中没有任何拉丁字母。"
+                                u8"北京是中华人民共和国的首都，历史悠久，文化灿烂。";
+
+    for (const std::string& text : {japanese, chinese}) {
+        for (encoding e : {encoding::utf16le, encoding::utf16be}) {
+            const std::string bytes = to_bytes(text, e);
+            REQUIRE(bytes.find('\0') == std::string::npos);
+            REQUIRE(detect_encoding(bytes).enc == e);
+        }
+    }
+
+    REQUIRE(detect_encoding(std::string(
+                "\xDC" "ber den Wolken mu\xDF die Freiheit wohl grenzenlos sein. "
+                "\xC0 la fin de l'\xE9t\xE9, \x93" "d\xE9j\xE0\x94 l\xE0-bas.")).enc
+            == encoding::latin1);
+}
+
+TEST_CASE("detect_encoding tolerates a sample ending mid-sequence")
+{
+    std::string text;
+    while (text.size() < 100000) {
+        text += u8;
+    }
+    REQUIRE(detect_encoding(text.data(), text.size(), 1001).enc == encoding::utf8);
+
+    const std::string u16 = to_bytes(text, encoding::utf16be);
+    REQUIRE(detect_encoding(u16.data(), u16.size(), 999).enc == encoding::utf16be);
+}
+
+TEST_CASE("Latin-1 byte buffers can be converted")
+{
+    const std::string latin = "caf\xE9 \xA3" "5";
+    REQUIRE(to_u8string(latin.data(), latin.size(), encoding::latin1) == u8"café £5");
+    REQUIRE(to_bytes(std::string(u8"café £5 €"), encoding::latin1) == latin + " ?");
+}
@@ -0,0 +1,160 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/file.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+using namespace tcb::unicode;
+
+#define TEST_STRING "$€0123456789你好abcdefghijklmnopqrstuvwxyz\U0001F60E"
+
+namespace {
+
+struct temp_file {
+    temp_file()
+    {
+        char name[] = "/tmp/tcb_unicode_XXXXXX";
+        const int fd = ::mkstemp(name);
+        REQUIRE(fd >= 0);
+        ::close(fd);
+        path = name;
+    }
+
+    ~temp_file() { std::remove(path.c_str()); }
+
+    std::string path;
+};
+
+void write_file(const std::string& path, const std::string& contents)
+{
+    std::ofstream f(path, std::ios::binary);
+    f << contents;
+}
+
+std::string read_file(const std::string& path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>{f},
+                       std::istreambuf_iterator<char>{});
+}
+
+template <typename CharT>
+std::string to_le_bytes(const std::basic_string<CharT>& str)
+{
+    std::string out;
+    for (CharT c : str) {
+        for (std::size_t i = 0; i < sizeof(CharT); i++) {
+            out += static_cast<char>((static_cast<std::uint32_t>(c) >> (8 * i)) & 0xFF);
+        }
+    }
+    return out;
+}
+
+}
+
+TEST_CASE("transcode_file converts files")
+{
+    std::string u8;
+    std::u16string u16;
+    for (int i = 0; i < 1000; i++) {
+        u8 += u8"" TEST_STRING;
+        u16 += u"" TEST_STRING;
+    }
+
+    temp_file in;
+    temp_file out;
+
+    for (unsigned threads : {1u, 2u, 7u}) {
+        write_file(in.path, u8);
+        transcode_file(in.path, out.path, encoding::utf8, encoding::utf16le, threads);
+        REQUIRE(read_file(out.path) == to_le_bytes(u16));
+
+        write_file(in.path, to_le_bytes(u16));
+        transcode_file(in.path, out.path, encoding::utf16le, encoding::utf8, threads);
+        REQUIRE(read_file(out.path) == u8);
+    }
+}
+
+TEST_CASE("transcode_file handles empty files")
+{
+    temp_file in;
+    temp_file out;
+    write_file(out.path, "garbage");
+
+    transcode_file(in.path, out.path, encoding::utf8, encoding::utf32be);
+    REQUIRE(read_file(out.path).empty());
+}
+
+TEST_CASE("transcode_file reports errors")
+{
+    temp_file out;
+    REQUIRE_THROWS_AS(transcode_file("/nonexistent/file", out.path,
+                                     encoding::utf8, encoding::utf16le),
+                      const std::system_error&);
+}
+
+TEST_CASE("transcode_file can convert a file in place")
+{
+    std::string u8;
+    std::u16string u16;
+    for (int i = 0; i < 1000; i++) {
+        u8 += u8"" TEST_STRING;
+        u16 += u"" TEST_STRING;
+    }
+
+    temp_file file;
+    for (unsigned threads : {1u, 3u}) {
+        write_file(file.path, u8);
+        transcode_file(file.path, file.path, encoding::utf8, encoding::utf16le, threads);
+        REQUIRE(read_file(file.path) == to_le_bytes(u16));
+
+        transcode_file(file.path, file.path, encoding::utf16le, encoding::utf8, threads);
+        REQUIRE(read_file(file.path) == u8);
+    }
+}
+
+TEST_CASE("transcode_file can skip a byte order mark")
+{
+    std::u16string u16;
+    for (int i = 0; i < 1000; i++) {
+        u16 += u"" TEST_STRING;
+    }
+    temp_file in;
+    temp_file out;
+    write_file(in.path, "\xFF\xFE" + to_le_bytes(u16));
+
+    for (unsigned threads : {1u, 3u}) {
+        transcode_file(in.path, out.path, encoding::utf16le, encoding::utf8, threads, 2);
+        REQUIRE(read_file(out.path) == to_u8string(u16));
+    }
+
+    // Skipping everything gives an empty file
+    transcode_file(in.path, out.path, encoding::utf16le, encoding::utf8, 1, 1000000);
+    REQUIRE(read_file(out.path).empty());
+}
+
+TEST_CASE("transcode_file can write a byte order mark")
+{
+    std::string u8;
+    std::u16string u16;
+    for (int i = 0; i < 1000; i++) {
+        u8 += u8"" TEST_STRING;
+        u16 += u"" TEST_STRING;
+    }
+    temp_file in;
+    temp_file out;
+    write_file(in.path, u8);
+
+    for (unsigned threads : {1u, 3u}) {
+        transcode_file(in.path, out.path, encoding::utf8, encoding::utf16le, threads, 0, "\xFF\xFE");
+        REQUIRE(read_file(out.path) == "\xFF\xFE" + to_le_bytes(u16));
+    }
+
+    // An empty input gives just the prefix
+    write_file(in.path, "");
+    transcode_file(in.path, out.path, encoding::utf8, encoding::utf16le, 3, 0, "\xFF\xFE");
+    REQUIRE(read_file(out.path) == "\xFF\xFE");
+}
@@ -0,0 +1,95 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/graphemes.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace tcb::unicode;
+
+namespace {
+
+template <typename String>
+std::vector<String> split_graphemes(const String& str)
+{
+    std::vector<String> result;
+    for (const auto& g : graphemes(str))
+        result.push_back(String(g.begin(), g.end()));
+    return result;
+}
+
+using strings = std::vector<std::string>;
+
+}
+
+TEST_CASE("ASCII text has a cluster per character, except CRLF")
+{
+    REQUIRE(split_graphemes(std::string{}).empty());
+    REQUIRE((split_graphemes(std::string{"ab c"}) == strings{"a", "b", " ", "c"}));
+    REQUIRE((split_graphemes(std::string{"a\r\nb\n\rc"}) ==
+             strings{"a", "\r\n", "b", "\n", "\r", "c"}));
+    REQUIRE((split_graphemes(std::string{"\r\r\n"}) == strings{"\r", "\r\n"}));
+}
+
+TEST_CASE("Marks extend the preceding cluster")
+{
+    REQUIRE((split_graphemes(std::string{u8"e\u0301\u0327x"}) ==
+             strings{u8"e\u0301\u0327", "x"}));
+    // A mark does not attach to a control
+    REQUIRE((split_graphemes(std::string{u8"\n\u0301"}) == strings{"\n", u8"\u0301"}));
+    // SpacingMark and Prepend
+    REQUIRE((split_graphemes(std::string{u8"कि"}) == strings{u8"कि"}));
+    REQUIRE((split_graphemes(std::string{u8"؀١a"}) == strings{u8"؀١", "a"}));
+    REQUIRE((split_graphemes(std::string{u8"؀\r"}) == strings{u8"؀", "\r"}));
+}
+
+TEST_CASE("Hangul syllable sequences form one cluster")
+{
+    REQUIRE((split_graphemes(std::string{u8"\u1100\u1161\u11A8\uAC00"}) ==
+             strings{u8"\u1100\u1161\u11A8", u8"\uAC00"}));
+    REQUIRE((split_graphemes(std::string{u8"\uAC00\u11A8\uAC01\u1161"}) ==
+             strings{u8"\uAC00\u11A8", u8"\uAC01", u8"\u1161"}));
+}
+
+TEST_CASE("Emoji ZWJ sequences and modifiers form one cluster")
+{
+    const std::string family = u8"\U0001F468‍\U0001F469‍\U0001F467";
+    REQUIRE((split_graphemes(family + "!") == strings{family, "!"}));
+    REQUIRE((split_graphemes(std::string{u8"\U0001F44D\U0001F3FD❤️"}) ==
+             strings{u8"\U0001F44D\U0001F3FD", u8"❤️"}));
+    // A ZWJ joins pictographs only after a pictograph
+    REQUIRE((split_graphemes(std::string{u8"a‍\U0001F469"}) ==
+             strings{u8"a‍", u8"\U0001F469"}));
+}
+
+TEST_CASE("Regional indicators pair up into flags")
+{
+    const std::string gb = u8"\U0001F1EC\U0001F1E7";
+    const std::string fr = u8"\U0001F1EB\U0001F1F7";
+    REQUIRE((split_graphemes(gb + fr + u8"\U0001F1EB") == strings{gb, fr, u8"\U0001F1EB"}));
+    REQUIRE((split_graphemes("a" + gb) == strings{"a", gb}));
+}
+
+TEST_CASE("Graphemes can be found in UTF-16 and UTF-32")
+{
+    const std::u16string str16 = u"e\u0301\U0001F1EC\U0001F1E7\r\n";
+    REQUIRE((split_graphemes(str16) ==
+             std::vector<std::u16string>{u"e\u0301", u"\U0001F1EC\U0001F1E7", u"\r\n"}));
+
+    const std::u32string str32 = U"가x";
+    REQUIRE((split_graphemes(str32) == std::vector<std::u32string>{U"가", U"x"}));
+}
+
+TEST_CASE("next_grapheme_boundary finds the end of one cluster")
+{
+    const std::string str = u8"e\u0301x";
+    REQUIRE(next_grapheme_boundary(str.begin(), str.end()) == str.begin() + 3);
+    REQUIRE(next_grapheme_boundary(str.begin() + 3, str.end()) == str.end());
+    REQUIRE(next_grapheme_boundary(str.end(), str.end()) == str.end());
+
+    // Invalid sequences are clusters of U+FFFD
+    const std::string invalid = "\xC3\xFF\xCC\x81";
+    REQUIRE(next_grapheme_boundary(invalid.begin(), invalid.end()) == invalid.begin() + 1);
+    REQUIRE(next_grapheme_boundary(invalid.begin() + 1, invalid.end()) == invalid.end());
+}
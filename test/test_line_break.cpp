@@ -0,0 +1,116 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/line_break.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace tcb::unicode;
+
+namespace {
+
+template <typename String>
+std::vector<String> split_lines(const String& str)
+{
+    std::vector<String> result;
+    for (const auto& s : line_breaks(str))
+        result.push_back(String(s.begin(), s.end()));
+    return result;
+}
+
+using strings = std::vector<std::string>;
+
+}
+
+TEST_CASE("Lines break after spaces and hyphens")
+{
+    REQUIRE(split_lines(std::string{}).empty());
+    REQUIRE((split_lines(std::string{"The quick  brown-fox"}) ==
+             strings{"The ", "quick  ", "brown-", "fox"}));
+    REQUIRE((split_lines(std::string{"  lead"}) == strings{"  ", "lead"}));
+    // No break before closing punctuation, or after opening punctuation
+    REQUIRE((split_lines(std::string{"(see [this] )!"}) ==
+             strings{"(see ", "[this] )!"}));
+    REQUIRE((split_lines(std::string{"a ( b"}) == strings{"a ", "( b"}));
+}
+
+TEST_CASE("Mandatory breaks follow line terminators")
+{
+    const std::string str = u8"one\r\ntwo\nthree\rfour\u2028five six";
+    REQUIRE((split_lines(str) ==
+             strings{"one\r\n", "two\n", "three\r", u8"four\u2028", "five ", "six"}));
+
+    std::vector<bool> mandatory;
+    for (const auto& s : line_breaks(str))
+        mandatory.push_back(is_mandatory_break(s));
+    REQUIRE((mandatory == std::vector<bool>{true, true, true, true, false, false}));
+
+    const std::string soft = "soft break";
+    REQUIRE_FALSE(is_mandatory_break(*line_breaks(soft).begin()));
+}
+
+TEST_CASE("is_mandatory_break decodes in the encoding of the view")
+{
+    // NEL is a single byte in Latin-1
+    const std::string str = "ab\x85" "cd";
+    std::vector<std::string> segments;
+    std::vector<bool> mandatory;
+    for (const auto& s : line_breaks<latin1>(str)) {
+        segments.emplace_back(s.begin(), s.end());
+        mandatory.push_back(is_mandatory_break(s));
+    }
+    REQUIRE((segments == strings{"ab\x85", "cd"}));
+    REQUIRE((mandatory == std::vector<bool>{true, false}));
+}
+
+TEST_CASE("Numbers with prefixes, suffixes and separators are kept together")
+{
+    REQUIRE((split_lines(std::string{"$(12.50) 100% -5 1,000.00"}) ==
+             strings{"$(12.50) ", "100% ", "-5 ", "1,000.00"}));
+    REQUIRE((split_lines(std::string{"3/4"}) == strings{"3/4"}));
+    REQUIRE((split_lines(std::string{"a-1"}) == strings{"a-1"}));
+}
+
+TEST_CASE("Glue, joiners and combining marks prevent breaks")
+{
+    REQUIRE((split_lines(std::string{u8"10\u00A0km a\u2060b"}) ==
+             strings{u8"10\u00A0km ", u8"a\u2060b"}));
+    // A mark takes the class of its base, unless it follows a space
+    REQUIRE((split_lines(std::string{u8"a\u0301 \u0301b"}) ==
+             strings{u8"a\u0301 ", u8"\u0301b"}));
+    // A zero width space is a break opportunity
+    REQUIRE((split_lines(std::string{u8"long\u200Bword"}) ==
+             strings{u8"long\u200B", u8"word"}));
+}
+
+TEST_CASE("Ideographs and kana allow breaks between characters")
+{
+    REQUIRE((split_lines(std::string{u8"日本語、です。"}) ==
+             strings{u8"日", u8"本", u8"語、", u8"で", u8"す。"}));
+    // Hangul syllables break like ideographs, but not within one
+    REQUIRE((split_lines(std::string{u8"각가"}) ==
+             strings{u8"각", u8"가"}));
+}
+
+TEST_CASE("Emoji and regional indicators")
+{
+    REQUIRE((split_lines(std::string{u8"\U0001F466\U0001F3FB\U0001F466"}) ==
+             strings{u8"\U0001F466\U0001F3FB", u8"\U0001F466"}));
+    REQUIRE((split_lines(std::string{u8"\U0001F1EC\U0001F1E7\U0001F1EB\U0001F1F7"}) ==
+             strings{u8"\U0001F1EC\U0001F1E7", u8"\U0001F1EB\U0001F1F7"}));
+    REQUIRE((split_lines(std::string{u8"\U0001F468\u200D\U0001F469"}) ==
+             strings{u8"\U0001F468\u200D\U0001F469"}));
+}
+
+TEST_CASE("Line breaks can be found in UTF-16 and UTF-32")
+{
+    REQUIRE((split_lines(std::u16string{u"déjà vu"}) ==
+             std::vector<std::u16string>{u"déjà ", u"vu"}));
+    REQUIRE((split_lines(std::u32string{U"\U00020000\U00020001"}) ==
+             std::vector<std::u32string>{U"\U00020000", U"\U00020001"}));
+
+    const std::string str = "ab cd";
+    REQUIRE(next_line_break(str.begin(), str.end()) == str.begin() + 3);
+    REQUIRE(next_line_break(str.begin() + 3, str.end()) == str.end());
+}
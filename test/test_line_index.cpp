@@ -0,0 +1,121 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/line_index.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("line_index finds line starts and ASCII lines")
+{
+    const line_index empty;
+    REQUIRE(empty.line_count() == 1);
+    REQUIRE((empty.to_line_column(0) == line_column{0, 0}));
+
+    const std::string str = u8"first line is long enough to span words\n"
+                            u8"s€cond\r\n"
+                            u8"\n"
+                            u8"😎 last, with no line feed and more than eight bytes";
+    const line_index idx{str};
+
+    REQUIRE(idx.line_count() == 4);
+    REQUIRE(idx.line_start(0) == 0);
+    REQUIRE(idx.line_start(1) == str.find(u8"s€"));
+    REQUIRE(idx.line_start(3) == str.find(u8"😎"));
+    REQUIRE(idx.is_ascii_line(0));
+    REQUIRE_FALSE(idx.is_ascii_line(1));
+    REQUIRE(idx.is_ascii_line(2));
+    REQUIRE_FALSE(idx.is_ascii_line(3));
+    REQUIRE(idx.line_end(1) == str.find("\r\n"));
+}
+
+TEST_CASE("line_index converts between offsets and columns")
+{
+    const std::string str = u8"ascii\n"
+                            u8"a€b😎c\n"
+                            u8"end";
+    const line_index idx{str};
+
+    const std::size_t b = str.find('b');
+    const std::size_t c = str.find('c', 6);
+    REQUIRE((idx.to_line_column(b) == line_column{1, 2}));
+    REQUIRE((idx.to_line_column(c) == line_column{1, 5}));
+    REQUIRE((idx.to_line_column(c, rope_metric::code_points) == line_column{1, 4}));
+    REQUIRE((idx.to_line_column(c, rope_metric::bytes) == line_column{1, c - 6}));
+    REQUIRE((idx.to_line_column(3) == line_column{0, 3}));
+    REQUIRE((idx.to_line_column(str.size()) == line_column{2, 3}));
+
+    // Offsets within a code point move back to its start
+    REQUIRE((idx.to_line_column(b - 1) == line_column{1, 1}));
+
+    REQUIRE(idx.to_offset({1, 2}) == b);
+    REQUIRE(idx.to_offset({1, 5}) == c);
+    REQUIRE(idx.to_offset({1, 4}, rope_metric::code_points) == c);
+    REQUIRE(idx.to_offset({0, 3}) == 3);
+
+    // Columns past the end of a line clamp to the line end
+    REQUIRE(idx.to_offset({0, 100}) == 5);
+    REQUIRE(idx.to_offset({1, 100}) == c + 1);
+    REQUIRE(idx.to_offset({7, 0}) == str.size());
+}
+
+TEST_CASE("line_index round-trips every position in long text")
+{
+    std::string str;
+    for (int i = 0; i < 300; i++) {
+        str += i % 3 == 0 ? u8"plain ASCII line\n" : u8"Ünïcödé 你好 😎 line\n";
+    }
+    const line_index idx{str};
+    REQUIRE(idx.line_count() == 301);
+
+    for (std::size_t i = 0; i <= str.size(); i++) {
+        if (i < str.size() && (static_cast<unsigned char>(str[i]) & 0xC0) == 0x80)
+            continue;
+        for (rope_metric m : {rope_metric::bytes, rope_metric::code_points, rope_metric::utf16_units}) {
+            const line_column lc = idx.to_line_column(i, m);
+            REQUIRE(idx.to_offset(lc, m) == i);
+        }
+    }
+}
+
+TEST_CASE("line_index ends lines at CR, LF and CR LF")
+{
+    const std::string str = "classic Mac\rUnix\nWindows\r\n\r\r\nend\r";
+    const line_index idx{str};
+    REQUIRE(idx.line_count() == 7);
+    REQUIRE(idx.line_start(1) == str.find("Unix"));
+    REQUIRE(idx.line_start(2) == str.find("Windows"));
+    REQUIRE(idx.line_start(5) == str.find("end"));
+    REQUIRE(idx.line_start(6) == str.size());
+    REQUIRE(idx.line_end(0) == str.find('\r'));
+    REQUIRE(idx.line_end(3) == idx.line_start(3));
+    REQUIRE(idx.line_end(5) == str.size() - 1);
+    REQUIRE((idx.to_line_column(str.find("Unix") + 2) == line_column{1, 2}));
+    REQUIRE(idx.to_offset({0, 100}) == str.find('\r'));
+
+    // CR LF counts once wherever it falls relative to an eight-byte word
+    for (std::size_t n = 0; n < 20; n++) {
+        const std::string s = std::string(n, 'x') + "\r\n" + u8"€";
+        const line_index i{s};
+        REQUIRE(i.line_count() == 2);
+        REQUIRE(i.line_start(1) == n + 2);
+        REQUIRE(i.line_end(0) == n);
+    }
+}
+
+TEST_CASE("line_index counts CR LF once when an edit brings them together")
+{
+    std::string str = "first line\rX\nsecond line";
+    REQUIRE(line_index{str}.line_count() == 3);
+
+    str.erase(str.find('X'), 1);
+    const line_index idx{str};
+    REQUIRE(idx.line_count() == 2);
+    REQUIRE(idx.line_start(1) == str.find("second"));
+
+    // And twice when an edit separates them again
+    str.insert(str.find('\n'), u8"é");
+    const line_index split{str};
+    REQUIRE(split.line_count() == 3);
+    REQUIRE_FALSE(split.is_ascii_line(1));
+    REQUIRE(split.line_end(1) == split.line_start(1) + 2);
+}
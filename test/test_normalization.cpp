@@ -0,0 +1,109 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/normalization.hpp>
+
+#include <list>
+#include <string>
+
+using namespace tcb::unicode;
+
+TEST_CASE("Canonical combining classes")
+{
+    REQUIRE(canonical_combining_class(U'a') == 0);
+    REQUIRE(canonical_combining_class(U'\u0301') == 230);
+    REQUIRE(canonical_combining_class(U'\u0323') == 220);
+    REQUIRE(canonical_combining_class(U'\u05AE') == 228);
+    REQUIRE(canonical_combining_class(0x110000) == 0);
+}
+
+TEST_CASE("Decomposition and composition")
+{
+    const std::u32string composed = U"\u00C5\u1E69 \uAC01";
+    const std::u32string decomposed = U"A\u030As\u0323\u0307 \u1100\u1161\u11A8";
+    REQUIRE(to_nfd(composed) == decomposed);
+    REQUIRE(to_nfc(decomposed) == composed);
+    REQUIRE(to_nfc(std::u32string{U"d\u0307\u0323"}) == U"\u1E0D\u0307");
+    // Singletons and other composition exclusions are not recomposed
+    REQUIRE(to_nfc(std::u32string{U"\u212B\u0958"}) == U"\u00C5\u0915\u093C");
+    // Composition of two starters
+    REQUIRE(to_nfc(std::u32string{U"\u0B47\u0B3E"}) == U"\u0B4B");
+    REQUIRE(to_nfc(std::u32string{U"\u1100\u1161"}) == U"\uAC00");
+}
+
+TEST_CASE("Combining marks are put in canonical order")
+{
+    // The example of UAX #15: U+0315 (232), U+0300 (230), U+05AE (228)
+    const std::u32string str = U"a\u0315\u0300\u05AE\u0300b";
+    REQUIRE(to_nfd(str) == U"a\u05AE\u0300\u0300\u0315b");
+    REQUIRE(to_nfc(str) == U"\u00E0\u05AE\u0300\u0315b");
+
+    // More marks than fit in a segment buffer without allocating
+    std::u32string marks = U"e";
+    for (int i = 0; i < 40; i++)
+        marks += U"\u0301\u0323";
+    const std::u32string expected =
+        U"\u1EB9" + std::u32string(39, U'\u0323') + std::u32string(40, U'\u0301');
+    REQUIRE(to_nfc(marks) == expected);
+}
+
+TEST_CASE("Compatibility decomposition")
+{
+    const std::u32string str = U"\uFB01\u00B2\u1E9B\u0323";
+    REQUIRE(to_nfkd(str) == U"fi2s\u0323\u0307");
+    REQUIRE(to_nfkc(str) == U"fi2\u1E69");
+    REQUIRE(to_nfc(str) == str);
+    REQUIRE(to_nfkc(std::u32string{U"\u3200\uFF76\uFF9E"}) == U"(\u1100)\u30AC");
+}
+
+TEST_CASE("Normalization of UTF-8 and UTF-16 text")
+{
+    REQUIRE(to_nfc(std::string{u8"Cafe\u0301 \u1100\u1161"}) == u8"Caf\u00E9 \uAC00");
+    REQUIRE(to_nfd(std::string{u8"Caf\u00E9"}) == u8"Cafe\u0301");
+    REQUIRE(to_nfkd(std::u16string{u"\U0001D400\u2460"}) == u"A1");
+    const std::list<char> list = {'e', '\xCC', '\x81'};
+    REQUIRE((to_nfc(list) == std::list<char>{'\xC3', '\xA9'}));
+    // Ill-formed sequences are replaced
+    REQUIRE(to_nfc(std::string{"a\xFF"}) == u8"a\uFFFD");
+}
+
+TEST_CASE("Quick check")
+{
+    using nf = normalization_form;
+    REQUIRE(quick_check<nf::nfc>(std::string{"plain ASCII"}) == quick_check_result::yes);
+    REQUIRE(quick_check<nf::nfc>(std::string{u8"Caf\u00E9"}) == quick_check_result::yes);
+    REQUIRE(quick_check<nf::nfd>(std::string{u8"Caf\u00E9"}) == quick_check_result::no);
+    REQUIRE(quick_check<nf::nfc>(std::string{u8"Cafe\u0301"}) == quick_check_result::maybe);
+    REQUIRE(quick_check<nf::nfc>(std::string{u8"a\u0323\u0301"}) == quick_check_result::maybe);
+    REQUIRE(quick_check<nf::nfc>(std::string{u8"a\u0301\u0323"}) == quick_check_result::no);
+    REQUIRE(quick_check<nf::nfkc>(std::string{u8"\uFB01"}) == quick_check_result::no);
+    REQUIRE(quick_check<nf::nfc>(std::string{"a\xFF"}) == quick_check_result::no);
+
+    REQUIRE(is_normalized<nf::nfc>(std::string{u8"\u1E0D\u0307"}));
+    REQUIRE_FALSE(is_normalized<nf::nfc>(std::string{u8"Cafe\u0301"}));
+    REQUIRE(is_normalized<nf::nfd>(std::string{u8"Cafe\u0301"}));
+    REQUIRE(is_normalized<nf::nfkd>(std::u32string{}));
+}
+
+TEST_CASE("Normalized text is returned without being copied")
+{
+    std::string str = u8"An identifier long enough to be on the heap: caf\u00E9";
+    const char* data = str.data();
+    const std::string result = to_nfc(std::move(str));
+    REQUIRE(result.data() == data);
+}
+
+TEST_CASE("Normalization views")
+{
+    const std::string str = u8"\u212Bngstr\u00F6m \u00C5";
+    REQUIRE(std::u32string(as_nfd(str)) == U"A\u030Angstro\u0308m A\u030A");
+    REQUIRE(std::u32string(as_nfc(str)) == U"\u00C5ngstr\u00F6m \u00C5");
+    REQUIRE(std::u32string(as_nfkc(std::string{u8"\uFB03x"})) == U"ffix");
+    REQUIRE(std::u32string(as_nfkd(std::string{})).empty());
+
+    auto view = as_normalized<normalization_form::nfd>(str.begin(), str.end());
+    auto it = view.begin();
+    REQUIRE(*it == U'A');
+    REQUIRE(*++it == U'\u030A');
+    REQUIRE(std::distance(view.begin(), view.end()) == 13);
+}
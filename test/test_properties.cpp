@@ -0,0 +1,83 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/properties.hpp>
+
+using namespace tcb::unicode;
+
+static_assert(get_general_category(U'A') == general_category::uppercase_letter,
+              "Property lookups should be usable in constant expressions");
+static_assert(is_white_space(U' ') && !is_white_space(U'x'),
+              "Property lookups should be usable in constant expressions");
+
+TEST_CASE("General_Category lookups")
+{
+    REQUIRE(get_general_category(U'a') == general_category::lowercase_letter);
+    REQUIRE(get_general_category(U'ǅ') == general_category::titlecase_letter);
+    REQUIRE(get_general_category(U'5') == general_category::decimal_number);
+    REQUIRE(get_general_category(U'\u0301') == general_category::nonspacing_mark);
+    REQUIRE(get_general_category(U'€') == general_category::currency_symbol);
+    REQUIRE(get_general_category(U'\u2028') == general_category::line_separator);
+    REQUIRE(get_general_category(U'\u00AD') == general_category::format);
+    REQUIRE(get_general_category(U'\x1F') == general_category::control);
+    REQUIRE(get_general_category(U'\U0001F60E') == general_category::other_symbol);
+    REQUIRE(get_general_category(U'\U00020000') == general_category::other_letter);
+    REQUIRE(get_general_category(0xD800) == general_category::surrogate);
+    REQUIRE(get_general_category(0xE000) == general_category::private_use);
+    REQUIRE(get_general_category(0x0378) == general_category::unassigned);
+    REQUIRE(get_general_category(0x110000) == general_category::unassigned);
+
+    REQUIRE(is_letter(U'你'));
+    REQUIRE(is_mark(U'ः'));
+    REQUIRE(is_number(U'Ⅷ'));
+    REQUIRE(is_punctuation(U'¿'));
+    REQUIRE(is_symbol(U'+'));
+    REQUIRE(is_separator(U'\u3000'));
+    REQUIRE_FALSE(is_letter(U'1'));
+}
+
+TEST_CASE("Script lookups")
+{
+    REQUIRE(get_script(U'a') == script::latin);
+    REQUIRE(get_script(U'α') == script::greek);
+    REQUIRE(get_script(U'ж') == script::cyrillic);
+    REQUIRE(get_script(U'你') == script::han);
+    REQUIRE(get_script(U'あ') == script::hiragana);
+    REQUIRE(get_script(U'ا') == script::arabic);
+    REQUIRE(get_script(U'1') == script::common);
+    REQUIRE(get_script(U'\u0301') == script::inherited);
+    REQUIRE(get_script(U'\U00010300') == script::old_italic);
+    REQUIRE(get_script(0x0378) == script::unknown);
+}
+
+TEST_CASE("East_Asian_Width lookups")
+{
+    REQUIRE(get_east_asian_width(U'a') == east_asian_width::narrow);
+    REQUIRE(get_east_asian_width(U'你') == east_asian_width::wide);
+    REQUIRE(get_east_asian_width(U'Ａ') == east_asian_width::fullwidth);
+    REQUIRE(get_east_asian_width(U'ｶ') == east_asian_width::halfwidth);
+    REQUIRE(get_east_asian_width(U'¡') == east_asian_width::ambiguous);
+    REQUIRE(get_east_asian_width(U'ا') == east_asian_width::neutral);
+    // Unassigned code points in CJK blocks default to wide
+    REQUIRE(get_east_asian_width(0x2FFFD) == east_asian_width::wide);
+}
+
+TEST_CASE("Binary property lookups")
+{
+    REQUIRE(is_white_space(U'\u00A0'));
+    REQUIRE(is_white_space(U'\u2029'));
+    REQUIRE_FALSE(is_white_space(U'\u200B'));
+
+    REQUIRE(is_alphabetic(U'\u0345'));
+    REQUIRE(is_lowercase(U'ª'));
+    REQUIRE(is_uppercase(U'Ⅰ'));
+    REQUIRE_FALSE(is_lowercase(U'A'));
+    REQUIRE(is_default_ignorable(U'\u200D'));
+
+    REQUIRE(is_emoji(U'#'));
+    REQUIRE_FALSE(is_emoji_presentation(U'#'));
+    REQUIRE(is_emoji_presentation(U'\U0001F60E'));
+    REQUIRE(is_extended_pictographic(U'©'));
+    REQUIRE(is_extended_pictographic(0x1FFFD));
+    REQUIRE_FALSE(is_extended_pictographic(U'a'));
+}
@@ -0,0 +1,176 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/rope.hpp>
+
+#include <random>
+
+using namespace tcb::unicode;
+
+namespace {
+
+rope_metrics naive_metrics(const std::string& str)
+{
+    rope_metrics m;
+    m.bytes = str.size();
+    const std::u32string u32 = to_u32string(str);
+    m.code_points = u32.size();
+    m.utf16_units = to_u16string(str).size();
+    for (char32_t c : u32) {
+        m.newlines += c == U'\n';
+    }
+    return m;
+}
+
+void check_metrics(const rope_metrics& a, const rope_metrics& b)
+{
+    REQUIRE(a.bytes == b.bytes);
+    REQUIRE(a.code_points == b.code_points);
+    REQUIRE(a.utf16_units == b.utf16_units);
+    REQUIRE(a.newlines == b.newlines);
+}
+
+std::string sample_text(std::size_t lines)
+{
+    std::string str;
+    for (std::size_t i = 0; i < lines; i++) {
+        str += u8"Line $€你好😎 number " + std::to_string(i) + "\n";
+    }
+    return str;
+}
+
+}
+
+TEST_CASE("UTF-8 metrics are counted a word at a time")
+{
+    const std::string str = sample_text(10);
+    for (std::size_t len = 0; len <= str.size(); len++) {
+        if (len < str.size() && (static_cast<unsigned char>(str[len]) & 0xC0) == 0x80)
+            continue;
+        check_metrics(detail::count_utf8_metrics(str.data(), str.data() + len),
+                      naive_metrics(str.substr(0, len)));
+    }
+}
+
+TEST_CASE("Ropes measure and convert positions in every metric")
+{
+    const std::string str = sample_text(500);
+    const rope r{str};
+
+    REQUIRE(r.str() == str);
+    check_metrics(r.metrics(), naive_metrics(str));
+    REQUIRE(r.line_count() == 501);
+
+    // Line starts
+    std::size_t line = 0;
+    for (std::size_t i = 0; i <= str.size(); i++) {
+        if (i == 0 || str[i - 1] == '\n') {
+            REQUIRE(r.to_byte_offset(rope_metric::lines, line) == i);
+            REQUIRE(r.measure(i).newlines == line);
+            ++line;
+        }
+    }
+
+    // Code point and UTF-16 positions, checked against the naive conversion
+    const std::u32string u32 = to_u32string(str);
+    for (std::size_t cp = 0; cp < u32.size(); cp += 37) {
+        const std::size_t b = r.to_byte_offset(rope_metric::code_points, cp);
+        REQUIRE(to_u32string(str.substr(0, b)).size() == cp);
+        const std::size_t u16 = r.convert(rope_metric::code_points, cp, rope_metric::utf16_units);
+        REQUIRE(u16 == to_u16string(str.substr(0, b)).size());
+        REQUIRE(r.convert(rope_metric::utf16_units, u16, rope_metric::code_points) == cp);
+    }
+
+    // A position in the middle of a code point moves back to its start
+    const std::size_t euro = str.find(u8"€");
+    REQUIRE(r.to_byte_offset(rope_metric::bytes, euro + 1) == euro);
+    const std::size_t emoji = str.find(u8"😎");
+    const std::size_t emoji16 = r.measure(emoji).utf16_units;
+    REQUIRE(r.to_byte_offset(rope_metric::utf16_units, emoji16 + 1) == emoji);
+}
+
+TEST_CASE("Rope edits match string edits")
+{
+    std::string model = sample_text(200);
+    rope r{model};
+    std::mt19937 gen(42);
+
+    const std::string snippets[] = {u8"x", u8"€", u8"😎\n", sample_text(60)};
+
+    for (int i = 0; i < 300; i++) {
+        const std::size_t cps = r.code_points();
+        const std::size_t cp = std::uniform_int_distribution<std::size_t>(0, cps)(gen);
+        const std::size_t b = r.to_byte_offset(rope_metric::code_points, cp);
+
+        if (i % 3 != 0) {
+            const std::string& s = snippets[gen() % 4];
+            r.insert(rope_metric::code_points, cp, s);
+            model.insert(b, s);
+        }
+        else {
+            const std::size_t cp2 = std::min(cps, cp + gen() % 200);
+            const std::size_t b2 = r.to_byte_offset(rope_metric::code_points, cp2);
+            r.erase(rope_metric::code_points, cp, cp2);
+            model.erase(b, b2 - b);
+        }
+
+        REQUIRE(r.size() == model.size());
+        if (i % 50 == 0) {
+            REQUIRE(r.str() == model);
+            check_metrics(r.metrics(), naive_metrics(model));
+        }
+    }
+    REQUIRE(r.str() == model);
+    check_metrics(r.metrics(), naive_metrics(model));
+
+    // Slices share structure with the original, which is unchanged
+    const rope copy = r;
+    const rope s = r.slice(rope_metric::lines, 10, 20);
+    REQUIRE(s.line_count() == 11);
+    REQUIRE(s.str() == model.substr(r.to_byte_offset(rope_metric::lines, 10),
+                                    r.to_byte_offset(rope_metric::lines, 20) -
+                                        r.to_byte_offset(rope_metric::lines, 10)));
+    REQUIRE(copy == r);
+
+    rope joined = s;
+    joined.append(s);
+    REQUIRE(joined.str() == s.str() + s.str());
+}
+
+TEST_CASE("Ill-formed text is replaced when inserted into a rope")
+{
+    rope r{"ab"};
+    r.insert(1, "\xFF");
+    REQUIRE(r.str() == u8"a�b");
+    REQUIRE(r.code_points() == 3);
+}
+
+TEST_CASE("Rope leaves do not fragment under many small inserts")
+{
+    std::string model(100000, 'a');
+    rope r{model};
+    std::mt19937 gen(7);
+
+    for (int i = 0; i < 20000; i++) {
+        const std::size_t b = std::uniform_int_distribution<std::size_t>(0, r.size())(gen);
+        r.insert(b, "b");
+        model.insert(b, "b");
+    }
+    REQUIRE(r.str() == model);
+
+    std::size_t leaves = 0;
+    std::size_t largest = 0;
+    r.for_each_chunk([&](const char*, std::size_t n) {
+        ++leaves;
+        largest = std::max(largest, n);
+    });
+    const std::size_t max_leaf_size = rope::max_leaf_size;
+    REQUIRE(largest <= max_leaf_size);
+    REQUIRE(leaves <= 2 * r.size() / max_leaf_size + 1);
+
+    // Erasing most of the text merges what is left
+    r.erase(100, r.size() - 100);
+    leaves = 0;
+    r.for_each_chunk([&](const char*, std::size_t) { ++leaves; });
+    REQUIRE(leaves == 1);
+}
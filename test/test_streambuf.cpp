@@ -0,0 +1,69 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/streambuf.hpp>
+
+#include <istream>
+#include <sstream>
+
+using namespace tcb::unicode;
+
+#define TEST_STRING "$€0123456789你好abcdefghijklmnopqrstuvwxyz\U0001F60E"
+
+namespace {
+
+const std::string u8 = u8"" TEST_STRING;
+const std::u16string u16 = u"" TEST_STRING;
+const std::u32string u32 = U"" TEST_STRING;
+
+template <typename CharT>
+std::basic_string<CharT> read_all(std::basic_streambuf<CharT>& buf)
+{
+    std::basic_istream<CharT> is(&buf);
+    return std::basic_string<CharT>(std::istreambuf_iterator<CharT>{is},
+                                    std::istreambuf_iterator<CharT>{});
+}
+
+}
+
+TEST_CASE("transcoding_streambuf converts between encodings")
+{
+    SECTION("UTF-8 to UTF-16") {
+        std::stringbuf src{u8};
+        transcoding_streambuf<char, char16_t> buf{&src};
+        REQUIRE(read_all(buf) == u16);
+    }
+
+    SECTION("UTF-16 to UTF-8") {
+        std::basic_stringbuf<char16_t> src{u16};
+        transcoding_streambuf<char16_t, char> buf{&src};
+        REQUIRE(read_all(buf) == u8);
+    }
+
+    SECTION("UTF-32 to UTF-16") {
+        std::basic_stringbuf<char32_t> src{u32};
+        transcoding_streambuf<char32_t, char16_t> buf{&src};
+        REQUIRE(read_all(buf) == u16);
+    }
+}
+
+TEST_CASE("transcoding_streambuf handles sequences split across blocks")
+{
+    // Every block boundary falls inside some multi-unit sequence
+    for (std::size_t size = 1; size < 9; size++) {
+        std::stringbuf src8{u8};
+        transcoding_streambuf<char, char32_t> buf8{&src8, size};
+        REQUIRE(read_all(buf8) == u32);
+
+        std::basic_stringbuf<char16_t> src16{u16};
+        transcoding_streambuf<char16_t, char> buf16{&src16, size};
+        REQUIRE(read_all(buf16) == u8);
+    }
+}
+
+TEST_CASE("transcoding_streambuf replaces invalid input")
+{
+    std::stringbuf src{"a\xFF" "b\xE4\xBD"};
+    transcoding_streambuf<char, char32_t> buf{&src};
+    REQUIRE(read_all(buf) == U"a�b�");
+}
@@ -0,0 +1,94 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/text.hpp>
+
+#include <list>
+#include <thread>
+#include <vector>
+
+using namespace tcb::unicode;
+
+TEST_CASE("text keeps its original encoding and converts on demand")
+{
+    const text empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.u16string().empty());
+
+    const text t8{u8"$€你好😎"};
+    REQUIRE(t8.original_width() == 1);
+    REQUIRE(t8.u8string() == u8"$€你好😎");
+    REQUIRE(t8.u16string() == u"$€你好😎");
+    REQUIRE(t8.u32string() == U"$€你好😎");
+
+    const text t16{std::u16string(u"$€你好😎")};
+    REQUIRE(t16.original_width() == 2);
+    REQUIRE(t16.str<char>() == u8"$€你好😎");
+    REQUIRE(t16 == t8);
+    REQUIRE(t16 != text{U"$"});
+
+    // Other input is converted to UTF-8
+    const std::list<char32_t> list{U'a', U'€'};
+    const text from_list{list};
+    REQUIRE(from_list.original_width() == 1);
+    REQUIRE(from_list.u8string() == u8"a€");
+
+    // Ill-formed input is kept as it is, but replaced when converted
+    const text bad{std::string("a\xFF")};
+    REQUIRE(bad.u8string() == "a\xFF");
+    REQUIRE(bad.u32string() == U"a�");
+}
+
+TEST_CASE("text comparison treats ill-formed input as U+FFFD either way round")
+{
+    const text a{std::string("a\xFF")};
+    const text b{std::u16string(u"a\uFFFD")};
+    REQUIRE(a == b);
+    REQUIRE(b == a);
+
+    const text c{std::u32string{U'a', char32_t(0x110000)}};
+    REQUIRE(a == c);
+    REQUIRE(c == b);
+    REQUIRE(text{std::string("a\xFE")} == a);
+
+    const text d{std::u16string{u'a', char16_t(0xD800), u'b'}};
+    REQUIRE(d != a);
+    REQUIRE(a != d);
+    REQUIRE(d == text{u8"a\uFFFDb"});
+    REQUIRE(text{u8"a\uFFFDb"} == d);
+    REQUIRE(text{} == text{std::u32string{}});
+}
+
+TEST_CASE("text conversions are cached and shared between copies")
+{
+    const text t{u8"$€你好😎"};
+    const text copy = t;
+
+    const std::u16string& a = t.u16string();
+    const std::u16string& b = copy.u16string();
+    REQUIRE(&a == &b);
+    REQUIRE(&t.u8string() == &copy.u8string());
+}
+
+TEST_CASE("text conversions can be requested from several threads")
+{
+    std::string str;
+    for (int i = 0; i < 10000; i++) {
+        str += u8"a€😎";
+    }
+    const text t{str};
+
+    std::vector<const std::u32string*> results(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < results.size(); i++) {
+        threads.emplace_back([&t, &results, i] { results[i] = &t.u32string(); });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    for (const auto* p : results) {
+        REQUIRE(p == results[0]);
+    }
+    REQUIRE(*results[0] == to_u32string(str));
+}
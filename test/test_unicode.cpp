@@ -154,4 +154,185 @@ TEST_CASE("Container conversion") {
     REQUIRE(equal(a, u8));
     REQUIRE(equal(b, u16));
     REQUIRE(equal(c, u32));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Streams can be converted in bulk")
+{
+    // Long enough to span several internal blocks, with multi-unit
+    // sequences straddling the block boundaries
+    std::string long8;
+    std::u16string long16;
+    std::u32string long32;
+    for (int i = 0; i < 500; i++) {
+        long8 += u8;
+        long16 += u16;
+        long32 += u32;
+    }
+
+    SECTION("From streams") {
+        std::istringstream s8{long8};
+        REQUIRE(to_u16string(s8) == long16);
+        REQUIRE(s8.eof());
+
+        std::basic_istringstream<char16_t> s16{long16};
+        REQUIRE(to_u32string(s16) == long32);
+
+        std::basic_istringstream<char32_t> s32{long32};
+        REQUIRE(to_u8string(s32) == long8);
+    }
+
+    SECTION("From stream buffer iterators") {
+        using iter8 = std::istreambuf_iterator<char>;
+        using iter16 = std::istreambuf_iterator<char16_t>;
+
+        std::istringstream s8{long8};
+        REQUIRE(to_u32string(iter8{s8}, iter8{}) == long32);
+
+        std::basic_istringstream<char16_t> s16{long16};
+        REQUIRE(to_u8string(iter16{s16}, iter16{}) == long8);
+    }
+}
+
+TEST_CASE("utf_transcoder converts byte streams incrementally")
+{
+    const std::string u16be = [] {
+        std::string s;
+        for (char16_t c : u16) {
+            s += static_cast<char>(c >> 8);
+            s += static_cast<char>(c & 0xFF);
+        }
+        return s;
+    }();
+
+    SECTION("All at once") {
+        utf_transcoder t{encoding::utf8, encoding::utf16be};
+        std::string out;
+        t.convert(u8.data(), u8.size(), out);
+        t.finish(out);
+        REQUIRE(out == u16be);
+    }
+
+    SECTION("One byte at a time") {
+        utf_transcoder t{encoding::utf16be, encoding::utf8};
+        std::string out;
+        for (char c : u16be) {
+            t.convert(&c, 1, out);
+        }
+        t.finish(out);
+        REQUIRE(out == u8);
+    }
+
+    SECTION("Truncated input is replaced") {
+        utf_transcoder t{encoding::utf16be, encoding::utf8};
+        std::string out;
+        t.convert("\xD8\x3D\xDE", 3, out);
+        REQUIRE(out.empty());
+        t.finish(out);
+        REQUIRE(out == u8"��");
+    }
+
+    SECTION("Empty pieces keep incomplete input") {
+        utf_transcoder t{encoding::utf8, encoding::utf16le};
+        std::string out;
+        t.convert("\xC3", 1, out);
+        t.convert("", 0, out);
+        t.convert("\xA9", 1, out);
+        t.finish(out);
+        REQUIRE(out == std::string("\xE9\0", 2));
+
+        // Pieces of up to four bytes, with an empty piece between each
+        utf_transcoder t2{encoding::utf8, encoding::utf16be};
+        std::string out2;
+        for (std::size_t i = 0; i < u8.size(); i += i % 4 + 1) {
+            t2.convert("", 0, out2);
+            t2.convert(u8.data() + i, std::min(i % 4 + 1, u8.size() - i), out2);
+        }
+        t2.finish(out2);
+        REQUIRE(out2 == u16be);
+    }
+}
+
+TEST_CASE("bytes_view serialises code units in the requested byte order")
+{
+    const std::u16string str = u"a€";
+
+    const std::vector<unsigned char> le = {0x61, 0x00, 0xAC, 0x20};
+    const std::vector<unsigned char> be = {0x00, 0x61, 0x20, 0xAC};
+
+    REQUIRE(equal(as_bytes<byte_order::little>(str), le));
+    REQUIRE(equal(as_bytes<byte_order::big>(str), be));
+    REQUIRE(equal(as_bytes(str), byte_order::native == byte_order::little ? le : be));
+
+    decltype(as_bytes(str)) v{};
+    REQUIRE(v.begin() == v.end());
+}
+
+TEST_CASE("Text can be decoded from and encoded to byte buffers")
+{
+    const std::string u16le = to_bytes(u8, encoding::utf16le);
+    const std::string u16be = to_bytes(u32, encoding::utf16be);
+    const std::string u32le = to_bytes(u16, encoding::utf32le);
+    const std::string u32be = to_bytes(u8, encoding::utf32be);
+
+    auto to_string = [](const auto& view) {
+        return std::string(view.begin(), view.end());
+    };
+    REQUIRE(u16le == to_string(as_bytes<byte_order::little>(u16)));
+    REQUIRE(u16be == to_string(as_bytes<byte_order::big>(u16)));
+    REQUIRE(u32le == to_string(as_bytes<byte_order::little>(u32)));
+    REQUIRE(u32be == to_string(as_bytes<byte_order::big>(u32)));
+
+    REQUIRE(to_u8string(u16le.data(), u16le.size(), encoding::utf16le) == u8);
+    REQUIRE(to_u8string(u16be.data(), u16be.size(), encoding::utf16be) == u8);
+    REQUIRE(to_u16string(u32le.data(), u32le.size(), encoding::utf32le) == u16);
+    REQUIRE(to_u32string(u32be.data(), u32be.size(), encoding::utf32be) == u32);
+
+    const auto bytes = reinterpret_cast<const unsigned char*>(u16le.data());
+    REQUIRE(to_u32string(bytes, u16le.size(), encoding::utf16le) == u32);
+
+    // Truncated final code unit
+    REQUIRE(to_u8string(u16le.data(), 3, encoding::utf16le) == u8"$�");
+}
+
+TEST_CASE("Latin-1 text can be converted to and from UTF")
+{
+    const std::string latin1_str = "caf\xE9 \xA3" "5";
+    const std::string utf8_str = u8"café £5";
+
+    REQUIRE(to_u8string<latin1>(latin1_str) == utf8_str);
+    REQUIRE(to_u16string<latin1>(latin1_str) == u"café £5");
+    REQUIRE(to_u32string<latin1>(latin1_str) == U"café £5");
+    REQUIRE(to_u8string(as_utf8<latin1>(latin1_str)) == utf8_str);
+
+    REQUIRE(to_latin1(utf8_str) == latin1_str);
+    REQUIRE(to_latin1(std::u16string(u"café £5")) == latin1_str);
+    REQUIRE(to_latin1(std::u32string(U"a€b")) == "a?b");
+    REQUIRE(to_latin1(as_latin1(std::u16string(u"a€b"))) == "a?b");
+
+    // Long enough to exercise the word-at-a-time paths
+    std::string long_latin1;
+    for (int i = 0; i < 300; i++) {
+        long_latin1 += static_cast<char>(i & 0xFF);
+    }
+    const auto long_utf8 = to_u8string<latin1>(long_latin1);
+    REQUIRE(long_utf8.size() == 300 + 128);
+    REQUIRE(to_latin1(long_utf8) == long_latin1);
+    REQUIRE(to_latin1(to_u16string(long_utf8)) == long_latin1);
+    REQUIRE(to_latin1(to_u32string(long_utf8)) == long_latin1);
+}
+
+TEST_CASE("Checked Latin-1 conversion reports the first misfit")
+{
+    const auto ok = to_latin1_checked(std::string(u8"café"));
+    REQUIRE(ok);
+    REQUIRE(ok.text == "caf\xE9");
+
+    const auto bad = to_latin1_checked(std::u16string(u"ab€cd"));
+    REQUIRE_FALSE(bad);
+    REQUIRE(bad.error_position == 2);
+    REQUIRE(bad.text == "ab");
+
+    const auto bad8 = to_latin1_checked(std::string(u8"é€"));
+    REQUIRE(bad8.error_position == 2);
+    REQUIRE(bad8.text == "\xE9");
+}
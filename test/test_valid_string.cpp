@@ -0,0 +1,87 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/valid_string.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("validate_utf8 and validate_utf32 find ill-formed sequences")
+{
+    REQUIRE(validate_utf8(std::string(u8"$€你好😎")));
+    REQUIRE(validate_utf8(std::string()));
+
+    std::string long_str(100, 'x');
+    long_str += u8"€";
+    REQUIRE(validate_utf8(long_str));
+
+    for (const char* bad : {"\x80", "\xC0\x80", "\xE2\x82", "\xED\xA0\x80", "\xF4\x90\x80\x80"}) {
+        std::string str = long_str + bad + "yz";
+        REQUIRE_FALSE(validate_utf8(str));
+        REQUIRE(find_invalid_utf8(str.data(), str.data() + str.size()) ==
+                str.data() + long_str.size());
+    }
+
+    REQUIRE(validate_utf32(std::u32string(U"$€你好😎")));
+    for (std::size_t len : {1u, 16u, 17u, 40u}) {
+        for (char32_t bad : {char32_t(0xD800), char32_t(0xDFFF), char32_t(0x110000)}) {
+            std::u32string str(len, U'x');
+            str[len - 1] = bad;
+            REQUIRE_FALSE(validate_utf32(str));
+            REQUIRE(find_invalid_utf32(str.data(), str.data() + len) == str.data() + len - 1);
+        }
+    }
+}
+
+TEST_CASE("Valid strings replace ill-formed input on construction")
+{
+    const valid_utf8_string good{std::string(u8"$€你好😎")};
+    REQUIRE(good.str() == u8"$€你好😎");
+
+    const valid_utf8_string bad{std::string("a\xFF" "b")};
+    REQUIRE(bad.str() == u8"a�b");
+
+    const valid_utf16_string lone{std::u16string{u'a', char16_t(0xD800)}};
+    REQUIRE(lone.str() == u"a�");
+
+    // Input in another encoding is converted
+    const valid_utf16_string from8{std::string(u8"€😎")};
+    REQUIRE(from8.str() == u"€😎");
+
+    const valid_utf32_string from_view{good.view()};
+    REQUIRE(from_view.str() == U"$€你好😎");
+}
+
+TEST_CASE("Valid strings convert without re-validating")
+{
+    const valid_utf8_string s{std::string(u8"$€你好😎")};
+
+    REQUIRE(to_u16string(s) == u"$€你好😎");
+    REQUIRE(to_u32string(s) == U"$€你好😎");
+    REQUIRE(to_u8string(valid_utf32_string{s.view()}) == s.str());
+
+    const auto view = as_utf32(s);
+    REQUIRE(std::u32string(view.begin(), view.end()) == U"$€你好😎");
+
+    // Sequences crossing the boundary between conversion blocks
+    std::string big;
+    while (big.size() < 40000) {
+        big += u8"a€😎";
+    }
+    const valid_utf8_string big_valid{big};
+    REQUIRE(to_u16string(big_valid) == to_u16string(big));
+    REQUIRE(to_u32string(big_valid) == to_u32string(big));
+}
+
+TEST_CASE("make_valid_view reports the first ill-formed sequence")
+{
+    const std::string good = u8"$€你好😎";
+    const auto res = make_valid_view(good);
+    REQUIRE(res);
+    REQUIRE(res.view.size() == good.size());
+    REQUIRE(to_u32string(res.view) == U"$€你好😎");
+
+    const std::u16string bad{u'a', u'b', char16_t(0xDC00)};
+    const auto res2 = make_valid_view(bad);
+    REQUIRE_FALSE(res2);
+    REQUIRE(res2.error_position == 2);
+}
@@ -0,0 +1,48 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/validate.hpp>
+
+using namespace tcb::unicode;
+
+TEST_CASE("validate_utf16 finds lone surrogates")
+{
+    REQUIRE(validate_utf16(std::u16string(u"$€你好😎")));
+    REQUIRE(validate_utf16(std::u16string()));
+
+    for (std::size_t len : {1u, 15u, 16u, 17u, 40u}) {
+        for (std::size_t pos = 0; pos < len; pos++) {
+            std::u16string str(len, u'x');
+            str[pos] = 0xDC00;
+            REQUIRE_FALSE(validate_utf16(str));
+            REQUIRE(find_invalid_utf16(str.data(), str.data() + len) == str.data() + pos);
+
+            str[pos] = 0xD800;
+            REQUIRE(find_invalid_utf16(str.data(), str.data() + len) == str.data() + pos);
+
+            // A pair is fine anywhere, including across a block boundary
+            if (pos + 1 < len) {
+                str[pos + 1] = 0xDC00;
+                REQUIRE(validate_utf16(str));
+            }
+        }
+    }
+}
+
+TEST_CASE("to_well_formed_utf16 replaces lone surrogates in place")
+{
+    std::u16string str(40, u'a');
+    str[3] = 0xD800;                    // lone lead
+    str[15] = 0xD83D; str[16] = 0xDE0E; // pair across a block boundary
+    str[20] = 0xDC00;                   // lone trail
+    str[21] = 0xDC00;
+    str[39] = 0xD800;                   // lead at the end
+
+    std::u16string expected = str;
+    expected[3] = expected[20] = expected[21] = expected[39] = 0xFFFD;
+
+    REQUIRE(to_well_formed_utf16(str) == 4);
+    REQUIRE(str == expected);
+    REQUIRE(validate_utf16(str));
+    REQUIRE(to_well_formed_utf16(str) == 0);
+}
@@ -0,0 +1,89 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/width.hpp>
+
+#include <list>
+#include <string>
+
+using namespace tcb::unicode;
+
+TEST_CASE("ASCII text is one column per printable character")
+{
+    REQUIRE(display_width(std::string{}) == 0);
+    REQUIRE(display_width(std::string{"hello, world"}) == 12);
+    REQUIRE(display_width(std::string{"tab\there\r\n"}) == 7);
+    const std::string long_line(1000, 'x');
+    REQUIRE(display_width(long_line) == 1000);
+}
+
+TEST_CASE("Wide characters take two columns and marks none")
+{
+    REQUIRE(display_width(std::string{u8"日本語"}) == 6);
+    REQUIRE(display_width(std::string{u8"ｈｉ"}) == 4);
+    REQUIRE(display_width(std::string{u8"ﾊﾝｶｸ"}) == 4);
+    REQUIRE(display_width(std::string{u8"e\u0301te\u0301"}) == 3);
+    REQUIRE(display_width(std::string{u8"a\u200Bb\u00ADc"}) == 3);
+    // Conjoining jamo form one wide syllable
+    REQUIRE(display_width(std::string{u8"\u1100\u1161\u11A8"}) == 2);
+    // Ambiguous characters are narrow
+    REQUIRE(display_width(std::string{u8"±①"}) == 2);
+}
+
+TEST_CASE("Emoji are two columns wide")
+{
+    REQUIRE(display_width(std::string{u8"\U0001F600"}) == 2);
+    REQUIRE(display_width(std::string{u8"\U0001F468\u200D\U0001F469\u200D\U0001F467"}) == 2);
+    REQUIRE(display_width(std::string{u8"\U0001F44D\U0001F3FD"}) == 2);
+    REQUIRE(display_width(std::string{u8"\U0001F1EC\U0001F1E7"}) == 2);
+    // Text presentation by default, unless followed by VS16
+    REQUIRE(display_width(std::string{u8"\u2764"}) == 1);
+    REQUIRE(display_width(std::string{u8"\u2764\uFE0F"}) == 2);
+    REQUIRE(display_width(std::string{u8"#\uFE0F\u20E3!"}) == 3);
+}
+
+TEST_CASE("Width can be measured in any encoding")
+{
+    REQUIRE(display_width(std::u16string{u"日本 is Japan"}) == 13);
+    REQUIRE(display_width(std::u32string{U"\U0001F600x"}) == 3);
+    const std::list<char> list = {'a', '\xE3', '\x81', '\x82'};
+    REQUIRE(display_width(list) == 3);
+    const std::string cafe = "caf\xE9";
+    REQUIRE(display_width<latin1>(cafe) == 4);
+    // Ill-formed sequences are U+FFFD
+    REQUIRE(display_width(std::string{"a\xFF"}) == 2);
+}
+
+TEST_CASE("find_width_boundary stops before the cluster which does not fit")
+{
+    const std::string str = u8"ab日本e\u0301";
+    REQUIRE(find_width_boundary(str.begin(), str.end(), 0) == str.begin());
+    REQUIRE(find_width_boundary(str.begin(), str.end(), 3) == str.begin() + 2);
+    REQUIRE(find_width_boundary(str.begin(), str.end(), 4) == str.begin() + 5);
+    REQUIRE(find_width_boundary(str.data(), str.data() + str.size(), 7) ==
+            str.data() + str.size());
+    // A trailing mark stays with its base
+    const std::string marked = u8"abce\u0301";
+    REQUIRE(find_width_boundary(marked.data(), marked.data() + marked.size(), 3) ==
+            marked.data() + 3);
+}
+
+TEST_CASE("truncate_to_width cuts at a cluster boundary and adds an ellipsis")
+{
+    const std::string str = "The quick brown fox";
+    REQUIRE(truncate_to_width(str, 19, "...") == str);
+    REQUIRE(truncate_to_width(str, 100) == str);
+    REQUIRE(truncate_to_width(str, 9) == "The quick");
+    REQUIRE(truncate_to_width(str, 9, "...") == "The qu...");
+    REQUIRE(truncate_to_width(str, 9, std::string{u8"\u2026"}) == u8"The quic\u2026");
+    REQUIRE(truncate_to_width(str, 2, "...") == "..");
+
+    // A wide character which does not fit is left out
+    const std::string cjk = u8"日本語のテキスト";
+    REQUIRE(truncate_to_width(cjk, 7, u8"\u2026") == u8"日本語\u2026");
+    REQUIRE(truncate_to_width(cjk, 6, u8"\u2026") == u8"日本\u2026");
+    REQUIRE(truncate_to_width(std::string{u8"\U0001F1EC\U0001F1E7\U0001F1EB\U0001F1F7"}, 3) ==
+            u8"\U0001F1EC\U0001F1E7");
+    REQUIRE(truncate_to_width(std::u16string{u"e\u0301e\u0301e\u0301"}, 2, u".") ==
+            u"e\u0301.");
+}
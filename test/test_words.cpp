@@ -0,0 +1,108 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/words.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace tcb::unicode;
+
+namespace {
+
+template <typename String>
+std::vector<String> split_words(const String& str)
+{
+    std::vector<String> result;
+    for (const auto& w : words(str))
+        result.push_back(String(w.begin(), w.end()));
+    return result;
+}
+
+using strings = std::vector<std::string>;
+
+}
+
+TEST_CASE("ASCII words are split at spaces and punctuation")
+{
+    REQUIRE(split_words(std::string{}).empty());
+    REQUIRE((split_words(std::string{"The quick  fox."}) ==
+             strings{"The", " ", "quick", "  ", "fox", "."}));
+    REQUIRE((split_words(std::string{"a_b c2d 42"}) == strings{"a_b", " ", "c2d", " ", "42"}));
+    REQUIRE((split_words(std::string{"a\r\n\nb"}) == strings{"a", "\r\n", "\n", "b"}));
+    REQUIRE((split_words(std::string{"(hi)!"}) == strings{"(", "hi", ")", "!"}));
+}
+
+TEST_CASE("Punctuation within words and numbers does not break them")
+{
+    REQUIRE((split_words(std::string{"can't e.g. end."}) ==
+             strings{"can't", " ", "e.g", ".", " ", "end", "."}));
+    REQUIRE((split_words(std::string{"3.14 1,000,000 a:b"}) ==
+             strings{"3.14", " ", "1,000,000", " ", "a:b"}));
+    // Punctuation not followed by a letter or digit
+    REQUIRE((split_words(std::string{"can'"}) == strings{"can", "'"}));
+    REQUIRE((split_words(std::string{"1..2"}) == strings{"1", ".", ".", "2"}));
+    REQUIRE((split_words(std::string{"a.1"}) == strings{"a", ".", "1"}));
+}
+
+TEST_CASE("Non-ASCII words")
+{
+    // Marks and format characters are skipped over
+    REQUIRE((split_words(std::string{u8"cafe\u0301 na\u00ADive"}) ==
+             strings{u8"cafe\u0301", " ", u8"na\u00ADive"}));
+    REQUIRE((split_words(std::string{u8"d\u0301'\u0301a"}) == strings{u8"d\u0301'\u0301a"}));
+    // Hebrew letters, katakana and ideographs
+    REQUIRE((split_words(std::string{u8"א\"ב א'"}) ==
+             strings{u8"א\"ב", " ", u8"א'"}));
+    REQUIRE((split_words(std::string{u8"カタカナひら"}) ==
+             strings{u8"カタカナ", u8"ひ", u8"ら"}));
+    REQUIRE((split_words(std::string{u8"中文"}) == strings{u8"中", u8"文"}));
+    // Emoji ZWJ sequences and flags
+    REQUIRE((split_words(std::string{u8"\U0001F468\u200D\U0001F469 "}) ==
+             strings{u8"\U0001F468\u200D\U0001F469", " "}));
+    REQUIRE((split_words(std::string{u8"\U0001F1EC\U0001F1E7\U0001F1EB\U0001F1F7\U0001F1EB"}) ==
+             strings{u8"\U0001F1EC\U0001F1E7", u8"\U0001F1EB\U0001F1F7", u8"\U0001F1EB"}));
+}
+
+TEST_CASE("Pictographic letters join words")
+{
+    // U+2139, U+24C2 and U+1F170 are both Extended_Pictographic and ALetter
+    REQUIRE((split_words(std::string{u8"_\u2139 \u24C21 \U0001F170a"}) ==
+             strings{u8"_\u2139", " ", u8"\u24C21", " ", u8"\U0001F170a"}));
+}
+
+TEST_CASE("Words can be found in UTF-16 and UTF-32")
+{
+    REQUIRE((split_words(std::u16string{u"l'été, 2.5"}) ==
+             std::vector<std::u16string>{u"l'été", u",", u" ", u"2.5"}));
+    REQUIRE((split_words(std::u32string{U"\U0001D400\U0001D401 x"}) ==
+             std::vector<std::u32string>{U"\U0001D400\U0001D401", U" ", U"x"}));
+}
+
+TEST_CASE("is_word_segment distinguishes words from the text between them")
+{
+    const std::string str = u8"Hello, 世界! 42 \U0001F600";
+    std::vector<bool> is_word;
+    for (const auto& w : words(str))
+        is_word.push_back(is_word_segment(w));
+    REQUIRE((is_word == std::vector<bool>{true, false, false, true, true, false, false, true,
+                                          false, false}));
+}
+
+TEST_CASE("is_word_segment decodes in the encoding of the view")
+{
+    // As UTF-8 these bytes are ill-formed, and U+FFFD is not a letter
+    const std::string str = "\xE9t\xE9 \xE9";
+    std::vector<bool> is_word;
+    for (const auto& w : words<latin1>(str))
+        is_word.push_back(is_word_segment(w));
+    REQUIRE((is_word == std::vector<bool>{true, false, true}));
+}
+
+TEST_CASE("next_word_boundary finds the end of one segment")
+{
+    const std::string str = "don't stop";
+    REQUIRE(next_word_boundary(str.begin(), str.end()) == str.begin() + 5);
+    REQUIRE(next_word_boundary(str.begin() + 5, str.end()) == str.begin() + 6);
+    REQUIRE(next_word_boundary(str.end(), str.end()) == str.end());
+}
@@ -0,0 +1,94 @@
+
+#include "catch.hpp"
+
+#include <tcb/unicode/wtf8.hpp>
+
+using namespace tcb::unicode;
+
+namespace {
+
+// "a", a lone lead surrogate, "b", U+1F60E, a lone trail surrogate
+const std::u16string lone = {u'a', 0xD800, u'b', 0xD83D, 0xDE0E, 0xDC00};
+const std::string lone_wtf8 = "a\xED\xA0\x80" "b\xF0\x9F\x98\x8E\xED\xB0\x80";
+const std::string lone_mutf8 = "a\xED\xA0\x80" "b\xED\xA0\xBD\xED\xB8\x8E\xED\xB0\x80";
+
+}
+
+TEST_CASE("WTF-8 round trips lone surrogates")
+{
+    REQUIRE((transcode<wtf8, wtf16>(lone)) == lone_wtf8);
+    REQUIRE((transcode<wtf16, wtf8>(lone_wtf8)) == lone);
+    REQUIRE(to_u32string<wtf8>(lone_wtf8) == U"a�b😎�");
+
+    // Converting to UTF replaces the surrogates
+    REQUIRE(to_u8string<wtf16>(lone) == u8"a�b😎�");
+    REQUIRE(to_u8string(as_utf8<wtf16>(lone)) == u8"a�b😎�");
+
+    // Well-formed text is the same in WTF-8 as in UTF-8
+    const std::string utf8 = u8"$€你好😎";
+    REQUIRE((transcode<wtf8, char>(utf8)) == utf8);
+    REQUIRE(to_u16string<wtf8>(utf8) == u"$€你好😎");
+}
+
+TEST_CASE("A surrogate pair split across blocks is reassembled")
+{
+    std::u16string long_str(5000, u'x');
+    long_str += lone;
+    long_str.insert(4095, 1, 0xD83D);
+    long_str.insert(4096, 1, 0xDE0E);
+
+    const std::string wtf = transcode<wtf8, wtf16>(long_str);
+    REQUIRE(wtf.substr(4095, 4) == "\xF0\x9F\x98\x8E");
+    REQUIRE((transcode<wtf16, wtf8>(wtf)) == long_str);
+}
+
+TEST_CASE("CESU-8 encodes supplementary characters as surrogate pairs")
+{
+    const std::string cesu = "a\xED\xA0\xBD\xED\xB8\x8E" "b";
+    REQUIRE(to_u16string<cesu8>(cesu) == u"a😎b");
+    REQUIRE((transcode<cesu8, char>(std::string(u8"a😎b"))) == cesu);
+
+    // Four-byte forms and lone surrogates are ill-formed
+    REQUIRE(to_u8string<cesu8>(std::string("\xF0\x9F\x98\x8E" "a")) == u8"����a");
+    REQUIRE(to_u8string<cesu8>(std::string("\xED\xA0\x80" "a")) == u8"�a");
+}
+
+TEST_CASE("Modified UTF-8 encodes NUL as two bytes")
+{
+    const std::u16string with_nul = {u'a', 0, u'b'};
+    const std::string mutf = "a\xC0\x80" "b";
+
+    REQUIRE((transcode<mutf8, char16_t>(with_nul)) == mutf);
+    REQUIRE(to_u16string<mutf8>(mutf) == with_nul);
+    REQUIRE(to_u8string(as_utf8<mutf8>(mutf)) == std::string("a\0b", 3));
+
+    std::string long_ascii(300, 'z');
+    long_ascii[150] = '\0';
+    const std::string long_mutf = transcode<mutf8, char>(long_ascii);
+    REQUIRE(long_mutf.size() == 301);
+    REQUIRE(long_mutf.substr(150, 2) == "\xC0\x80");
+
+    REQUIRE((transcode<mutf8, wtf16>(lone)) == lone_mutf8);
+    REQUIRE((transcode<wtf16, mutf8>(lone_mutf8)) == lone);
+
+    // Views encode through the traits too
+    const auto view = as_utf8<mutf8>(lone_mutf8);
+    REQUIRE(std::string(view.begin(), view.end()) == u8"a�b😎�");
+}
+
+TEST_CASE("WTF-8 rejects a surrogate pair written as two sequences")
+{
+    const std::u16string pair = {u'a', 0xD83D, 0xDE00, u'b'};
+    const std::string pair_wtf8 = transcode<wtf8, wtf16>(pair);
+    REQUIRE(pair_wtf8 == "a\xF0\x9F\x98\x80" "b");
+    REQUIRE((transcode<wtf16, wtf8>(pair_wtf8)) == pair);
+
+    // The CESU-8 form of the pair is not WTF-8
+    const std::string cesu = "a\xED\xA0\xBD\xED\xB8\x80" "b";
+    REQUIRE((transcode<wtf16, wtf8>(cesu)) == u"a�b");
+    REQUIRE(to_u8string<wtf8>(cesu) == u8"a�b");
+
+    // A lead surrogate followed by something other than a trail is kept
+    const std::string lead_then_text = "\xED\xA0\xBD" "a\xED\xA0\xBD";
+    REQUIRE((transcode<wtf16, wtf8>(lead_then_text)) == (std::u16string{0xD83D, u'a', 0xD83D}));
+}
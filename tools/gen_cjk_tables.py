@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016 Tristan Brindle (tcbrindle at gmail dot com)
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+"""Generates include/tcb/unicode/detail/cjk_tables.hpp from the mappings
+shipped with Python's codecs module.
+
+Each mapping is stored as a two-stage table over a 16-bit key: an index of
+block numbers, followed by the deduplicated blocks themselves. The block
+size is chosen separately for each table to minimise its total size.
+
+Usage: gen_cjk_tables.py > include/tcb/unicode/detail/cjk_tables.hpp
+"""
+
+import sys
+
+# (C++ name, Python codec, description)
+ENCODINGS = [
+    ("shift_jis", "shift_jis", "Shift_JIS (JIS X 0201 and JIS X 0208)"),
+    ("gb18030", "gb18030", "GB18030 one- and two-byte codes (a superset of GBK)"),
+    ("euc_kr", "euc_kr", "EUC-KR (KS X 1001)"),
+]
+
+UNMAPPED_DECODE = 0xFFFD
+UNMAPPED_ENCODE = 0
+
+
+def bmp():
+    for c in range(0x80, 0x10000):
+        if not 0xD800 <= c <= 0xDFFF:
+            yield c
+
+
+def mappings(codec):
+    """Returns {code_point: code}, where code is the byte sequence as a
+    big-endian integer, for all one- and two-byte non-ASCII codes"""
+    result = {}
+    for c in bmp():
+        try:
+            b = chr(c).encode(codec)
+        except UnicodeEncodeError:
+            continue
+        if len(b) <= 2:
+            result[c] = int.from_bytes(b, "big")
+    return result
+
+
+def decodings(codec):
+    """Returns {code: code_point} for every one- and two-byte code which
+    decodes to a single code point"""
+    result = {}
+    for code in range(0x80, 0x10000):
+        b = code.to_bytes(2 if code > 0xFF else 1, "big")
+        if len(b) == 2 and b[0] < 0x80:
+            continue
+        try:
+            s = b.decode(codec)
+        except UnicodeDecodeError:
+            continue
+        if len(s) == 1 and ord(s) <= 0xFFFF and ord(s) >= 0x80:
+            result[code] = ord(s)
+    return result
+
+
+def two_stage(values, default):
+    """Splits a 65536-entry table into (shift, index, data), choosing the
+    block size which minimises the total size"""
+    best = None
+    for shift in range(3, 11):
+        size = 1 << shift
+        blocks = {}
+        data = []
+        index = []
+        for start in range(0, 0x10000, size):
+            block = tuple(values.get(k, default) for k in range(start, start + size))
+            if block not in blocks:
+                blocks[block] = len(blocks)
+                data.extend(block)
+            index.append(blocks[block])
+        total = 2 * len(index) + 2 * len(data)
+        if best is None or total < best[0]:
+            best = (total, shift, index, data)
+    assert len(best[3]) <= 0x10000 * 4
+    return best[1], best[2], best[3]
+
+
+def gb18030_ranges():
+    """Returns (linear, code_point, length) runs for the BMP code points
+    which GB18030 encodes with four bytes"""
+    runs = []
+    for c in bmp():
+        b = chr(c).encode("gb18030")
+        if len(b) != 4:
+            continue
+        linear = (((b[0] - 0x81) * 10 + (b[1] - 0x30)) * 126 + (b[2] - 0x81)) * 10 + (b[3] - 0x30)
+        if runs and runs[-1][0] + runs[-1][2] == linear and runs[-1][1] + runs[-1][2] == c:
+            runs[-1][2] += 1
+        else:
+            assert not runs or (linear > runs[-1][0] and c > runs[-1][1])
+            runs.append([linear, c, 1])
+    return runs
+
+
+def format_array(values, fmt, per_line, indent="            "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def emit_array(out, ctype, name, values, fmt, per_line):
+    out.write("""
+    static const {ctype}* {name}()
+    {{
+        static constexpr {ctype} table[{n}] = {{
+{values}
+        }};
+        return table;
+    }}
+""".format(ctype=ctype, name=name, n=len(values),
+           values=format_array(values, fmt, per_line)))
+
+
+def main():
+    out = sys.stdout
+    out.write("""
+// Generated by tools/gen_cjk_tables.py -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_CJK_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_CJK_TABLES_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+namespace detail {
+
+// Each table provides two two-stage lookups over 16-bit keys, where the
+// value for key k is data[(index[k >> shift] << shift) + (k & mask)]:
+//  - decode_*: from a non-ASCII one-byte code, or a two-byte code as
+//    (lead << 8 | trail), to a BMP code point, or U+FFFD if unmapped
+//  - encode_*: from a non-ASCII BMP code point to its one- or two-byte
+//    code, or zero if unmapped
+""")
+    for name, codec, desc in ENCODINGS:
+        dec_shift, dec_index, dec_data = two_stage(decodings(codec), UNMAPPED_DECODE)
+        enc_shift, enc_index, enc_data = two_stage(mappings(codec), UNMAPPED_ENCODE)
+        out.write("\n// {}\nstruct {}_table {{\n".format(desc, name))
+        out.write("    static constexpr int decode_shift = {};\n".format(dec_shift))
+        emit_array(out, "std::uint16_t", "decode_index", dec_index, "{}", 16)
+        emit_array(out, "char16_t", "decode_data", dec_data, "0x{:04X}", 8)
+        out.write("\n    static constexpr int encode_shift = {};\n".format(enc_shift))
+        emit_array(out, "std::uint16_t", "encode_index", enc_index, "{}", 16)
+        emit_array(out, "std::uint16_t", "encode_data", enc_data, "0x{:04X}", 8)
+        if codec == "gb18030":
+            runs = gb18030_ranges()
+            out.write("""
+    // Runs of BMP code points with four-byte codes, as (linear index,
+    // first code point, length), in increasing order of both
+    static constexpr std::size_t four_byte_ranges_size = {};
+""".format(len(runs)))
+            emit_array(out, "std::uint32_t", "four_byte_ranges",
+                       [v for r in runs for v in r], "{}", 12)
+        out.write("};\n")
+
+    out.write("""
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
+""")
+
+
+if __name__ == "__main__":
+    main()
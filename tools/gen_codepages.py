@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016 Tristan Brindle (tcbrindle at gmail dot com)
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+"""Generates include/tcb/unicode/detail/codepage_tables.hpp from the code
+page mappings shipped with Python's codecs module.
+
+Usage: gen_codepages.py > include/tcb/unicode/detail/codepage_tables.hpp
+"""
+
+import codecs
+import sys
+
+# (C++ name, Python codec, description)
+CODEPAGES = [
+    ("cp874", "cp874", "Windows-874 (Thai)"),
+    ("cp1250", "cp1250", "Windows-1250 (Central European)"),
+    ("cp1251", "cp1251", "Windows-1251 (Cyrillic)"),
+    ("cp1252", "cp1252", "Windows-1252 (Western European)"),
+    ("cp1253", "cp1253", "Windows-1253 (Greek)"),
+    ("cp1254", "cp1254", "Windows-1254 (Turkish)"),
+    ("cp1255", "cp1255", "Windows-1255 (Hebrew)"),
+    ("cp1256", "cp1256", "Windows-1256 (Arabic)"),
+    ("cp1257", "cp1257", "Windows-1257 (Baltic)"),
+    ("cp1258", "cp1258", "Windows-1258 (Vietnamese)"),
+    ("iso8859_2", "iso8859_2", "ISO-8859-2 (Latin-2)"),
+    ("iso8859_3", "iso8859_3", "ISO-8859-3 (Latin-3)"),
+    ("iso8859_4", "iso8859_4", "ISO-8859-4 (Latin-4)"),
+    ("iso8859_5", "iso8859_5", "ISO-8859-5 (Cyrillic)"),
+    ("iso8859_6", "iso8859_6", "ISO-8859-6 (Arabic)"),
+    ("iso8859_7", "iso8859_7", "ISO-8859-7 (Greek)"),
+    ("iso8859_8", "iso8859_8", "ISO-8859-8 (Hebrew)"),
+    ("iso8859_9", "iso8859_9", "ISO-8859-9 (Latin-5)"),
+    ("iso8859_10", "iso8859_10", "ISO-8859-10 (Latin-6)"),
+    ("iso8859_11", "iso8859_11", "ISO-8859-11 (Thai)"),
+    ("iso8859_13", "iso8859_13", "ISO-8859-13 (Latin-7)"),
+    ("iso8859_14", "iso8859_14", "ISO-8859-14 (Latin-8)"),
+    ("iso8859_15", "iso8859_15", "ISO-8859-15 (Latin-9)"),
+    ("iso8859_16", "iso8859_16", "ISO-8859-16 (Latin-10)"),
+    ("koi8_r", "koi8_r", "KOI8-R (Russian)"),
+    ("koi8_u", "koi8_u", "KOI8-U (Ukrainian)"),
+]
+
+UNDEFINED = 0xFFFD
+
+
+def decode_table(codec):
+    table = []
+    for b in range(256):
+        try:
+            s = bytes([b]).decode(codec)
+        except UnicodeDecodeError:
+            table.append(UNDEFINED)
+            continue
+        assert len(s) == 1 and ord(s) <= 0xFFFF and ord(s) != UNDEFINED
+        table.append(ord(s))
+    assert table[:128] == list(range(128)), codec + " is not ASCII compatible"
+    return table
+
+
+def reverse_table(table):
+    seen = {}
+    for b in range(128, 256):
+        c = table[b]
+        if c != UNDEFINED and c not in seen:
+            seen[c] = b
+    return sorted((c << 8) | b for c, b in seen.items())
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("            " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = sys.stdout
+    out.write("""
+// Generated by tools/gen_codepages.py -- do not edit
+
+#ifndef TCB_UNICODE_DETAIL_CODEPAGE_TABLES_HPP_INCLUDED
+#define TCB_UNICODE_DETAIL_CODEPAGE_TABLES_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tcb {
+namespace unicode {
+namespace detail {
+
+// Each table provides:
+//  - to_unicode(): 256 entries mapping each byte to a BMP code point, with
+//    U+FFFD for bytes the code page leaves undefined
+//  - from_unicode(): the defined non-ASCII bytes as (code_point << 8 | byte),
+//    sorted for binary search
+""")
+    for name, codec, desc in CODEPAGES:
+        table = decode_table(codec)
+        rev = reverse_table(table)
+        out.write("""
+// {desc}
+struct {name}_table {{
+    static const char16_t* to_unicode()
+    {{
+        static constexpr char16_t table[256] = {{
+{decode}
+        }};
+        return table;
+    }}
+
+    static constexpr std::size_t from_unicode_size = {n};
+
+    static const std::uint32_t* from_unicode()
+    {{
+        static constexpr std::uint32_t table[from_unicode_size] = {{
+{encode}
+        }};
+        return table;
+    }}
+}};
+""".format(desc=desc, name=name, n=len(rev),
+           decode=format_array(table, "0x{:04X}", 8),
+           encode=format_array(rev, "0x{:06X}", 6)))
+
+    out.write("""
+} // end namespace detail
+} // end namespace unicode
+} // end namespace tcb
+
+#endif
+""")
+
+
+if __name__ == "__main__":
+    main()
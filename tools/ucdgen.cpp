@@ -0,0 +1,983 @@
+// Copyright (c) 2016 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Generates the Unicode property tables in include/tcb/unicode/detail from
+// the Unicode Character Database files in data/ucd.
+//
+// Each table maps code points to small integers through a multi-stage
+// lookup: the code point is split into fields, and each field but the last
+// selects a deduplicated block of the next stage. Both two- and three-stage
+// layouts are tried with every block size, and the smallest (counting the
+// narrowest element type that fits each stage) is written out.
+//
+// Usage: tcb-ucdgen <ucd directory> <output directory>
+// or build the `generate_tables` target.
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::uint32_t max_code_point = 0x10FFFF;
+
+struct ucd_range {
+    std::uint32_t first;
+    std::uint32_t last;
+    std::string value;
+    std::string value2; // A further field, as in "0300 ; NFC_QC; M"
+};
+
+std::string trim(const std::string& s)
+{
+    const auto first = s.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+        return {};
+    const auto last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+std::vector<std::string> split_fields(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::istringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, ';'))
+        fields.push_back(trim(field));
+    return fields;
+}
+
+std::ifstream open_ucd_file(const std::string& dir, const std::string& name)
+{
+    std::ifstream in(dir + "/" + name);
+    if (!in)
+        throw std::runtime_error("cannot open " + dir + "/" + name);
+    return in;
+}
+
+/// Reads a UCD property file of lines "XXXX..YYYY ; Value # comment"
+std::vector<ucd_range> parse_ranges(const std::string& dir, const std::string& name)
+{
+    std::ifstream in = open_ucd_file(dir, name);
+    std::vector<ucd_range> ranges;
+    std::string line;
+    while (std::getline(in, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+        const auto fields = split_fields(line);
+        const auto dots = fields[0].find("..");
+        ucd_range r;
+        r.first = static_cast<std::uint32_t>(std::stoul(fields[0].substr(0, dots), nullptr, 16));
+        r.last = dots == std::string::npos
+                     ? r.first
+                     : static_cast<std::uint32_t>(std::stoul(fields[0].substr(dots + 2), nullptr, 16));
+        r.value = fields.size() > 1 ? fields[1] : std::string{};
+        r.value2 = fields.size() > 2 ? fields[2] : std::string{};
+        ranges.push_back(r);
+    }
+    return ranges;
+}
+
+/// Reads UnicodeData.txt, calling f(first, last, fields) for each entry,
+/// where a <..., First> and <..., Last> pair gives a range
+template <typename Func>
+void for_each_unicode_data(const std::string& dir, Func f)
+{
+    std::ifstream in = open_ucd_file(dir, "UnicodeData.txt");
+    std::string line;
+    std::uint32_t range_start = 0;
+    bool in_range = false;
+    while (std::getline(in, line)) {
+        if (line.empty())
+            continue;
+        const auto fields = split_fields(line);
+        const auto cp = static_cast<std::uint32_t>(std::stoul(fields[0], nullptr, 16));
+        const std::string& name = fields[1];
+        if (name.size() > 8 && name.compare(name.size() - 8, 8, ", First>") == 0) {
+            range_start = cp;
+            in_range = true;
+            continue;
+        }
+        f(in_range ? range_start : cp, cp, fields);
+        in_range = false;
+    }
+}
+
+// Multi-stage tables
+
+struct staged_table {
+    // From the top stage down; the last is the size of the leaf blocks
+    std::vector<int> shifts;
+    std::vector<std::vector<std::uint32_t>> stages;
+};
+
+int element_size(const std::vector<std::uint32_t>& values)
+{
+    const auto m = values.empty() ? 0 : *std::max_element(values.begin(), values.end());
+    return m <= 0xFF ? 1 : m <= 0xFFFF ? 2 : 4;
+}
+
+const char* element_type(const std::vector<std::uint32_t>& values)
+{
+    switch (element_size(values)) {
+    case 1: return "std::uint8_t";
+    case 2: return "std::uint16_t";
+    default: return "std::uint32_t";
+    }
+}
+
+std::size_t table_size(const staged_table& t)
+{
+    std::size_t total = 0;
+    for (const auto& s : t.stages)
+        total += s.size() * static_cast<std::size_t>(element_size(s));
+    return total;
+}
+
+/// Splits values into deduplicated blocks of 1 << shift, returning the
+/// block number of each block and the distinct blocks, concatenated
+void split_blocks(const std::vector<std::uint32_t>& values, int shift,
+                  std::vector<std::uint32_t>& index, std::vector<std::uint32_t>& data)
+{
+    const std::size_t size = std::size_t{1} << shift;
+    std::map<std::vector<std::uint32_t>, std::uint32_t> blocks;
+    index.clear();
+    data.clear();
+    for (std::size_t start = 0; start < values.size(); start += size) {
+        const auto end = std::min(start + size, values.size());
+        std::vector<std::uint32_t> block(values.begin() + static_cast<std::ptrdiff_t>(start),
+                                         values.begin() + static_cast<std::ptrdiff_t>(end));
+        const auto it = blocks.emplace(std::move(block), static_cast<std::uint32_t>(blocks.size()));
+        if (it.second)
+            data.insert(data.end(), it.first->first.begin(), it.first->first.end());
+        index.push_back(it.first->second);
+    }
+}
+
+/// Finds the smallest two- or three-stage layout of values
+staged_table compress(const std::vector<std::uint32_t>& values)
+{
+    staged_table best;
+    std::size_t best_size = SIZE_MAX;
+    std::vector<std::uint32_t> index, leaves, top, middle;
+
+    for (int leaf_shift = 2; leaf_shift <= 12; leaf_shift++) {
+        split_blocks(values, leaf_shift, index, leaves);
+
+        staged_table two{{leaf_shift}, {index, leaves}};
+        if (table_size(two) < best_size) {
+            best_size = table_size(two);
+            best = two;
+        }
+
+        for (int mid_shift = 2; mid_shift <= 10; mid_shift++) {
+            split_blocks(index, mid_shift, top, middle);
+            staged_table three{{mid_shift, leaf_shift}, {top, middle, leaves}};
+            if (table_size(three) < best_size) {
+                best_size = table_size(three);
+                best = std::move(three);
+            }
+        }
+    }
+    return best;
+}
+
+// Output
+
+void write_array(std::ostream& out, const char* ctype, const std::string& name,
+                 const std::vector<std::uint32_t>& values, bool hex, int per_line)
+{
+    out << "\n    static constexpr " << ctype << ' ' << name << '[' << values.size() << "] = {\n";
+    char buf[16];
+    for (std::size_t i = 0; i < values.size(); i++) {
+        if (i % static_cast<std::size_t>(per_line) == 0)
+            out << "        ";
+        std::snprintf(buf, sizeof(buf), hex ? "0x%08X" : "%u", values[i]);
+        out << buf << ',';
+        out << ((i + 1) % static_cast<std::size_t>(per_line) == 0 || i + 1 == values.size() ? "\n" : " ");
+    }
+    out << "    };\n";
+}
+
+void write_member_definition(std::ostream& out, const std::string& ctype,
+                             const std::string& name, const std::string& member)
+{
+    out << "\ntemplate <typename T>\nconstexpr " << ctype << ' ' << name << "_tables<T>::" << member << ";\n";
+}
+
+///
+/// Writes a lookup table struct `name_tables` and a function
+/// `name_lookup(c)` returning results[values[c]], or results[0] for values
+/// above U+10FFFF. If `results` is empty, the lookup returns values[c]
+/// itself, or zero.
+///
+void write_staged_table(std::ostream& out, const std::string& name,
+                        const std::vector<std::uint32_t>& values,
+                        const char* result_type, const std::vector<std::uint32_t>& results)
+{
+    const staged_table t = compress(values);
+    const bool three = t.stages.size() == 3;
+
+    std::cerr << name << ": " << t.stages.size() << " stages, shifts";
+    for (int s : t.shifts)
+        std::cerr << ' ' << s;
+    std::cerr << ", " << table_size(t) + results.size() * 4 << " bytes\n";
+
+    const bool direct = results.empty();
+    if (three) {
+        out << (direct ? R"(
+// The value for code point c is
+//   stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                  ((c >> shift2) & mask1)] << shift2) + (c & mask2)]
+)" : R"(
+// The value for code point c is
+//   results[stage3[(stage2[(stage1[c >> (shift1 + shift2)] << shift1) +
+//                          ((c >> shift2) & mask1)] << shift2) + (c & mask2)]]
+)");
+    }
+    else {
+        out << (direct ? R"(
+// The value for code point c is
+//   stage2[(stage1[c >> shift2] << shift2) + (c & mask2)]
+)" : R"(
+// The value for code point c is
+//   results[stage2[(stage1[c >> shift2] << shift2) + (c & mask2)]]
+)");
+    }
+    out << "// The tables are static members of a class template so that they may be\n"
+           "// defined in a header and used in constant expressions.\n"
+           "template <typename = void>\n"
+           "struct " << name << "_tables {\n";
+    if (three)
+        out << "    static constexpr int shift1 = " << t.shifts[0] << ";\n";
+    out << "    static constexpr int shift2 = " << t.shifts.back() << ";\n";
+
+    const std::vector<std::string> stage_names = three
+        ? std::vector<std::string>{"stage1", "stage2", "stage3"}
+        : std::vector<std::string>{"stage1", "stage2"};
+    for (std::size_t i = 0; i < t.stages.size(); i++)
+        write_array(out, element_type(t.stages[i]), stage_names[i], t.stages[i], false, 16);
+    if (!direct) {
+        write_array(out, result_type, "results", results,
+                    std::string(result_type) == "std::uint32_t", 6);
+    }
+    out << "};\n";
+
+    if (three)
+        write_member_definition(out, "int", name, "shift1");
+    write_member_definition(out, "int", name, "shift2");
+    for (std::size_t i = 0; i < t.stages.size(); i++)
+        write_member_definition(out, element_type(t.stages[i]), name, stage_names[i] + "[]");
+    if (!direct)
+        write_member_definition(out, result_type, name, "results[]");
+
+    out << "\nconstexpr " << result_type << ' ' << name << "_lookup(char32_t c)\n"
+        << "{\n"
+        << "    using t = " << name << "_tables<>;\n";
+    if (direct && three) {
+        out << R"(    return c > 0x10FFFF ? 0 :
+        t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                  (c & ((1u << t::shift2) - 1))];
+)";
+    }
+    else if (direct) {
+        out << R"(    return c > 0x10FFFF ? 0 :
+        t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> t::shift2]) << t::shift2) +
+                  (c & ((1u << t::shift2) - 1))];
+)";
+    }
+    else if (three) {
+        out << R"(    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage3[(static_cast<std::uint32_t>(
+            t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> (t::shift1 + t::shift2)]) << t::shift1) +
+                      ((c >> t::shift2) & ((1u << t::shift1) - 1))]) << t::shift2) +
+                   (c & ((1u << t::shift2) - 1))]];
+)";
+    }
+    else {
+        out << R"(    return c > 0x10FFFF ? t::results[0] :
+        t::results[t::stage2[(static_cast<std::uint32_t>(t::stage1[c >> t::shift2]) << t::shift2) +
+                             (c & ((1u << t::shift2) - 1))]];
+)";
+    }
+    out << "}\n";
+}
+
+void write_header_start(std::ostream& out, const std::string& guard)
+{
+    out << "\n// Generated by tools/ucdgen.cpp -- do not edit\n\n"
+        << "#ifndef " << guard << "\n#define " << guard << "\n\n#include <cstdint>\n\n"
+        << "namespace tcb {\nnamespace unicode {\n";
+}
+
+void write_header_end(std::ostream& out)
+{
+    out << "\n} // end namespace detail\n} // end namespace unicode\n} // end namespace tcb\n\n#endif\n";
+}
+
+/// Replaces the file at path with contents, unless they are the same
+void update_file(const std::string& path, const std::string& contents)
+{
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::ostringstream old;
+        old << in.rdbuf();
+        if (in && old.str() == contents) {
+            std::cerr << path << " is up to date\n";
+            return;
+        }
+    }
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    if (!out)
+        throw std::runtime_error("cannot write " + path);
+    std::cerr << "wrote " << path << '\n';
+}
+
+// General properties
+
+const std::vector<std::pair<std::string, std::string>> general_categories = {
+    {"Lu", "uppercase_letter"}, {"Ll", "lowercase_letter"},
+    {"Lt", "titlecase_letter"}, {"Lm", "modifier_letter"},
+    {"Lo", "other_letter"}, {"Mn", "nonspacing_mark"},
+    {"Mc", "spacing_mark"}, {"Me", "enclosing_mark"},
+    {"Nd", "decimal_number"}, {"Nl", "letter_number"},
+    {"No", "other_number"}, {"Pc", "connector_punctuation"},
+    {"Pd", "dash_punctuation"}, {"Ps", "open_punctuation"},
+    {"Pe", "close_punctuation"}, {"Pi", "initial_punctuation"},
+    {"Pf", "final_punctuation"}, {"Po", "other_punctuation"},
+    {"Sm", "math_symbol"}, {"Sc", "currency_symbol"},
+    {"Sk", "modifier_symbol"}, {"So", "other_symbol"},
+    {"Zs", "space_separator"}, {"Zl", "line_separator"},
+    {"Zp", "paragraph_separator"}, {"Cc", "control"}, {"Cf", "format"},
+    {"Cs", "surrogate"}, {"Co", "private_use"}, {"Cn", "unassigned"},
+};
+
+const std::vector<std::pair<std::string, std::string>> east_asian_widths = {
+    {"N", "neutral"}, {"A", "ambiguous"}, {"H", "halfwidth"},
+    {"W", "wide"}, {"F", "fullwidth"}, {"Na", "narrow"},
+};
+
+struct binary_property {
+    const char* file;
+    const char* property;
+    const char* flag;
+};
+
+// In bit order
+const std::vector<binary_property> binary_properties = {
+    {"PropList.txt", "White_Space", "white_space"},
+    {"DerivedCoreProperties.txt", "Alphabetic", "alphabetic"},
+    {"DerivedCoreProperties.txt", "Lowercase", "lowercase"},
+    {"DerivedCoreProperties.txt", "Uppercase", "uppercase"},
+    {"DerivedCoreProperties.txt", "Default_Ignorable_Code_Point", "default_ignorable"},
+    {"emoji-data.txt", "Emoji", "emoji"},
+    {"emoji-data.txt", "Emoji_Presentation", "emoji_presentation"},
+    {"emoji-data.txt", "Extended_Pictographic", "extended_pictographic"},
+};
+
+template <typename Pairs>
+std::uint32_t index_of(const Pairs& pairs, const std::string& key)
+{
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        if (pairs[i].first == key)
+            return static_cast<std::uint32_t>(i);
+    }
+    throw std::runtime_error("unknown property value " + key);
+}
+
+std::string to_lower(std::string s)
+{
+    for (char& c : s)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return s;
+}
+
+/// Returns the values of a property with a default, in the order they
+/// appear in the data file with the default first
+std::vector<std::string> value_names(const std::vector<ucd_range>& ranges,
+                                     const std::vector<std::string>& first)
+{
+    std::set<std::string> names;
+    for (const auto& r : ranges)
+        names.insert(r.value);
+    std::vector<std::string> result = first;
+    for (const auto& n : names) {
+        if (std::find(result.begin(), result.end(), n) == result.end())
+            result.push_back(n);
+    }
+    return result;
+}
+
+/// Replaces each value with its index in a list of distinct values, in
+/// which `first` comes first
+std::vector<std::uint32_t> deduplicate(const std::vector<std::uint32_t>& values,
+                                       std::uint32_t first,
+                                       std::vector<std::uint32_t>& distinct)
+{
+    std::set<std::uint32_t> set(values.begin(), values.end());
+    set.erase(first);
+    distinct.assign(1, first);
+    distinct.insert(distinct.end(), set.begin(), set.end());
+    std::map<std::uint32_t, std::uint32_t> number;
+    for (std::size_t i = 0; i < distinct.size(); i++)
+        number[distinct[i]] = static_cast<std::uint32_t>(i);
+    std::vector<std::uint32_t> result;
+    result.reserve(values.size());
+    for (auto v : values)
+        result.push_back(number[v]);
+    return result;
+}
+
+std::string generate_property_tables(const std::string& ucd)
+{
+    std::vector<std::uint32_t> records(max_code_point + 1, index_of(general_categories, "Cn"));
+    for_each_unicode_data(ucd, [&](std::uint32_t first, std::uint32_t last,
+                                   const std::vector<std::string>& fields) {
+        for (auto c = first; c <= last; c++)
+            records[c] = index_of(general_categories, fields[2]);
+    });
+
+    const auto script_ranges = parse_ranges(ucd, "Scripts.txt");
+    const auto scripts = value_names(script_ranges, {"Unknown", "Common", "Inherited"});
+    for (const auto& r : script_ranges) {
+        const auto value = static_cast<std::uint32_t>(
+            std::find(scripts.begin(), scripts.end(), r.value) - scripts.begin());
+        for (auto c = r.first; c <= r.last; c++)
+            records[c] |= value << 8;
+    }
+
+    for (const auto& r : parse_ranges(ucd, "EastAsianWidth.txt")) {
+        for (auto c = r.first; c <= r.last; c++)
+            records[c] |= index_of(east_asian_widths, r.value) << 16;
+    }
+
+    for (std::size_t bit = 0; bit < binary_properties.size(); bit++) {
+        for (const auto& r : parse_ranges(ucd, binary_properties[bit].file)) {
+            if (r.value != binary_properties[bit].property)
+                continue;
+            for (auto c = r.first; c <= r.last; c++)
+                records[c] |= 1u << (24 + bit);
+        }
+    }
+
+    std::ostringstream out;
+    write_header_start(out, "TCB_UNICODE_DETAIL_PROPERTY_TABLES_HPP_INCLUDED");
+
+    out << "\n/// The Unicode General_Category property\n"
+           "enum class general_category : std::uint8_t {\n";
+    for (const auto& gc : general_categories)
+        out << "    " << gc.second << ", ///< " << gc.first << '\n';
+    out << "};\n\n/// The Unicode Script property\nenum class script : std::uint8_t {\n";
+    for (const auto& s : scripts)
+        out << "    " << to_lower(s) << ",\n";
+    out << "};\n\n/// The Unicode East_Asian_Width property\n"
+           "enum class east_asian_width : std::uint8_t {\n";
+    for (const auto& ea : east_asian_widths)
+        out << "    " << ea.second << ", ///< " << ea.first << '\n';
+    out << "};\n\nnamespace detail {\n\n"
+           "// Bits of the binary properties in a property record\n"
+           "enum property_flag : std::uint32_t {\n";
+    for (std::size_t bit = 0; bit < binary_properties.size(); bit++) {
+        out << "    flag_" << binary_properties[bit].flag << " = 1u << " << 24 + bit
+            << ", // " << binary_properties[bit].property << '\n';
+    }
+    out << "};\n\n"
+           "// The properties of each code point are packed into a record, as\n"
+           "// general_category | script << 8 | east_asian_width << 16 | flags\n";
+
+    // Record zero holds the defaults, used for values above U+10FFFF
+    std::vector<std::uint32_t> distinct;
+    const auto numbers = deduplicate(records, index_of(general_categories, "Cn"), distinct);
+    write_staged_table(out, "property", numbers, "std::uint32_t", distinct);
+
+    write_header_end(out);
+    return out.str();
+}
+
+// Segmentation properties
+
+const std::vector<std::pair<std::string, std::string>> grapheme_cluster_breaks = {
+    {"Other", "other"}, {"CR", "cr"}, {"LF", "lf"}, {"Control", "control"},
+    {"Extend", "extend"}, {"ZWJ", "zwj"}, {"Regional_Indicator", "regional_indicator"},
+    {"Prepend", "prepend"}, {"SpacingMark", "spacing_mark"},
+    {"L", "l"}, {"V", "v"}, {"T", "t"}, {"LV", "lv"}, {"LVT", "lvt"},
+    {"Extended_Pictographic", "extended_pictographic"},
+};
+
+const std::vector<std::pair<std::string, std::string>> word_breaks = {
+    {"Other", "other"}, {"CR", "cr"}, {"LF", "lf"}, {"Newline", "newline"},
+    {"Extend", "extend"}, {"ZWJ", "zwj"}, {"Regional_Indicator", "regional_indicator"},
+    {"Format", "format"}, {"Katakana", "katakana"}, {"Hebrew_Letter", "hebrew_letter"},
+    {"ALetter", "aletter"}, {"Single_Quote", "single_quote"},
+    {"Double_Quote", "double_quote"}, {"MidNumLet", "midnumlet"},
+    {"MidLetter", "midletter"}, {"MidNum", "midnum"}, {"Numeric", "numeric"},
+    {"ExtendNumLet", "extendnumlet"}, {"WSegSpace", "wsegspace"},
+};
+
+// Roughly in the order of the rules of UAX #14, with the default first
+const std::vector<std::pair<std::string, std::string>> line_breaks = {
+    {"AL", "al"}, {"BK", "bk"}, {"CR", "cr"}, {"LF", "lf"}, {"NL", "nl"},
+    {"SP", "sp"}, {"ZW", "zw"}, {"CM", "cm"}, {"ZWJ", "zwj"}, {"WJ", "wj"},
+    {"GL", "gl"}, {"CL", "cl"}, {"CP", "cp"}, {"EX", "ex"}, {"IS", "is"},
+    {"SY", "sy"}, {"OP", "op"}, {"QU", "qu"}, {"NS", "ns"}, {"B2", "b2"},
+    {"BA", "ba"}, {"BB", "bb"}, {"HY", "hy"}, {"CB", "cb"}, {"IN", "in"},
+    {"HL", "hl"}, {"NU", "nu"}, {"PR", "pr"}, {"PO", "po"}, {"ID", "id"},
+    {"EB", "eb"}, {"EM", "em"}, {"JL", "jl"}, {"JV", "jv"}, {"JT", "jt"},
+    {"H2", "h2"}, {"H3", "h3"}, {"RI", "ri"},
+};
+
+/// Reads LineBreak.txt, resolving the classes which rule LB1 of UAX #14
+/// leaves to the implementation: AI, SG and XX become AL, CJ becomes NS,
+/// and SA becomes CM for marks (general category Mn or Mc) and AL otherwise
+std::vector<std::uint32_t> read_line_break(const std::string& ucd)
+{
+    std::vector<bool> is_mark(max_code_point + 1, false);
+    for_each_unicode_data(ucd, [&](std::uint32_t first, std::uint32_t last,
+                                   const std::vector<std::string>& fields) {
+        for (auto c = first; c <= last; c++)
+            is_mark[c] = fields[2] == "Mn" || fields[2] == "Mc";
+    });
+
+    std::vector<std::uint32_t> values(max_code_point + 1, index_of(line_breaks, "AL"));
+    for (const auto& r : parse_ranges(ucd, "LineBreak.txt")) {
+        for (auto c = r.first; c <= r.last; c++) {
+            std::string v = r.value;
+            if (v == "AI" || v == "SG" || v == "XX")
+                v = "AL";
+            else if (v == "CJ")
+                v = "NS";
+            else if (v == "SA")
+                v = is_mark[c] ? "CM" : "AL";
+            values[c] = index_of(line_breaks, v);
+        }
+    }
+    return values;
+}
+
+/// Reads a break property file into a value per code point. If `names`
+/// includes Extended_Pictographic, code points with that property and the
+/// default value get that value instead, for rules which treat it as one
+/// more property value.
+std::vector<std::uint32_t> read_break_property(
+    const std::string& ucd, const std::string& file,
+    const std::vector<std::pair<std::string, std::string>>& names)
+{
+    std::vector<std::uint32_t> values(max_code_point + 1, 0);
+    for (const auto& r : parse_ranges(ucd, file)) {
+        for (auto c = r.first; c <= r.last; c++)
+            values[c] = index_of(names, r.value);
+    }
+    const auto has_ext_pict = std::find_if(names.begin(), names.end(), [](const auto& n) {
+        return n.first == "Extended_Pictographic";
+    });
+    if (has_ext_pict == names.end())
+        return values;
+    const auto ext_pict = index_of(names, "Extended_Pictographic");
+    for (const auto& r : parse_ranges(ucd, "emoji-data.txt")) {
+        if (r.value != "Extended_Pictographic")
+            continue;
+        for (auto c = r.first; c <= r.last; c++) {
+            if (values[c] == 0)
+                values[c] = ext_pict;
+        }
+    }
+    return values;
+}
+
+void write_break_property(std::ostream& out, const std::string& name,
+                          const std::string& description,
+                          const std::vector<std::pair<std::string, std::string>>& names,
+                          const std::vector<std::uint32_t>& values)
+{
+    out << "\n/// " << description << "\nenum class " << name << " : std::uint8_t {\n";
+    for (const auto& n : names)
+        out << "    " << n.second << ", ///< " << n.first << '\n';
+    out << "};\n";
+
+    std::vector<std::uint32_t> results;
+    for (std::size_t i = 0; i < names.size(); i++)
+        results.push_back(static_cast<std::uint32_t>(i));
+    write_staged_table(out, name, values, "std::uint8_t", results);
+}
+
+std::string generate_break_tables(const std::string& ucd)
+{
+    std::ostringstream out;
+    write_header_start(out, "TCB_UNICODE_DETAIL_BREAK_TABLES_HPP_INCLUDED");
+    out << "\nnamespace detail {\n";
+
+    write_break_property(out, "grapheme_cluster_break",
+                         "The Grapheme_Cluster_Break property, with Extended_Pictographic",
+                         grapheme_cluster_breaks,
+                         read_break_property(ucd, "GraphemeBreakProperty.txt",
+                                             grapheme_cluster_breaks));
+    write_break_property(out, "word_break", "The Word_Break property", word_breaks,
+                         read_break_property(ucd, "WordBreakProperty.txt", word_breaks));
+    write_break_property(out, "line_break",
+                         "The Line_Break property, with the classes of rule LB1 resolved",
+                         line_breaks, read_line_break(ucd));
+
+    write_header_end(out);
+    return out.str();
+}
+
+// Display width
+
+/// Returns the number of terminal columns taken by each code point: zero for
+/// marks, format and control characters, default ignorable code points and
+/// conjoining Hangul vowels and final consonants; two for East Asian Wide
+/// and Fullwidth characters, and for regional indicators, which are
+/// displayed in pairs as flags; and one for everything else
+std::vector<std::uint32_t> read_display_width(const std::string& ucd)
+{
+    std::vector<std::uint32_t> values(max_code_point + 1, 1);
+    for (const auto& r : parse_ranges(ucd, "EastAsianWidth.txt")) {
+        if (r.value != "W" && r.value != "F")
+            continue;
+        for (auto c = r.first; c <= r.last; c++)
+            values[c] = 2;
+    }
+    for (const auto& r : parse_ranges(ucd, "GraphemeBreakProperty.txt")) {
+        std::uint32_t width;
+        if (r.value == "Regional_Indicator")
+            width = 2;
+        else if (r.value == "V" || r.value == "T")
+            width = 0;
+        else
+            continue;
+        for (auto c = r.first; c <= r.last; c++)
+            values[c] = width;
+    }
+    for (const auto& r : parse_ranges(ucd, "DerivedCoreProperties.txt")) {
+        if (r.value != "Default_Ignorable_Code_Point")
+            continue;
+        for (auto c = r.first; c <= r.last; c++)
+            values[c] = 0;
+    }
+    for_each_unicode_data(ucd, [&](std::uint32_t first, std::uint32_t last,
+                                   const std::vector<std::string>& fields) {
+        const auto& gc = fields[2];
+        if (gc != "Mn" && gc != "Me" && gc != "Cf" && gc != "Cc" && gc != "Zl" && gc != "Zp")
+            return;
+        for (auto c = first; c <= last; c++)
+            values[c] = 0;
+    });
+    return values;
+}
+
+std::string generate_width_tables(const std::string& ucd)
+{
+    std::ostringstream out;
+    write_header_start(out, "TCB_UNICODE_DETAIL_WIDTH_TABLES_HPP_INCLUDED");
+    out << "\nnamespace detail {\n\n"
+           "// The display width of each code point, in terminal columns\n";
+    write_staged_table(out, "display_width", read_display_width(ucd), "std::uint8_t", {0, 1, 2});
+    write_header_end(out);
+    return out.str();
+}
+
+// Normalization
+
+constexpr std::uint32_t hangul_s_base = 0xAC00;
+constexpr std::uint32_t hangul_s_count = 11172;
+
+/// Appends the full decomposition of c to out, applying compatibility
+/// mappings as well as canonical ones if `compat` is true
+void decompose(std::uint32_t c, bool compat, const std::vector<std::vector<std::uint32_t>>& mappings,
+               const std::vector<bool>& is_compat, std::vector<std::uint32_t>& out)
+{
+    if (c >= hangul_s_base && c < hangul_s_base + hangul_s_count) {
+        const auto s = c - hangul_s_base;
+        out.push_back(0x1100 + s / (21 * 28));
+        out.push_back(0x1161 + s % (21 * 28) / 28);
+        if (s % 28 != 0)
+            out.push_back(0x11A7 + s % 28);
+        return;
+    }
+    if (mappings[c].empty() || (is_compat[c] && !compat)) {
+        out.push_back(c);
+        return;
+    }
+    for (auto m : mappings[c])
+        decompose(m, compat, mappings, is_compat, out);
+}
+
+std::string generate_normalization_tables(const std::string& ucd)
+{
+    std::vector<std::uint32_t> props(max_code_point + 1, 0);
+    std::vector<std::vector<std::uint32_t>> mappings(max_code_point + 1);
+    std::vector<bool> is_compat(max_code_point + 1, false);
+    for_each_unicode_data(ucd, [&](std::uint32_t first, std::uint32_t last,
+                                   const std::vector<std::string>& fields) {
+        for (auto c = first; c <= last; c++)
+            props[c] = static_cast<std::uint32_t>(std::stoul(fields[3]));
+        std::istringstream ss(fields[5]);
+        std::string field;
+        while (ss >> field) {
+            if (field[0] == '<')
+                is_compat[first] = true;
+            else
+                mappings[first].push_back(static_cast<std::uint32_t>(std::stoul(field, nullptr, 16)));
+        }
+    });
+
+    // The quick check properties are stored as flags above the combining
+    // class, in the order of the normalization_flag enumeration
+    const std::vector<std::pair<std::string, std::string>> quick_checks = {
+        {"NFD_QC", "N"}, {"NFC_QC", "N"}, {"NFC_QC", "M"},
+        {"NFKD_QC", "N"}, {"NFKC_QC", "N"}, {"NFKC_QC", "M"},
+    };
+    std::vector<bool> excluded(max_code_point + 1, false);
+    for (const auto& r : parse_ranges(ucd, "DerivedNormalizationProps.txt")) {
+        for (auto c = r.first; c <= r.last; c++) {
+            if (r.value == "Full_Composition_Exclusion")
+                excluded[c] = true;
+            for (std::size_t i = 0; i < quick_checks.size(); i++) {
+                if (quick_checks[i].first == r.value && quick_checks[i].second == r.value2)
+                    props[c] |= 1u << (8 + i);
+            }
+        }
+    }
+
+    // Full decompositions are stored in a pool, with the high bit set on the
+    // last code point of each; offset zero means no decomposition
+    std::vector<std::uint32_t> pool(1, 0);
+    std::map<std::vector<std::uint32_t>, std::uint32_t> offsets;
+    const auto add_to_pool = [&](const std::vector<std::uint32_t>& d) {
+        const auto it = offsets.emplace(d, static_cast<std::uint32_t>(pool.size()));
+        if (it.second) {
+            pool.insert(pool.end(), d.begin(), d.end());
+            pool.back() |= 0x80000000;
+        }
+        return it.first->second;
+    };
+    std::vector<std::uint32_t> decompositions(max_code_point + 1, 0);
+    std::vector<std::uint64_t> compositions;
+    for (std::uint32_t c = 0; c <= max_code_point; c++) {
+        if (mappings[c].empty())
+            continue;
+        std::vector<std::uint32_t> d;
+        decompose(c, is_compat[c], mappings, is_compat, d);
+        decompositions[c] = add_to_pool(d);
+        if (!is_compat[c] && mappings[c].size() == 2 && !excluded[c]) {
+            compositions.push_back(std::uint64_t{mappings[c][0]} << 42 |
+                                   std::uint64_t{mappings[c][1]} << 21 | c);
+        }
+    }
+    std::sort(compositions.begin(), compositions.end());
+
+    std::ostringstream out;
+    write_header_start(out, "TCB_UNICODE_DETAIL_NORMALIZATION_TABLES_HPP_INCLUDED");
+    out << "\nnamespace detail {\n\n"
+           "// Bits of the quick check properties in a normalization record\n"
+           "enum normalization_flag : std::uint16_t {\n";
+    for (std::size_t i = 0; i < quick_checks.size(); i++) {
+        out << "    flag_" << to_lower(quick_checks[i].first) << '_'
+            << (quick_checks[i].second == "N" ? "no" : "maybe") << " = 1u << " << 8 + i
+            << ",\n";
+    }
+    out << "};\n\n"
+           "// The normalization properties of each code point are packed into a\n"
+           "// record, as canonical_combining_class | flags\n";
+    std::vector<std::uint32_t> distinct;
+    const auto numbers = deduplicate(props, 0, distinct);
+    write_staged_table(out, "normalization", numbers, "std::uint16_t", distinct);
+
+    out << "\n// The offset in decomposition_tables<>::pool of the full decomposition of\n"
+           "// each code point other than a Hangul syllable, or zero. This is the\n"
+           "// full canonical decomposition of a code point with a canonical mapping;\n"
+           "// its full compatibility decomposition is that of each code point in it.\n";
+    write_staged_table(out, "decomposition_offset", decompositions, "std::uint16_t", {});
+
+    out << "\n// Full decompositions, as sequences of code points in which the last has\n"
+           "// bit 31 set, and the primary composites (other than Hangul syllables)\n"
+           "// as first << 42 | second << 21 | composite, in order\n"
+           "template <typename = void>\n"
+           "struct decomposition_tables {";
+    write_array(out, "std::uint32_t", "pool", pool, true, 6);
+    out << "};\n";
+    write_member_definition(out, "std::uint32_t", "decomposition", "pool[]");
+
+    out << "\ntemplate <typename = void>\nstruct composition_tables {\n"
+        << "    static constexpr std::uint64_t pairs[" << compositions.size() << "] = {\n";
+    char buf[32];
+    for (std::size_t i = 0; i < compositions.size(); i++) {
+        if (i % 4 == 0)
+            out << "        ";
+        std::snprintf(buf, sizeof(buf), "0x%016llX",
+                      static_cast<unsigned long long>(compositions[i]));
+        out << buf << ',' << ((i + 1) % 4 == 0 || i + 1 == compositions.size() ? "\n" : " ");
+    }
+    out << "    };\n};\n";
+    write_member_definition(out, "std::uint64_t", "composition", "pairs[]");
+
+    std::cerr << "decomposition pool: " << pool.size() * 4 << " bytes, compositions: "
+              << compositions.size() * 8 << " bytes\n";
+
+    write_header_end(out);
+    return out.str();
+}
+
+// Case mapping
+
+std::vector<std::uint32_t> parse_code_points(const std::string& field)
+{
+    std::vector<std::uint32_t> result;
+    std::istringstream ss(field);
+    std::string cp;
+    while (ss >> cp)
+        result.push_back(static_cast<std::uint32_t>(std::stoul(cp, nullptr, 16)));
+    return result;
+}
+
+std::string generate_case_tables(const std::string& ucd)
+{
+    enum { lower, upper, fold };
+    std::vector<std::array<std::uint32_t, 3>> simple(max_code_point + 1);
+    std::vector<std::array<std::vector<std::uint32_t>, 3>> full(max_code_point + 1);
+    for (std::uint32_t c = 0; c <= max_code_point; c++)
+        simple[c] = {{c, c, c}};
+
+    for_each_unicode_data(ucd, [&](std::uint32_t first, std::uint32_t,
+                                   const std::vector<std::string>& fields) {
+        if (!fields[12].empty())
+            simple[first][upper] = parse_code_points(fields[12])[0];
+        if (!fields[13].empty())
+            simple[first][lower] = parse_code_points(fields[13])[0];
+    });
+
+    // Only the unconditional mappings are used: those which depend on the
+    // language or on the context have a fifth field
+    {
+        std::ifstream in = open_ucd_file(ucd, "SpecialCasing.txt");
+        std::string line;
+        while (std::getline(in, line)) {
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty())
+                continue;
+            const auto fields = split_fields(line);
+            if (fields.size() > 4 && !fields[4].empty())
+                continue;
+            const auto c = static_cast<std::uint32_t>(std::stoul(fields[0], nullptr, 16));
+            full[c][lower] = parse_code_points(fields[1]);
+            full[c][upper] = parse_code_points(fields[3]);
+        }
+    }
+
+    // The Turkic (T) foldings are not used
+    for (const auto& r : parse_ranges(ucd, "CaseFolding.txt")) {
+        if (r.value == "C" || r.value == "S")
+            simple[r.first][fold] = parse_code_points(r.value2)[0];
+        if (r.value == "F")
+            full[r.first][fold] = parse_code_points(r.value2);
+    }
+
+    // Each mapping is stored as the difference between the code point and
+    // its simple mapping, modulo 2^22, with the offset in special[] of its
+    // full mapping (if it is not the simple mapping) in the top ten bits
+    std::vector<std::uint32_t> special(1, 0);
+    std::map<std::vector<std::uint32_t>, std::uint32_t> offsets;
+    std::size_t max_length = 1;
+    const auto encode = [&](std::uint32_t c, std::uint32_t mapped,
+                            const std::vector<std::uint32_t>& expansion) {
+        std::uint32_t offset = 0;
+        if (!expansion.empty() && expansion != std::vector<std::uint32_t>{mapped}) {
+            const auto it = offsets.emplace(expansion, static_cast<std::uint32_t>(special.size()));
+            if (it.second) {
+                special.insert(special.end(), expansion.begin(), expansion.end());
+                special.back() |= 0x80000000;
+            }
+            offset = it.first->second;
+            max_length = std::max(max_length, expansion.size());
+        }
+        if (offset >= 1u << 10)
+            throw std::runtime_error("too many full case mappings");
+        return (offset << 22) | ((mapped - c) & 0x3FFFFF);
+    };
+
+    std::map<std::array<std::uint32_t, 3>, std::uint32_t> records;
+    records.emplace(std::array<std::uint32_t, 3>{{0, 0, 0}}, 0);
+    std::vector<std::uint32_t> record_numbers(max_code_point + 1, 0);
+    std::vector<std::uint32_t> record_values[3];
+    for (auto& v : record_values)
+        v.push_back(0);
+    for (std::uint32_t c = 0; c <= max_code_point; c++) {
+        std::array<std::uint32_t, 3> r;
+        for (int op = lower; op <= fold; op++)
+            r[op] = encode(c, simple[c][op], full[c][op]);
+        const auto it = records.emplace(r, static_cast<std::uint32_t>(records.size()));
+        if (it.second) {
+            for (int op = lower; op <= fold; op++)
+                record_values[op].push_back(r[op]);
+        }
+        record_numbers[c] = it.first->second;
+    }
+
+    std::ostringstream out;
+    write_header_start(out, "TCB_UNICODE_DETAIL_CASE_TABLES_HPP_INCLUDED");
+    out << "\nnamespace detail {\n\n"
+           "// The number of the case mapping record of each code point\n";
+    write_staged_table(out, "case_record", record_numbers, "std::uint16_t", {});
+
+    out << "\n// The lowercase, uppercase and case folding mappings of each record, as\n"
+           "// (c + simple mapping - c) % 2^22 | offset of full mapping << 22, and\n"
+           "// the full mappings which are not the simple mapping, as sequences of\n"
+           "// code points in which the last has bit 31 set\n"
+           "template <typename = void>\n"
+           "struct case_mapping_tables {\n"
+           "    static constexpr int max_length = " << max_length << ";\n";
+    write_array(out, "std::uint32_t", "lower", record_values[lower], true, 6);
+    write_array(out, "std::uint32_t", "upper", record_values[upper], true, 6);
+    write_array(out, "std::uint32_t", "fold", record_values[fold], true, 6);
+    write_array(out, "std::uint32_t", "special", special, true, 6);
+    out << "};\n";
+    write_member_definition(out, "int", "case_mapping", "max_length");
+    for (const char* member : {"lower[]", "upper[]", "fold[]", "special[]"})
+        write_member_definition(out, "std::uint32_t", "case_mapping", member);
+
+    std::cerr << "case mapping records: " << records.size() * 12 << " bytes, special: "
+              << special.size() * 4 << " bytes\n";
+
+    write_header_end(out);
+    return out.str();
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <ucd directory> <output directory>\n";
+        return 2;
+    }
+
+    const std::string ucd = argv[1];
+    const std::string out_dir = argv[2];
+
+    try {
+        update_file(out_dir + "/property_tables.hpp", generate_property_tables(ucd));
+        update_file(out_dir + "/break_tables.hpp", generate_break_tables(ucd));
+        update_file(out_dir + "/width_tables.hpp", generate_width_tables(ucd));
+        update_file(out_dir + "/normalization_tables.hpp", generate_normalization_tables(ucd));
+        update_file(out_dir + "/case_tables.hpp", generate_case_tables(ucd));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << '\n';
+        return 1;
+    }
+}
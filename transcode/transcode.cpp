@@ -0,0 +1,331 @@
+// Copyright (c) 2016 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tcb/unicode.hpp>
+#include <tcb/unicode/detect.hpp>
+#include <tcb/unicode/file.hpp>
+
+#include <sys/stat.h>
+
+using tcb::unicode::encoding;
+
+namespace {
+
+const char usage[] =
+R"(Usage: tcb-transcode [OPTIONS] [INPUT [OUTPUT]]
+
+Converts INPUT (default: standard input) between Unicode encodings, writing
+to OUTPUT (default: standard output).
+
+Options:
+  -f, --from ENC     Input encoding (default: utf-8)
+  -t, --to ENC       Output encoding (default: utf-8)
+      --bom          Write a byte order mark at the start of the output
+  -m, --mode MODE    stream (default), mmap or parallel
+  -j, --threads N    Number of threads for parallel mode
+                     (default: number of hardware threads)
+      --stats        Report sizes and throughput on standard error
+  -h, --help         Show this message
+
+Encodings: utf-8, latin-1, utf-16le, utf-16be, utf-32le, utf-32be. As an
+input encoding, utf-16 or utf-32 selects the byte order from the byte order
+mark, which is removed, or big endian if there is none, and auto guesses the
+encoding from the start of the input. Otherwise a byte order mark is treated
+as an ordinary character.
+
+The mmap and parallel modes require INPUT and OUTPUT to be regular files.
+)";
+
+enum class mode { stream, mmap, parallel };
+
+struct options {
+    std::string from = "utf-8";
+    std::string to = "utf-8";
+    bool bom = false;
+    mode m = mode::stream;
+    unsigned threads = std::thread::hardware_concurrency();
+    bool stats = false;
+    std::string input;
+    std::string output;
+};
+
+[[noreturn]] void fail(const std::string& msg)
+{
+    std::cerr << "tcb-transcode: " << msg << "\n";
+    std::exit(1);
+}
+
+bool parse_encoding(std::string name, encoding& e)
+{
+    for (char& c : name) {
+        if (c == '_')
+            c = '-';
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (name == "utf-8" || name == "utf8")
+        e = encoding::utf8;
+    else if (name == "latin-1" || name == "latin1" || name == "iso-8859-1")
+        e = encoding::latin1;
+    else if (name == "utf-16le" || name == "utf16le")
+        e = encoding::utf16le;
+    else if (name == "utf-16be" || name == "utf16be")
+        e = encoding::utf16be;
+    else if (name == "utf-32le" || name == "utf32le")
+        e = encoding::utf32le;
+    else if (name == "utf-32be" || name == "utf32be")
+        e = encoding::utf32be;
+    else
+        return false;
+    return true;
+}
+
+bool is_generic(const std::string& name, const char* base)
+{
+    std::string n;
+    for (char c : name) {
+        if (c != '-' && c != '_')
+            n += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return n == base;
+}
+
+options parse_args(int argc, char** argv)
+{
+    options opts;
+    int positional = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (++i == argc)
+                fail("missing value for " + arg);
+            return argv[i];
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            std::cout << usage;
+            std::exit(0);
+        }
+        else if (arg == "-f" || arg == "--from")
+            opts.from = value();
+        else if (arg == "-t" || arg == "--to")
+            opts.to = value();
+        else if (arg == "--bom")
+            opts.bom = true;
+        else if (arg == "--stats")
+            opts.stats = true;
+        else if (arg == "-m" || arg == "--mode") {
+            const std::string m = value();
+            if (m == "stream")
+                opts.m = mode::stream;
+            else if (m == "mmap")
+                opts.m = mode::mmap;
+            else if (m == "parallel")
+                opts.m = mode::parallel;
+            else
+                fail("unknown mode '" + m + "'");
+        }
+        else if (arg == "-j" || arg == "--threads" || arg.compare(0, 2, "-j") == 0) {
+            const int n = std::atoi(arg.size() > 2 && arg[1] == 'j' ? arg.c_str() + 2
+                                                                    : value().c_str());
+            if (n <= 0)
+                fail("invalid thread count");
+            opts.threads = static_cast<unsigned>(n);
+        }
+        else if (arg.size() > 1 && arg[0] == '-')
+            fail("unknown option '" + arg + "'");
+        else if (positional == 0) {
+            opts.input = arg;
+            positional++;
+        }
+        else if (positional == 1) {
+            opts.output = arg;
+            positional++;
+        }
+        else
+            fail("too many arguments");
+    }
+
+    if (opts.threads == 0)
+        opts.threads = 1;
+
+    return opts;
+}
+
+// Handles utf-16, utf-32 and auto input encodings, given the first bytes of
+// input. Returns the number of bytes of byte order mark to skip.
+std::size_t resolve_input_encoding(const std::string& name, const unsigned char* data,
+                                   std::size_t size, encoding& e)
+{
+    if (name == "auto") {
+        const auto detected = tcb::unicode::detect_encoding(data, size);
+        e = detected;
+        return detected.bom_size;
+    }
+    if (is_generic(name, "utf16")) {
+        if (size >= 2 && data[0] == 0xFF && data[1] == 0xFE) {
+            e = encoding::utf16le;
+            return 2;
+        }
+        e = encoding::utf16be;
+        return (size >= 2 && data[0] == 0xFE && data[1] == 0xFF) ? 2 : 0;
+    }
+    if (is_generic(name, "utf32")) {
+        if (size >= 4 && data[0] == 0xFF && data[1] == 0xFE && data[2] == 0 && data[3] == 0) {
+            e = encoding::utf32le;
+            return 4;
+        }
+        e = encoding::utf32be;
+        return (size >= 4 && data[0] == 0 && data[1] == 0 && data[2] == 0xFE && data[3] == 0xFF) ? 4 : 0;
+    }
+    if (!parse_encoding(name, e))
+        fail("unknown encoding '" + name + "'");
+    return 0;
+}
+
+struct stats {
+    std::size_t in_bytes = 0;
+    std::size_t out_bytes = 0;
+};
+
+stats run_stream(const options& opts, encoding to)
+{
+    std::FILE* in = stdin;
+    std::FILE* out = stdout;
+    if (!opts.input.empty() && opts.input != "-") {
+        in = std::fopen(opts.input.c_str(), "rb");
+        if (!in)
+            fail(opts.input + ": " + std::strerror(errno));
+    }
+    if (!opts.output.empty() && opts.output != "-") {
+        out = std::fopen(opts.output.c_str(), "wb");
+        if (!out)
+            fail(opts.output + ": " + std::strerror(errno));
+    }
+
+    constexpr std::size_t block_size = 1 << 20;
+    std::unique_ptr<unsigned char[]> buf(new unsigned char[block_size]);
+    std::string converted;
+    stats s;
+
+    // The first block is used to identify the input encoding if necessary
+    std::size_t n = std::fread(buf.get(), 1, block_size, in);
+    encoding from{};
+    const std::size_t skip = resolve_input_encoding(opts.from, buf.get(), n, from);
+    tcb::unicode::utf_transcoder transcoder{from, to};
+
+    if (opts.bom) {
+        // U+FEFF, converted from UTF-8 to the output encoding
+        tcb::unicode::utf_transcoder{encoding::utf8, to}.convert("\xEF\xBB\xBF", 3, converted);
+    }
+    transcoder.convert(buf.get() + skip, n - skip, converted);
+    s.in_bytes += n;
+
+    while ((n = std::fread(buf.get(), 1, block_size, in)) > 0) {
+        s.in_bytes += n;
+        transcoder.convert(buf.get(), n, converted);
+        if (std::fwrite(converted.data(), 1, converted.size(), out) != converted.size())
+            fail(std::string("write error: ") + std::strerror(errno));
+        s.out_bytes += converted.size();
+        converted.clear();
+    }
+    if (std::ferror(in))
+        fail(std::string("read error: ") + std::strerror(errno));
+
+    transcoder.finish(converted);
+    if (std::fwrite(converted.data(), 1, converted.size(), out) != converted.size())
+        fail(std::string("write error: ") + std::strerror(errno));
+    s.out_bytes += converted.size();
+
+    if (in != stdin)
+        std::fclose(in);
+    if (out != stdout && std::fclose(out) != 0)
+        fail(opts.output + ": " + std::strerror(errno));
+    else
+        std::fflush(out);
+
+    return s;
+}
+
+std::size_t file_size(const std::string& path)
+{
+    struct ::stat st{};
+    if (::stat(path.c_str(), &st) < 0)
+        fail(path + ": " + std::strerror(errno));
+    return static_cast<std::size_t>(st.st_size);
+}
+
+stats run_mapped(const options& opts, encoding to)
+{
+    if (opts.input.empty() || opts.output.empty() ||
+        opts.input == "-" || opts.output == "-") {
+        fail("mmap and parallel modes need input and output files");
+    }
+    std::vector<unsigned char> head(65536);
+    std::FILE* f = std::fopen(opts.input.c_str(), "rb");
+    if (!f)
+        fail(opts.input + ": " + std::strerror(errno));
+    const std::size_t n = std::fread(head.data(), 1, head.size(), f);
+    std::fclose(f);
+
+    // As in stream mode, a byte order mark which selected the encoding is
+    // removed
+    encoding from{};
+    const std::size_t skip = resolve_input_encoding(opts.from, head.data(), n, from);
+
+    std::string prefix;
+    if (opts.bom) {
+        // U+FEFF, converted from UTF-8 to the output encoding
+        tcb::unicode::utf_transcoder{encoding::utf8, to}.convert("\xEF\xBB\xBF", 3, prefix);
+    }
+
+    const unsigned threads = opts.m == mode::parallel ? opts.threads : 1;
+    try {
+        tcb::unicode::transcode_file(opts.input, opts.output, from, to, threads, skip, prefix);
+    }
+    catch (const std::system_error& e) {
+        fail(e.what());
+    }
+
+    stats s;
+    s.in_bytes = file_size(opts.input);
+    s.out_bytes = file_size(opts.output);
+    return s;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const options opts = parse_args(argc, argv);
+
+    encoding to{};
+    if (!parse_encoding(opts.to, to))
+        fail("unknown output encoding '" + opts.to + "'");
+
+    const auto start = std::chrono::steady_clock::now();
+    const stats s = opts.m == mode::stream ? run_stream(opts, to)
+                                           : run_mapped(opts, to);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    if (opts.stats) {
+        const double secs = elapsed.count();
+        std::fprintf(stderr, "%zu bytes in, %zu bytes out, %.3f s, %.1f MB/s\n",
+                     s.in_bytes, s.out_bytes, secs,
+                     secs > 0 ? s.in_bytes / secs / 1e6 : 0.0);
+    }
+}